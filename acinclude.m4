@@ -7,6 +7,93 @@ AC_DEFUN([AX_LIBFDATETIME_CHECK_LOCAL],
   [dnl No additional checks.
   ])
 
+dnl Function to detect if the C++ interface can be tested
+AC_DEFUN([AX_LIBFDATETIME_CHECK_CXX],
+  [AC_REQUIRE([AC_PROG_CXX])
+
+  AC_MSG_CHECKING(
+    [whether $CXX supports C++14])
+
+  AC_LANG_PUSH(C++)
+
+  AC_COMPILE_IFELSE(
+    [AC_LANG_PROGRAM(
+      [[#if !defined( __cplusplus ) || ( __cplusplus < 201402L )
+#error C++14 is not supported
+#endif
+constexpr int test_function( int value ) { int result = value; result *= 2; return( result ); }]],
+      [[static_assert( test_function( 2 ) == 4, "" );]] )],
+    [ac_cv_libfdatetime_cxx=yes],
+    [ac_cv_libfdatetime_cxx=no])
+
+  AC_LANG_POP(C++)
+
+  AC_MSG_RESULT(
+    [$ac_cv_libfdatetime_cxx])
+
+  AM_CONDITIONAL(
+    [HAVE_CXX_TESTS],
+    [test "x$ac_cv_libfdatetime_cxx" = xyes])
+
+  AS_IF(
+    [test "x$ac_cv_libfdatetime_cxx" != xyes],
+    [AC_SUBST(
+      [TESTS_SKIP_CXX],
+      [yes])
+    ])
+  ])
+
+dnl Function to detect if benchmark dependencies are available
+AC_DEFUN([AX_LIBFDATETIME_CHECK_BENCH],
+  [AC_CHECK_HEADERS([sys/mman.h unistd.h])
+  AC_CHECK_FUNCS([clock_gettime mmap sysconf])
+  ])
+
+dnl Function to check if instrumentation counters should be enabled
+AC_DEFUN([AX_LIBFDATETIME_CHECK_ENABLE_STATS],
+  [AX_COMMON_ARG_ENABLE(
+    [stats],
+    [stats],
+    [enable instrumentation counters of the conversion functions],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_stats" != xno ],
+    [AC_DEFINE(
+      [HAVE_LIBFDATETIME_STATS],
+      [1],
+      [Define to 1 if instrumentation counters should be used.])
+
+    ac_cv_enable_stats=yes])
+  ])
+
+dnl Function to check if static (USDT) probes should be enabled
+AC_DEFUN([AX_LIBFDATETIME_CHECK_ENABLE_SDT_PROBES],
+  [AX_COMMON_ARG_ENABLE(
+    [sdt-probes],
+    [sdt_probes],
+    [enable static (USDT) probes for SystemTap and bpftrace, requires sys/sdt.h],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_sdt_probes" != xno ],
+    [AC_CHECK_HEADERS([sys/sdt.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_sys_sdt_h" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing header: sys/sdt.h header is needed for static probes],
+        [1])
+      ])
+
+    AC_DEFINE(
+      [HAVE_LIBFDATETIME_SDT_PROBES],
+      [1],
+      [Define to 1 if static (USDT) probes should be used.])
+
+    ac_cv_enable_sdt_probes=yes])
+  ])
+
 dnl Function to check if DLL support is needed
 AC_DEFUN([AX_LIBFDATETIME_CHECK_DLL_SUPPORT],
   [AS_IF(
@@ -0,0 +1,1837 @@
+/*
+ * Benchmark suite of the conversion and string format functions of all timestamp types
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_bench_libcerror.h"
+#include "fdatetime_bench_libfdatetime.h"
+#include "fdatetime_bench_timer.h"
+
+#include "../libfdatetime/libfdatetime_calendar.h"
+#include "../libfdatetime/libfdatetime_date_time_values.h"
+#include "../libfdatetime/libfdatetime_fat_date_time.h"
+#include "../libfdatetime/libfdatetime_filetime.h"
+#include "../libfdatetime/libfdatetime_floatingtime.h"
+#include "../libfdatetime/libfdatetime_hfs_time.h"
+#include "../libfdatetime/libfdatetime_nsf_timedate.h"
+#include "../libfdatetime/libfdatetime_posix_time.h"
+#include "../libfdatetime/libfdatetime_systemtime.h"
+
+/* The number of values per timestamp type and distribution
+ */
+#define FDATETIME_BENCH_NUMBER_OF_VALUES		4096
+
+/* The default number of rounds
+ */
+#define FDATETIME_BENCH_NUMBER_OF_ROUNDS		4
+
+/* The default number of trials, the median of the trials is reported
+ */
+#define FDATETIME_BENCH_NUMBER_OF_TRIALS		5
+
+/* The maximum number of trials
+ */
+#define FDATETIME_BENCH_MAXIMUM_NUMBER_OF_TRIALS	101
+
+/* The default regression threshold in percent
+ */
+#define FDATETIME_BENCH_REGRESSION_THRESHOLD		10.0
+
+/* The number of median absolute deviations a difference must exceed to not be considered noise
+ */
+#define FDATETIME_BENCH_NOISE_FACTOR			3.0
+
+/* The maximum size of a result key and of a line of a baseline file
+ */
+#define FDATETIME_BENCH_MAXIMUM_KEY_SIZE		128
+#define FDATETIME_BENCH_MAXIMUM_LINE_SIZE		1024
+
+/* The maximum size of an encoded value
+ */
+#define FDATETIME_BENCH_MAXIMUM_VALUE_SIZE		16
+
+/* The size of the UTF-8 string of an individual value
+ */
+#define FDATETIME_BENCH_UTF8_STRING_SIZE		64
+
+/* The number of nano seconds since January 1, 1970 of the first and last value
+ * of the random and sorted distributions, January 1, 1980 and December 31, 2037
+ * which is within the supported date range of every timestamp type
+ */
+#define FDATETIME_BENCH_FIRST_NANO_SECONDS		315532800000000000LL
+#define FDATETIME_BENCH_LAST_NANO_SECONDS		2145916799999999999LL
+
+#define FDATETIME_BENCH_NUMBER_OF_TYPES			7
+#define FDATETIME_BENCH_NUMBER_OF_DISTRIBUTIONS		4
+#define FDATETIME_BENCH_NUMBER_OF_STRING_FORMATS	36
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+enum FDATETIME_BENCH_DISTRIBUTIONS
+{
+	FDATETIME_BENCH_DISTRIBUTION_FIXED,
+	FDATETIME_BENCH_DISTRIBUTION_RANDOM,
+	FDATETIME_BENCH_DISTRIBUTION_SORTED,
+	FDATETIME_BENCH_DISTRIBUTION_OUT_OF_RANGE
+};
+
+enum FDATETIME_BENCH_OPERATIONS
+{
+	FDATETIME_BENCH_OPERATION_COPY_FROM_BYTE_STREAM,
+	FDATETIME_BENCH_OPERATION_COPY_TO_DATE_TIME_VALUES,
+	FDATETIME_BENCH_OPERATION_COPY_TO_UTF8_STRING
+};
+
+typedef union fdatetime_bench_timestamp fdatetime_bench_timestamp_t;
+
+/* Contains a decoded timestamp of any type
+ */
+union fdatetime_bench_timestamp
+{
+	libfdatetime_internal_fat_date_time_t fat_date_time;
+	libfdatetime_internal_filetime_t filetime;
+	libfdatetime_internal_floatingtime_t floatingtime;
+	libfdatetime_internal_hfs_time_t hfs_time;
+	libfdatetime_internal_nsf_timedate_t nsf_timedate;
+	libfdatetime_internal_posix_time_t posix_time;
+	libfdatetime_internal_systemtime_t systemtime;
+};
+
+typedef struct fdatetime_bench_result fdatetime_bench_result_t;
+
+struct fdatetime_bench_result
+{
+	/* The name of the timestamp type
+	 */
+	const char *timestamp_type;
+
+	/* The distribution
+	 */
+	const char *distribution;
+
+	/* The operation
+	 */
+	const char *operation;
+
+	/* The string format, NULL if not applicable
+	 */
+	const char *string_format;
+
+	/* The median of the number of nano seconds per operation of the trials
+	 */
+	double median;
+
+	/* The median absolute deviation of the number of nano seconds per operation of the trials
+	 */
+	double median_absolute_deviation;
+
+	/* The minimum of the number of nano seconds per operation of the trials
+	 */
+	double minimum;
+
+	/* The number of values that failed
+	 */
+	size_t number_of_failures;
+};
+
+typedef struct fdatetime_bench_baseline_result fdatetime_bench_baseline_result_t;
+
+struct fdatetime_bench_baseline_result
+{
+	/* The key, which consists of the timestamp type, distribution, operation and string format
+	 */
+	char key[ FDATETIME_BENCH_MAXIMUM_KEY_SIZE ];
+
+	/* The median of the number of nano seconds per operation
+	 */
+	double median;
+
+	/* The median absolute deviation of the number of nano seconds per operation
+	 */
+	double median_absolute_deviation;
+};
+
+typedef struct fdatetime_bench_type fdatetime_bench_type_t;
+
+struct fdatetime_bench_type
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The timestamp type
+	 */
+	int timestamp_type;
+
+	/* The size of an encoded value
+	 */
+	size_t value_size;
+};
+
+typedef struct fdatetime_bench_string_format fdatetime_bench_string_format_t;
+
+struct fdatetime_bench_string_format
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The string format flags
+	 */
+	uint32_t string_format_flags;
+};
+
+/* POSIX time values are benchmarked as signed 64-bit nano seconds
+ * so that the fraction of second string formats are fully exercised
+ */
+fdatetime_bench_type_t fdatetime_bench_types[ FDATETIME_BENCH_NUMBER_OF_TYPES ] = {
+	{ "fat_date_time", LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME, 4 },
+	{ "filetime", LIBFDATETIME_TIMESTAMP_TYPE_FILETIME, 8 },
+	{ "floatingtime", LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME, 8 },
+	{ "hfs_time", LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME, 4 },
+	{ "nsf_timedate", LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE, 8 },
+	{ "posix_time", LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME, 8 },
+	{ "systemtime", LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME, 16 } };
+
+/* The out of range distribution consists of random bit patterns, which span
+ * the full value range of the type and contain invalid encodings
+ */
+const char *fdatetime_bench_distributions[ FDATETIME_BENCH_NUMBER_OF_DISTRIBUTIONS ] = {
+	"fixed",
+	"random",
+	"sorted",
+	"out_of_range" };
+
+/* Every combination of format type, date and time flags and timezone indicator
+ */
+fdatetime_bench_string_format_t fdatetime_bench_string_formats[ FDATETIME_BENCH_NUMBER_OF_STRING_FORMATS ] = {
+	{ "ctime_date",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE },
+	{ "ctime_time",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME },
+	{ "ctime_time_milli",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS },
+	{ "ctime_time_micro",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS },
+	{ "ctime_time_nano",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS },
+	{ "ctime_date_time",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME },
+	{ "ctime_date_time_milli",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS },
+	{ "ctime_date_time_micro",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS },
+	{ "ctime_date_time_nano",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS },
+	{ "ctime_date_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_time_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_time_milli_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_time_micro_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_time_nano_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_date_time_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_date_time_milli_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_date_time_micro_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "ctime_date_time_nano_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_date",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE },
+	{ "iso8601_time",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME },
+	{ "iso8601_time_milli",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS },
+	{ "iso8601_time_micro",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS },
+	{ "iso8601_time_nano",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS },
+	{ "iso8601_date_time",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME },
+	{ "iso8601_date_time_milli",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS },
+	{ "iso8601_date_time_micro",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS },
+	{ "iso8601_date_time_nano",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS },
+	{ "iso8601_date_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_time_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_time_milli_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_time_micro_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_time_nano_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_date_time_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_date_time_milli_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_date_time_micro_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601_date_time_nano_timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR } };
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint64_t fdatetime_bench_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Compares two 64-bit signed values, used to sort the values of the sorted distribution
+ * Returns -1, 0 or 1
+ */
+int fdatetime_bench_compare_values(
+     const void *first_value,
+     const void *second_value )
+{
+	int64_t first_64bit  = *( (const int64_t *) first_value );
+	int64_t second_64bit = *( (const int64_t *) second_value );
+
+	if( first_64bit < second_64bit )
+	{
+		return( -1 );
+	}
+	else if( first_64bit > second_64bit )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Encodes a number of nano seconds since January 1, 1970 as a little-endian value of a timestamp type
+ * The date time values are determined by the POSIX time conversion and stored by the conversion
+ * of the timestamp type, which keeps the encoding consistent with the library
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_encode_value(
+     int timestamp_type,
+     int64_t number_of_nano_seconds,
+     uint8_t *byte_stream,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	fdatetime_bench_timestamp_t timestamp;
+
+	int result = 0;
+
+	internal_posix_time.timestamp  = (uint64_t) number_of_nano_seconds;
+	internal_posix_time.value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED;
+
+	if( libfdatetime_internal_posix_time_copy_to_date_time_values(
+	     &internal_posix_time,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+			          &( timestamp.fat_date_time ),
+			          &date_time_values,
+			          error );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 byte_stream,
+			 timestamp.fat_date_time.date );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 2 ] ),
+			 timestamp.fat_date_time.time );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			result = libfdatetime_internal_filetime_copy_from_date_time_values(
+			          &( timestamp.filetime ),
+			          &date_time_values,
+			          error );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 timestamp.filetime.lower );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( byte_stream[ 4 ] ),
+			 timestamp.filetime.upper );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			result = libfdatetime_internal_floatingtime_copy_from_date_time_values(
+			          &( timestamp.floatingtime ),
+			          &date_time_values,
+			          error );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 timestamp.floatingtime.timestamp.integer );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+			          &( timestamp.hfs_time ),
+			          &date_time_values,
+			          error );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 timestamp.hfs_time.timestamp );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			result = libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+			          &( timestamp.nsf_timedate ),
+			          &date_time_values,
+			          error );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 timestamp.nsf_timedate.lower );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( byte_stream[ 4 ] ),
+			 timestamp.nsf_timedate.upper );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			result = 1;
+
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 internal_posix_time.timestamp );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			result = libfdatetime_internal_systemtime_copy_from_date_time_values(
+			          &( timestamp.systemtime ),
+			          &date_time_values,
+			          error );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 byte_stream,
+			 timestamp.systemtime.year );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 2 ] ),
+			 timestamp.systemtime.month );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 4 ] ),
+			 timestamp.systemtime.day_of_week );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 6 ] ),
+			 timestamp.systemtime.day_of_month );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 8 ] ),
+			 timestamp.systemtime.hours );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 10 ] ),
+			 timestamp.systemtime.minutes );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 12 ] ),
+			 timestamp.systemtime.seconds );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( byte_stream[ 14 ] ),
+			 timestamp.systemtime.milli_seconds );
+			break;
+
+		default:
+			result = -1;
+			break;
+	}
+	return( result );
+}
+
+/* Generates the encoded values of a timestamp type with a specific distribution
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_generate_values(
+     fdatetime_bench_type_t *bench_type,
+     int distribution,
+     uint8_t *byte_stream,
+     int64_t *number_of_nano_seconds,
+     uint64_t *random_state,
+     libcerror_error_t **error )
+{
+	uint64_t range_size = (uint64_t) ( FDATETIME_BENCH_LAST_NANO_SECONDS - FDATETIME_BENCH_FIRST_NANO_SECONDS ) + 1;
+	uint64_t value_64bit = 0;
+	size_t byte_index    = 0;
+	size_t value_index   = 0;
+
+	if( distribution == FDATETIME_BENCH_DISTRIBUTION_OUT_OF_RANGE )
+	{
+		for( byte_index = 0;
+		     byte_index < ( FDATETIME_BENCH_NUMBER_OF_VALUES * bench_type->value_size );
+		     byte_index += 8 )
+		{
+			value_64bit = fdatetime_bench_get_random_value(
+			               random_state );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( byte_stream[ byte_index ] ),
+			 value_64bit );
+		}
+		return( 1 );
+	}
+	for( value_index = 0;
+	     value_index < FDATETIME_BENCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( ( distribution == FDATETIME_BENCH_DISTRIBUTION_FIXED )
+		 && ( value_index > 0 ) )
+		{
+			number_of_nano_seconds[ value_index ] = number_of_nano_seconds[ 0 ];
+		}
+		else
+		{
+			value_64bit = fdatetime_bench_get_random_value(
+			               random_state );
+
+			number_of_nano_seconds[ value_index ] = FDATETIME_BENCH_FIRST_NANO_SECONDS + (int64_t) ( value_64bit % range_size );
+		}
+	}
+	if( distribution == FDATETIME_BENCH_DISTRIBUTION_SORTED )
+	{
+		qsort(
+		 number_of_nano_seconds,
+		 FDATETIME_BENCH_NUMBER_OF_VALUES,
+		 sizeof( int64_t ),
+		 &fdatetime_bench_compare_values );
+	}
+	for( value_index = 0;
+	     value_index < FDATETIME_BENCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( fdatetime_bench_encode_value(
+		     bench_type->timestamp_type,
+		     number_of_nano_seconds[ value_index ],
+		     &( byte_stream[ value_index * bench_type->value_size ] ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies a timestamp of a specific type from a little-endian byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_copy_from_byte_stream(
+     int timestamp_type,
+     fdatetime_bench_timestamp_t *timestamp,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			return( libfdatetime_fat_date_time_copy_from_byte_stream(
+			         (libfdatetime_fat_date_time_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			return( libfdatetime_filetime_copy_from_byte_stream(
+			         (libfdatetime_filetime_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			return( libfdatetime_floatingtime_copy_from_byte_stream(
+			         (libfdatetime_floatingtime_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			return( libfdatetime_hfs_time_copy_from_byte_stream(
+			         (libfdatetime_hfs_time_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			return( libfdatetime_nsf_timedate_copy_from_byte_stream(
+			         (libfdatetime_nsf_timedate_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			return( libfdatetime_posix_time_copy_from_byte_stream(
+			         (libfdatetime_posix_time_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			return( libfdatetime_systemtime_copy_from_byte_stream(
+			         (libfdatetime_systemtime_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		default:
+			break;
+	}
+	return( -1 );
+}
+
+/* Copies a timestamp of a specific type to an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_copy_to_utf8_string(
+     int timestamp_type,
+     fdatetime_bench_timestamp_t *timestamp,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			return( libfdatetime_fat_date_time_copy_to_utf8_string(
+			         (libfdatetime_fat_date_time_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			return( libfdatetime_filetime_copy_to_utf8_string(
+			         (libfdatetime_filetime_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			return( libfdatetime_floatingtime_copy_to_utf8_string(
+			         (libfdatetime_floatingtime_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			return( libfdatetime_hfs_time_copy_to_utf8_string(
+			         (libfdatetime_hfs_time_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			return( libfdatetime_nsf_timedate_copy_to_utf8_string(
+			         (libfdatetime_nsf_timedate_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			return( libfdatetime_posix_time_copy_to_utf8_string(
+			         (libfdatetime_posix_time_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			return( libfdatetime_systemtime_copy_to_utf8_string(
+			         (libfdatetime_systemtime_t *) timestamp,
+			         utf8_string,
+			         utf8_string_size,
+			         string_format_flags,
+			         error ) );
+
+		default:
+			break;
+	}
+	return( -1 );
+}
+
+/* Runs an operation once over all values
+ * No error is passed to the library functions, so that values which cannot be converted
+ * are counted as failures instead of being measured including the error construction
+ * Returns the number of values that failed
+ */
+size_t fdatetime_bench_run_values(
+        fdatetime_bench_type_t *bench_type,
+        int operation,
+        uint32_t string_format_flags,
+        const uint8_t *byte_stream,
+        fdatetime_bench_timestamp_t *timestamps )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	uint8_t utf8_string[ FDATETIME_BENCH_UTF8_STRING_SIZE ];
+
+	size_t number_of_failures = 0;
+	size_t value_index        = 0;
+
+	switch( operation )
+	{
+		case FDATETIME_BENCH_OPERATION_COPY_FROM_BYTE_STREAM:
+			for( value_index = 0;
+			     value_index < FDATETIME_BENCH_NUMBER_OF_VALUES;
+			     value_index++ )
+			{
+				if( fdatetime_bench_copy_from_byte_stream(
+				     bench_type->timestamp_type,
+				     &( timestamps[ value_index ] ),
+				     &( byte_stream[ value_index * bench_type->value_size ] ),
+				     bench_type->value_size,
+				     NULL ) != 1 )
+				{
+					number_of_failures++;
+				}
+			}
+			break;
+
+		case FDATETIME_BENCH_OPERATION_COPY_TO_DATE_TIME_VALUES:
+			for( value_index = 0;
+			     value_index < FDATETIME_BENCH_NUMBER_OF_VALUES;
+			     value_index++ )
+			{
+				if( libfdatetime_internal_copy_to_date_time_values(
+				     bench_type->timestamp_type,
+				     (intptr_t *) &( timestamps[ value_index ] ),
+				     &date_time_values,
+				     NULL ) != 1 )
+				{
+					number_of_failures++;
+				}
+			}
+			break;
+
+		case FDATETIME_BENCH_OPERATION_COPY_TO_UTF8_STRING:
+			for( value_index = 0;
+			     value_index < FDATETIME_BENCH_NUMBER_OF_VALUES;
+			     value_index++ )
+			{
+				if( fdatetime_bench_copy_to_utf8_string(
+				     bench_type->timestamp_type,
+				     &( timestamps[ value_index ] ),
+				     utf8_string,
+				     FDATETIME_BENCH_UTF8_STRING_SIZE,
+				     string_format_flags,
+				     NULL ) != 1 )
+				{
+					number_of_failures++;
+				}
+			}
+			break;
+
+		default:
+			number_of_failures = FDATETIME_BENCH_NUMBER_OF_VALUES;
+			break;
+	}
+	return( number_of_failures );
+}
+
+/* Compares two numbers of nano seconds per operation, used to sort the trials
+ * Returns -1 if first is smaller than second, 0 if equal or 1 if larger
+ */
+int fdatetime_bench_compare_trials(
+     const void *first,
+     const void *second )
+{
+	double first_value  = *( (const double *) first );
+	double second_value = *( (const double *) second );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the median of values
+ * The values are sorted in place
+ * Returns the median
+ */
+double fdatetime_bench_get_median(
+        double *values,
+        int number_of_values )
+{
+	qsort(
+	 values,
+	 (size_t) number_of_values,
+	 sizeof( double ),
+	 &fdatetime_bench_compare_trials );
+
+	if( ( number_of_values % 2 ) == 0 )
+	{
+		return( ( values[ ( number_of_values / 2 ) - 1 ] + values[ number_of_values / 2 ] ) / 2.0 );
+	}
+	return( values[ number_of_values / 2 ] );
+}
+
+/* Runs the benchmark of an operation
+ * The number of failures is determined by an untimed run, which also warms the caches
+ * Every trial times the requested number of rounds, the result contains the median,
+ * the median absolute deviation and the minimum of the trials
+ */
+void fdatetime_bench_run(
+      fdatetime_bench_type_t *bench_type,
+      int operation,
+      uint32_t string_format_flags,
+      const uint8_t *byte_stream,
+      fdatetime_bench_timestamp_t *timestamps,
+      int number_of_rounds,
+      int number_of_trials,
+      fdatetime_bench_result_t *result )
+{
+	double trials[ FDATETIME_BENCH_MAXIMUM_NUMBER_OF_TRIALS ];
+
+	uint64_t end_time   = 0;
+	uint64_t start_time = 0;
+	int round_index     = 0;
+	int trial_index     = 0;
+
+	result->number_of_failures = fdatetime_bench_run_values(
+	                              bench_type,
+	                              operation,
+	                              string_format_flags,
+	                              byte_stream,
+	                              timestamps );
+
+	for( trial_index = 0;
+	     trial_index < number_of_trials;
+	     trial_index++ )
+	{
+		start_time = fdatetime_bench_timer_get_nano_seconds();
+
+		for( round_index = 0;
+		     round_index < number_of_rounds;
+		     round_index++ )
+		{
+			fdatetime_bench_run_values(
+			 bench_type,
+			 operation,
+			 string_format_flags,
+			 byte_stream,
+			 timestamps );
+		}
+		end_time = fdatetime_bench_timer_get_nano_seconds();
+
+		trials[ trial_index ] = (double) ( end_time - start_time )
+		                      / ( (double) number_of_rounds * FDATETIME_BENCH_NUMBER_OF_VALUES );
+	}
+	result->median = fdatetime_bench_get_median(
+	                  trials,
+	                  number_of_trials );
+
+	/* The trials are sorted by fdatetime_bench_get_median
+	 */
+	result->minimum = trials[ 0 ];
+
+	for( trial_index = 0;
+	     trial_index < number_of_trials;
+	     trial_index++ )
+	{
+		if( trials[ trial_index ] < result->median )
+		{
+			trials[ trial_index ] = result->median - trials[ trial_index ];
+		}
+		else
+		{
+			trials[ trial_index ] -= result->median;
+		}
+	}
+	result->median_absolute_deviation = fdatetime_bench_get_median(
+	                                     trials,
+	                                     number_of_trials );
+}
+
+/* Prints the results as JSON
+ */
+void fdatetime_bench_print_results(
+      FILE *stream,
+      fdatetime_bench_result_t *results,
+      int number_of_results,
+      int number_of_rounds,
+      int number_of_trials )
+{
+	int result_index = 0;
+
+	fprintf(
+	 stream,
+	 "{\n  \"benchmark\": \"fdatetime_bench\",\n  \"number_of_values\": %d,\n  \"number_of_rounds\": %d,\n  \"number_of_trials\": %d,\n  \"results\": [",
+	 FDATETIME_BENCH_NUMBER_OF_VALUES,
+	 number_of_rounds,
+	 number_of_trials );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		fprintf(
+		 stream,
+		 "%s\n    { \"timestamp_type\": \"%s\", \"distribution\": \"%s\", \"operation\": \"%s\", ",
+		 ( result_index == 0 ) ? "" : ",",
+		 results[ result_index ].timestamp_type,
+		 results[ result_index ].distribution,
+		 results[ result_index ].operation );
+
+		if( results[ result_index ].string_format == NULL )
+		{
+			fprintf(
+			 stream,
+			 "\"string_format\": null, " );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\"string_format\": \"%s\", ",
+			 results[ result_index ].string_format );
+		}
+		fprintf(
+		 stream,
+		 "\"ns_per_op\": %.3f, \"mad_ns_per_op\": %.3f, \"minimum_ns_per_op\": %.3f, \"failures\": %" PRIzu " }",
+		 results[ result_index ].median,
+		 results[ result_index ].median_absolute_deviation,
+		 results[ result_index ].minimum,
+		 results[ result_index ].number_of_failures );
+	}
+	fprintf(
+	 stream,
+	 "\n  ]\n}\n" );
+}
+
+/* Retrieves the key of a result
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_get_result_key(
+     const char *timestamp_type,
+     const char *distribution,
+     const char *operation,
+     const char *string_format,
+     char *key,
+     size_t key_size )
+{
+	int print_count = 0;
+
+	print_count = narrow_string_snprintf(
+	               key,
+	               key_size,
+	               "%s:%s:%s:%s",
+	               timestamp_type,
+	               distribution,
+	               operation,
+	               ( string_format == NULL ) ? "" : string_format );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= key_size ) )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value of a string member from a line of JSON
+ * A null value is retrieved as an empty string
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int fdatetime_bench_get_json_string(
+     const char *line,
+     const char *name,
+     char *value,
+     size_t value_size )
+{
+	char member_name[ 64 ];
+
+	const char *value_end   = NULL;
+	const char *value_start = NULL;
+	size_t value_length     = 0;
+	int print_count         = 0;
+
+	print_count = narrow_string_snprintf(
+	               member_name,
+	               64,
+	               "\"%s\": ",
+	               name );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		return( -1 );
+	}
+	value_start = narrow_string_search_string(
+	               line,
+	               member_name,
+	               narrow_string_length( line ) );
+
+	if( value_start == NULL )
+	{
+		return( 0 );
+	}
+	value_start += print_count;
+
+	if( narrow_string_compare(
+	     value_start,
+	     "null",
+	     4 ) == 0 )
+	{
+		value[ 0 ] = 0;
+
+		return( 1 );
+	}
+	if( *value_start != '"' )
+	{
+		return( -1 );
+	}
+	value_start++;
+
+	value_end = narrow_string_search_character(
+	             value_start,
+	             '"',
+	             narrow_string_length( value_start ) );
+
+	if( value_end == NULL )
+	{
+		return( -1 );
+	}
+	value_length = (size_t) ( value_end - value_start );
+
+	if( value_length >= value_size )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     value,
+	     value_start,
+	     value_length ) == NULL )
+	{
+		return( -1 );
+	}
+	value[ value_length ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the value of a number member from a line of JSON
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int fdatetime_bench_get_json_number(
+     const char *line,
+     const char *name,
+     double *value )
+{
+	char member_name[ 64 ];
+
+	const char *value_start = NULL;
+	char *value_end         = NULL;
+	int print_count         = 0;
+
+	print_count = narrow_string_snprintf(
+	               member_name,
+	               64,
+	               "\"%s\": ",
+	               name );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		return( -1 );
+	}
+	value_start = narrow_string_search_string(
+	               line,
+	               member_name,
+	               narrow_string_length( line ) );
+
+	if( value_start == NULL )
+	{
+		return( 0 );
+	}
+	value_start += print_count;
+
+	*value = strtod(
+	          value_start,
+	          &value_end );
+
+	if( value_end == value_start )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the results of a baseline file
+ * Both the median absolute deviation and the number of trials are optional
+ * so that results written before they were added can be used as a baseline
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_read_baseline(
+     const system_character_t *filename,
+     fdatetime_bench_baseline_result_t **baseline_results,
+     int *number_of_baseline_results )
+{
+	char distribution[ 32 ];
+	char line[ FDATETIME_BENCH_MAXIMUM_LINE_SIZE ];
+	char operation[ 32 ];
+	char string_format[ 48 ];
+	char timestamp_type[ 32 ];
+
+	fdatetime_bench_baseline_result_t *baseline_result    = NULL;
+	fdatetime_bench_baseline_result_t *reallocated_results = NULL;
+	FILE *stream                                           = NULL;
+	double median                                          = 0.0;
+	double median_absolute_deviation                       = 0.0;
+	int maximum_number_of_results                          = 0;
+	int result                                             = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          L"r" );
+#else
+	stream = file_stream_open(
+	          filename,
+	          "r" );
+#endif
+	if( stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open baseline file: %" PRIs_SYSTEM ".\n",
+		 filename );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        FDATETIME_BENCH_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		if( narrow_string_search_string(
+		     line,
+		     "\"timestamp_type\"",
+		     narrow_string_length( line ) ) == NULL )
+		{
+			continue;
+		}
+		if( ( fdatetime_bench_get_json_string(
+		       line,
+		       "timestamp_type",
+		       timestamp_type,
+		       32 ) != 1 )
+		 || ( fdatetime_bench_get_json_string(
+		       line,
+		       "distribution",
+		       distribution,
+		       32 ) != 1 )
+		 || ( fdatetime_bench_get_json_string(
+		       line,
+		       "operation",
+		       operation,
+		       32 ) != 1 )
+		 || ( fdatetime_bench_get_json_string(
+		       line,
+		       "string_format",
+		       string_format,
+		       48 ) != 1 )
+		 || ( fdatetime_bench_get_json_number(
+		       line,
+		       "ns_per_op",
+		       &median ) != 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to parse baseline result: %s",
+			 line );
+
+			goto on_error;
+		}
+		result = fdatetime_bench_get_json_number(
+		          line,
+		          "mad_ns_per_op",
+		          &median_absolute_deviation );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to parse baseline result: %s",
+			 line );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			median_absolute_deviation = 0.0;
+		}
+		if( *number_of_baseline_results >= maximum_number_of_results )
+		{
+			maximum_number_of_results += 1024;
+
+			reallocated_results = (fdatetime_bench_baseline_result_t *) realloc(
+			                                                             *baseline_results,
+			                                                             sizeof( fdatetime_bench_baseline_result_t ) * maximum_number_of_results );
+
+			if( reallocated_results == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to resize baseline results.\n" );
+
+				goto on_error;
+			}
+			*baseline_results = reallocated_results;
+		}
+		baseline_result = &( ( *baseline_results )[ *number_of_baseline_results ] );
+
+		if( fdatetime_bench_get_result_key(
+		     timestamp_type,
+		     distribution,
+		     operation,
+		     ( string_format[ 0 ] == 0 ) ? NULL : string_format,
+		     baseline_result->key,
+		     FDATETIME_BENCH_MAXIMUM_KEY_SIZE ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine key of baseline result: %s",
+			 line );
+
+			goto on_error;
+		}
+		baseline_result->median                    = median;
+		baseline_result->median_absolute_deviation = median_absolute_deviation;
+
+		*number_of_baseline_results += 1;
+	}
+	file_stream_close(
+	 stream );
+
+	if( *number_of_baseline_results == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Baseline file: %" PRIs_SYSTEM " does not contain results.\n",
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 stream );
+
+	return( -1 );
+}
+
+/* Compares the results against the baseline results
+ * A result has regressed if its median exceeds the baseline median by more than
+ * the threshold and the difference is larger than the noise of both runs
+ * A result that is not in the baseline fails the comparison, since a stale
+ * or mismatched baseline would otherwise not detect any regression
+ * Returns 1 if no result regressed or 0 if a result regressed, a result is
+ * not in the baseline or no result was compared
+ */
+int fdatetime_bench_compare_results(
+     FILE *stream,
+     fdatetime_bench_result_t *results,
+     int number_of_results,
+     fdatetime_bench_baseline_result_t *baseline_results,
+     int number_of_baseline_results,
+     double threshold )
+{
+	char key[ FDATETIME_BENCH_MAXIMUM_KEY_SIZE ];
+
+	fdatetime_bench_baseline_result_t *baseline_result = NULL;
+	fdatetime_bench_result_t *result                   = NULL;
+	double difference                                  = 0.0;
+	double noise                                       = 0.0;
+	size_t key_size                                    = 0;
+	int baseline_result_index                          = 0;
+	int number_of_compared_results                     = 0;
+	int number_of_improved_results                     = 0;
+	int number_of_missing_results                      = 0;
+	int number_of_regressed_results                    = 0;
+	int result_index                                   = 0;
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		result = &( results[ result_index ] );
+
+		if( fdatetime_bench_get_result_key(
+		     result->timestamp_type,
+		     result->distribution,
+		     result->operation,
+		     result->string_format,
+		     key,
+		     FDATETIME_BENCH_MAXIMUM_KEY_SIZE ) != 1 )
+		{
+			continue;
+		}
+		key_size = narrow_string_length(
+		            key ) + 1;
+
+		baseline_result = NULL;
+
+		for( baseline_result_index = 0;
+		     baseline_result_index < number_of_baseline_results;
+		     baseline_result_index++ )
+		{
+			if( narrow_string_compare(
+			     baseline_results[ baseline_result_index ].key,
+			     key,
+			     key_size ) == 0 )
+			{
+				baseline_result = &( baseline_results[ baseline_result_index ] );
+
+				break;
+			}
+		}
+		if( ( baseline_result == NULL )
+		 || ( baseline_result->median <= 0.0 ) )
+		{
+			fprintf(
+			 stream,
+			 "MISSING %s %s %s%s%s: not in baseline\n",
+			 result->timestamp_type,
+			 result->distribution,
+			 result->operation,
+			 ( result->string_format == NULL ) ? "" : " ",
+			 ( result->string_format == NULL ) ? "" : result->string_format );
+
+			number_of_missing_results++;
+
+			continue;
+		}
+		number_of_compared_results++;
+
+		difference = result->median - baseline_result->median;
+
+		noise = result->median_absolute_deviation;
+
+		if( baseline_result->median_absolute_deviation > noise )
+		{
+			noise = baseline_result->median_absolute_deviation;
+		}
+		noise *= FDATETIME_BENCH_NOISE_FACTOR;
+
+		if( ( difference > ( baseline_result->median * threshold / 100.0 ) )
+		 && ( difference > noise ) )
+		{
+			fprintf(
+			 stream,
+			 "REGRESSION %s %s %s%s%s: %.3f -> %.3f ns/op (+%.1f%%, threshold %.1f%%)\n",
+			 result->timestamp_type,
+			 result->distribution,
+			 result->operation,
+			 ( result->string_format == NULL ) ? "" : " ",
+			 ( result->string_format == NULL ) ? "" : result->string_format,
+			 baseline_result->median,
+			 result->median,
+			 difference * 100.0 / baseline_result->median,
+			 threshold );
+
+			number_of_regressed_results++;
+		}
+		else if( ( -difference > ( baseline_result->median * threshold / 100.0 ) )
+		      && ( -difference > noise ) )
+		{
+			number_of_improved_results++;
+		}
+	}
+	fprintf(
+	 stream,
+	 "Compared: %d, regressed: %d, improved: %d, not in baseline: %d\n",
+	 number_of_compared_results,
+	 number_of_regressed_results,
+	 number_of_improved_results,
+	 number_of_missing_results );
+
+	if( ( number_of_compared_results == 0 )
+	 || ( number_of_missing_results != 0 )
+	 || ( number_of_regressed_results != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Prints usage information
+ */
+void fdatetime_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fdatetime_bench to benchmark the timestamp conversions.\n\n" );
+
+	fprintf( stream, "Usage: fdatetime_bench [ -b baseline ] [ -n trials ] [ -o output ]\n"
+	                 "                       [ -r rounds ] [ -t threshold ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-b: compare the results against a baseline file and fail if\n"
+	                 "\t    any result regressed or is not in the baseline\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-n: number of trials, the median of the trials is reported\n"
+	                 "\t    (default is %d, maximum is %d)\n",
+	                 FDATETIME_BENCH_NUMBER_OF_TRIALS,
+	                 FDATETIME_BENCH_MAXIMUM_NUMBER_OF_TRIALS );
+	fprintf( stream, "\t-o: write the results to an output file instead of stdout\n" );
+	fprintf( stream, "\t-r: number of rounds per trial (default is %d)\n",
+	                 FDATETIME_BENCH_NUMBER_OF_ROUNDS );
+	fprintf( stream, "\t-t: regression threshold in percent (default is %.0f)\n",
+	                 FDATETIME_BENCH_REGRESSION_THRESHOLD );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+	fdatetime_bench_baseline_result_t *baseline_results = NULL;
+	fdatetime_bench_result_t *results                    = NULL;
+	fdatetime_bench_timestamp_t *timestamps              = NULL;
+	libcerror_error_t *error                             = NULL;
+	const system_character_t *baseline_filename          = NULL;
+	const system_character_t *output_filename            = NULL;
+	FILE *output_stream                                  = NULL;
+	system_character_t *value_end                        = NULL;
+	uint8_t *byte_stream                                 = NULL;
+	int64_t *number_of_nano_seconds                      = NULL;
+	double threshold                                     = FDATETIME_BENCH_REGRESSION_THRESHOLD;
+	uint64_t random_state                                = 0x5eed12345678abcdULL;
+	int argument_index                                   = 0;
+	int compare_result                                   = 1;
+	int distribution                                     = 0;
+	int format_index                                     = 0;
+	int maximum_number_of_results                        = 0;
+	int number_of_baseline_results                       = 0;
+	int number_of_results                                = 0;
+	int number_of_rounds                                 = FDATETIME_BENCH_NUMBER_OF_ROUNDS;
+	int number_of_trials                                 = FDATETIME_BENCH_NUMBER_OF_TRIALS;
+	int type_index                                       = 0;
+
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		/* Only options consisting of a dash and a single character are supported
+		 */
+		if( system_string_length(
+		     argv[ argument_index ] ) != 2 )
+		{
+			fdatetime_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( system_string_compare(
+		     argv[ argument_index ],
+		     _SYSTEM_STRING( "-h" ),
+		     2 ) == 0 )
+		{
+			fdatetime_bench_usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		if( ( argument_index + 1 ) >= argc )
+		{
+			fdatetime_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( system_string_compare(
+		     argv[ argument_index ],
+		     _SYSTEM_STRING( "-b" ),
+		     2 ) == 0 )
+		{
+			baseline_filename = argv[ ++argument_index ];
+		}
+		else if( system_string_compare(
+		          argv[ argument_index ],
+		          _SYSTEM_STRING( "-n" ),
+		          2 ) == 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			number_of_trials = (int) wcstol( argv[ ++argument_index ], &value_end, 10 );
+#else
+			number_of_trials = (int) strtol( argv[ ++argument_index ], &value_end, 10 );
+#endif
+			if( ( *value_end != 0 )
+			 || ( number_of_trials <= 0 )
+			 || ( number_of_trials > FDATETIME_BENCH_MAXIMUM_NUMBER_OF_TRIALS ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of trials.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else if( system_string_compare(
+		          argv[ argument_index ],
+		          _SYSTEM_STRING( "-o" ),
+		          2 ) == 0 )
+		{
+			output_filename = argv[ ++argument_index ];
+		}
+		else if( system_string_compare(
+		          argv[ argument_index ],
+		          _SYSTEM_STRING( "-r" ),
+		          2 ) == 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			number_of_rounds = (int) wcstol( argv[ ++argument_index ], &value_end, 10 );
+#else
+			number_of_rounds = (int) strtol( argv[ ++argument_index ], &value_end, 10 );
+#endif
+			if( ( *value_end != 0 )
+			 || ( number_of_rounds <= 0 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of rounds.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else if( system_string_compare(
+		          argv[ argument_index ],
+		          _SYSTEM_STRING( "-t" ),
+		          2 ) == 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			threshold = wcstod( argv[ ++argument_index ], &value_end );
+#else
+			threshold = strtod( argv[ ++argument_index ], &value_end );
+#endif
+			if( ( *value_end != 0 )
+			 || ( threshold < 0.0 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid regression threshold.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else
+		{
+			fdatetime_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( baseline_filename != NULL )
+	{
+		if( fdatetime_bench_read_baseline(
+		     baseline_filename,
+		     &baseline_results,
+		     &number_of_baseline_results ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	maximum_number_of_results = FDATETIME_BENCH_NUMBER_OF_TYPES
+	                          * FDATETIME_BENCH_NUMBER_OF_DISTRIBUTIONS
+	                          * ( 2 + FDATETIME_BENCH_NUMBER_OF_STRING_FORMATS );
+
+	byte_stream = (uint8_t *) malloc(
+	                           FDATETIME_BENCH_NUMBER_OF_VALUES * FDATETIME_BENCH_MAXIMUM_VALUE_SIZE );
+
+	number_of_nano_seconds = (int64_t *) malloc(
+	                                      sizeof( int64_t ) * FDATETIME_BENCH_NUMBER_OF_VALUES );
+
+	timestamps = (fdatetime_bench_timestamp_t *) malloc(
+	                                              sizeof( fdatetime_bench_timestamp_t ) * FDATETIME_BENCH_NUMBER_OF_VALUES );
+
+	results = (fdatetime_bench_result_t *) malloc(
+	                                        sizeof( fdatetime_bench_result_t ) * maximum_number_of_results );
+
+	if( ( byte_stream == NULL )
+	 || ( number_of_nano_seconds == NULL )
+	 || ( timestamps == NULL )
+	 || ( results == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	for( type_index = 0;
+	     type_index < FDATETIME_BENCH_NUMBER_OF_TYPES;
+	     type_index++ )
+	{
+		for( distribution = 0;
+		     distribution < FDATETIME_BENCH_NUMBER_OF_DISTRIBUTIONS;
+		     distribution++ )
+		{
+			if( fdatetime_bench_generate_values(
+			     &( fdatetime_bench_types[ type_index ] ),
+			     distribution,
+			     byte_stream,
+			     number_of_nano_seconds,
+			     &random_state,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to generate %s values of type: %s.\n",
+				 fdatetime_bench_distributions[ distribution ],
+				 fdatetime_bench_types[ type_index ].name );
+
+				goto on_error;
+			}
+			/* The copy from byte stream benchmark also decodes the timestamps used by the other benchmarks
+			 */
+			results[ number_of_results ].timestamp_type = fdatetime_bench_types[ type_index ].name;
+			results[ number_of_results ].distribution   = fdatetime_bench_distributions[ distribution ];
+			results[ number_of_results ].operation      = "copy_from_byte_stream";
+			results[ number_of_results ].string_format  = NULL;
+
+			fdatetime_bench_run(
+			 &( fdatetime_bench_types[ type_index ] ),
+			 FDATETIME_BENCH_OPERATION_COPY_FROM_BYTE_STREAM,
+			 0,
+			 byte_stream,
+			 timestamps,
+			 number_of_rounds,
+			 number_of_trials,
+			 &( results[ number_of_results++ ] ) );
+
+			results[ number_of_results ].timestamp_type = fdatetime_bench_types[ type_index ].name;
+			results[ number_of_results ].distribution   = fdatetime_bench_distributions[ distribution ];
+			results[ number_of_results ].operation      = "copy_to_date_time_values";
+			results[ number_of_results ].string_format  = NULL;
+
+			fdatetime_bench_run(
+			 &( fdatetime_bench_types[ type_index ] ),
+			 FDATETIME_BENCH_OPERATION_COPY_TO_DATE_TIME_VALUES,
+			 0,
+			 byte_stream,
+			 timestamps,
+			 number_of_rounds,
+			 number_of_trials,
+			 &( results[ number_of_results++ ] ) );
+
+			for( format_index = 0;
+			     format_index < FDATETIME_BENCH_NUMBER_OF_STRING_FORMATS;
+			     format_index++ )
+			{
+				results[ number_of_results ].timestamp_type = fdatetime_bench_types[ type_index ].name;
+				results[ number_of_results ].distribution   = fdatetime_bench_distributions[ distribution ];
+				results[ number_of_results ].operation      = "copy_to_utf8_string";
+				results[ number_of_results ].string_format  = fdatetime_bench_string_formats[ format_index ].name;
+
+				fdatetime_bench_run(
+				 &( fdatetime_bench_types[ type_index ] ),
+				 FDATETIME_BENCH_OPERATION_COPY_TO_UTF8_STRING,
+				 fdatetime_bench_string_formats[ format_index ].string_format_flags,
+				 byte_stream,
+				 timestamps,
+				 number_of_rounds,
+				 number_of_trials,
+				 &( results[ number_of_results++ ] ) );
+			}
+		}
+	}
+	if( output_filename != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		output_stream = file_stream_open_wide(
+		                 output_filename,
+		                 L"w" );
+#else
+		output_stream = file_stream_open(
+		                 output_filename,
+		                 "w" );
+#endif
+		if( output_stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open output file: %" PRIs_SYSTEM ".\n",
+			 output_filename );
+
+			goto on_error;
+		}
+		fdatetime_bench_print_results(
+		 output_stream,
+		 results,
+		 number_of_results,
+		 number_of_rounds,
+		 number_of_trials );
+
+		file_stream_close(
+		 output_stream );
+	}
+	else if( baseline_filename == NULL )
+	{
+		fdatetime_bench_print_results(
+		 stdout,
+		 results,
+		 number_of_results,
+		 number_of_rounds,
+		 number_of_trials );
+	}
+	if( baseline_filename != NULL )
+	{
+		compare_result = fdatetime_bench_compare_results(
+		                  stdout,
+		                  results,
+		                  number_of_results,
+		                  baseline_results,
+		                  number_of_baseline_results,
+		                  threshold );
+	}
+	free(
+	 results );
+	free(
+	 timestamps );
+	free(
+	 number_of_nano_seconds );
+	free(
+	 byte_stream );
+
+	if( baseline_results != NULL )
+	{
+		free(
+		 baseline_results );
+	}
+	if( compare_result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( results != NULL )
+	{
+		free(
+		 results );
+	}
+	if( timestamps != NULL )
+	{
+		free(
+		 timestamps );
+	}
+	if( number_of_nano_seconds != NULL )
+	{
+		free(
+		 number_of_nano_seconds );
+	}
+	if( byte_stream != NULL )
+	{
+		free(
+		 byte_stream );
+	}
+	if( baseline_results != NULL )
+	{
+		free(
+		 baseline_results );
+	}
+	return( EXIT_FAILURE );
+#else
+	fprintf(
+	 stderr,
+	 "Benchmark requires access to the internal library functions.\n" );
+
+	return( EXIT_FAILURE );
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,329 @@
+/*
+ * Benchmark of the batch conversion scaling over a number of threads
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fdatetime_bench_libcerror.h"
+#include "fdatetime_bench_libfdatetime.h"
+#include "fdatetime_bench_timer.h"
+
+/* The number of FILETIME values converted per batch
+ */
+#define FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES		( 1024 * 1024 )
+
+/* The size of the UTF-8 string of an individual value
+ */
+#define FDATETIME_BENCH_BATCH_UTF8_STRING_SIZE		32
+
+/* The number of times each benchmark is repeated, the fastest repetition is reported
+ */
+#define FDATETIME_BENCH_BATCH_NUMBER_OF_REPETITIONS	5
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint64_t fdatetime_bench_batch_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Retrieves the number of online processors
+ * Returns the number of processors or 1 if not available
+ */
+int fdatetime_bench_batch_get_number_of_processors(
+     void )
+{
+	int number_of_processors = 1;
+
+#if defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	long value = sysconf(
+	              _SC_NPROCESSORS_ONLN );
+
+	if( value > 0 )
+	{
+		number_of_processors = (int) value;
+	}
+#endif
+	return( number_of_processors );
+}
+
+/* Runs the benchmark with a specific number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_batch_run(
+     libfdatetime_batch_job_t *batch_job,
+     int number_of_threads,
+     double *nano_seconds_per_value,
+     libfdatetime_error_t **error )
+{
+	uint64_t elapsed_time = 0;
+	uint64_t end_time     = 0;
+	uint64_t minimum_time = 0;
+	uint64_t start_time   = 0;
+	int repetition_index  = 0;
+
+	if( libfdatetime_batch_job_set_number_of_threads(
+	     batch_job,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( repetition_index = 0;
+	     repetition_index < FDATETIME_BENCH_BATCH_NUMBER_OF_REPETITIONS;
+	     repetition_index++ )
+	{
+		start_time = fdatetime_bench_timer_get_nano_seconds();
+
+		if( libfdatetime_batch_convert(
+		     batch_job,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		end_time     = fdatetime_bench_timer_get_nano_seconds();
+		elapsed_time = end_time - start_time;
+
+		if( ( repetition_index == 0 )
+		 || ( elapsed_time < minimum_time ) )
+		{
+			minimum_time = elapsed_time;
+		}
+	}
+	*nano_seconds_per_value = (double) minimum_time / FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES;
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libfdatetime_batch_job_t *batch_job = NULL;
+	libfdatetime_error_t *error         = NULL;
+	uint8_t *byte_stream                = NULL;
+	uint8_t *utf8_string_arena          = NULL;
+	double nano_seconds_per_value       = 0.0;
+	double single_thread_nano_seconds   = 0.0;
+	uint64_t random_state               = 0x5eed12345678abcdULL;
+	uint64_t value_64bit                = 0;
+	size_t value_index                  = 0;
+	int maximum_number_of_threads       = 0;
+	int number_of_threads               = 0;
+
+	if( argc > 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		maximum_number_of_threads = (int) wcstol( argv[ 1 ], NULL, 10 );
+#else
+		maximum_number_of_threads = (int) strtol( argv[ 1 ], NULL, 10 );
+#endif
+		if( ( maximum_number_of_threads <= 0 )
+		 || ( maximum_number_of_threads > 256 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of threads.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	else
+	{
+		maximum_number_of_threads = fdatetime_bench_batch_get_number_of_processors();
+	}
+	byte_stream = (uint8_t *) malloc(
+	                           FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES * 8 );
+
+	utf8_string_arena = (uint8_t *) malloc(
+	                                 FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES * FDATETIME_BENCH_BATCH_UTF8_STRING_SIZE );
+
+	if( ( byte_stream == NULL )
+	 || ( utf8_string_arena == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	/* FILETIME values between 1601 and approximately 2185
+	 */
+	for( value_index = 0;
+	     value_index < FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		value_64bit = fdatetime_bench_batch_get_random_value(
+		               &random_state ) & 0x01ffffffffffffffULL;
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( byte_stream[ value_index * 8 ] ),
+		 value_64bit );
+	}
+	if( libfdatetime_batch_job_initialize(
+	     &batch_job,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create batch job.\n" );
+
+		goto on_error;
+	}
+	if( libfdatetime_batch_job_set_input(
+	     batch_job,
+	     byte_stream,
+	     FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES * 8,
+	     LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	     0,
+	     LIBFDATETIME_ENDIAN_LITTLE,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set batch job input.\n" );
+
+		goto on_error;
+	}
+	if( libfdatetime_batch_job_set_output(
+	     batch_job,
+	     utf8_string_arena,
+	     FDATETIME_BENCH_BATCH_NUMBER_OF_VALUES * FDATETIME_BENCH_BATCH_UTF8_STRING_SIZE,
+	     FDATETIME_BENCH_BATCH_UTF8_STRING_SIZE,
+	     LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set batch job output.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "%8s %12s %12s %12s\n",
+	 "threads",
+	 "ns/value",
+	 "Mvalues/s",
+	 "speedup" );
+
+	for( number_of_threads = 1;
+	     number_of_threads <= maximum_number_of_threads;
+	     number_of_threads++ )
+	{
+		if( fdatetime_bench_batch_run(
+		     batch_job,
+		     number_of_threads,
+		     &nano_seconds_per_value,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark with: %d threads.\n",
+			 number_of_threads );
+
+			goto on_error;
+		}
+		if( number_of_threads == 1 )
+		{
+			single_thread_nano_seconds = nano_seconds_per_value;
+		}
+		fprintf(
+		 stdout,
+		 "%8d %12.2f %12.2f %11.2fx\n",
+		 number_of_threads,
+		 nano_seconds_per_value,
+		 1000.0 / nano_seconds_per_value,
+		 single_thread_nano_seconds / nano_seconds_per_value );
+	}
+	if( libfdatetime_batch_job_free(
+	     &batch_job,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free batch job.\n" );
+
+		goto on_error;
+	}
+	free(
+	 utf8_string_arena );
+	free(
+	 byte_stream );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libfdatetime_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libfdatetime_error_free(
+		 &error );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	if( utf8_string_arena != NULL )
+	{
+		free(
+		 utf8_string_arena );
+	}
+	if( byte_stream != NULL )
+	{
+		free(
+		 byte_stream );
+	}
+	return( EXIT_FAILURE );
+}
+
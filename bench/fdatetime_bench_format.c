@@ -0,0 +1,292 @@
+/*
+ * Benchmark of the date and time values string format dispatch
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_bench_libcerror.h"
+#include "fdatetime_bench_libfdatetime.h"
+#include "fdatetime_bench_timer.h"
+
+#include "../libfdatetime/libfdatetime_date_time_values.h"
+
+/* The number of date and time values formatted per round
+ */
+#define FDATETIME_BENCH_FORMAT_NUMBER_OF_VALUES		4096
+
+/* The default number of rounds
+ */
+#define FDATETIME_BENCH_FORMAT_NUMBER_OF_ROUNDS		256
+
+/* The number of times each benchmark is repeated, the fastest repetition is reported
+ */
+#define FDATETIME_BENCH_FORMAT_NUMBER_OF_REPETITIONS	5
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+typedef struct fdatetime_bench_format_case fdatetime_bench_format_case_t;
+
+struct fdatetime_bench_format_case
+{
+	/* The description
+	 */
+	const char *description;
+
+	/* The string format flags
+	 */
+	uint32_t string_format_flags;
+};
+
+/* Pairs of string format flags, the first uses a specialized function
+ * the second a closely related combination that uses the generic function
+ */
+fdatetime_bench_format_case_t fdatetime_bench_format_cases[ 8 ] = {
+	{ "iso8601 date time nano timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601 date time nano",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS },
+	{ "ctime date time milli",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS },
+	{ "ctime date time milli timezone",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR },
+	{ "iso8601 date",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE },
+	{ "iso8601 date duration",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION },
+	{ "ctime date",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE },
+	{ "ctime date duration",
+	  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION } };
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint32_t fdatetime_bench_format_get_random_value(
+          uint32_t *random_state )
+{
+	uint32_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Runs the benchmark of a specific string format
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_format_run(
+     libfdatetime_date_time_values_t *date_time_values,
+     int number_of_rounds,
+     uint32_t string_format_flags,
+     double *nano_seconds_per_operation,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ 48 ];
+
+	uint64_t elapsed_time = 0;
+	uint64_t end_time     = 0;
+	uint64_t minimum_time = 0;
+	uint64_t start_time   = 0;
+	size_t string_index   = 0;
+	int repetition_index  = 0;
+	int result            = 0;
+	int round_index       = 0;
+	int value_index       = 0;
+
+	for( repetition_index = 0;
+	     repetition_index < FDATETIME_BENCH_FORMAT_NUMBER_OF_REPETITIONS;
+	     repetition_index++ )
+	{
+		start_time = fdatetime_bench_timer_get_nano_seconds();
+
+		for( round_index = 0;
+		     round_index < number_of_rounds;
+		     round_index++ )
+		{
+			for( value_index = 0;
+			     value_index < FDATETIME_BENCH_FORMAT_NUMBER_OF_VALUES;
+			     value_index++ )
+			{
+				string_index = 0;
+
+				result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+				          &( date_time_values[ value_index ] ),
+				          utf8_string,
+				          48,
+				          &string_index,
+				          string_format_flags,
+				          error );
+
+				if( result != 1 )
+				{
+					return( -1 );
+				}
+			}
+		}
+		end_time     = fdatetime_bench_timer_get_nano_seconds();
+		elapsed_time = end_time - start_time;
+
+		if( ( repetition_index == 0 )
+		 || ( elapsed_time < minimum_time ) )
+		{
+			minimum_time = elapsed_time;
+		}
+	}
+	*nano_seconds_per_operation = (double) minimum_time
+	                            / ( (double) number_of_rounds * FDATETIME_BENCH_FORMAT_NUMBER_OF_VALUES );
+
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+	libfdatetime_date_time_values_t *date_time_values = NULL;
+	libcerror_error_t *error                          = NULL;
+	double nano_seconds_per_operation[ 8 ];
+	uint32_t random_state                             = 0x5eed1234UL;
+	int case_index                                    = 0;
+	int number_of_rounds                              = FDATETIME_BENCH_FORMAT_NUMBER_OF_ROUNDS;
+	int value_index                                   = 0;
+
+	if( argc > 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		number_of_rounds = (int) wcstol( argv[ 1 ], NULL, 10 );
+#else
+		number_of_rounds = (int) strtol( argv[ 1 ], NULL, 10 );
+#endif
+		if( number_of_rounds <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of rounds.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	date_time_values = (libfdatetime_date_time_values_t *) malloc(
+	                    sizeof( libfdatetime_date_time_values_t ) * FDATETIME_BENCH_FORMAT_NUMBER_OF_VALUES );
+
+	if( date_time_values == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create date time values.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	for( value_index = 0;
+	     value_index < FDATETIME_BENCH_FORMAT_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		date_time_values[ value_index ].year          = (uint16_t) ( 1601 + ( fdatetime_bench_format_get_random_value( &random_state ) % 8399 ) );
+		date_time_values[ value_index ].month         = (uint8_t) ( 1 + ( fdatetime_bench_format_get_random_value( &random_state ) % 12 ) );
+		date_time_values[ value_index ].day           = (uint8_t) ( 1 + ( fdatetime_bench_format_get_random_value( &random_state ) % 28 ) );
+		date_time_values[ value_index ].hours         = (uint8_t) ( fdatetime_bench_format_get_random_value( &random_state ) % 24 );
+		date_time_values[ value_index ].minutes       = (uint8_t) ( fdatetime_bench_format_get_random_value( &random_state ) % 60 );
+		date_time_values[ value_index ].seconds       = (uint8_t) ( fdatetime_bench_format_get_random_value( &random_state ) % 60 );
+		date_time_values[ value_index ].milli_seconds = (uint16_t) ( fdatetime_bench_format_get_random_value( &random_state ) % 1000 );
+		date_time_values[ value_index ].micro_seconds = (uint16_t) ( fdatetime_bench_format_get_random_value( &random_state ) % 1000 );
+		date_time_values[ value_index ].nano_seconds  = (uint16_t) ( fdatetime_bench_format_get_random_value( &random_state ) % 1000 );
+	}
+	fprintf(
+	 stdout,
+	 "%-32s %12s %12s\n",
+	 "string format",
+	 "ns/op",
+	 "relative" );
+
+	for( case_index = 0;
+	     case_index < 8;
+	     case_index++ )
+	{
+		if( fdatetime_bench_format_run(
+		     date_time_values,
+		     number_of_rounds,
+		     fdatetime_bench_format_cases[ case_index ].string_format_flags,
+		     &( nano_seconds_per_operation[ case_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s.\n",
+			 fdatetime_bench_format_cases[ case_index ].description );
+
+			goto on_error;
+		}
+		/* The odd cases use the generic function and are reported relative to the specialized function
+		 */
+		fprintf(
+		 stdout,
+		 "%-32s %12.2f %11.2fx\n",
+		 fdatetime_bench_format_cases[ case_index ].description,
+		 nano_seconds_per_operation[ case_index ],
+		 ( ( case_index % 2 ) == 0 ) ? 1.0 : nano_seconds_per_operation[ case_index ] / nano_seconds_per_operation[ case_index - 1 ] );
+	}
+	free(
+	 date_time_values );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	free(
+	 date_time_values );
+
+	return( EXIT_FAILURE );
+#else
+	fprintf(
+	 stderr,
+	 "Benchmark requires access to the internal library functions.\n" );
+
+	return( EXIT_FAILURE );
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+}
+
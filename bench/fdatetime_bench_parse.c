@@ -0,0 +1,335 @@
+/*
+ * Benchmark of the ISO 8601 string parsing
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_bench_libcerror.h"
+#include "fdatetime_bench_libfdatetime.h"
+#include "fdatetime_bench_timer.h"
+
+/* The number of strings parsed per round
+ */
+#define FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS		4096
+
+/* The size of an individual string
+ */
+#define FDATETIME_BENCH_PARSE_STRING_SIZE		48
+
+/* The default number of rounds
+ */
+#define FDATETIME_BENCH_PARSE_NUMBER_OF_ROUNDS		256
+
+/* The number of times each benchmark is repeated, the fastest repetition is reported
+ */
+#define FDATETIME_BENCH_PARSE_NUMBER_OF_REPETITIONS	5
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint32_t fdatetime_bench_parse_get_random_value(
+          uint32_t *random_state )
+{
+	uint32_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Runs the benchmark of parsing the strings
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_parse_run(
+     uint8_t *utf8_strings,
+     size_t *utf8_string_lengths,
+     int number_of_rounds,
+     double *nano_seconds_per_string,
+     libcerror_error_t **error )
+{
+	libfdatetime_filetime_t *filetime = NULL;
+	uint64_t elapsed_time             = 0;
+	uint64_t end_time                 = 0;
+	uint64_t minimum_time             = 0;
+	uint64_t start_time               = 0;
+	int repetition_index              = 0;
+	int result                        = 0;
+	int round_index                   = 0;
+	int string_index                  = 0;
+
+	if( libfdatetime_filetime_initialize(
+	     &filetime,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( repetition_index = 0;
+	     repetition_index < FDATETIME_BENCH_PARSE_NUMBER_OF_REPETITIONS;
+	     repetition_index++ )
+	{
+		start_time = fdatetime_bench_timer_get_nano_seconds();
+
+		for( round_index = 0;
+		     round_index < number_of_rounds;
+		     round_index++ )
+		{
+			for( string_index = 0;
+			     string_index < FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS;
+			     string_index++ )
+			{
+				result = libfdatetime_filetime_copy_from_utf8_string(
+				          filetime,
+				          &( utf8_strings[ string_index * FDATETIME_BENCH_PARSE_STRING_SIZE ] ),
+				          utf8_string_lengths[ string_index ],
+				          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+				          error );
+
+				if( result != 1 )
+				{
+					libfdatetime_filetime_free(
+					 &filetime,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+		}
+		end_time     = fdatetime_bench_timer_get_nano_seconds();
+		elapsed_time = end_time - start_time;
+
+		if( ( repetition_index == 0 )
+		 || ( elapsed_time < minimum_time ) )
+		{
+			minimum_time = elapsed_time;
+		}
+	}
+	*nano_seconds_per_string = (double) minimum_time
+	                         / ( (double) number_of_rounds * FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS );
+
+	return( libfdatetime_filetime_free(
+	         &filetime,
+	         error ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	uint32_t string_format_flags[ 3 ] = {
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR };
+
+	const char *descriptions[ 3 ] = {
+		"iso8601 date time nano timezone",
+		"iso8601 date time milli",
+		"iso8601 date time timezone" };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	uint8_t *utf8_strings             = NULL;
+	size_t *utf8_string_lengths       = NULL;
+	double nano_seconds_per_string    = 0.0;
+	size_t total_string_length        = 0;
+	uint64_t value_64bit              = 0;
+	uint32_t random_state             = 0x5eed1234UL;
+	int case_index                    = 0;
+	int number_of_rounds              = FDATETIME_BENCH_PARSE_NUMBER_OF_ROUNDS;
+	int string_index                  = 0;
+
+	if( argc > 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		number_of_rounds = (int) wcstol( argv[ 1 ], NULL, 10 );
+#else
+		number_of_rounds = (int) strtol( argv[ 1 ], NULL, 10 );
+#endif
+		if( number_of_rounds <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of rounds.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	utf8_strings = (uint8_t *) malloc(
+	                FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS * FDATETIME_BENCH_PARSE_STRING_SIZE );
+
+	if( utf8_strings == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create strings.\n" );
+
+		goto on_error;
+	}
+	utf8_string_lengths = (size_t *) malloc(
+	                       sizeof( size_t ) * FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS );
+
+	if( utf8_string_lengths == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create string lengths.\n" );
+
+		goto on_error;
+	}
+	if( libfdatetime_filetime_initialize(
+	     &filetime,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create FILETIME.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "%-32s %12s %12s\n",
+	 "string format",
+	 "ns/string",
+	 "MiB/s" );
+
+	for( case_index = 0;
+	     case_index < 3;
+	     case_index++ )
+	{
+		total_string_length = 0;
+
+		for( string_index = 0;
+		     string_index < FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS;
+		     string_index++ )
+		{
+			/* FILETIME values between January 1, 1601 and December 31, 9999
+			 */
+			value_64bit   = fdatetime_bench_parse_get_random_value( &random_state );
+			value_64bit <<= 32;
+			value_64bit  |= fdatetime_bench_parse_get_random_value( &random_state );
+			value_64bit  %= (uint64_t) 0x24c85a5ed1c04000ULL;
+
+			if( libfdatetime_filetime_copy_from_64bit(
+			     filetime,
+			     value_64bit,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libfdatetime_filetime_copy_to_utf8_string(
+			     filetime,
+			     &( utf8_strings[ string_index * FDATETIME_BENCH_PARSE_STRING_SIZE ] ),
+			     FDATETIME_BENCH_PARSE_STRING_SIZE,
+			     string_format_flags[ case_index ],
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			utf8_string_lengths[ string_index ] = narrow_string_length(
+			                                       (char *) &( utf8_strings[ string_index * FDATETIME_BENCH_PARSE_STRING_SIZE ] ) );
+
+			total_string_length += utf8_string_lengths[ string_index ];
+		}
+		if( fdatetime_bench_parse_run(
+		     utf8_strings,
+		     utf8_string_lengths,
+		     number_of_rounds,
+		     &nano_seconds_per_string,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s.\n",
+			 descriptions[ case_index ] );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "%-32s %12.2f %12.1f\n",
+		 descriptions[ case_index ],
+		 nano_seconds_per_string,
+		 ( (double) total_string_length / FDATETIME_BENCH_PARSE_NUMBER_OF_STRINGS )
+		 / nano_seconds_per_string * 1000000000.0 / ( 1024.0 * 1024.0 ) );
+	}
+	if( libfdatetime_filetime_free(
+	     &filetime,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free FILETIME.\n" );
+
+		goto on_error;
+	}
+	free(
+	 utf8_string_lengths );
+	free(
+	 utf8_strings );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( utf8_string_lengths != NULL )
+	{
+		free(
+		 utf8_string_lengths );
+	}
+	if( utf8_strings != NULL )
+	{
+		free(
+		 utf8_strings );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,395 @@
+/*
+ * Benchmark of the FILETIME carving scan
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define HAVE_FDATETIME_BENCH_SCAN_MMAP
+#endif
+
+#include "fdatetime_bench_libcerror.h"
+#include "fdatetime_bench_libfdatetime.h"
+#include "fdatetime_bench_timer.h"
+
+/* The size of the buffer with pseudo random data
+ */
+#define FDATETIME_BENCH_SCAN_BUFFER_SIZE		( 64 * 1024 * 1024 )
+
+/* The interval of the FILETIME values in the buffer with pseudo random data
+ */
+#define FDATETIME_BENCH_SCAN_VALUE_INTERVAL		4096
+
+/* The number of offsets retrieved per scan
+ */
+#define FDATETIME_BENCH_SCAN_NUMBER_OF_OFFSETS		4096
+
+/* The number of times each benchmark is repeated, the fastest repetition is reported
+ */
+#define FDATETIME_BENCH_SCAN_NUMBER_OF_REPETITIONS	5
+
+/* The range of years of the FILETIME values that are carved
+ */
+#define FDATETIME_BENCH_SCAN_MINIMUM_YEAR		1980
+#define FDATETIME_BENCH_SCAN_MAXIMUM_YEAR		2030
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint64_t fdatetime_bench_scan_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Runs the benchmark with a specific alignment
+ * The scan is resumed until the end of the buffer every time the offsets array is full
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_bench_scan_run(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t alignment,
+     size_t *offsets,
+     size_t *number_of_candidates,
+     double *mebibytes_per_second,
+     libfdatetime_error_t **error )
+{
+	size_t buffer_offset     = 0;
+	size_t number_of_offsets = 0;
+	size_t scanned_size      = 0;
+	uint64_t elapsed_time    = 0;
+	uint64_t end_time        = 0;
+	uint64_t minimum_time    = 0;
+	uint64_t start_time      = 0;
+	int repetition_index     = 0;
+
+	for( repetition_index = 0;
+	     repetition_index < FDATETIME_BENCH_SCAN_NUMBER_OF_REPETITIONS;
+	     repetition_index++ )
+	{
+		*number_of_candidates = 0;
+		buffer_offset         = 0;
+
+		start_time = fdatetime_bench_timer_get_nano_seconds();
+
+		while( buffer_offset < buffer_size )
+		{
+			if( libfdatetime_scan_filetimes(
+			     &( buffer[ buffer_offset ] ),
+			     buffer_size - buffer_offset,
+			     alignment,
+			     FDATETIME_BENCH_SCAN_MINIMUM_YEAR,
+			     FDATETIME_BENCH_SCAN_MAXIMUM_YEAR,
+			     offsets,
+			     FDATETIME_BENCH_SCAN_NUMBER_OF_OFFSETS,
+			     &number_of_offsets,
+			     &scanned_size,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			*number_of_candidates += number_of_offsets;
+			buffer_offset         += scanned_size;
+		}
+		end_time     = fdatetime_bench_timer_get_nano_seconds();
+		elapsed_time = end_time - start_time;
+
+		if( ( repetition_index == 0 )
+		 || ( elapsed_time < minimum_time ) )
+		{
+			minimum_time = elapsed_time;
+		}
+	}
+	if( minimum_time == 0 )
+	{
+		minimum_time = 1;
+	}
+	*mebibytes_per_second = ( (double) buffer_size * 1000000000.0 ) / ( (double) minimum_time * 1024.0 * 1024.0 );
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	size_t alignments[ 3 ] = { 1, 4, 8 };
+
+	libfdatetime_error_t *error = NULL;
+	uint8_t *buffer             = NULL;
+	size_t *offsets             = NULL;
+	double mebibytes_per_second = 0.0;
+	uint64_t random_state       = 0x5eed12345678abcdULL;
+	uint64_t value_64bit        = 0;
+	size_t buffer_offset        = 0;
+	size_t buffer_size          = FDATETIME_BENCH_SCAN_BUFFER_SIZE;
+	size_t number_of_candidates = 0;
+	int alignment_index         = 0;
+	int number_of_alignments    = 3;
+
+#if defined( HAVE_FDATETIME_BENCH_SCAN_MMAP )
+	struct stat file_statistics;
+
+	int file_descriptor         = -1;
+#endif
+
+	if( argc > 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		alignments[ 0 ] = (size_t) wcstoul( argv[ 1 ], NULL, 10 );
+#else
+		alignments[ 0 ] = (size_t) strtoul( argv[ 1 ], NULL, 10 );
+#endif
+		if( ( alignments[ 0 ] == 0 )
+		 || ( alignments[ 0 ] > 4096 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid alignment.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		number_of_alignments = 1;
+	}
+	offsets = (size_t *) malloc(
+	                      sizeof( size_t ) * FDATETIME_BENCH_SCAN_NUMBER_OF_OFFSETS );
+
+	if( offsets == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create offsets.\n" );
+
+		goto on_error;
+	}
+	if( argc > 2 )
+	{
+		/* The image is mapped into memory and scanned in place
+		 */
+#if defined( HAVE_FDATETIME_BENCH_SCAN_MMAP )
+		file_descriptor = open(
+		                   argv[ 2 ],
+		                   O_RDONLY );
+
+		if( file_descriptor == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open file: %s.\n",
+			 argv[ 2 ] );
+
+			goto on_error;
+		}
+		if( ( fstat(
+		       file_descriptor,
+		       &file_statistics ) != 0 )
+		 || ( file_statistics.st_size <= 0 )
+		 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported file size.\n" );
+
+			goto on_error;
+		}
+		buffer_size = (size_t) file_statistics.st_size;
+
+		buffer = (uint8_t *) mmap(
+		                      NULL,
+		                      buffer_size,
+		                      PROT_READ,
+		                      MAP_PRIVATE,
+		                      file_descriptor,
+		                      0 );
+
+		if( buffer == (uint8_t *) MAP_FAILED )
+		{
+			buffer = NULL;
+
+			fprintf(
+			 stderr,
+			 "Unable to map file: %s.\n",
+			 argv[ 2 ] );
+
+			goto on_error;
+		}
+#else
+		fprintf(
+		 stderr,
+		 "Mapping a file into memory is not supported.\n" );
+
+		goto on_error;
+#endif
+	}
+	else
+	{
+		buffer = (uint8_t *) malloc(
+		                      buffer_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		/* Pseudo random data with a FILETIME of the range of years at every interval
+		 */
+		for( buffer_offset = 0;
+		     buffer_offset < buffer_size;
+		     buffer_offset += 8 )
+		{
+			value_64bit = fdatetime_bench_scan_get_random_value(
+			               &random_state );
+
+			if( ( buffer_offset % FDATETIME_BENCH_SCAN_VALUE_INTERVAL ) == 0 )
+			{
+				/* FILETIME values between 2001 and 2007
+				 */
+				value_64bit = 0x01c1000000000000ULL + ( value_64bit & 0x0007ffffffffffffULL );
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 value_64bit );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "%10s %12s %12s\n",
+	 "alignment",
+	 "candidates",
+	 "MiB/s" );
+
+	for( alignment_index = 0;
+	     alignment_index < number_of_alignments;
+	     alignment_index++ )
+	{
+		if( fdatetime_bench_scan_run(
+		     buffer,
+		     buffer_size,
+		     alignments[ alignment_index ],
+		     offsets,
+		     &number_of_candidates,
+		     &mebibytes_per_second,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark with alignment: %" PRIzu ".\n",
+			 alignments[ alignment_index ] );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "%10" PRIzu " %12" PRIzu " %12.1f\n",
+		 alignments[ alignment_index ],
+		 number_of_candidates,
+		 mebibytes_per_second );
+	}
+#if defined( HAVE_FDATETIME_BENCH_SCAN_MMAP )
+	if( file_descriptor != -1 )
+	{
+		munmap(
+		 buffer,
+		 buffer_size );
+		close(
+		 file_descriptor );
+	}
+	else
+#endif
+	{
+		free(
+		 buffer );
+	}
+	free(
+	 offsets );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libfdatetime_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libfdatetime_error_free(
+		 &error );
+	}
+#if defined( HAVE_FDATETIME_BENCH_SCAN_MMAP )
+	if( file_descriptor != -1 )
+	{
+		if( buffer != NULL )
+		{
+			munmap(
+			 buffer,
+			 buffer_size );
+		}
+		close(
+		 file_descriptor );
+	}
+	else
+#endif
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
+	if( offsets != NULL )
+	{
+		free(
+		 offsets );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1127 @@
+/*
+ * Optional C++ interface of the library
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_HPP )
+#define _LIBFDATETIME_HPP
+
+#if !defined( __cplusplus ) || ( ( __cplusplus < 201402L ) && ( !defined( _MSVC_LANG ) || ( _MSVC_LANG < 201402L ) ) )
+#error libfdatetime.hpp requires C++14 or later
+#endif
+
+#include <libfdatetime/definitions.h>
+#include <libfdatetime/types.h>
+
+#include <stddef.h>
+
+#include <string>
+
+/* The C++ interface is header-only and does not depend on the library
+ * binary. The value types decode and format the timestamps with the
+ * same algorithms as the C functions, such that the strings are identical
+ * byte for byte, but the decoding is constexpr and the string format flags
+ * are template parameters, so the flag checks are resolved at compile time.
+ *
+ * Example:
+ *   constexpr fdatetime::filetime filetime( 0x01cb3a623d0a17ceULL );
+ *
+ *   constexpr auto string = filetime.to_string_buffer<
+ *    LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS >();
+ */
+namespace fdatetime
+{
+
+/* The date and time values
+ */
+struct date_time_values
+{
+	/* The year
+	 */
+	uint16_t year = 0;
+
+	/* The month
+	 */
+	uint8_t month = 0;
+
+	/* The day
+	 */
+	uint8_t day = 0;
+
+	/* The hours
+	 */
+	uint8_t hours = 0;
+
+	/* The minutes
+	 */
+	uint8_t minutes = 0;
+
+	/* The seconds
+	 */
+	uint8_t seconds = 0;
+
+	/* The milli seconds
+	 */
+	uint16_t milli_seconds = 0;
+
+	/* The micro seconds
+	 */
+	uint16_t micro_seconds = 0;
+
+	/* The nano seconds
+	 */
+	uint16_t nano_seconds = 0;
+};
+
+/* A fixed size string buffer that can be created in a constant expression
+ */
+template<typename CharType, size_t Size>
+struct basic_string_buffer
+{
+	/* The string including the end of string character
+	 */
+	CharType data[ Size ] = {};
+
+	/* The string length without the end of string character
+	 */
+	size_t length = 0;
+
+	constexpr const CharType *c_str(
+	                           void ) const noexcept
+	{
+		return( data );
+	}
+
+	constexpr size_t size(
+	                  void ) const noexcept
+	{
+		return( length );
+	}
+
+	std::basic_string<CharType> str(
+	                             void ) const
+	{
+		return( std::basic_string<CharType>( data, length ) );
+	}
+};
+
+namespace detail
+{
+
+/* Determines if the year is a leap year
+ * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+ */
+constexpr bool is_leap_year(
+                uint16_t year ) noexcept
+{
+	return( ( ( ( year % 4 ) == 0 )
+	      &&  ( ( year % 100 ) != 0 ) )
+	     || ( ( year % 400 ) == 0 ) );
+}
+
+/* Retrieves the number of days in the month
+ * Returns 0 if the month is not supported
+ */
+constexpr uint8_t get_days_in_month(
+                   uint16_t year,
+                   uint8_t month ) noexcept
+{
+	return( ( month == 2 ) ? ( is_leap_year( year ) ? 29 : 28 )
+	      : ( ( month == 4 ) || ( month == 6 ) || ( month == 9 ) || ( month == 11 ) ) ? 30
+	      : ( ( month >= 1 ) && ( month <= 12 ) ) ? 31 : 0 );
+}
+
+/* The string format flags resolved at compile time
+ */
+template<uint32_t StringFormatFlags>
+struct string_format
+{
+	static constexpr uint32_t type = StringFormatFlags & 0x000000ffUL;
+
+	static constexpr bool is_ctime = ( type == LIBFDATETIME_STRING_FORMAT_TYPE_CTIME );
+
+	static constexpr bool has_date = ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_DATE ) != 0;
+
+	static constexpr bool has_time = ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME ) != 0;
+
+	static constexpr bool has_nano_seconds = has_time
+	                                      && ( ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS ) != 0 );
+
+	static constexpr bool has_micro_seconds = has_nano_seconds
+	                                       || ( has_time
+	                                        &&  ( ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS ) != 0 ) );
+
+	static constexpr bool has_milli_seconds = has_micro_seconds
+	                                       || ( has_time
+	                                        &&  ( ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS ) != 0 ) );
+
+	static constexpr bool has_timezone_indicator = ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) != 0;
+
+	/* The string size including the end of string character
+	 */
+	static constexpr size_t string_size = 1
+	                                    + ( has_date ? ( is_ctime ? 12 : 10 ) : 0 )
+	                                    + ( ( has_date && has_time ) ? 1 : 0 )
+	                                    + ( has_time ? 8 : 0 )
+	                                    + ( has_milli_seconds ? 4 : 0 )
+	                                    + ( has_micro_seconds ? 3 : 0 )
+	                                    + ( has_nano_seconds ? 3 : 0 )
+	                                    + ( has_timezone_indicator ? ( is_ctime ? 4 : 1 ) : 0 );
+
+	static_assert(
+	 ( type == LIBFDATETIME_STRING_FORMAT_TYPE_CTIME )
+	 || ( type == LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 ),
+	 "unsupported string format type" );
+
+	static_assert(
+	 ( StringFormatFlags & LIBFDATETIME_STRING_FORMAT_FLAG_DURATION ) == 0,
+	 "unsupported string format flag: duration" );
+};
+
+/* Determines if the date and time values can be represented with the string format flags
+ */
+template<uint32_t StringFormatFlags>
+constexpr bool date_time_values_are_valid(
+                const date_time_values &values ) noexcept
+{
+	using format = string_format<StringFormatFlags>;
+
+	if( format::has_date )
+	{
+		if( ( values.year > 9999 )
+		 || ( values.day == 0 )
+		 || ( values.day > get_days_in_month( values.year, values.month ) ) )
+		{
+			return( false );
+		}
+	}
+	if( format::has_time )
+	{
+		if( ( values.hours > 23 )
+		 || ( values.minutes > 59 )
+		 || ( values.seconds > 59 ) )
+		{
+			return( false );
+		}
+		if( format::has_milli_seconds
+		 && ( values.milli_seconds > 999 ) )
+		{
+			return( false );
+		}
+		if( format::has_micro_seconds
+		 && ( values.micro_seconds > 999 ) )
+		{
+			return( false );
+		}
+		if( format::has_nano_seconds
+		 && ( values.nano_seconds > 999 ) )
+		{
+			return( false );
+		}
+	}
+	return( true );
+}
+
+/* Copies a 2 digit decimal value into a string
+ */
+template<typename CharType>
+constexpr void copy_decimal_2digits(
+                CharType *string,
+                size_t &string_index,
+                uint16_t value ) noexcept
+{
+	string[ string_index++ ] = (CharType) ( '0' + ( value / 10 ) );
+	string[ string_index++ ] = (CharType) ( '0' + ( value % 10 ) );
+}
+
+/* Copies a 3 digit decimal value into a string
+ */
+template<typename CharType>
+constexpr void copy_decimal_3digits(
+                CharType *string,
+                size_t &string_index,
+                uint16_t value ) noexcept
+{
+	string[ string_index++ ] = (CharType) ( '0' + ( ( value / 100 ) % 10 ) );
+	string[ string_index++ ] = (CharType) ( '0' + ( ( value / 10 ) % 10 ) );
+	string[ string_index++ ] = (CharType) ( '0' + ( value % 10 ) );
+}
+
+/* Copies a 4 digit decimal value into a string
+ */
+template<typename CharType>
+constexpr void copy_decimal_4digits(
+                CharType *string,
+                size_t &string_index,
+                uint16_t value ) noexcept
+{
+	string[ string_index++ ] = (CharType) ( '0' + ( value / 1000 ) );
+	string[ string_index++ ] = (CharType) ( '0' + ( ( value / 100 ) % 10 ) );
+	string[ string_index++ ] = (CharType) ( '0' + ( ( value / 10 ) % 10 ) );
+	string[ string_index++ ] = (CharType) ( '0' + ( value % 10 ) );
+}
+
+/* Copies the date and time values into a string
+ * The string must be able to hold string_format<StringFormatFlags>::string_size characters
+ * and the date and time values must be valid
+ * Returns the number of characters written including the end of string character
+ */
+template<uint32_t StringFormatFlags, typename CharType>
+constexpr size_t copy_date_time_values_to_string(
+                  const date_time_values &values,
+                  CharType *string ) noexcept
+{
+	using format = string_format<StringFormatFlags>;
+
+	const char month_strings[ 12 ][ 4 ] = {
+		"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+		"Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+	size_t string_index = 0;
+
+	if( format::has_date )
+	{
+		if( format::is_ctime )
+		{
+			/* Format: mmm dd, yyyy */
+			string[ string_index++ ] = (CharType) month_strings[ values.month - 1 ][ 0 ];
+			string[ string_index++ ] = (CharType) month_strings[ values.month - 1 ][ 1 ];
+			string[ string_index++ ] = (CharType) month_strings[ values.month - 1 ][ 2 ];
+			string[ string_index++ ] = (CharType) ' ';
+
+			copy_decimal_2digits( string, string_index, values.day );
+
+			string[ string_index++ ] = (CharType) ',';
+			string[ string_index++ ] = (CharType) ' ';
+
+			copy_decimal_4digits( string, string_index, values.year );
+		}
+		else
+		{
+			/* Format: yyyy-mm-dd */
+			copy_decimal_4digits( string, string_index, values.year );
+
+			string[ string_index++ ] = (CharType) '-';
+
+			copy_decimal_2digits( string, string_index, values.month );
+
+			string[ string_index++ ] = (CharType) '-';
+
+			copy_decimal_2digits( string, string_index, values.day );
+		}
+		if( format::has_time )
+		{
+			string[ string_index++ ] = (CharType) ( format::is_ctime ? ' ' : 'T' );
+		}
+	}
+	if( format::has_time )
+	{
+		/* Format: HH:MM:SS */
+		copy_decimal_2digits( string, string_index, values.hours );
+
+		string[ string_index++ ] = (CharType) ':';
+
+		copy_decimal_2digits( string, string_index, values.minutes );
+
+		string[ string_index++ ] = (CharType) ':';
+
+		copy_decimal_2digits( string, string_index, values.seconds );
+
+		if( format::has_milli_seconds )
+		{
+			/* Format: .### */
+			string[ string_index++ ] = (CharType) '.';
+
+			copy_decimal_3digits( string, string_index, values.milli_seconds );
+		}
+		if( format::has_micro_seconds )
+		{
+			copy_decimal_3digits( string, string_index, values.micro_seconds );
+		}
+		if( format::has_nano_seconds )
+		{
+			copy_decimal_3digits( string, string_index, values.nano_seconds );
+		}
+	}
+	if( format::has_timezone_indicator )
+	{
+		if( format::is_ctime )
+		{
+			string[ string_index++ ] = (CharType) ' ';
+			string[ string_index++ ] = (CharType) 'U';
+			string[ string_index++ ] = (CharType) 'T';
+			string[ string_index++ ] = (CharType) 'C';
+		}
+		else
+		{
+			string[ string_index++ ] = (CharType) 'Z';
+		}
+	}
+	string[ string_index++ ] = 0;
+
+	return( string_index );
+}
+
+/* Copies hexadecimal digits of a value into a string
+ */
+template<typename CharType>
+constexpr void copy_hexadecimal_digits(
+                CharType *string,
+                size_t &string_index,
+                uint64_t value,
+                int number_of_digits ) noexcept
+{
+	uint8_t byte_value = 0;
+	int byte_shift     = ( number_of_digits - 1 ) * 4;
+
+	string[ string_index++ ] = (CharType) '0';
+	string[ string_index++ ] = (CharType) 'x';
+
+	while( byte_shift >= 0 )
+	{
+		byte_value = (uint8_t) ( ( value >> byte_shift ) & 0x0f );
+
+		if( byte_value <= 9 )
+		{
+			string[ string_index++ ] = (CharType) ( '0' + byte_value );
+		}
+		else
+		{
+			string[ string_index++ ] = (CharType) ( 'a' + byte_value - 10 );
+		}
+		byte_shift -= 4;
+	}
+}
+
+constexpr size_t maximum_size(
+                  size_t size1,
+                  size_t size2 ) noexcept
+{
+	return( ( size1 > size2 ) ? size1 : size2 );
+}
+
+/* Base of the timestamp value types
+ * The TimestampType must provide:
+ *   static constexpr size_t hexadecimal_string_size
+ *   constexpr bool is_valid( void ) const
+ *   constexpr bool copy_to_date_time_values( date_time_values &values ) const
+ *   template<typename CharType> constexpr size_t copy_to_string_in_hexadecimal( CharType *string ) const
+ */
+template<typename TimestampType>
+class timestamp_base
+{
+public:
+	/* Retrieves the maximum size of the string for the string format flags
+	 * The string size includes the end of string character
+	 */
+	template<uint32_t StringFormatFlags>
+	static constexpr size_t get_maximum_string_size(
+	                         void ) noexcept
+	{
+		return( maximum_size(
+		         string_format<StringFormatFlags>::string_size,
+		         TimestampType::hexadecimal_string_size ) );
+	}
+
+	/* Converts the timestamp into a string buffer
+	 * If the timestamp cannot be represented as a date and time the hexadecimal
+	 * representation is used, as with the C functions
+	 * The string buffer is empty if the timestamp is invalid
+	 */
+	template<uint32_t StringFormatFlags, typename CharType = char>
+	constexpr basic_string_buffer<CharType, get_maximum_string_size<StringFormatFlags>()> to_string_buffer(
+	                                                                                       void ) const noexcept
+	{
+		basic_string_buffer<CharType, get_maximum_string_size<StringFormatFlags>()> string_buffer;
+		date_time_values values;
+
+		const TimestampType &timestamp = static_cast<const TimestampType &>( *this );
+
+		if( !timestamp.is_valid() )
+		{
+			return( string_buffer );
+		}
+		if( timestamp.copy_to_date_time_values( values )
+		 && date_time_values_are_valid<StringFormatFlags>( values ) )
+		{
+			string_buffer.length = copy_date_time_values_to_string<StringFormatFlags>(
+			                        values,
+			                        string_buffer.data ) - 1;
+		}
+		else
+		{
+			string_buffer.length = timestamp.copy_to_string_in_hexadecimal(
+			                        string_buffer.data ) - 1;
+		}
+		return( string_buffer );
+	}
+
+	/* Converts the timestamp into a string
+	 * The string size should include the end of string character
+	 * Returns the number of characters written including the end of string character
+	 * or 0 if the timestamp is invalid or the string is too small
+	 */
+	template<uint32_t StringFormatFlags, typename CharType>
+	constexpr size_t copy_to_string(
+	                  CharType *string,
+	                  size_t string_size ) const noexcept
+	{
+		const basic_string_buffer<CharType, get_maximum_string_size<StringFormatFlags>()> string_buffer = to_string_buffer<StringFormatFlags, CharType>();
+
+		size_t string_index = 0;
+
+		if( ( string == nullptr )
+		 || ( string_size <= string_buffer.length )
+		 || !static_cast<const TimestampType &>( *this ).is_valid() )
+		{
+			return( 0 );
+		}
+		for( string_index = 0;
+		     string_index <= string_buffer.length;
+		     string_index++ )
+		{
+			string[ string_index ] = string_buffer.data[ string_index ];
+		}
+		return( string_index );
+	}
+
+	/* Converts the timestamp into a string
+	 */
+	template<uint32_t StringFormatFlags, typename CharType = char>
+	std::basic_string<CharType> to_string(
+	                             void ) const
+	{
+		return( to_string_buffer<StringFormatFlags, CharType>().str() );
+	}
+};
+
+} /* namespace detail */
+
+/* FILETIME
+ * The timestamp is a 64-bit value containing the number of 100th nano seconds since 1601-01-01 00:00:00
+ */
+class filetime : public detail::timestamp_base<filetime>
+{
+public:
+	/* The size of the string in hexadecimal representation: (0x%08x 0x%08x)
+	 */
+	static constexpr size_t hexadecimal_string_size = 24;
+
+	constexpr filetime(
+	           void ) noexcept
+		: timestamp( 0 )
+	{
+	}
+
+	constexpr explicit filetime(
+	                    uint64_t value_64bit ) noexcept
+		: timestamp( value_64bit )
+	{
+	}
+
+	/* Converts a byte stream into a FILETIME
+	 * The byte stream must contain at least 8 bytes
+	 */
+	static constexpr filetime from_byte_stream(
+	                           const uint8_t *byte_stream,
+	                           int byte_order ) noexcept
+	{
+		uint64_t value_64bit = 0;
+		int byte_index       = 0;
+
+		for( byte_index = 0;
+		     byte_index < 8;
+		     byte_index++ )
+		{
+			if( byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+			{
+				value_64bit |= (uint64_t) byte_stream[ byte_index ] << ( byte_index * 8 );
+			}
+			else
+			{
+				value_64bit <<= 8;
+				value_64bit  |= byte_stream[ byte_index ];
+			}
+		}
+		return( filetime( value_64bit ) );
+	}
+
+	constexpr uint64_t get_value(
+	                    void ) const noexcept
+	{
+		return( timestamp );
+	}
+
+	/* Determines if the FILETIME is valid, every value is supported
+	 */
+	constexpr bool is_valid(
+	                void ) const noexcept
+	{
+		return( true );
+	}
+
+	/* Converts the FILETIME into date time values
+	 * Returns true if successful or false if the FILETIME cannot be represented
+	 */
+	constexpr bool copy_to_date_time_values(
+	                date_time_values &values ) const noexcept
+	{
+		uint64_t filetimestamp   = timestamp;
+		uint32_t days_in_century = 0;
+		uint16_t days_in_year    = 0;
+		uint8_t days_in_month    = 0;
+
+		/* The timestamp is in units of 100 nano seconds correct the value to seconds
+		 */
+		values.nano_seconds = (uint16_t) ( ( filetimestamp % 10 ) * 100 );
+		filetimestamp      /= 10;
+
+		values.micro_seconds = (uint16_t) ( filetimestamp % 1000 );
+		filetimestamp       /= 1000;
+
+		values.milli_seconds = (uint16_t) ( filetimestamp % 1000 );
+		filetimestamp       /= 1000;
+
+		values.seconds = (uint8_t) ( filetimestamp % 60 );
+		filetimestamp /= 60;
+
+		values.minutes = (uint8_t) ( filetimestamp % 60 );
+		filetimestamp /= 60;
+
+		values.hours   = (uint8_t) ( filetimestamp % 24 );
+		filetimestamp /= 24;
+
+		/* Add 1 day to compensate that Jan 1 1601 is represented as 0
+		 */
+		filetimestamp += 1;
+
+		values.year = 1601;
+
+		if( filetimestamp > 36159 )
+		{
+			values.year = 1700;
+
+			filetimestamp -= 36159;
+		}
+		while( filetimestamp > 0 )
+		{
+			days_in_century = ( ( values.year % 400 ) == 0 ) ? 36525 : 36524;
+
+			if( filetimestamp <= days_in_century )
+			{
+				break;
+			}
+			filetimestamp -= days_in_century;
+
+			values.year = (uint16_t) ( values.year + 100 );
+		}
+		while( filetimestamp > 0 )
+		{
+			days_in_year = detail::is_leap_year( values.year ) ? 366 : 365;
+
+			if( filetimestamp <= days_in_year )
+			{
+				break;
+			}
+			filetimestamp -= days_in_year;
+
+			values.year = (uint16_t) ( values.year + 1 );
+		}
+		if( values.year > 9999 )
+		{
+			return( false );
+		}
+		values.month = 1;
+
+		while( filetimestamp > 0 )
+		{
+			days_in_month = detail::get_days_in_month( values.year, values.month );
+
+			if( days_in_month == 0 )
+			{
+				return( false );
+			}
+			if( filetimestamp <= days_in_month )
+			{
+				break;
+			}
+			filetimestamp -= days_in_month;
+
+			values.month += 1;
+		}
+		values.day = (uint8_t) filetimestamp;
+
+		return( true );
+	}
+
+	/* Converts the FILETIME into a string in hexadecimal representation
+	 * Returns the number of characters written including the end of string character
+	 */
+	template<typename CharType>
+	constexpr size_t copy_to_string_in_hexadecimal(
+	                  CharType *string ) const noexcept
+	{
+		size_t string_index = 0;
+
+		string[ string_index++ ] = (CharType) '(';
+
+		detail::copy_hexadecimal_digits( string, string_index, timestamp >> 32, 8 );
+
+		string[ string_index++ ] = (CharType) ' ';
+
+		detail::copy_hexadecimal_digits( string, string_index, timestamp & 0xffffffffUL, 8 );
+
+		string[ string_index++ ] = (CharType) ')';
+		string[ string_index++ ] = 0;
+
+		return( string_index );
+	}
+
+private:
+	/* The timestamp
+	 */
+	uint64_t timestamp;
+};
+
+/* POSIX time
+ * The ValueType is one of the LIBFDATETIME_POSIX_TIME_VALUE_TYPE_* definitions
+ */
+template<uint8_t ValueType>
+class posix_time : public detail::timestamp_base<posix_time<ValueType>>
+{
+	static_assert(
+	 ( ValueType >= LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 && ( ValueType <= LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ),
+	 "unsupported POSIX time value type" );
+
+public:
+	static constexpr bool is_32bit = ( ValueType == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	                              || ( ValueType == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED );
+
+	static constexpr bool has_micro_seconds = ( ValueType >= LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED );
+
+	static constexpr bool has_nano_seconds = ( ValueType >= LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED );
+
+	static constexpr bool is_signed = ( ValueType == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	                               || ( ValueType == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+	                               || ( ValueType == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	                               || ( ValueType == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED );
+
+	/* The size of the string in hexadecimal representation: (0x%08x) or (0x%016x)
+	 */
+	static constexpr size_t hexadecimal_string_size = is_32bit ? 13 : 21;
+
+	constexpr posix_time(
+	           void ) noexcept
+		: timestamp( 0 )
+	{
+	}
+
+	/* Creates a POSIX time, 32-bit values are stored without sign extension
+	 */
+	constexpr explicit posix_time(
+	                    uint64_t value ) noexcept
+		: timestamp( is_32bit ? ( value & 0xffffffffUL ) : value )
+	{
+	}
+
+	/* Converts a byte stream into a POSIX time
+	 * The byte stream must contain at least 4 bytes for 32-bit and 8 bytes for 64-bit value types
+	 */
+	static constexpr posix_time from_byte_stream(
+	                             const uint8_t *byte_stream,
+	                             int byte_order ) noexcept
+	{
+		uint64_t value_64bit = 0;
+		int byte_index       = 0;
+		int byte_size        = is_32bit ? 4 : 8;
+
+		for( byte_index = 0;
+		     byte_index < byte_size;
+		     byte_index++ )
+		{
+			if( byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+			{
+				value_64bit |= (uint64_t) byte_stream[ byte_index ] << ( byte_index * 8 );
+			}
+			else
+			{
+				value_64bit <<= 8;
+				value_64bit  |= byte_stream[ byte_index ];
+			}
+		}
+		return( posix_time( value_64bit ) );
+	}
+
+	constexpr uint64_t get_value(
+	                    void ) const noexcept
+	{
+		return( timestamp );
+	}
+
+	/* Determines if the POSIX time is valid
+	 * As with the C functions the minimum value of a signed value type,
+	 * a 32-bit value of 0x80000000 or a 64-bit value of 0x8000000000000000,
+	 * is not supported
+	 */
+	constexpr bool is_valid(
+	                void ) const noexcept
+	{
+		return( !is_signed
+		     || ( timestamp != ( is_32bit ? 0x80000000UL : 0x8000000000000000ULL ) ) );
+	}
+
+	/* Converts the POSIX time into date time values
+	 * Returns true if successful or false if the POSIX time is invalid or cannot be represented
+	 */
+	constexpr bool copy_to_date_time_values(
+	                date_time_values &values ) const noexcept
+	{
+		int64_t number_of_days          = 0;
+		int64_t number_of_eras          = 0;
+		int64_t number_of_seconds       = 0;
+		int64_t remainder               = 0;
+		int64_t seconds_in_day          = 0;
+		int64_t units_per_second        = has_nano_seconds ? 1000000000 : ( has_micro_seconds ? 1000000 : 1 );
+		uint64_t posix_timestamp        = 0;
+		uint32_t days_in_century        = 0;
+		uint32_t number_of_nano_seconds = 0;
+		uint16_t days_in_year           = 0;
+		uint8_t days_in_month           = 0;
+
+		if( !is_valid() )
+		{
+			return( false );
+		}
+		/* The number of seconds is rounded down for timestamps before Jan 1, 1970
+		 * hence the remaining number of nano seconds is never negative
+		 */
+		if( is_32bit )
+		{
+			number_of_seconds = is_signed ? (int64_t) (int32_t) timestamp : (int64_t) timestamp;
+		}
+		else if( is_signed )
+		{
+			number_of_seconds = (int64_t) timestamp / units_per_second;
+			remainder         = (int64_t) timestamp % units_per_second;
+
+			if( remainder < 0 )
+			{
+				number_of_seconds -= 1;
+				remainder         += units_per_second;
+			}
+		}
+		else
+		{
+			if( ( units_per_second == 1 )
+			 && ( timestamp > (uint64_t) INT64_MAX ) )
+			{
+				return( false );
+			}
+			number_of_seconds = (int64_t) ( timestamp / (uint64_t) units_per_second );
+			remainder         = (int64_t) ( timestamp % (uint64_t) units_per_second );
+		}
+		number_of_nano_seconds = (uint32_t) ( remainder * ( 1000000000 / units_per_second ) );
+
+		values.nano_seconds    = (uint16_t) ( number_of_nano_seconds % 1000 );
+		number_of_nano_seconds /= 1000;
+		values.micro_seconds   = (uint16_t) ( number_of_nano_seconds % 1000 );
+		values.milli_seconds   = (uint16_t) ( number_of_nano_seconds / 1000 );
+
+		number_of_days = number_of_seconds / 86400;
+		seconds_in_day = number_of_seconds % 86400;
+
+		if( seconds_in_day < 0 )
+		{
+			number_of_days -= 1;
+			seconds_in_day += 86400;
+		}
+		/* Jan 1, 0000 is day -719528 and Jan 1, 10000 is day 2932897
+		 */
+		if( ( number_of_days < -719528 )
+		 || ( number_of_days >= 2932897 ) )
+		{
+			return( false );
+		}
+		values.seconds  = (uint8_t) ( seconds_in_day % 60 );
+		seconds_in_day /= 60;
+		values.minutes  = (uint8_t) ( seconds_in_day % 60 );
+		seconds_in_day /= 60;
+		values.hours    = (uint8_t) seconds_in_day;
+
+		/* The Gregorian calendar repeats every 400 years (146097 days)
+		 * Jan 1, 2000 is day 10957
+		 */
+		number_of_days -= 10957;
+
+		if( number_of_days >= 0 )
+		{
+			number_of_eras = number_of_days / 146097;
+		}
+		else
+		{
+			number_of_eras = ( number_of_days - 146096 ) / 146097;
+		}
+		posix_timestamp = (uint64_t) ( number_of_days - ( number_of_eras * 146097 ) );
+		values.year     = (uint16_t) ( 2000 + ( number_of_eras * 400 ) );
+
+		while( posix_timestamp > 0 )
+		{
+			days_in_century = ( ( values.year % 400 ) == 0 ) ? 36525 : 36524;
+
+			if( posix_timestamp < days_in_century )
+			{
+				break;
+			}
+			posix_timestamp -= days_in_century;
+
+			values.year = (uint16_t) ( values.year + 100 );
+		}
+		while( posix_timestamp > 0 )
+		{
+			days_in_year = detail::is_leap_year( values.year ) ? 366 : 365;
+
+			if( posix_timestamp < days_in_year )
+			{
+				break;
+			}
+			posix_timestamp -= days_in_year;
+
+			values.year = (uint16_t) ( values.year + 1 );
+		}
+		/* Add 1 day to compensate that Jan 1 is represented as 0
+		 */
+		posix_timestamp += 1;
+
+		values.month = 1;
+
+		do
+		{
+			days_in_month = detail::get_days_in_month( values.year, values.month );
+
+			if( days_in_month == 0 )
+			{
+				return( false );
+			}
+			if( posix_timestamp <= days_in_month )
+			{
+				break;
+			}
+			posix_timestamp -= days_in_month;
+
+			values.month = (uint8_t) ( values.month + 1 );
+		}
+		while( posix_timestamp > 0 );
+
+		values.day = (uint8_t) posix_timestamp;
+
+		return( true );
+	}
+
+	/* Converts the POSIX time into a string in hexadecimal representation
+	 * Returns the number of characters written including the end of string character
+	 */
+	template<typename CharType>
+	constexpr size_t copy_to_string_in_hexadecimal(
+	                  CharType *string ) const noexcept
+	{
+		size_t string_index = 0;
+
+		string[ string_index++ ] = (CharType) '(';
+
+		detail::copy_hexadecimal_digits( string, string_index, timestamp, is_32bit ? 8 : 16 );
+
+		string[ string_index++ ] = (CharType) ')';
+		string[ string_index++ ] = 0;
+
+		return( string_index );
+	}
+
+private:
+	/* The timestamp
+	 */
+	uint64_t timestamp;
+};
+
+/* HFS time
+ * The timestamp is a 32-bit value containing the number of seconds since 1904-01-01 00:00:00
+ */
+class hfs_time : public detail::timestamp_base<hfs_time>
+{
+public:
+	/* The size of the string in hexadecimal representation: (0x%08x)
+	 */
+	static constexpr size_t hexadecimal_string_size = 13;
+
+	constexpr hfs_time(
+	           void ) noexcept
+		: timestamp( 0 )
+	{
+	}
+
+	constexpr explicit hfs_time(
+	                    uint32_t value_32bit ) noexcept
+		: timestamp( value_32bit )
+	{
+	}
+
+	/* Converts a byte stream into a HFS time
+	 * The byte stream must contain at least 4 bytes
+	 */
+	static constexpr hfs_time from_byte_stream(
+	                           const uint8_t *byte_stream,
+	                           int byte_order ) noexcept
+	{
+		uint32_t value_32bit = 0;
+		int byte_index       = 0;
+
+		for( byte_index = 0;
+		     byte_index < 4;
+		     byte_index++ )
+		{
+			if( byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+			{
+				value_32bit |= (uint32_t) byte_stream[ byte_index ] << ( byte_index * 8 );
+			}
+			else
+			{
+				value_32bit <<= 8;
+				value_32bit  |= byte_stream[ byte_index ];
+			}
+		}
+		return( hfs_time( value_32bit ) );
+	}
+
+	constexpr uint32_t get_value(
+	                    void ) const noexcept
+	{
+		return( timestamp );
+	}
+
+	/* Determines if the HFS time is valid, every value is supported
+	 */
+	constexpr bool is_valid(
+	                void ) const noexcept
+	{
+		return( true );
+	}
+
+	/* Converts the HFS time into date time values
+	 * Returns true if successful or false if the HFS time cannot be represented
+	 */
+	constexpr bool copy_to_date_time_values(
+	                date_time_values &values ) const noexcept
+	{
+		uint32_t hfs_timestamp = timestamp;
+		uint16_t days_in_year  = 0;
+		uint8_t days_in_month  = 0;
+
+		values.micro_seconds = 0;
+		values.milli_seconds = 0;
+		values.nano_seconds  = 0;
+
+		values.seconds = (uint8_t) ( hfs_timestamp % 60 );
+		hfs_timestamp /= 60;
+
+		values.minutes = (uint8_t) ( hfs_timestamp % 60 );
+		hfs_timestamp /= 60;
+
+		values.hours   = (uint8_t) ( hfs_timestamp % 24 );
+		hfs_timestamp /= 24;
+
+		/* Add 1 day to compensate that Jan 1, 1904 is represented as 0
+		 */
+		hfs_timestamp += 1;
+
+		values.year = 1904;
+
+		/* January 1, 2000 is day 35065 since January 1, 1904 is represented as day 1
+		 */
+		if( hfs_timestamp > 35064 )
+		{
+			values.year = 2000;
+
+			hfs_timestamp -= 35064;
+		}
+		while( hfs_timestamp > 0 )
+		{
+			days_in_year = detail::is_leap_year( values.year ) ? 366 : 365;
+
+			if( hfs_timestamp <= days_in_year )
+			{
+				break;
+			}
+			hfs_timestamp -= days_in_year;
+
+			values.year = (uint16_t) ( values.year + 1 );
+		}
+		values.month = 1;
+
+		do
+		{
+			days_in_month = detail::get_days_in_month( values.year, values.month );
+
+			if( days_in_month == 0 )
+			{
+				return( false );
+			}
+			if( hfs_timestamp <= days_in_month )
+			{
+				break;
+			}
+			hfs_timestamp -= days_in_month;
+
+			values.month += 1;
+		}
+		while( hfs_timestamp > 0 );
+
+		values.day = (uint8_t) hfs_timestamp;
+
+		return( true );
+	}
+
+	/* Converts the HFS time into a string in hexadecimal representation
+	 * Returns the number of characters written including the end of string character
+	 */
+	template<typename CharType>
+	constexpr size_t copy_to_string_in_hexadecimal(
+	                  CharType *string ) const noexcept
+	{
+		size_t string_index = 0;
+
+		string[ string_index++ ] = (CharType) '(';
+
+		detail::copy_hexadecimal_digits( string, string_index, timestamp, 8 );
+
+		string[ string_index++ ] = (CharType) ')';
+		string[ string_index++ ] = 0;
+
+		return( string_index );
+	}
+
+private:
+	/* The timestamp
+	 */
+	uint32_t timestamp;
+};
+
+} /* namespace fdatetime */
+
+#endif /* !defined( _LIBFDATETIME_HPP ) */
+
@@ -0,0 +1,1316 @@
+/*
+ * Batch conversion functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfdatetime_batch.h"
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_fat_date_time.h"
+#include "libfdatetime_filetime.h"
+#include "libfdatetime_floatingtime.h"
+#include "libfdatetime_hfs_time.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_nsf_timedate.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_systemtime.h"
+#include "libfdatetime_types.h"
+
+/* Creates a batch job
+ * Make sure the value batch_job is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_initialize(
+     libfdatetime_batch_job_t **batch_job,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_initialize";
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = memory_allocate_structure(
+	                      libfdatetime_internal_batch_job_t );
+
+	if( internal_batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch_job,
+	     0,
+	     sizeof( libfdatetime_internal_batch_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch job.",
+		 function );
+
+		memory_free(
+		 internal_batch_job );
+
+		return( -1 );
+	}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	if( pthread_mutex_init(
+	     &( internal_batch_job->mutex ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_batch_job->number_of_threads = 1;
+
+	*batch_job = (libfdatetime_batch_job_t *) internal_batch_job;
+
+	return( 1 );
+
+on_error:
+	if( internal_batch_job != NULL )
+	{
+		memory_free(
+		 internal_batch_job );
+	}
+	return( -1 );
+}
+
+/* Frees a batch job
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_free(
+     libfdatetime_batch_job_t **batch_job,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_free";
+	int result                                            = 1;
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_job != NULL )
+	{
+		internal_batch_job = (libfdatetime_internal_batch_job_t *) *batch_job;
+		*batch_job         = NULL;
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+		if( pthread_mutex_destroy(
+		     &( internal_batch_job->mutex ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_batch_job->failed_chunk_error != NULL )
+		{
+			libcerror_error_free(
+			 &( internal_batch_job->failed_chunk_error ) );
+		}
+		memory_free(
+		 internal_batch_job );
+	}
+	return( result );
+}
+
+/* Sets the input of a batch job
+ * The byte stream contains consecutive timestamp values of the same type
+ * The value type is only used by the POSIX time timestamp type and should be 0 otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_set_input(
+     libfdatetime_batch_job_t *batch_job,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int timestamp_type,
+     uint8_t value_type,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_set_input";
+	size_t value_size                                     = 0;
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = (libfdatetime_internal_batch_job_t *) batch_job;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBFDATETIME_ENDIAN_BIG )
+	 && ( byte_order != LIBFDATETIME_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			value_size = 4;
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			value_size = 8;
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			switch( value_type )
+			{
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED:
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED:
+					value_size = 4;
+					break;
+
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED:
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED:
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED:
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED:
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED:
+				case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED:
+					value_size = 8;
+					break;
+
+				default:
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported value type.",
+					 function );
+
+					return( -1 );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			value_size = 16;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timestamp type.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( byte_stream_size % value_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job->byte_stream      = byte_stream;
+	internal_batch_job->byte_stream_size = byte_stream_size;
+	internal_batch_job->timestamp_type   = timestamp_type;
+	internal_batch_job->value_type       = value_type;
+	internal_batch_job->byte_order       = byte_order;
+	internal_batch_job->value_size       = value_size;
+	internal_batch_job->number_of_values = byte_stream_size / value_size;
+
+	return( 1 );
+}
+
+/* Sets the output of a batch job
+ * The UTF-8 string of the value with index N is stored at offset N * utf8_string_size in the arena
+ * The UTF-8 string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_set_output(
+     libfdatetime_batch_job_t *batch_job,
+     uint8_t *utf8_string_arena,
+     size_t utf8_string_arena_size,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_set_output";
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = (libfdatetime_internal_batch_job_t *) batch_job;
+
+	if( utf8_string_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_arena_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string arena size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > utf8_string_arena_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job->utf8_string_arena      = utf8_string_arena;
+	internal_batch_job->utf8_string_arena_size = utf8_string_arena_size;
+	internal_batch_job->utf8_string_size       = utf8_string_size;
+	internal_batch_job->string_format_flags    = string_format_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of threads of a batch job
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_get_number_of_threads(
+     libfdatetime_batch_job_t *batch_job,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_get_number_of_threads";
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = (libfdatetime_internal_batch_job_t *) batch_job;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_batch_job->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads of a batch job
+ * The calling thread is one of the threads, a value of 1 converts the values in the calling thread only
+ * When multi-threading is not supported the values are always converted in the calling thread
+ * The worker threads are created and joined by every call to libfdatetime_batch_convert,
+ * no more threads are created than there are chunks of values to convert
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_set_number_of_threads(
+     libfdatetime_batch_job_t *batch_job,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_set_number_of_threads";
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = (libfdatetime_internal_batch_job_t *) batch_job;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFDATETIME_BATCH_JOB_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Retrieves the number of values of a batch job
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_job_get_number_of_values(
+     libfdatetime_batch_job_t *batch_job,
+     size_t *number_of_values,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_job_get_number_of_values";
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = (libfdatetime_internal_batch_job_t *) batch_job;
+
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = internal_batch_job->number_of_values;
+
+	return( 1 );
+}
+
+/* Creates a timestamp of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_batch_job_initialize_timestamp(
+     int timestamp_type,
+     intptr_t **timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_batch_job_initialize_timestamp";
+	int result            = 0;
+
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			result = libfdatetime_fat_date_time_initialize(
+			          (libfdatetime_fat_date_time_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			result = libfdatetime_filetime_initialize(
+			          (libfdatetime_filetime_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			result = libfdatetime_floatingtime_initialize(
+			          (libfdatetime_floatingtime_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			result = libfdatetime_hfs_time_initialize(
+			          (libfdatetime_hfs_time_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			result = libfdatetime_nsf_timedate_initialize(
+			          (libfdatetime_nsf_timedate_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			result = libfdatetime_posix_time_initialize(
+			          (libfdatetime_posix_time_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			result = libfdatetime_systemtime_initialize(
+			          (libfdatetime_systemtime_t **) timestamp,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timestamp type.",
+			 function );
+
+			return( -1 );
+	}
+	return( result );
+}
+
+/* Frees a timestamp of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_batch_job_free_timestamp(
+     int timestamp_type,
+     intptr_t **timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_batch_job_free_timestamp";
+	int result            = 0;
+
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			result = libfdatetime_fat_date_time_free(
+			          (libfdatetime_fat_date_time_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			result = libfdatetime_filetime_free(
+			          (libfdatetime_filetime_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			result = libfdatetime_floatingtime_free(
+			          (libfdatetime_floatingtime_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			result = libfdatetime_hfs_time_free(
+			          (libfdatetime_hfs_time_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			result = libfdatetime_nsf_timedate_free(
+			          (libfdatetime_nsf_timedate_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			result = libfdatetime_posix_time_free(
+			          (libfdatetime_posix_time_t **) timestamp,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			result = libfdatetime_systemtime_free(
+			          (libfdatetime_systemtime_t **) timestamp,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timestamp type.",
+			 function );
+
+			return( -1 );
+	}
+	return( result );
+}
+
+/* Converts a POSIX time value that is not supported into an UTF-8 string in hexadecimal representation
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_batch_job_copy_posix_time_value_to_utf8_string_in_hexadecimal(
+     libfdatetime_internal_batch_job_t *internal_batch_job,
+     const uint8_t *byte_stream,
+     uint8_t *utf8_string,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	static char *function = "libfdatetime_internal_batch_job_copy_posix_time_value_to_utf8_string_in_hexadecimal";
+	size_t string_index   = 0;
+
+	if( internal_batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch_job->value_size == 4 )
+	{
+		if( internal_batch_job->byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 byte_stream,
+			 internal_posix_time.timestamp );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 byte_stream,
+			 internal_posix_time.timestamp );
+		}
+	}
+	else
+	{
+		if( internal_batch_job->byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 byte_stream,
+			 internal_posix_time.timestamp );
+		}
+		else
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 byte_stream,
+			 internal_posix_time.timestamp );
+		}
+	}
+	internal_posix_time.value_type = internal_batch_job->value_type;
+
+	if( libfdatetime_internal_posix_time_copy_to_utf8_string_in_hexadecimal(
+	     &internal_posix_time,
+	     utf8_string,
+	     internal_batch_job->utf8_string_size,
+	     &string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time to hexadecimal UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a range of values of a batch job
+ * A POSIX time value that is not supported is stored as a hexadecimal string
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_batch_job_convert_values(
+     libfdatetime_internal_batch_job_t *internal_batch_job,
+     size_t value_index,
+     size_t number_of_values,
+     libcerror_error_t **error )
+{
+	const uint8_t *byte_stream = NULL;
+	intptr_t *timestamp        = NULL;
+	static char *function      = "libfdatetime_internal_batch_job_convert_values";
+	uint8_t *utf8_string       = NULL;
+	size_t last_value_index    = 0;
+	int result                 = 0;
+
+	if( internal_batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index > internal_batch_job->number_of_values )
+	 || ( number_of_values > ( internal_batch_job->number_of_values - value_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_batch_job_initialize_timestamp(
+	     internal_batch_job->timestamp_type,
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream = &( internal_batch_job->byte_stream[ value_index * internal_batch_job->value_size ] );
+	utf8_string = &( internal_batch_job->utf8_string_arena[ value_index * internal_batch_job->utf8_string_size ] );
+
+	for( last_value_index = value_index + number_of_values;
+	     value_index < last_value_index;
+	     value_index++ )
+	{
+		switch( internal_batch_job->timestamp_type )
+		{
+			case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+				result = libfdatetime_fat_date_time_copy_from_byte_stream(
+				          (libfdatetime_fat_date_time_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          error );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+				result = libfdatetime_filetime_copy_from_byte_stream(
+				          (libfdatetime_filetime_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          error );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+				result = libfdatetime_floatingtime_copy_from_byte_stream(
+				          (libfdatetime_floatingtime_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          error );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+				result = libfdatetime_hfs_time_copy_from_byte_stream(
+				          (libfdatetime_hfs_time_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          error );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+				result = libfdatetime_nsf_timedate_copy_from_byte_stream(
+				          (libfdatetime_nsf_timedate_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          error );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+				/* The input was validated by set input, hence the copy can only fail
+				 * on a value that is not supported, which should not fail the batch
+				 */
+				result = libfdatetime_posix_time_copy_from_byte_stream(
+				          (libfdatetime_posix_time_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          internal_batch_job->value_type,
+				          NULL );
+
+				if( result != 1 )
+				{
+					result = 0;
+				}
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+				result = libfdatetime_systemtime_copy_from_byte_stream(
+				          (libfdatetime_systemtime_t *) timestamp,
+				          byte_stream,
+				          internal_batch_job->value_size,
+				          internal_batch_job->byte_order,
+				          error );
+				break;
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %" PRIzd " from byte stream.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = libfdatetime_internal_batch_job_copy_posix_time_value_to_utf8_string_in_hexadecimal(
+			          internal_batch_job,
+			          byte_stream,
+			          utf8_string,
+			          error );
+		}
+		else
+		{
+			switch( internal_batch_job->timestamp_type )
+			{
+				case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+					result = libfdatetime_fat_date_time_copy_to_utf8_string(
+					          (libfdatetime_fat_date_time_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+
+				case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+					result = libfdatetime_filetime_copy_to_utf8_string(
+					          (libfdatetime_filetime_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+
+				case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+					result = libfdatetime_floatingtime_copy_to_utf8_string(
+					          (libfdatetime_floatingtime_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+
+				case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+					result = libfdatetime_hfs_time_copy_to_utf8_string(
+					          (libfdatetime_hfs_time_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+
+				case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+					result = libfdatetime_nsf_timedate_copy_to_utf8_string(
+					          (libfdatetime_nsf_timedate_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+
+				case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+					result = libfdatetime_posix_time_copy_to_utf8_string(
+					          (libfdatetime_posix_time_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+
+				case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+					result = libfdatetime_systemtime_copy_to_utf8_string(
+					          (libfdatetime_systemtime_t *) timestamp,
+					          utf8_string,
+					          internal_batch_job->utf8_string_size,
+					          internal_batch_job->string_format_flags,
+					          error );
+					break;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %" PRIzd " to UTF-8 string.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		byte_stream += internal_batch_job->value_size;
+		utf8_string += internal_batch_job->utf8_string_size;
+	}
+	if( libfdatetime_internal_batch_job_free_timestamp(
+	     internal_batch_job->timestamp_type,
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( timestamp != NULL )
+	{
+		libfdatetime_internal_batch_job_free_timestamp(
+		 internal_batch_job->timestamp_type,
+		 &timestamp,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Converts the chunks of a batch job until no chunks are left or a chunk failed to convert
+ * This function is run by every worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_batch_job_convert_chunks(
+     libfdatetime_internal_batch_job_t *internal_batch_job )
+{
+	libcerror_error_t *error = NULL;
+	size_t chunk_index       = 0;
+	size_t number_of_chunks  = 0;
+	size_t number_of_values  = 0;
+	size_t value_index       = 0;
+	int result               = 1;
+
+	if( internal_batch_job == NULL )
+	{
+		return( -1 );
+	}
+	number_of_chunks = internal_batch_job->number_of_values / LIBFDATETIME_BATCH_JOB_CHUNK_SIZE;
+
+	if( ( internal_batch_job->number_of_values % LIBFDATETIME_BATCH_JOB_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks++;
+	}
+	while( result == 1 )
+	{
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+		if( pthread_mutex_lock(
+		     &( internal_batch_job->mutex ) ) != 0 )
+		{
+			return( -1 );
+		}
+#endif
+		chunk_index = internal_batch_job->next_chunk_index;
+
+		/* Stop when all chunks have been handed out or once a chunk failed
+		 * All chunks before a failed chunk have already been handed out
+		 */
+		if( ( chunk_index < number_of_chunks )
+		 && ( internal_batch_job->failed_chunk_error == NULL ) )
+		{
+			internal_batch_job->next_chunk_index += 1;
+		}
+		else
+		{
+			chunk_index = number_of_chunks;
+		}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+		if( pthread_mutex_unlock(
+		     &( internal_batch_job->mutex ) ) != 0 )
+		{
+			return( -1 );
+		}
+#endif
+		if( chunk_index >= number_of_chunks )
+		{
+			break;
+		}
+		value_index      = chunk_index * LIBFDATETIME_BATCH_JOB_CHUNK_SIZE;
+		number_of_values = internal_batch_job->number_of_values - value_index;
+
+		if( number_of_values > LIBFDATETIME_BATCH_JOB_CHUNK_SIZE )
+		{
+			number_of_values = LIBFDATETIME_BATCH_JOB_CHUNK_SIZE;
+		}
+		result = libfdatetime_internal_batch_job_convert_values(
+		          internal_batch_job,
+		          value_index,
+		          number_of_values,
+		          &error );
+
+		if( result != 1 )
+		{
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+			if( pthread_mutex_lock(
+			     &( internal_batch_job->mutex ) ) != 0 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				return( -1 );
+			}
+#endif
+			/* Keep the error of the first failed chunk in input order
+			 */
+			if( ( internal_batch_job->failed_chunk_error == NULL )
+			 || ( chunk_index < internal_batch_job->failed_chunk_index ) )
+			{
+				if( internal_batch_job->failed_chunk_error != NULL )
+				{
+					libcerror_error_free(
+					 &( internal_batch_job->failed_chunk_error ) );
+				}
+				internal_batch_job->failed_chunk_error = error;
+				internal_batch_job->failed_chunk_index = chunk_index;
+
+				error = NULL;
+			}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+			if( pthread_mutex_unlock(
+			     &( internal_batch_job->mutex ) ) != 0 )
+			{
+				result = -1;
+			}
+#endif
+			if( error != NULL )
+			{
+				libcerror_error_free(
+				 &error );
+			}
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+
+/* The start function of a batch job worker thread
+ * Returns NULL
+ */
+static void *libfdatetime_internal_batch_job_worker_thread_start_function(
+              void *arguments )
+{
+	libfdatetime_internal_batch_job_convert_chunks(
+	 (libfdatetime_internal_batch_job_t *) arguments );
+
+	return( NULL );
+}
+
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
+/* Converts the values of a batch job into UTF-8 strings
+ * The input is split into chunks that are converted by a pool of worker threads,
+ * the string of every value is stored at its input index in the arena
+ * A POSIX time value that is not supported is stored as a hexadecimal string
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_batch_convert(
+     libfdatetime_batch_job_t *batch_job,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	pthread_t worker_threads[ LIBFDATETIME_BATCH_JOB_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	libfdatetime_internal_batch_job_t *internal_batch_job = NULL;
+	static char *function                                 = "libfdatetime_batch_convert";
+	size_t number_of_chunks                               = 0;
+	int number_of_worker_threads                          = 0;
+	int result                                            = 1;
+	int worker_thread_index                               = 0;
+
+	if( batch_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch_job = (libfdatetime_internal_batch_job_t *) batch_job;
+
+	if( internal_batch_job->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch job - missing input.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch_job->utf8_string_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch job - missing output.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch_job->number_of_values > ( internal_batch_job->utf8_string_arena_size / internal_batch_job->utf8_string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string arena is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch_job->failed_chunk_error != NULL )
+	{
+		libcerror_error_free(
+		 &( internal_batch_job->failed_chunk_error ) );
+	}
+	internal_batch_job->next_chunk_index   = 0;
+	internal_batch_job->failed_chunk_index = 0;
+
+	number_of_chunks = internal_batch_job->number_of_values / LIBFDATETIME_BATCH_JOB_CHUNK_SIZE;
+
+	if( ( internal_batch_job->number_of_values % LIBFDATETIME_BATCH_JOB_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks++;
+	}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	/* The calling thread is used as one of the workers and the worker threads
+	 * are created per call, hence no more are created than there are chunks left
+	 * for them to convert
+	 */
+	number_of_worker_threads = internal_batch_job->number_of_threads - 1;
+
+	if( (size_t) number_of_worker_threads >= number_of_chunks )
+	{
+		number_of_worker_threads = (int) number_of_chunks - 1;
+	}
+	for( worker_thread_index = 0;
+	     worker_thread_index < number_of_worker_threads;
+	     worker_thread_index++ )
+	{
+		/* If a worker thread cannot be created the remaining chunks
+		 * are converted by the threads that were created
+		 */
+		if( pthread_create(
+		     &( worker_threads[ worker_thread_index ] ),
+		     NULL,
+		     &libfdatetime_internal_batch_job_worker_thread_start_function,
+		     (void *) internal_batch_job ) != 0 )
+		{
+			number_of_worker_threads = worker_thread_index;
+
+			break;
+		}
+	}
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
+	if( libfdatetime_internal_batch_job_convert_chunks(
+	     internal_batch_job ) != 1 )
+	{
+		result = -1;
+	}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	for( worker_thread_index = 0;
+	     worker_thread_index < number_of_worker_threads;
+	     worker_thread_index++ )
+	{
+		if( pthread_join(
+		     worker_threads[ worker_thread_index ],
+		     NULL ) != 0 )
+		{
+			result = -1;
+		}
+	}
+#endif
+	if( internal_batch_job->failed_chunk_error != NULL )
+	{
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = internal_batch_job->failed_chunk_error;
+
+			internal_batch_job->failed_chunk_error = NULL;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &( internal_batch_job->failed_chunk_error ) );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to convert chunk: %" PRIzd ".",
+		 function,
+		 internal_batch_job->failed_chunk_index );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to convert values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,201 @@
+/*
+ * Batch conversion functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_INTERNAL_BATCH_H )
+#define _LIBFDATETIME_INTERNAL_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of values converted by a worker at a time
+ */
+#define LIBFDATETIME_BATCH_JOB_CHUNK_SIZE	16384
+
+/* The maximum number of worker threads
+ */
+#define LIBFDATETIME_BATCH_JOB_MAXIMUM_NUMBER_OF_THREADS	256
+
+typedef struct libfdatetime_internal_batch_job libfdatetime_internal_batch_job_t;
+
+struct libfdatetime_internal_batch_job
+{
+	/* The input byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The input byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The timestamp type
+	 */
+	int timestamp_type;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The byte order
+	 */
+	int byte_order;
+
+	/* The size of an individual value in the byte stream
+	 */
+	size_t value_size;
+
+	/* The number of values
+	 */
+	size_t number_of_values;
+
+	/* The output UTF-8 string arena
+	 */
+	uint8_t *utf8_string_arena;
+
+	/* The output UTF-8 string arena size
+	 */
+	size_t utf8_string_arena_size;
+
+	/* The size of the UTF-8 string of an individual value
+	 */
+	size_t utf8_string_size;
+
+	/* The string format flags
+	 */
+	uint32_t string_format_flags;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The index of the next chunk to convert
+	 */
+	size_t next_chunk_index;
+
+	/* The index of the first chunk that failed to convert
+	 */
+	size_t failed_chunk_index;
+
+	/* The error of the first chunk that failed to convert
+	 */
+	libcerror_error_t *failed_chunk_error;
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	/* The mutex that protects the chunk indexes
+	 */
+	pthread_mutex_t mutex;
+#endif
+};
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_initialize(
+     libfdatetime_batch_job_t **batch_job,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_free(
+     libfdatetime_batch_job_t **batch_job,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_set_input(
+     libfdatetime_batch_job_t *batch_job,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int timestamp_type,
+     uint8_t value_type,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_set_output(
+     libfdatetime_batch_job_t *batch_job,
+     uint8_t *utf8_string_arena,
+     size_t utf8_string_arena_size,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_get_number_of_threads(
+     libfdatetime_batch_job_t *batch_job,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_set_number_of_threads(
+     libfdatetime_batch_job_t *batch_job,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_job_get_number_of_values(
+     libfdatetime_batch_job_t *batch_job,
+     size_t *number_of_values,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_batch_job_initialize_timestamp(
+     int timestamp_type,
+     intptr_t **timestamp,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_batch_job_free_timestamp(
+     int timestamp_type,
+     intptr_t **timestamp,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_batch_job_copy_posix_time_value_to_utf8_string_in_hexadecimal(
+     libfdatetime_internal_batch_job_t *internal_batch_job,
+     const uint8_t *byte_stream,
+     uint8_t *utf8_string,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_batch_job_convert_values(
+     libfdatetime_internal_batch_job_t *internal_batch_job,
+     size_t value_index,
+     size_t number_of_values,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_batch_job_convert_chunks(
+     libfdatetime_internal_batch_job_t *internal_batch_job );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_batch_convert(
+     libfdatetime_batch_job_t *batch_job,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_INTERNAL_BATCH_H ) */
+
@@ -0,0 +1,251 @@
+/*
+ * Calendar functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_calendar.h"
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_fat_date_time.h"
+#include "libfdatetime_filetime.h"
+#include "libfdatetime_floatingtime.h"
+#include "libfdatetime_hfs_time.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_nsf_timedate.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_systemtime.h"
+
+/* Converts a timestamp of a specific type into date time values
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_copy_to_date_time_values(
+     int timestamp_type,
+     intptr_t *timestamp,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_copy_to_date_time_values";
+	int result            = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
+			          (libfdatetime_internal_fat_date_time_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			result = libfdatetime_internal_filetime_copy_to_date_time_values(
+			          (libfdatetime_internal_filetime_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+			          (libfdatetime_internal_floatingtime_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+			          (libfdatetime_internal_hfs_time_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			result = libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
+			          (libfdatetime_internal_nsf_timedate_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+			          (libfdatetime_internal_posix_time_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			result = libfdatetime_internal_systemtime_copy_to_date_time_values(
+			          (libfdatetime_internal_systemtime_t *) timestamp,
+			          date_time_values,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timestamp type.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy timestamp to date time values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the calendar values of a timestamp of a specific type
+ * The day of week is 0 for Sunday, the day of year is 1 for January 1 and
+ * the ISO week year and ISO week are the ISO 8601 week-numbering year and week
+ * The timestamp is decoded into a year, month and day, from which the number of days
+ * since January 1, 1970 is determined arithmetically. The calendar values are derived
+ * from that number of days, without iterating days or years
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_get_calendar_values(
+     int timestamp_type,
+     intptr_t *timestamp,
+     uint8_t *day_of_week,
+     uint16_t *day_of_year,
+     uint16_t *iso_week_year,
+     uint8_t *iso_week,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function  = "libfdatetime_get_calendar_values";
+	int64_t number_of_days = 0;
+
+	if( day_of_week == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid day of week.",
+		 function );
+
+		return( -1 );
+	}
+	if( day_of_year == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid day of year.",
+		 function );
+
+		return( -1 );
+	}
+	if( iso_week_year == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ISO week year.",
+		 function );
+
+		return( -1 );
+	}
+	if( iso_week == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ISO week.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_copy_to_date_time_values(
+	     timestamp_type,
+	     timestamp,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy timestamp to date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_days_since_1970(
+	     &date_time_values,
+	     &number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of days since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_calendar_values(
+	     &date_time_values,
+	     number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set calendar values.",
+		 function );
+
+		return( -1 );
+	}
+	*day_of_week   = date_time_values.day_of_week;
+	*day_of_year   = date_time_values.day_of_year;
+	*iso_week_year = date_time_values.iso_week_year;
+	*iso_week      = date_time_values.iso_week;
+
+	return( 1 );
+}
+
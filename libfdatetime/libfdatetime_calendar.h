@@ -0,0 +1,57 @@
+/*
+ * Calendar functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_CALENDAR_H )
+#define _LIBFDATETIME_CALENDAR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfdatetime_internal_copy_to_date_time_values(
+     int timestamp_type,
+     intptr_t *timestamp,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_get_calendar_values(
+     int timestamp_type,
+     intptr_t *timestamp,
+     uint8_t *day_of_week,
+     uint16_t *day_of_year,
+     uint16_t *iso_week_year,
+     uint8_t *iso_week,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_CALENDAR_H ) */
+
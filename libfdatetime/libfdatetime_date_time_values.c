@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #include "libfdatetime_definitions.h"
@@ -365,6 +367,296 @@ int libfdatetime_date_time_values_get_string_size(
 	return( 1 );
 }
 
+/* The month strings used by the ctime string format type
+ */
+static const char libfdatetime_date_time_values_month_strings[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+/* The fraction of seconds level, indexed by the bits of the milli, micro and nano seconds string format flags
+ * A level of 1 represents milli seconds, 2 micro seconds and 3 nano seconds
+ */
+static const uint8_t libfdatetime_date_time_values_fraction_of_seconds_levels[ 8 ] = {
+	0, 1, 2, 2, 3, 3, 3, 3 };
+
+/* The string format flags that can be handled by the specialized string functions
+ */
+#define LIBFDATETIME_DATE_TIME_VALUES_SPECIALIZED_STRING_FORMAT_FLAGS \
+	( LIBFDATETIME_STRING_FORMAT_TYPE_CTIME \
+	| LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 \
+	| LIBFDATETIME_STRING_FORMAT_FLAG_DATE \
+	| LIBFDATETIME_STRING_FORMAT_FLAG_TIME \
+	| LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS \
+	| LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS \
+	| LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS \
+	| LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR )
+
+/* Determines the index of the specialized string function
+ * The string format type must be either ctime or ISO 8601
+ * Bit 0 is set for ISO 8601, bit 1 for date, bit 2 for time,
+ * bits 3 and 4 contain the fraction of seconds level and bit 5 is set for the timezone indicator
+ */
+#define libfdatetime_date_time_values_get_specialized_string_function_index( string_format_flags ) \
+	( ( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 ) >> 1 ) \
+	| ( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_DATE ) >> 7 ) \
+	| ( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME ) >> 7 ) \
+	| ( libfdatetime_date_time_values_fraction_of_seconds_levels[ ( string_format_flags >> 16 ) & 0x07 ] << 3 ) \
+	| ( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) >> 26 ) )
+
+/* The pairs of decimal digits of the values 0 to 99
+ */
+static const char libfdatetime_date_time_values_decimal_digit_pairs[] = \
+	"00010203040506070809" \
+	"10111213141516171819" \
+	"20212223242526272829" \
+	"30313233343536373839" \
+	"40414243444546474849" \
+	"50515253545556575859" \
+	"60616263646566676869" \
+	"70717273747576777879" \
+	"80818283848586878889" \
+	"90919293949596979899";
+
+/* Writes 2 decimal digits, value must be smaller than 100
+ */
+#define libfdatetime_date_time_values_write_2_digits( string, string_index, value, character_type ) \
+	string[ string_index++ ] = (character_type) libfdatetime_date_time_values_decimal_digit_pairs[ ( value ) * 2 ]; \
+	string[ string_index++ ] = (character_type) libfdatetime_date_time_values_decimal_digit_pairs[ ( ( value ) * 2 ) + 1 ];
+
+/* Writes 3 decimal digits, value must be smaller than 1000
+ */
+#define libfdatetime_date_time_values_write_3_digits( string, string_index, value, character_type ) \
+	string[ string_index++ ] = (character_type) '0' + (character_type) ( ( value ) / 100 ); \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, ( value ) % 100, character_type )
+
+/* Writes 4 decimal digits, value must be smaller than 10000
+ */
+#define libfdatetime_date_time_values_write_4_digits( string, string_index, value, character_type ) \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, ( value ) / 100, character_type ) \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, ( value ) % 100, character_type )
+
+/* Writes the date in the ctime format: mmm dd, yyyy
+ */
+#define libfdatetime_date_time_values_write_ctime_date( string, string_index, values, character_type ) \
+	string[ string_index++ ] = (character_type) libfdatetime_date_time_values_month_strings[ ( ( values.month - 1 ) * 3 ) ]; \
+	string[ string_index++ ] = (character_type) libfdatetime_date_time_values_month_strings[ ( ( values.month - 1 ) * 3 ) + 1 ]; \
+	string[ string_index++ ] = (character_type) libfdatetime_date_time_values_month_strings[ ( ( values.month - 1 ) * 3 ) + 2 ]; \
+	string[ string_index++ ] = (character_type) ' '; \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, values.day, character_type ) \
+	string[ string_index++ ] = (character_type) ','; \
+	string[ string_index++ ] = (character_type) ' '; \
+	libfdatetime_date_time_values_write_4_digits( string, string_index, values.year, character_type )
+
+/* Writes the date in the ISO 8601 format: yyyy-mm-dd
+ */
+#define libfdatetime_date_time_values_write_iso8601_date( string, string_index, values, character_type ) \
+	libfdatetime_date_time_values_write_4_digits( string, string_index, values.year, character_type ) \
+	string[ string_index++ ] = (character_type) '-'; \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, values.month, character_type ) \
+	string[ string_index++ ] = (character_type) '-'; \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, values.day, character_type )
+
+/* Writes the time: HH:MM:SS
+ */
+#define libfdatetime_date_time_values_write_time( string, string_index, values, character_type ) \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, values.hours, character_type ) \
+	string[ string_index++ ] = (character_type) ':'; \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, values.minutes, character_type ) \
+	string[ string_index++ ] = (character_type) ':'; \
+	libfdatetime_date_time_values_write_2_digits( string, string_index, values.seconds, character_type )
+
+/* Writes the date and time in the ctime format: mmm dd, yyyy HH:MM:SS.###
+ */
+#define libfdatetime_date_time_values_write_ctime_date_time_milli_seconds( string, string_index, values, character_type ) \
+	libfdatetime_date_time_values_write_ctime_date( string, string_index, values, character_type ) \
+	string[ string_index++ ] = (character_type) ' '; \
+	libfdatetime_date_time_values_write_time( string, string_index, values, character_type ) \
+	string[ string_index++ ] = (character_type) '.'; \
+	libfdatetime_date_time_values_write_3_digits( string, string_index, values.milli_seconds, character_type )
+
+/* Writes the date and time in the ISO 8601 format: yyyy-mm-ddTHH:MM:SS.#########Z
+ */
+#define libfdatetime_date_time_values_write_iso8601_date_time_nano_seconds_timezone( string, string_index, values, character_type ) \
+	libfdatetime_date_time_values_write_iso8601_date( string, string_index, values, character_type ) \
+	string[ string_index++ ] = (character_type) 'T'; \
+	libfdatetime_date_time_values_write_time( string, string_index, values, character_type ) \
+	string[ string_index++ ] = (character_type) '.'; \
+	libfdatetime_date_time_values_write_3_digits( string, string_index, values.milli_seconds, character_type ) \
+	libfdatetime_date_time_values_write_3_digits( string, string_index, values.micro_seconds, character_type ) \
+	libfdatetime_date_time_values_write_3_digits( string, string_index, values.nano_seconds, character_type ) \
+	string[ string_index++ ] = (character_type) 'Z';
+
+/* Determines if the date values are valid
+ * Returns 1 if valid or 0 if not
+ */
+static int libfdatetime_date_time_values_date_is_valid(
+            libfdatetime_date_time_values_t *date_time_values )
+{
+	uint8_t days_in_month = 0;
+
+	if( date_time_values->year > 9999 )
+	{
+		return( 0 );
+	}
+	switch( date_time_values->month )
+	{
+		case 1:
+		case 3:
+		case 5:
+		case 7:
+		case 8:
+		case 10:
+		case 12:
+			days_in_month = 31;
+			break;
+
+		case 4:
+		case 6:
+		case 9:
+		case 11:
+			days_in_month = 30;
+			break;
+
+		case 2:
+			if( ( ( ( date_time_values->year % 4 ) == 0 )
+			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+			 || ( ( date_time_values->year % 400 ) == 0 ) )
+			{
+				days_in_month = 29;
+			}
+			else
+			{
+				days_in_month = 28;
+			}
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( ( date_time_values->day == 0 )
+	 || ( date_time_values->day > days_in_month ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the time values are valid
+ * The fraction of seconds level determines which fraction of seconds values are validated
+ * Returns 1 if valid or 0 if not
+ */
+static int libfdatetime_date_time_values_time_is_valid(
+            libfdatetime_date_time_values_t *date_time_values,
+            uint8_t fraction_of_seconds_level )
+{
+	if( ( date_time_values->hours > 23 )
+	 || ( date_time_values->minutes > 59 )
+	 || ( date_time_values->seconds > 59 ) )
+	{
+		return( 0 );
+	}
+	if( ( fraction_of_seconds_level >= 1 )
+	 && ( date_time_values->milli_seconds > 999 ) )
+	{
+		return( 0 );
+	}
+	if( ( fraction_of_seconds_level >= 2 )
+	 && ( date_time_values->micro_seconds > 999 ) )
+	{
+		return( 0 );
+	}
+	if( ( fraction_of_seconds_level >= 3 )
+	 && ( date_time_values->nano_seconds > 999 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Defines a specialized function that converts the date and time values into a string
+ * The function validates the date and time values, checks the string size once and
+ * writes the string without evaluating the string format flags
+ * Returns 1 if successful, 0 if the date and time values are not valid or -1 on error
+ */
+#define LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTION( encoding, encoding_description, character_type, format, string_size_value, validate_date, fraction_of_seconds_level ) \
+static int libfdatetime_date_time_values_copy_to_ ## encoding ## _string_ ## format( \
+            libfdatetime_date_time_values_t *date_time_values, \
+            character_type *string, \
+            size_t string_size, \
+            size_t *string_index, \
+            libcerror_error_t **error ) \
+{ \
+	libfdatetime_date_time_values_t values; \
+\
+	static char *function    = "libfdatetime_date_time_values_copy_to_" #encoding "_string_" #format; \
+	size_t safe_string_index = 0; \
+\
+	if( ( validate_date != 0 ) \
+	 && ( libfdatetime_date_time_values_date_is_valid( date_time_values ) == 0 ) ) \
+	{ \
+		return( 0 ); \
+	} \
+	if( ( fraction_of_seconds_level != 0 ) \
+	 && ( libfdatetime_date_time_values_time_is_valid( date_time_values, fraction_of_seconds_level ) == 0 ) ) \
+	{ \
+		return( 0 ); \
+	} \
+	safe_string_index = *string_index; \
+\
+	if( ( safe_string_index + string_size_value ) > string_size ) \
+	{ \
+		libcerror_error_set( \
+		 error, \
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS, \
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL, \
+		 "%s: " encoding_description " string is too small.", \
+		 function ); \
+\
+		return( -1 ); \
+	} \
+	/* Use a local copy of the date and time values so that the writes to the string \
+	 * cannot alias them and the compiler does not need to reload the values \
+	 */ \
+	values = *date_time_values; \
+\
+	libfdatetime_date_time_values_write_ ## format( string, safe_string_index, values, character_type ) \
+\
+	string[ safe_string_index++ ] = 0; \
+\
+	*string_index = safe_string_index; \
+\
+	return( 1 ); \
+}
+
+/* Defines the specialized functions that convert the date and time values into a string
+ * and the table used to look them up, which is indexed by
+ * libfdatetime_date_time_values_get_specialized_string_function_index
+ */
+#define LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTIONS( encoding, encoding_description, character_type ) \
+typedef int (*libfdatetime_date_time_values_copy_to_ ## encoding ## _string_function_t)( \
+             libfdatetime_date_time_values_t *date_time_values, \
+             character_type *string, \
+             size_t string_size, \
+             size_t *string_index, \
+             libcerror_error_t **error ); \
+\
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTION( encoding, encoding_description, character_type, ctime_date, 13, 1, 0 ) \
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTION( encoding, encoding_description, character_type, iso8601_date, 11, 1, 0 ) \
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTION( encoding, encoding_description, character_type, ctime_date_time_milli_seconds, 26, 1, 1 ) \
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTION( encoding, encoding_description, character_type, iso8601_date_time_nano_seconds_timezone, 31, 1, 3 ) \
+\
+static const libfdatetime_date_time_values_copy_to_ ## encoding ## _string_function_t libfdatetime_date_time_values_copy_to_ ## encoding ## _string_functions[ 64 ] = { \
+	NULL, NULL, libfdatetime_date_time_values_copy_to_ ## encoding ## _string_ctime_date, libfdatetime_date_time_values_copy_to_ ## encoding ## _string_iso8601_date, NULL, NULL, NULL, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, libfdatetime_date_time_values_copy_to_ ## encoding ## _string_ctime_date_time_milli_seconds, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, libfdatetime_date_time_values_copy_to_ ## encoding ## _string_iso8601_date_time_nano_seconds_timezone };
+
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTIONS( utf8, "UTF-8", uint8_t )
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTIONS( utf16, "UTF-16", uint16_t )
+LIBFDATETIME_DATE_TIME_VALUES_DEFINE_COPY_TO_STRING_FUNCTIONS( utf32, "UTF-32", uint32_t )
+
 /* Converts the date and time values into an UTF-8 string
  * The string size should include the end of string character
  * Returns 1 if successful, 0 if the date and time values are not valid or -1 on error
@@ -380,6 +672,7 @@ int libfdatetime_date_time_values_copy_to_utf8_string_with_index(
 	char *month_string          = NULL;
 	static char *function       = "libfdatetime_date_time_values_copy_to_utf8_string_with_index";
 	size_t string_index         = 0;
+	uint32_t function_index     = 0;
 	uint32_t string_format_type = 0;
 	uint32_t supported_flags    = 0;
 	uint16_t micro_seconds      = 0;
@@ -468,6 +761,21 @@ int libfdatetime_date_time_values_copy_to_utf8_string_with_index(
 
 		return( -1 );
 	}
+	if( ( string_format_flags & ~( LIBFDATETIME_DATE_TIME_VALUES_SPECIALIZED_STRING_FORMAT_FLAGS ) ) == 0 )
+	{
+		function_index = libfdatetime_date_time_values_get_specialized_string_function_index(
+		                  string_format_flags );
+
+		if( libfdatetime_date_time_values_copy_to_utf8_string_functions[ function_index ] != NULL )
+		{
+			return( libfdatetime_date_time_values_copy_to_utf8_string_functions[ function_index ](
+			         date_time_values,
+			         utf8_string,
+			         utf8_string_size,
+			         utf8_string_index,
+			         error ) );
+		}
+	}
 	string_index = *utf8_string_index;
 
 	/* Validate the date and time if necessary
@@ -893,6 +1201,7 @@ int libfdatetime_date_time_values_copy_to_utf16_string_with_index(
 	char *month_string          = NULL;
 	static char *function       = "libfdatetime_date_time_values_copy_to_utf16_string_with_index";
 	size_t string_index         = 0;
+	uint32_t function_index     = 0;
 	uint32_t string_format_type = 0;
 	uint32_t supported_flags    = 0;
 	uint16_t micro_seconds      = 0;
@@ -981,6 +1290,21 @@ int libfdatetime_date_time_values_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
+	if( ( string_format_flags & ~( LIBFDATETIME_DATE_TIME_VALUES_SPECIALIZED_STRING_FORMAT_FLAGS ) ) == 0 )
+	{
+		function_index = libfdatetime_date_time_values_get_specialized_string_function_index(
+		                  string_format_flags );
+
+		if( libfdatetime_date_time_values_copy_to_utf16_string_functions[ function_index ] != NULL )
+		{
+			return( libfdatetime_date_time_values_copy_to_utf16_string_functions[ function_index ](
+			         date_time_values,
+			         utf16_string,
+			         utf16_string_size,
+			         utf16_string_index,
+			         error ) );
+		}
+	}
 	string_index = *utf16_string_index;
 
 	/* Validate the date and time if necessary
@@ -1406,6 +1730,7 @@ int libfdatetime_date_time_values_copy_to_utf32_string_with_index(
 	char *month_string          = NULL;
 	static char *function       = "libfdatetime_date_time_values_copy_to_utf32_string_with_index";
 	size_t string_index         = 0;
+	uint32_t function_index     = 0;
 	uint32_t string_format_type = 0;
 	uint32_t supported_flags    = 0;
 	uint16_t micro_seconds      = 0;
@@ -1494,6 +1819,21 @@ int libfdatetime_date_time_values_copy_to_utf32_string_with_index(
 
 		return( -1 );
 	}
+	if( ( string_format_flags & ~( LIBFDATETIME_DATE_TIME_VALUES_SPECIALIZED_STRING_FORMAT_FLAGS ) ) == 0 )
+	{
+		function_index = libfdatetime_date_time_values_get_specialized_string_function_index(
+		                  string_format_flags );
+
+		if( libfdatetime_date_time_values_copy_to_utf32_string_functions[ function_index ] != NULL )
+		{
+			return( libfdatetime_date_time_values_copy_to_utf32_string_functions[ function_index ](
+			         date_time_values,
+			         utf32_string,
+			         utf32_string_size,
+			         utf32_string_index,
+			         error ) );
+		}
+	}
 	string_index = *utf32_string_index;
 
 	/* Validate the date and time if necessary
@@ -1904,3 +2244,1099 @@ int libfdatetime_date_time_values_copy_to_utf32_string_with_index(
 	return( 1 );
 }
 
+
+/* Determines if 8 characters, stored in little-endian order in a 64-bit value,
+ * contain decimal digits at the positions set in the digits mask and the
+ * separator characters at the other positions
+ * The digits are validated in parallel: the upper nibble of every digit must be 3
+ * and adding 6 to the lower nibble must not carry into the upper nibble
+ * Returns 1 if valid or 0 if not
+ */
+#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
+#define libfdatetime_date_time_values_string_segment_is_valid( value_64bit, digits_mask, separators ) \
+	( ( ( ( value_64bit ) & ~( digits_mask ) ) == ( separators ) ) \
+	 && ( ( ( value_64bit ) & ( digits_mask ) & 0xf0f0f0f0f0f0f0f0UL ) == ( ( digits_mask ) & 0x3030303030303030UL ) ) \
+	 && ( ( ( ( ( value_64bit ) & ( digits_mask ) ) + ( ( digits_mask ) & 0x0606060606060606UL ) ) & 0xf0f0f0f0f0f0f0f0UL ) == ( ( digits_mask ) & 0x3030303030303030UL ) ) )
+#else
+#define libfdatetime_date_time_values_string_segment_is_valid( value_64bit, digits_mask, separators ) \
+	( ( ( ( value_64bit ) & ~( digits_mask ) ) == ( separators ) ) \
+	 && ( ( ( value_64bit ) & ( digits_mask ) & 0xf0f0f0f0f0f0f0f0ULL ) == ( ( digits_mask ) & 0x3030303030303030ULL ) ) \
+	 && ( ( ( ( ( value_64bit ) & ( digits_mask ) ) + ( ( digits_mask ) & 0x0606060606060606ULL ) ) & 0xf0f0f0f0f0f0f0f0ULL ) == ( ( digits_mask ) & 0x3030303030303030ULL ) ) )
+#endif
+
+/* The digits mask and separators of the "YYYY-MM-" date segment
+ */
+#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
+#define LIBFDATETIME_DATE_TIME_VALUES_DATE_SEGMENT_DIGITS_MASK		0x00ffff00ffffffffUL
+#define LIBFDATETIME_DATE_TIME_VALUES_DATE_SEGMENT_SEPARATORS		0x2d00002d00000000UL
+#else
+#define LIBFDATETIME_DATE_TIME_VALUES_DATE_SEGMENT_DIGITS_MASK		0x00ffff00ffffffffULL
+#define LIBFDATETIME_DATE_TIME_VALUES_DATE_SEGMENT_SEPARATORS		0x2d00002d00000000ULL
+#endif
+
+/* The digits mask and separators of the "hh:mm:ss" time segment
+ */
+#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
+#define LIBFDATETIME_DATE_TIME_VALUES_TIME_SEGMENT_DIGITS_MASK		0xffff00ffff00ffffUL
+#define LIBFDATETIME_DATE_TIME_VALUES_TIME_SEGMENT_SEPARATORS		0x00003a00003a0000UL
+#else
+#define LIBFDATETIME_DATE_TIME_VALUES_TIME_SEGMENT_DIGITS_MASK		0xffff00ffff00ffffULL
+#define LIBFDATETIME_DATE_TIME_VALUES_TIME_SEGMENT_SEPARATORS		0x00003a00003a0000ULL
+#endif
+
+/* Determines if a character is a decimal digit
+ */
+#define libfdatetime_date_time_values_is_digit( character ) \
+	( ( ( character ) >= (uint8_t) '0' ) && ( ( character ) <= (uint8_t) '9' ) )
+
+/* Retrieves the value of 2 decimal digits
+ */
+#define libfdatetime_date_time_values_get_2_digits( string ) \
+	( (uint8_t) ( ( ( ( string )[ 0 ] - (uint8_t) '0' ) * 10 ) + ( ( string )[ 1 ] - (uint8_t) '0' ) ) )
+
+/* Converts 8 decimal digits, stored in little-endian order in a 64-bit value, into their value
+ * The digits are combined pairwise: first into 2-digit, then 4-digit and finally an 8-digit value
+ * The digits must have been validated
+ */
+static uint32_t libfdatetime_date_time_values_get_8_digits(
+                 uint64_t value_64bit )
+{
+#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
+	value_64bit -= 0x3030303030303030UL;
+	value_64bit  = ( ( value_64bit * 10 ) + ( value_64bit >> 8 ) ) & 0x00ff00ff00ff00ffUL;
+	value_64bit  = ( ( value_64bit * 100 ) + ( value_64bit >> 16 ) ) & 0x0000ffff0000ffffUL;
+	value_64bit  = ( ( value_64bit * 10000 ) + ( value_64bit >> 32 ) ) & 0x00000000ffffffffUL;
+#else
+	value_64bit -= 0x3030303030303030ULL;
+	value_64bit  = ( ( value_64bit * 10 ) + ( value_64bit >> 8 ) ) & 0x00ff00ff00ff00ffULL;
+	value_64bit  = ( ( value_64bit * 100 ) + ( value_64bit >> 16 ) ) & 0x0000ffff0000ffffULL;
+	value_64bit  = ( ( value_64bit * 10000 ) + ( value_64bit >> 32 ) ) & 0x00000000ffffffffULL;
+#endif
+	return( (uint32_t) value_64bit );
+}
+
+/* Copies the time from an "hh:mm:ss" segment of an UTF-8 string
+ * Returns 1 if successful or 0 if the segment is not supported
+ */
+static int libfdatetime_date_time_values_copy_time_from_utf8_string(
+            libfdatetime_date_time_values_t *date_time_values,
+            const uint8_t *utf8_string,
+            size_t utf8_string_length,
+            size_t *utf8_string_index )
+{
+	uint64_t value_64bit = 0;
+	size_t string_index  = *utf8_string_index;
+
+	if( ( string_index + 8 ) > utf8_string_length )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( utf8_string[ string_index ] ),
+	 value_64bit );
+
+	if( !libfdatetime_date_time_values_string_segment_is_valid(
+	      value_64bit,
+	      LIBFDATETIME_DATE_TIME_VALUES_TIME_SEGMENT_DIGITS_MASK,
+	      LIBFDATETIME_DATE_TIME_VALUES_TIME_SEGMENT_SEPARATORS ) )
+	{
+		return( 0 );
+	}
+	date_time_values->hours   = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ string_index ] ) );
+	date_time_values->minutes = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ string_index + 3 ] ) );
+	date_time_values->seconds = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ string_index + 6 ] ) );
+
+	*utf8_string_index = string_index + 8;
+
+	return( 1 );
+}
+
+/* Copies the fraction of seconds from an UTF-8 string
+ * The fraction of seconds is optional and starts with a '.' or ',' followed by 1 or more digits
+ * Only the first 9 digits of the fraction of seconds are stored
+ * Returns 1 if successful or 0 if the fraction of seconds is not supported
+ */
+static int libfdatetime_date_time_values_copy_fraction_of_seconds_from_utf8_string(
+            libfdatetime_date_time_values_t *date_time_values,
+            const uint8_t *utf8_string,
+            size_t utf8_string_length,
+            size_t *utf8_string_index )
+{
+	uint64_t value_64bit              = 0;
+	size_t string_index               = *utf8_string_index;
+	uint32_t fraction_of_seconds      = 0;
+	uint8_t character                 = 0;
+	uint8_t number_of_fraction_digits = 0;
+
+	if( ( string_index >= utf8_string_length )
+	 || ( ( utf8_string[ string_index ] != (uint8_t) '.' )
+	  &&  ( utf8_string[ string_index ] != (uint8_t) ',' ) ) )
+	{
+		return( 1 );
+	}
+	string_index++;
+
+	/* Convert the first 8 digits at once if available
+	 */
+	if( ( string_index + 8 ) <= utf8_string_length )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf8_string[ string_index ] ),
+		 value_64bit );
+
+#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
+		if( libfdatetime_date_time_values_string_segment_is_valid(
+		     value_64bit,
+		     0xffffffffffffffffUL,
+		     0 ) )
+#else
+		if( libfdatetime_date_time_values_string_segment_is_valid(
+		     value_64bit,
+		     0xffffffffffffffffULL,
+		     0 ) )
+#endif
+		{
+			fraction_of_seconds       = libfdatetime_date_time_values_get_8_digits(
+			                             value_64bit );
+			number_of_fraction_digits = 8;
+			string_index             += 8;
+		}
+	}
+	while( string_index < utf8_string_length )
+	{
+		character = utf8_string[ string_index ];
+
+		if( !libfdatetime_date_time_values_is_digit( character ) )
+		{
+			break;
+		}
+		/* Digits beyond nano seconds precision are ignored
+		 */
+		if( number_of_fraction_digits < 9 )
+		{
+			fraction_of_seconds *= 10;
+			fraction_of_seconds += character - (uint8_t) '0';
+
+			number_of_fraction_digits++;
+		}
+		string_index++;
+	}
+	if( number_of_fraction_digits == 0 )
+	{
+		return( 0 );
+	}
+	while( number_of_fraction_digits < 9 )
+	{
+		fraction_of_seconds *= 10;
+
+		number_of_fraction_digits++;
+	}
+	date_time_values->milli_seconds = (uint16_t) ( fraction_of_seconds / 1000000 );
+	date_time_values->micro_seconds = (uint16_t) ( ( fraction_of_seconds / 1000 ) % 1000 );
+	date_time_values->nano_seconds  = (uint16_t) ( fraction_of_seconds % 1000 );
+
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Clears the time values
+ */
+#define libfdatetime_date_time_values_clear_time( date_time_values ) \
+	date_time_values->hours         = 0; \
+	date_time_values->minutes       = 0; \
+	date_time_values->seconds       = 0; \
+	date_time_values->milli_seconds = 0; \
+	date_time_values->micro_seconds = 0; \
+	date_time_values->nano_seconds  = 0;
+
+/* Copies date time values from an ISO 8601 formatted UTF-8 string
+ * Supported layouts are YYYY-MM-DD and YYYY-MM-DDThh:mm:ss, where the date and time
+ * can also be separated by a space, followed by an optional fraction of seconds
+ * of 1 or more digits and an optional timezone indicator: Z, +hh:mm or -hh:mm
+ * Returns 1 if successful or 0 if the string is not supported
+ */
+static int libfdatetime_date_time_values_copy_from_iso8601_utf8_string(
+            libfdatetime_date_time_values_t *date_time_values,
+            const uint8_t *utf8_string,
+            size_t utf8_string_length,
+            int16_t *timezone_offset )
+{
+	uint64_t value_64bit       = 0;
+	size_t string_index        = 0;
+	uint16_t offset_in_minutes = 0;
+	uint8_t character          = 0;
+	uint8_t offset_hours       = 0;
+	uint8_t offset_minutes     = 0;
+
+	if( utf8_string_length < 10 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 utf8_string,
+	 value_64bit );
+
+	if( !libfdatetime_date_time_values_string_segment_is_valid(
+	      value_64bit,
+	      LIBFDATETIME_DATE_TIME_VALUES_DATE_SEGMENT_DIGITS_MASK,
+	      LIBFDATETIME_DATE_TIME_VALUES_DATE_SEGMENT_SEPARATORS ) )
+	{
+		return( 0 );
+	}
+	if( !libfdatetime_date_time_values_is_digit( utf8_string[ 8 ] )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 9 ] ) )
+	{
+		return( 0 );
+	}
+	date_time_values->year  = (uint16_t) ( ( libfdatetime_date_time_values_get_2_digits( utf8_string ) * 100 )
+	                                     + libfdatetime_date_time_values_get_2_digits( &( utf8_string[ 2 ] ) ) );
+	date_time_values->month = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ 5 ] ) );
+	date_time_values->day   = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ 8 ] ) );
+
+	libfdatetime_date_time_values_clear_time( date_time_values )
+
+	string_index = 10;
+
+	if( string_index < utf8_string_length )
+	{
+		character = utf8_string[ string_index++ ];
+
+		if( ( character != (uint8_t) 'T' )
+		 && ( character != (uint8_t) 't' )
+		 && ( character != (uint8_t) ' ' ) )
+		{
+			return( 0 );
+		}
+		if( libfdatetime_date_time_values_copy_time_from_utf8_string(
+		     date_time_values,
+		     utf8_string,
+		     utf8_string_length,
+		     &string_index ) != 1 )
+		{
+			return( 0 );
+		}
+		if( libfdatetime_date_time_values_copy_fraction_of_seconds_from_utf8_string(
+		     date_time_values,
+		     utf8_string,
+		     utf8_string_length,
+		     &string_index ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	*timezone_offset = 0;
+
+	if( string_index < utf8_string_length )
+	{
+		character = utf8_string[ string_index++ ];
+
+		if( ( character == (uint8_t) '+' )
+		 || ( character == (uint8_t) '-' ) )
+		{
+			if( ( string_index + 5 ) > utf8_string_length )
+			{
+				return( 0 );
+			}
+			if( !libfdatetime_date_time_values_is_digit( utf8_string[ string_index ] )
+			 || !libfdatetime_date_time_values_is_digit( utf8_string[ string_index + 1 ] )
+			 || ( utf8_string[ string_index + 2 ] != (uint8_t) ':' )
+			 || !libfdatetime_date_time_values_is_digit( utf8_string[ string_index + 3 ] )
+			 || !libfdatetime_date_time_values_is_digit( utf8_string[ string_index + 4 ] ) )
+			{
+				return( 0 );
+			}
+			offset_hours   = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ string_index ] ) );
+			offset_minutes = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ string_index + 3 ] ) );
+
+			if( ( offset_hours > 23 )
+			 || ( offset_minutes > 59 ) )
+			{
+				return( 0 );
+			}
+			offset_in_minutes = (uint16_t) ( ( offset_hours * 60 ) + offset_minutes );
+
+			if( character == (uint8_t) '-' )
+			{
+				*timezone_offset = -( (int16_t) offset_in_minutes );
+			}
+			else
+			{
+				*timezone_offset = (int16_t) offset_in_minutes;
+			}
+			string_index += 5;
+		}
+		else if( ( character != (uint8_t) 'Z' )
+		      && ( character != (uint8_t) 'z' ) )
+		{
+			return( 0 );
+		}
+	}
+	if( string_index != utf8_string_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* The month, indexed by the perfect hash of the lower case month string
+ * A value of 0 represents an unsupported month string
+ */
+static const uint8_t libfdatetime_date_time_values_month_string_hash_table[ 32 ] = {
+	0, 7, 4, 6, 0, 11, 0, 2, 12, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 3, 0, 9, 0, 10, 0, 0, 5, 0, 8, 0, 0, 0 };
+
+/* Determines the perfect hash of a lower case month string
+ * The sum of the second and third character is unique for every month string
+ */
+#define libfdatetime_date_time_values_get_month_string_hash( string ) \
+	( ( ( ( string )[ 1 ] | 0x20 ) + ( ( string )[ 2 ] | 0x20 ) ) & 0x1f )
+
+/* Copies date time values from a ctime formatted UTF-8 string
+ * Supported layouts are mmm dd, yyyy and mmm dd, yyyy hh:mm:ss, followed by an optional fraction
+ * of seconds of 1 or more digits and an optional timezone indicator: UTC
+ * The month string is matched case insensitive
+ * Returns 1 if successful or 0 if the string is not supported
+ */
+static int libfdatetime_date_time_values_copy_from_ctime_utf8_string(
+            libfdatetime_date_time_values_t *date_time_values,
+            const uint8_t *utf8_string,
+            size_t utf8_string_length,
+            int16_t *timezone_offset )
+{
+	const char *month_string = NULL;
+	size_t string_index      = 0;
+	uint8_t month            = 0;
+
+	if( utf8_string_length < 12 )
+	{
+		return( 0 );
+	}
+	month = libfdatetime_date_time_values_month_string_hash_table[
+	         libfdatetime_date_time_values_get_month_string_hash( utf8_string ) ];
+
+	if( month == 0 )
+	{
+		return( 0 );
+	}
+	month_string = &( libfdatetime_date_time_values_month_strings[ ( month - 1 ) * 3 ] );
+
+	if( ( ( utf8_string[ 0 ] | 0x20 ) != ( (uint8_t) month_string[ 0 ] | 0x20 ) )
+	 || ( ( utf8_string[ 1 ] | 0x20 ) != (uint8_t) month_string[ 1 ] )
+	 || ( ( utf8_string[ 2 ] | 0x20 ) != (uint8_t) month_string[ 2 ] ) )
+	{
+		return( 0 );
+	}
+	if( ( utf8_string[ 3 ] != (uint8_t) ' ' )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 4 ] )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 5 ] )
+	 || ( utf8_string[ 6 ] != (uint8_t) ',' )
+	 || ( utf8_string[ 7 ] != (uint8_t) ' ' )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 8 ] )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 9 ] )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 10 ] )
+	 || !libfdatetime_date_time_values_is_digit( utf8_string[ 11 ] ) )
+	{
+		return( 0 );
+	}
+	date_time_values->year  = (uint16_t) ( ( libfdatetime_date_time_values_get_2_digits( &( utf8_string[ 8 ] ) ) * 100 )
+	                                     + libfdatetime_date_time_values_get_2_digits( &( utf8_string[ 10 ] ) ) );
+	date_time_values->month = month;
+	date_time_values->day   = libfdatetime_date_time_values_get_2_digits( &( utf8_string[ 4 ] ) );
+
+	libfdatetime_date_time_values_clear_time( date_time_values )
+
+	string_index = 12;
+
+	if( ( ( string_index + 1 ) < utf8_string_length )
+	 && ( utf8_string[ string_index ] == (uint8_t) ' ' )
+	 && libfdatetime_date_time_values_is_digit( utf8_string[ string_index + 1 ] ) )
+	{
+		string_index++;
+
+		if( libfdatetime_date_time_values_copy_time_from_utf8_string(
+		     date_time_values,
+		     utf8_string,
+		     utf8_string_length,
+		     &string_index ) != 1 )
+		{
+			return( 0 );
+		}
+		if( libfdatetime_date_time_values_copy_fraction_of_seconds_from_utf8_string(
+		     date_time_values,
+		     utf8_string,
+		     utf8_string_length,
+		     &string_index ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	*timezone_offset = 0;
+
+	if( ( string_index + 4 ) == utf8_string_length )
+	{
+		if( ( utf8_string[ string_index ] != (uint8_t) ' ' )
+		 || ( utf8_string[ string_index + 1 ] != (uint8_t) 'U' )
+		 || ( utf8_string[ string_index + 2 ] != (uint8_t) 'T' )
+		 || ( utf8_string[ string_index + 3 ] != (uint8_t) 'C' ) )
+		{
+			return( 0 );
+		}
+		string_index += 4;
+	}
+	if( string_index != utf8_string_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Copies date time values from an UTF-8 string
+ * The string can be terminated by an end of string character
+ * The timezone offset contains the number of minutes the date and time are ahead of UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_date_time_values_copy_from_utf8_string(
+     libfdatetime_date_time_values_t *date_time_values,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int16_t *timezone_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *end_of_string = NULL;
+	static char *function        = "libfdatetime_date_time_values_copy_from_utf8_string";
+	size_t utf8_string_length    = 0;
+	uint32_t string_format_type  = 0;
+	int result                   = 0;
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	string_format_type = string_format_flags & 0x000000ffUL;
+
+	if( ( string_format_type != LIBFDATETIME_STRING_FORMAT_TYPE_CTIME )
+	 && ( string_format_type != LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format type: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_type );
+
+		return( -1 );
+	}
+	if( timezone_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone offset.",
+		 function );
+
+		return( -1 );
+	}
+	end_of_string = (const uint8_t *) narrow_string_search_character(
+	                                   utf8_string,
+	                                   0,
+	                                   utf8_string_size );
+
+	if( end_of_string != NULL )
+	{
+		utf8_string_length = (size_t) ( end_of_string - utf8_string );
+	}
+	else
+	{
+		utf8_string_length = utf8_string_size;
+	}
+	if( string_format_type == LIBFDATETIME_STRING_FORMAT_TYPE_CTIME )
+	{
+		result = libfdatetime_date_time_values_copy_from_ctime_utf8_string(
+		          date_time_values,
+		          utf8_string,
+		          utf8_string_length,
+		          timezone_offset );
+	}
+	else
+	{
+		result = libfdatetime_date_time_values_copy_from_iso8601_utf8_string(
+		          date_time_values,
+		          utf8_string,
+		          utf8_string_length,
+		          timezone_offset );
+	}
+	if( result == 1 )
+	{
+		if( ( libfdatetime_date_time_values_date_is_valid(
+		       date_time_values ) == 0 )
+		 || ( libfdatetime_date_time_values_time_is_valid(
+		       date_time_values,
+		       0 ) == 0 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies date time values from an UTF-16 string
+ * The string can be terminated by an end of string character
+ * The string is narrowed to UTF-8 and parsed by the UTF-8 string parser, since all the supported
+ * formats only consist of ASCII characters
+ * The timezone offset contains the number of minutes the date and time are ahead of UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_date_time_values_copy_from_utf16_string(
+     libfdatetime_date_time_values_t *date_time_values,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int16_t *timezone_offset,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ LIBFDATETIME_DATE_TIME_VALUES_MAXIMUM_PARSE_STRING_LENGTH ];
+
+	static char *function = "libfdatetime_date_time_values_copy_from_utf16_string";
+	size_t string_index   = 0;
+	uint16_t character    = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < utf16_string_size;
+	     string_index++ )
+	{
+		character = utf16_string[ string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( ( character > 0x007f )
+		 || ( string_index >= LIBFDATETIME_DATE_TIME_VALUES_MAXIMUM_PARSE_STRING_LENGTH ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index ] = (uint8_t) character;
+	}
+	if( libfdatetime_date_time_values_copy_from_utf8_string(
+	     date_time_values,
+	     utf8_string,
+	     string_index,
+	     string_format_flags,
+	     timezone_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values from narrowed UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of days since January 1, 1970 of the date time values
+ * The number of days is determined directly from the date instead of iterating the years
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_date_time_values_get_number_of_days_since_1970(
+     libfdatetime_date_time_values_t *date_time_values,
+     int64_t *number_of_days,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_date_time_values_get_number_of_days_since_1970";
+	int64_t day_of_era    = 0;
+	int64_t day_of_year   = 0;
+	int64_t era           = 0;
+	int64_t year          = 0;
+	int64_t year_of_era   = 0;
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_days == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of days.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_date_is_valid(
+	     date_time_values ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The year is considered to start at March 1 so that the leap day is the last day of the year
+	 * An era consists of 400 years or 146097 days
+	 */
+	year = (int64_t) date_time_values->year;
+
+	if( date_time_values->month <= 2 )
+	{
+		year -= 1;
+	}
+	if( year >= 0 )
+	{
+		era = year / 400;
+	}
+	else
+	{
+		era = ( year - 399 ) / 400;
+	}
+	year_of_era = year - ( era * 400 );
+
+	if( date_time_values->month > 2 )
+	{
+		day_of_year = ( ( 153 * ( (int64_t) date_time_values->month - 3 ) ) + 2 ) / 5;
+	}
+	else
+	{
+		day_of_year = ( ( 153 * ( (int64_t) date_time_values->month + 9 ) ) + 2 ) / 5;
+	}
+	day_of_year += (int64_t) date_time_values->day - 1;
+
+	day_of_era = ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) + day_of_year;
+
+	/* 719468 is the number of days from March 1, 0000 to January 1, 1970
+	 */
+	*number_of_days = ( era * 146097 ) + day_of_era - 719468;
+
+	return( 1 );
+}
+
+/* Retrieves the number of seconds since January 1, 1970 00:00:00 of the date time values
+ * The number of days is determined directly from the date instead of iterating the years
+ * The fraction of seconds is validated but not included in the number of seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+     libfdatetime_date_time_values_t *date_time_values,
+     int64_t *number_of_seconds,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfdatetime_date_time_values_get_number_of_seconds_since_1970";
+	int64_t number_of_days = 0;
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_time_is_valid(
+	     date_time_values,
+	     3 ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_days_since_1970(
+	     date_time_values,
+	     &number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of days since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_seconds = ( number_of_days * 86400 )
+	                   + ( (int64_t) date_time_values->hours * 3600 )
+	                   + ( (int64_t) date_time_values->minutes * 60 )
+	                   + (int64_t) date_time_values->seconds;
+
+	return( 1 );
+}
+
+/* The number of days before the first day of the month, for a year that is not a leap year
+ */
+static const uint16_t libfdatetime_date_time_values_days_before_month[ 13 ] = {
+	0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+/* Sets the calendar values that are derived from the date of the date time values
+ * The number of days is the number of days since January 1, 1970 of the date, e.g. as determined
+ * by the decoder of a timestamp or by libfdatetime_date_time_values_get_number_of_days_since_1970
+ * The day of the week follows from the number of days, the day of the year and the ISO 8601 week
+ * from the day of the week and the day of the year, without iterating days or years
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_date_time_values_set_calendar_values(
+     libfdatetime_date_time_values_t *date_time_values,
+     int64_t number_of_days,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfdatetime_date_time_values_set_calendar_values";
+	int64_t day_of_week         = 0;
+	uint16_t day_of_year        = 0;
+	uint16_t days_in_year       = 0;
+	uint8_t first_day_of_week   = 0;
+	uint8_t is_leap_year        = 0;
+	uint8_t iso_day_of_week     = 0;
+	uint8_t number_of_iso_weeks = 0;
+	int16_t iso_week            = 0;
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_date_is_valid(
+	     date_time_values ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( ( date_time_values->year % 4 ) == 0 )
+	  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+	 || ( ( date_time_values->year % 400 ) == 0 ) )
+	{
+		is_leap_year = 1;
+	}
+	day_of_year = libfdatetime_date_time_values_days_before_month[ date_time_values->month ]
+	            + (uint16_t) date_time_values->day;
+
+	if( ( is_leap_year != 0 )
+	 && ( date_time_values->month > 2 ) )
+	{
+		day_of_year += 1;
+	}
+	/* January 1, 1970 was a Thursday and a day of week of 0 represents Sunday
+	 */
+	day_of_week = ( number_of_days + 4 ) % 7;
+
+	if( day_of_week < 0 )
+	{
+		day_of_week += 7;
+	}
+	/* The ISO 8601 week starts on Monday and week 1 contains the first Thursday of the year
+	 */
+	iso_day_of_week = ( day_of_week == 0 ) ? 7 : (uint8_t) day_of_week;
+
+	iso_week = (int16_t) ( ( day_of_year - iso_day_of_week + 10 ) / 7 );
+
+	/* The day of week of January 1 determines if the year has 52 or 53 ISO weeks
+	 */
+	first_day_of_week = (uint8_t) ( ( day_of_week + 371 - ( day_of_year - 1 ) ) % 7 );
+
+	date_time_values->iso_week_year = date_time_values->year;
+
+	if( iso_week < 1 )
+	{
+		/* The date is in the last ISO week of the previous year
+		 */
+		if( date_time_values->year == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ISO week year value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		date_time_values->iso_week_year -= 1;
+
+		if( ( ( ( date_time_values->iso_week_year % 4 ) == 0 )
+		  &&  ( ( date_time_values->iso_week_year % 100 ) != 0 ) )
+		 || ( ( date_time_values->iso_week_year % 400 ) == 0 ) )
+		{
+			days_in_year = 366;
+		}
+		else
+		{
+			days_in_year = 365;
+		}
+		first_day_of_week = (uint8_t) ( ( first_day_of_week + 371 - ( days_in_year % 7 ) ) % 7 );
+
+		if( ( first_day_of_week == 4 )
+		 || ( ( first_day_of_week == 3 )
+		  &&  ( days_in_year == 366 ) ) )
+		{
+			iso_week = 53;
+		}
+		else
+		{
+			iso_week = 52;
+		}
+	}
+	else if( iso_week > 52 )
+	{
+		/* A year has 53 ISO weeks if January 1 is a Thursday, or a Wednesday in a leap year
+		 */
+		if( ( first_day_of_week == 4 )
+		 || ( ( first_day_of_week == 3 )
+		  &&  ( is_leap_year != 0 ) ) )
+		{
+			number_of_iso_weeks = 53;
+		}
+		else
+		{
+			number_of_iso_weeks = 52;
+		}
+		if( iso_week > (int16_t) number_of_iso_weeks )
+		{
+			if( date_time_values->year == (uint16_t) UINT16_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid ISO week year value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			date_time_values->iso_week_year += 1;
+
+			iso_week = 1;
+		}
+	}
+	date_time_values->day_of_week = (uint8_t) day_of_week;
+	date_time_values->day_of_year = day_of_year;
+	date_time_values->iso_week    = (uint8_t) iso_week;
+
+	return( 1 );
+}
+
+/* Sets the date time values
+ * The fraction of seconds is specified as a number of nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_date_time_values_set_values(
+     libfdatetime_date_time_values_t *date_time_values,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_date_time_values_set_values";
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( month == 0 )
+	 || ( month > 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid month value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( day == 0 )
+	 || ( day > 31 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid day value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hours > 23 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hours value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( minutes > 59 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minutes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( seconds > 59 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( nano_seconds > 999999999 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	date_time_values->year          = year;
+	date_time_values->month         = month;
+	date_time_values->day           = day;
+	date_time_values->hours         = hours;
+	date_time_values->minutes       = minutes;
+	date_time_values->seconds       = seconds;
+	date_time_values->milli_seconds = (uint16_t) ( nano_seconds / 1000000 );
+	date_time_values->micro_seconds = (uint16_t) ( ( nano_seconds / 1000 ) % 1000 );
+	date_time_values->nano_seconds  = (uint16_t) ( nano_seconds % 1000 );
+
+	return( 1 );
+}
+
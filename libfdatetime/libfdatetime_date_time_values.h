@@ -32,6 +32,11 @@
 extern "C" {
 #endif
 
+/* The maximum length of a string that can be parsed into date time values
+ * when it has to be converted into UTF-8 first
+ */
+#define LIBFDATETIME_DATE_TIME_VALUES_MAXIMUM_PARSE_STRING_LENGTH	64
+
 typedef struct libfdatetime_date_time_values libfdatetime_date_time_values_t;
 
 struct libfdatetime_date_time_values
@@ -73,6 +78,29 @@ struct libfdatetime_date_time_values
 	/* The number of nano seconds
 	 */
 	uint16_t nano_seconds;
+
+	/* The calendar values below are derived from the date
+	 * and only set by libfdatetime_date_time_values_set_calendar_values
+	 */
+
+	/* The day of the week
+	 * 0 represents Sunday
+	 */
+	uint8_t day_of_week;
+
+	/* The day of the year
+	 * 1 represents January 1
+	 */
+	uint16_t day_of_year;
+
+	/* The ISO 8601 week-numbering year
+	 */
+	uint16_t iso_week_year;
+
+	/* The ISO 8601 week number
+	 * 1 represents the week that contains the first Thursday of the ISO week-numbering year
+	 */
+	uint8_t iso_week;
 };
 
 int libfdatetime_date_time_values_initialize(
@@ -113,6 +141,48 @@ int libfdatetime_date_time_values_copy_to_utf32_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+int libfdatetime_date_time_values_copy_from_utf8_string(
+     libfdatetime_date_time_values_t *date_time_values,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int16_t *timezone_offset,
+     libcerror_error_t **error );
+
+int libfdatetime_date_time_values_copy_from_utf16_string(
+     libfdatetime_date_time_values_t *date_time_values,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int16_t *timezone_offset,
+     libcerror_error_t **error );
+
+int libfdatetime_date_time_values_get_number_of_days_since_1970(
+     libfdatetime_date_time_values_t *date_time_values,
+     int64_t *number_of_days,
+     libcerror_error_t **error );
+
+int libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+     libfdatetime_date_time_values_t *date_time_values,
+     int64_t *number_of_seconds,
+     libcerror_error_t **error );
+
+int libfdatetime_date_time_values_set_calendar_values(
+     libfdatetime_date_time_values_t *date_time_values,
+     int64_t number_of_days,
+     libcerror_error_t **error );
+
+int libfdatetime_date_time_values_set_values(
+     libfdatetime_date_time_values_t *date_time_values,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,840 @@
+/*
+ * Duration functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_duration.h"
+#include "libfdatetime_libcerror.h"
+
+/* Determines the duration between two number of seconds since the same epoch
+ * The duration is the first value minus the second value in nano seconds
+ * and is saturated to the range of a signed 64-bit integer
+ * Returns the duration
+ */
+int64_t libfdatetime_get_duration_from_number_of_seconds(
+         int64_t first_number_of_seconds,
+         uint32_t first_number_of_nano_seconds,
+         int64_t second_number_of_seconds,
+         uint32_t second_number_of_nano_seconds )
+{
+	int64_t number_of_nano_seconds = 0;
+	int64_t number_of_seconds      = 0;
+
+	if( ( second_number_of_seconds < 0 )
+	 && ( first_number_of_seconds > ( INT64_MAX + second_number_of_seconds ) ) )
+	{
+		return( INT64_MAX );
+	}
+	if( ( second_number_of_seconds > 0 )
+	 && ( first_number_of_seconds < ( INT64_MIN + second_number_of_seconds ) ) )
+	{
+		return( INT64_MIN );
+	}
+	number_of_seconds      = first_number_of_seconds - second_number_of_seconds;
+	number_of_nano_seconds = (int64_t) first_number_of_nano_seconds - (int64_t) second_number_of_nano_seconds;
+
+	/* Borrow a second so that the nano seconds are positive before the bounds are checked
+	 */
+	if( number_of_nano_seconds < 0 )
+	{
+		if( number_of_seconds == INT64_MIN )
+		{
+			return( INT64_MIN );
+		}
+		number_of_seconds      -= 1;
+		number_of_nano_seconds += 1000000000;
+	}
+	/* INT64_MAX is 9223372036 seconds and 854775807 nano seconds
+	 * INT64_MIN is -9223372037 seconds and 145224192 nano seconds
+	 */
+	if( ( number_of_seconds > 9223372036 )
+	 || ( ( number_of_seconds == 9223372036 )
+	  &&  ( number_of_nano_seconds > 854775807 ) ) )
+	{
+		return( INT64_MAX );
+	}
+	if( ( number_of_seconds < -9223372037 )
+	 || ( ( number_of_seconds == -9223372037 )
+	  &&  ( number_of_nano_seconds < 145224192 ) ) )
+	{
+		return( INT64_MIN );
+	}
+	/* Multiply the negative seconds one second closer to 0 to prevent an overflow
+	 */
+	if( number_of_seconds < 0 )
+	{
+		return( ( ( number_of_seconds + 1 ) * 1000000000 ) + ( number_of_nano_seconds - 1000000000 ) );
+	}
+	return( ( number_of_seconds * 1000000000 ) + number_of_nano_seconds );
+}
+
+/* Adds a duration in nano seconds to a number of seconds and nano seconds
+ * The duration can be negative, the resulting number of nano seconds is within 0 - 999999999
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_duration_add_to_number_of_seconds(
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     int64_t duration,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfdatetime_internal_duration_add_to_number_of_seconds";
+	int64_t duration_nano_seconds    = 0;
+	int64_t duration_seconds         = 0;
+	int64_t result_number_of_seconds = 0;
+	uint32_t result_nano_seconds     = 0;
+
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_nano_seconds >= 1000000000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	duration_seconds      = duration / 1000000000;
+	duration_nano_seconds = duration % 1000000000;
+
+	/* Round the number of seconds down for negative durations
+	 */
+	if( duration_nano_seconds < 0 )
+	{
+		duration_seconds      -= 1;
+		duration_nano_seconds += 1000000000;
+	}
+	result_nano_seconds = *number_of_nano_seconds + (uint32_t) duration_nano_seconds;
+
+	if( result_nano_seconds >= 1000000000 )
+	{
+		result_nano_seconds -= 1000000000;
+		duration_seconds    += 1;
+	}
+	if( ( ( duration_seconds > 0 )
+	  &&  ( *number_of_seconds > ( INT64_MAX - duration_seconds ) ) )
+	 || ( ( duration_seconds < 0 )
+	  &&  ( *number_of_seconds < ( INT64_MIN - duration_seconds ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid duration value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result_number_of_seconds = *number_of_seconds + duration_seconds;
+
+	*number_of_seconds      = result_number_of_seconds;
+	*number_of_nano_seconds = result_nano_seconds;
+
+	return( 1 );
+}
+
+/* Converts a duration into a string
+ * The duration is in nano seconds
+ * The string format type determines the format, either
+ * ctime, e.g. 123 days 04:05:06.789 or
+ * ISO 8601, e.g. P123DT4H5M6.789S
+ * A negative duration is prefixed with a minus sign
+ * The fraction of seconds is truncated to the precision of the string format flags
+ * The string is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_duration_copy_to_string(
+     int64_t duration,
+     char *string,
+     size_t string_size,
+     size_t *string_length,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	char days_string[ 20 ];
+
+	static char *function             = "libfdatetime_internal_duration_copy_to_string";
+	size_t days_string_index          = 0;
+	size_t string_index               = 0;
+	uint64_t magnitude                = 0;
+	uint64_t number_of_days           = 0;
+	uint32_t fraction_divider         = 0;
+	uint32_t number_of_nano_seconds   = 0;
+	uint32_t string_format_type       = 0;
+	uint32_t supported_flags          = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t number_of_fraction_digits = 0;
+	uint8_t seconds                   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string length.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = 0x000000ffUL
+	                | LIBFDATETIME_STRING_FORMAT_FLAG_DATE
+	                | LIBFDATETIME_STRING_FORMAT_FLAG_TIME
+	                | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION
+	                | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS
+	                | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS
+	                | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS;
+
+	if( ( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	 || ( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_DURATION ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_flags );
+
+		return( -1 );
+	}
+	string_format_type = string_format_flags & 0x000000ffUL;
+
+	if( ( string_format_type != LIBFDATETIME_STRING_FORMAT_TYPE_CTIME )
+	 && ( string_format_type != LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format type: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_type );
+
+		return( -1 );
+	}
+	if( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS ) != 0 )
+	{
+		number_of_fraction_digits = 9;
+	}
+	else if( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS ) != 0 )
+	{
+		number_of_fraction_digits = 6;
+	}
+	else if( ( string_format_flags & LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS ) != 0 )
+	{
+		number_of_fraction_digits = 3;
+	}
+	if( duration < 0 )
+	{
+		string[ string_index++ ] = '-';
+
+		/* Negate without overflowing on the smallest negative value
+		 */
+		magnitude = (uint64_t) ( -( duration + 1 ) ) + 1;
+	}
+	else
+	{
+		magnitude = (uint64_t) duration;
+	}
+	number_of_nano_seconds = (uint32_t) ( magnitude % 1000000000 );
+	magnitude             /= 1000000000;
+	seconds                = (uint8_t) ( magnitude % 60 );
+	magnitude             /= 60;
+	minutes                = (uint8_t) ( magnitude % 60 );
+	magnitude             /= 60;
+	hours                  = (uint8_t) ( magnitude % 24 );
+	number_of_days         = magnitude / 24;
+
+	do
+	{
+		days_string[ days_string_index++ ] = (char) ( '0' + ( number_of_days % 10 ) );
+
+		number_of_days /= 10;
+	}
+	while( number_of_days > 0 );
+
+	if( string_format_type == LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+	{
+		string[ string_index++ ] = 'P';
+	}
+	while( days_string_index > 0 )
+	{
+		string[ string_index++ ] = days_string[ --days_string_index ];
+	}
+	if( string_format_type == LIBFDATETIME_STRING_FORMAT_TYPE_CTIME )
+	{
+		string[ string_index++ ] = ' ';
+		string[ string_index++ ] = 'd';
+		string[ string_index++ ] = 'a';
+		string[ string_index++ ] = 'y';
+		string[ string_index++ ] = 's';
+		string[ string_index++ ] = ' ';
+		string[ string_index++ ] = (char) ( '0' + ( hours / 10 ) );
+		string[ string_index++ ] = (char) ( '0' + ( hours % 10 ) );
+		string[ string_index++ ] = ':';
+		string[ string_index++ ] = (char) ( '0' + ( minutes / 10 ) );
+		string[ string_index++ ] = (char) ( '0' + ( minutes % 10 ) );
+		string[ string_index++ ] = ':';
+		string[ string_index++ ] = (char) ( '0' + ( seconds / 10 ) );
+		string[ string_index++ ] = (char) ( '0' + ( seconds % 10 ) );
+	}
+	else
+	{
+		string[ string_index++ ] = 'D';
+		string[ string_index++ ] = 'T';
+
+		if( hours >= 10 )
+		{
+			string[ string_index++ ] = (char) ( '0' + ( hours / 10 ) );
+		}
+		string[ string_index++ ] = (char) ( '0' + ( hours % 10 ) );
+		string[ string_index++ ] = 'H';
+
+		if( minutes >= 10 )
+		{
+			string[ string_index++ ] = (char) ( '0' + ( minutes / 10 ) );
+		}
+		string[ string_index++ ] = (char) ( '0' + ( minutes % 10 ) );
+		string[ string_index++ ] = 'M';
+
+		if( seconds >= 10 )
+		{
+			string[ string_index++ ] = (char) ( '0' + ( seconds / 10 ) );
+		}
+		string[ string_index++ ] = (char) ( '0' + ( seconds % 10 ) );
+	}
+	if( number_of_fraction_digits > 0 )
+	{
+		string[ string_index++ ] = '.';
+
+		fraction_divider = 100000000;
+
+		while( number_of_fraction_digits > 0 )
+		{
+			string[ string_index++ ] = (char) ( '0' + ( ( number_of_nano_seconds / fraction_divider ) % 10 ) );
+
+			fraction_divider          /= 10;
+			number_of_fraction_digits -= 1;
+		}
+	}
+	if( string_format_type == LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+	{
+		string[ string_index++ ] = 'S';
+	}
+	*string_length = string_index;
+
+	return( 1 );
+}
+
+/* Determines the size of the string for a duration
+ * The duration is in nano seconds
+ * The string size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_get_string_size(
+     int64_t duration,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	char string[ LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE ];
+
+	static char *function = "libfdatetime_duration_get_string_size";
+	size_t string_length  = 0;
+
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_duration_copy_to_string(
+	     duration,
+	     string,
+	     LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	     &string_length,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to string.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = string_length + 1;
+
+	return( 1 );
+}
+
+/* Converts a duration into an UTF-8 string
+ * The duration is in nano seconds
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_copy_to_utf8_string(
+     int64_t duration,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfdatetime_duration_copy_to_utf8_string";
+	size_t utf8_string_index = 0;
+
+	if( libfdatetime_duration_copy_to_utf8_string_with_index(
+	     duration,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a duration into an UTF-8 string
+ * The duration is in nano seconds
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_copy_to_utf8_string_with_index(
+     int64_t duration,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	char string[ LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE ];
+
+	static char *function          = "libfdatetime_duration_copy_to_utf8_string_with_index";
+	size_t string_index            = 0;
+	size_t string_length           = 0;
+	size_t utf8_string_index_value = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_duration_copy_to_string(
+	     duration,
+	     string,
+	     LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	     &string_length,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to string.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string_index_value = *utf8_string_index;
+
+	if( ( utf8_string_index_value >= utf8_string_size )
+	 || ( ( string_length + 1 ) > ( utf8_string_size - utf8_string_index_value ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		utf8_string[ utf8_string_index_value++ ] = (uint8_t) string[ string_index ];
+	}
+	utf8_string[ utf8_string_index_value++ ] = 0;
+
+	*utf8_string_index = utf8_string_index_value;
+
+	return( 1 );
+}
+
+/* Converts a duration into an UTF-16 string
+ * The duration is in nano seconds
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_copy_to_utf16_string(
+     int64_t duration,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_duration_copy_to_utf16_string";
+	size_t utf16_string_index = 0;
+
+	if( libfdatetime_duration_copy_to_utf16_string_with_index(
+	     duration,
+	     utf16_string,
+	     utf16_string_size,
+	     &utf16_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a duration into an UTF-16 string
+ * The duration is in nano seconds
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_copy_to_utf16_string_with_index(
+     int64_t duration,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	char string[ LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE ];
+
+	static char *function           = "libfdatetime_duration_copy_to_utf16_string_with_index";
+	size_t string_index             = 0;
+	size_t string_length            = 0;
+	size_t utf16_string_index_value = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_duration_copy_to_string(
+	     duration,
+	     string,
+	     LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	     &string_length,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to string.",
+		 function );
+
+		return( -1 );
+	}
+	utf16_string_index_value = *utf16_string_index;
+
+	if( ( utf16_string_index_value >= utf16_string_size )
+	 || ( ( string_length + 1 ) > ( utf16_string_size - utf16_string_index_value ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-16 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		utf16_string[ utf16_string_index_value++ ] = (uint16_t) string[ string_index ];
+	}
+	utf16_string[ utf16_string_index_value++ ] = 0;
+
+	*utf16_string_index = utf16_string_index_value;
+
+	return( 1 );
+}
+
+/* Converts a duration into an UTF-32 string
+ * The duration is in nano seconds
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_copy_to_utf32_string(
+     int64_t duration,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_duration_copy_to_utf32_string";
+	size_t utf32_string_index = 0;
+
+	if( libfdatetime_duration_copy_to_utf32_string_with_index(
+	     duration,
+	     utf32_string,
+	     utf32_string_size,
+	     &utf32_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a duration into an UTF-32 string
+ * The duration is in nano seconds
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_duration_copy_to_utf32_string_with_index(
+     int64_t duration,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	char string[ LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE ];
+
+	static char *function           = "libfdatetime_duration_copy_to_utf32_string_with_index";
+	size_t string_index             = 0;
+	size_t string_length            = 0;
+	size_t utf32_string_index_value = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_duration_copy_to_string(
+	     duration,
+	     string,
+	     LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	     &string_length,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy duration to string.",
+		 function );
+
+		return( -1 );
+	}
+	utf32_string_index_value = *utf32_string_index;
+
+	if( ( utf32_string_index_value >= utf32_string_size )
+	 || ( ( string_length + 1 ) > ( utf32_string_size - utf32_string_index_value ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-32 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		utf32_string[ utf32_string_index_value++ ] = (uint32_t) string[ string_index ];
+	}
+	utf32_string[ utf32_string_index_value++ ] = 0;
+
+	*utf32_string_index = utf32_string_index_value;
+
+	return( 1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Duration functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_DURATION_H )
+#define _LIBFDATETIME_DURATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a duration string, without the end of string character
+ * e.g. -106751 days 23:47:16.854775808
+ */
+#define LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE	32
+
+int64_t libfdatetime_get_duration_from_number_of_seconds(
+         int64_t first_number_of_seconds,
+         uint32_t first_number_of_nano_seconds,
+         int64_t second_number_of_seconds,
+         uint32_t second_number_of_nano_seconds );
+
+int libfdatetime_internal_duration_add_to_number_of_seconds(
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     int64_t duration,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_duration_copy_to_string(
+     int64_t duration,
+     char *string,
+     size_t string_size,
+     size_t *string_length,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_get_string_size(
+     int64_t duration,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_copy_to_utf8_string(
+     int64_t duration,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_copy_to_utf8_string_with_index(
+     int64_t duration,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_copy_to_utf16_string(
+     int64_t duration,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_copy_to_utf16_string_with_index(
+     int64_t duration,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_copy_to_utf32_string(
+     int64_t duration,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_duration_copy_to_utf32_string_with_index(
+     int64_t duration,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_DURATION_H ) */
+
@@ -28,6 +28,9 @@
 #include "libfdatetime_date_time_values.h"
 #include "libfdatetime_fat_date_time.h"
 #include "libfdatetime_libcerror.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
 #include "libfdatetime_types.h"
 
 /* Creates a FAT date and time
@@ -231,6 +234,11 @@ int libfdatetime_fat_date_time_copy_from_byte_stream(
 		byte_stream,
 		internal_fat_date_time->time );
 	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -261,6 +269,11 @@ int libfdatetime_fat_date_time_copy_from_32bit(
 	internal_fat_date_time->date = (uint16_t) ( value_32bit & 0x0ffffL );
 	internal_fat_date_time->time = (uint16_t) ( value_32bit >> 16 );
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -306,6 +319,138 @@ int libfdatetime_fat_date_time_copy_to_32bit(
 	return( 1 );
 }
 
+/* Converts date time values into a FAT date and time
+ * The FAT date and time can represent the years 1980 through 2107 with 2 seconds precision,
+ * an odd number of seconds and the fraction of seconds are truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+     libfdatetime_internal_fat_date_time_t *internal_fat_date_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_internal_fat_date_time_copy_from_date_time_values";
+	int64_t number_of_seconds = 0;
+
+	if( internal_fat_date_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of seconds is also used to validate the date time values
+	 */
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( date_time_values->year < 1980 )
+	 || ( date_time_values->year > 2107 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid date time values - year value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_fat_date_time->date = (uint16_t) ( ( ( date_time_values->year - 1980 ) << 9 )
+	                                          | ( date_time_values->month << 5 )
+	                                          | date_time_values->day );
+
+	internal_fat_date_time->time = (uint16_t) ( ( date_time_values->hours << 11 )
+	                                          | ( date_time_values->minutes << 5 )
+	                                          | ( date_time_values->seconds / 2 ) );
+
+	return( 1 );
+}
+
+/* Converts date time values into a FAT date and time
+ * The fraction of seconds is specified as a number of nano seconds
+ * The FAT date and time can represent the years 1980 through 2107 with 2 seconds precision,
+ * an odd number of seconds and the fraction of seconds are truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_fat_date_time_copy_from_date_time_values(
+     libfdatetime_fat_date_time_t *fat_date_time,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_fat_date_time_copy_from_date_time_values";
+
+	if( fat_date_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+	     (libfdatetime_internal_fat_date_time_t *) fat_date_time,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Converts a FAT date and time into date time values
  * Returns 1 if successful or -1 on error
  */
@@ -372,6 +517,257 @@ int libfdatetime_internal_fat_date_time_copy_to_date_time_values(
 	return( 1 );
 }
 
+/* Retrieves the sort key of a FAT date time
+ * The FAT date time is stored in local time, the sort key considers it to be in UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_fat_date_time_get_sort_key(
+     libfdatetime_internal_fat_date_time_t *internal_fat_date_time,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function     = "libfdatetime_internal_fat_date_time_get_sort_key";
+	int64_t number_of_seconds = 0;
+
+	if( internal_fat_date_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	/* The error is not set since a FAT date time that does not represent a date and time
+	 * maps to the invalid sort key
+	 */
+	if( libfdatetime_internal_fat_date_time_copy_to_date_time_values(
+	     internal_fat_date_time,
+	     &date_time_values,
+	     NULL ) != 1 )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+	}
+	else if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	          &date_time_values,
+	          &number_of_seconds,
+	          NULL ) != 1 )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+	}
+	else
+	{
+		*sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+		             number_of_seconds,
+		             0 );
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A FAT date time that does not represent a date and time maps to LIBFDATETIME_SORT_KEY_INVALID
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_fat_date_time_get_sort_key(
+     libfdatetime_fat_date_time_t *fat_date_time,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_fat_date_time_get_sort_key";
+
+	if( fat_date_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_fat_date_time_get_sort_key(
+	     (libfdatetime_internal_fat_date_time_t *) fat_date_time,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of FAT date time values
+ * The FAT date time values are stored as by libfdatetime_fat_date_time_copy_to_32bit
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_fat_date_time_array_get_sort_keys(
+     const uint32_t *fat_date_time_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_fat_date_time_t internal_fat_date_time;
+
+	static char *function = "libfdatetime_fat_date_time_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( fat_date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_fat_date_time.date = (uint16_t) ( fat_date_time_values[ value_index ] & 0x0ffffUL );
+		internal_fat_date_time.time = (uint16_t) ( fat_date_time_values[ value_index ] >> 16 );
+
+		if( libfdatetime_internal_fat_date_time_get_sort_key(
+		     &internal_fat_date_time,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two FAT date time
+ * Both values are compared by their sort key
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_fat_date_time_compare(
+     libfdatetime_fat_date_time_t *first_fat_date_time,
+     libfdatetime_fat_date_time_t *second_fat_date_time,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_fat_date_time_compare";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_fat_date_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_fat_date_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second FAT date time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_fat_date_time_get_sort_key(
+	     (libfdatetime_internal_fat_date_time_t *) first_fat_date_time,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_fat_date_time_get_sort_key(
+	     (libfdatetime_internal_fat_date_time_t *) second_fat_date_time,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
 /* Deterimes the size of the string for the FAT date time
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -409,34 +805,15 @@ int libfdatetime_fat_date_time_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
 	          (libfdatetime_internal_fat_date_time_t *) fat_date_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -644,6 +1021,10 @@ int libfdatetime_fat_date_time_copy_to_utf8_string_with_index(
 	static char *function                                         = "libfdatetime_fat_date_time_copy_to_utf8_string_with_index";
 	int result                                                    = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( fat_date_time == NULL )
 	{
 		libcerror_error_set(
@@ -657,32 +1038,33 @@ int libfdatetime_fat_date_time_copy_to_utf8_string_with_index(
 	}
 	internal_fat_date_time = (libfdatetime_internal_fat_date_time_t *) fat_date_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 fat_date_time,
+	 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+	  internal_fat_date_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
 	          internal_fat_date_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -708,6 +1090,16 @@ int libfdatetime_fat_date_time_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+		  internal_fat_date_time ) )
+
 		result = libfdatetime_internal_fat_date_time_copy_to_utf8_string_in_hexadecimal(
 		          internal_fat_date_time,
 		          utf8_string,
@@ -727,6 +1119,23 @@ int libfdatetime_fat_date_time_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 fat_date_time,
+	 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+	  internal_fat_date_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -909,6 +1318,10 @@ int libfdatetime_fat_date_time_copy_to_utf16_string_with_index(
 	static char *function                                         = "libfdatetime_fat_date_time_copy_to_utf16_string_with_index";
 	int result                                                    = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( fat_date_time == NULL )
 	{
 		libcerror_error_set(
@@ -922,32 +1335,33 @@ int libfdatetime_fat_date_time_copy_to_utf16_string_with_index(
 	}
 	internal_fat_date_time = (libfdatetime_internal_fat_date_time_t *) fat_date_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 fat_date_time,
+	 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+	  internal_fat_date_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
 	          (libfdatetime_internal_fat_date_time_t *) fat_date_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -973,6 +1387,16 @@ int libfdatetime_fat_date_time_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+		  internal_fat_date_time ) )
+
 		result = libfdatetime_internal_fat_date_time_copy_to_utf16_string_in_hexadecimal(
 		          internal_fat_date_time,
 		          utf16_string,
@@ -992,6 +1416,23 @@ int libfdatetime_fat_date_time_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 fat_date_time,
+	 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+	  internal_fat_date_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1174,6 +1615,10 @@ int libfdatetime_fat_date_time_copy_to_utf32_string_with_index(
 	static char *function                                         = "libfdatetime_fat_date_time_copy_to_utf32_string_with_index";
 	int result                                                    = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( fat_date_time == NULL )
 	{
 		libcerror_error_set(
@@ -1187,33 +1632,33 @@ int libfdatetime_fat_date_time_copy_to_utf32_string_with_index(
 	}
 	internal_fat_date_time = (libfdatetime_internal_fat_date_time_t *) fat_date_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 fat_date_time,
+	 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+	  internal_fat_date_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
 	          (libfdatetime_internal_fat_date_time_t *) fat_date_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1239,6 +1684,16 @@ int libfdatetime_fat_date_time_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+		 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+		  internal_fat_date_time ) )
+
 		result = libfdatetime_internal_fat_date_time_copy_to_utf32_string_in_hexadecimal(
 		          internal_fat_date_time,
 		          utf32_string,
@@ -1258,6 +1713,23 @@ int libfdatetime_fat_date_time_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 fat_date_time,
+	 LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME(
+	  internal_fat_date_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
@@ -80,11 +80,52 @@ int libfdatetime_fat_date_time_copy_to_32bit(
      uint32_t *value_32bit,
      libcerror_error_t **error );
 
+int libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+     libfdatetime_internal_fat_date_time_t *internal_fat_date_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_fat_date_time_copy_to_date_time_values(
      libfdatetime_internal_fat_date_time_t *internal_fat_date_time,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+int libfdatetime_internal_fat_date_time_get_sort_key(
+     libfdatetime_internal_fat_date_time_t *internal_fat_date_time,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_fat_date_time_get_sort_key(
+     libfdatetime_fat_date_time_t *fat_date_time,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_fat_date_time_array_get_sort_keys(
+     const uint32_t *fat_date_time_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_fat_date_time_copy_from_date_time_values(
+     libfdatetime_fat_date_time_t *fat_date_time,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_fat_date_time_compare(
+     libfdatetime_fat_date_time_t *first_fat_date_time,
+     libfdatetime_fat_date_time_t *second_fat_date_time,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_fat_date_time_get_string_size(
      libfdatetime_fat_date_time_t *fat_date_time,
@@ -28,6 +28,11 @@
 #include "libfdatetime_date_time_values.h"
 #include "libfdatetime_filetime.h"
 #include "libfdatetime_libcerror.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
+#include "libfdatetime_truncate.h"
 #include "libfdatetime_types.h"
 
 /* Creates a FILETIME
@@ -147,6 +152,8 @@ int libfdatetime_filetime_add(
 	libfdatetime_internal_filetime_t *internal_additional_filetime = NULL;
 	libfdatetime_internal_filetime_t *internal_filetime            = NULL;
 	static char *function                                          = "libfdatetime_filetime_add";
+	uint64_t additional_value_64bit                                = 0;
+	uint64_t value_64bit                                           = 0;
 
 	if( filetime == NULL )
 	{
@@ -174,24 +181,42 @@ int libfdatetime_filetime_add(
 	}
 	internal_additional_filetime = (libfdatetime_internal_filetime_t *) additional_filetime;
 
-	internal_filetime->lower += internal_additional_filetime->lower;
-	internal_filetime->upper += internal_additional_filetime->upper;
+	value_64bit = ( (uint64_t) internal_filetime->upper << 32 ) | internal_filetime->lower;
+
+	additional_value_64bit = ( (uint64_t) internal_additional_filetime->upper << 32 ) | internal_additional_filetime->lower;
+
+	if( value_64bit > ( (uint64_t) 0xffffffffffffffffULL - additional_value_64bit ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid additional FILETIME value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_64bit += additional_value_64bit;
+
+	internal_filetime->upper = (uint32_t) ( value_64bit >> 32 );
+	internal_filetime->lower = (uint32_t) ( value_64bit & 0xffffffffUL );
 
 	return( 1 );
 }
 
-/* Converts a byte stream into a FILETIME
+/* Subtracts the subtracted FILETIME from the FILETIME
  * Returns 1 if successful or -1 on error
  */
-int libfdatetime_filetime_copy_from_byte_stream(
+int libfdatetime_filetime_subtract(
      libfdatetime_filetime_t *filetime,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
-     int byte_order,
+     libfdatetime_filetime_t *subtracted_filetime,
      libcerror_error_t **error )
 {
-	libfdatetime_internal_filetime_t *internal_filetime = NULL;
-	static char *function                               = "libfdatetime_filetime_copy_from_byte_stream";
+	libfdatetime_internal_filetime_t *internal_filetime            = NULL;
+	libfdatetime_internal_filetime_t *internal_subtracted_filetime = NULL;
+	static char *function                                          = "libfdatetime_filetime_subtract";
+	uint64_t subtracted_value_64bit                                = 0;
+	uint64_t value_64bit                                           = 0;
 
 	if( filetime == NULL )
 	{
@@ -206,90 +231,293 @@ int libfdatetime_filetime_copy_from_byte_stream(
 	}
 	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
 
-	if( byte_stream == NULL )
+	if( subtracted_filetime == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
+		 "%s: invalid subtracted FILETIME.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_stream_size < 8 )
+	internal_subtracted_filetime = (libfdatetime_internal_filetime_t *) subtracted_filetime;
+
+	value_64bit = ( (uint64_t) internal_filetime->upper << 32 ) | internal_filetime->lower;
+
+	subtracted_value_64bit = ( (uint64_t) internal_subtracted_filetime->upper << 32 ) | internal_subtracted_filetime->lower;
+
+	if( value_64bit < subtracted_value_64bit )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid subtracted FILETIME value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_64bit -= subtracted_value_64bit;
+
+	internal_filetime->upper = (uint32_t) ( value_64bit >> 32 );
+	internal_filetime->lower = (uint32_t) ( value_64bit & 0xffffffffUL );
+
+	return( 1 );
+}
+
+/* Adds a number of 100th nano seconds (ticks) to the FILETIME
+ * The number of ticks can be negative
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_add_number_of_ticks(
+     libfdatetime_filetime_t *filetime,
+     int64_t number_of_ticks,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t *internal_filetime = NULL;
+	static char *function                               = "libfdatetime_filetime_add_number_of_ticks";
+	uint64_t value_64bit                                = 0;
+	uint64_t value_delta                                = 0;
+
+	if( filetime == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: byte stream too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_stream_size > (size_t) SSIZE_MAX )
+	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
+
+	value_64bit = ( (uint64_t) internal_filetime->upper << 32 ) | internal_filetime->lower;
+
+	if( number_of_ticks >= 0 )
+	{
+		value_delta = (uint64_t) number_of_ticks;
+
+		if( value_64bit > ( (uint64_t) 0xffffffffffffffffULL - value_delta ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of ticks value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit += value_delta;
+	}
+	else
+	{
+		/* Negate without overflowing on the smallest negative value
+		 */
+		value_delta = (uint64_t) ( -( number_of_ticks + 1 ) ) + 1;
+
+		if( value_64bit < value_delta )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of ticks value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit -= value_delta;
+	}
+	internal_filetime->upper = (uint32_t) ( value_64bit >> 32 );
+	internal_filetime->lower = (uint32_t) ( value_64bit & 0xffffffffUL );
+
+	return( 1 );
+}
+
+/* Determines the signed difference between two 64-bit FILETIME values
+ * The difference is the first value minus the second value in 100th nano seconds (ticks)
+ * and is saturated to the range of a signed 64-bit integer
+ * Returns the difference
+ */
+int64_t libfdatetime_internal_filetime_get_difference(
+         uint64_t first_value_64bit,
+         uint64_t second_value_64bit )
+{
+	uint64_t difference = 0;
+
+	if( first_value_64bit >= second_value_64bit )
+	{
+		difference = first_value_64bit - second_value_64bit;
+
+		if( difference > (uint64_t) 0x7fffffffffffffffULL )
+		{
+			difference = (uint64_t) 0x7fffffffffffffffULL;
+		}
+		return( (int64_t) difference );
+	}
+	difference = second_value_64bit - first_value_64bit;
+
+	if( difference > (uint64_t) 0x8000000000000000ULL )
+	{
+		difference = (uint64_t) 0x8000000000000000ULL;
+	}
+	/* Negate without overflowing on the smallest negative value
+	 */
+	return( -( (int64_t) ( difference - 1 ) ) - 1 );
+}
+
+/* Retrieves the difference between two FILETIME
+ * The difference is the first FILETIME minus the second FILETIME in 100th nano seconds (ticks)
+ * and is saturated to the range of a signed 64-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_get_difference(
+     libfdatetime_filetime_t *first_filetime,
+     libfdatetime_filetime_t *second_filetime,
+     int64_t *number_of_ticks,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t *internal_first_filetime  = NULL;
+	libfdatetime_internal_filetime_t *internal_second_filetime = NULL;
+	static char *function                                      = "libfdatetime_filetime_get_difference";
+
+	if( first_filetime == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: byte stream size exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first FILETIME.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( byte_order != LIBFDATETIME_ENDIAN_BIG )
-	 && ( byte_order != LIBFDATETIME_ENDIAN_LITTLE ) )
+	internal_first_filetime = (libfdatetime_internal_filetime_t *) first_filetime;
+
+	if( second_filetime == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported byte order.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second FILETIME.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+	internal_second_filetime = (libfdatetime_internal_filetime_t *) second_filetime;
+
+	if( number_of_ticks == NULL )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 byte_stream,
-		 internal_filetime->lower );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ticks.",
+		 function );
 
-		byte_stream += 4;
+		return( -1 );
+	}
+	*number_of_ticks = libfdatetime_internal_filetime_get_difference(
+	                    ( (uint64_t) internal_first_filetime->upper << 32 ) | internal_first_filetime->lower,
+	                    ( (uint64_t) internal_second_filetime->upper << 32 ) | internal_second_filetime->lower );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 byte_stream,
-		 internal_filetime->upper );
+	return( 1 );
+}
+
+/* Retrieves the differences between two arrays of 64-bit FILETIME values
+ * Every difference is the first value minus the second value in 100th nano seconds (ticks)
+ * and is saturated to the range of a signed 64-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_array_get_differences(
+     const uint64_t *first_filetime_values,
+     const uint64_t *second_filetime_values,
+     size_t number_of_values,
+     int64_t *differences,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_filetime_array_get_differences";
+	size_t value_index    = 0;
+
+	if( first_filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first FILETIME values.",
+		 function );
+
+		return( -1 );
 	}
-	else if( byte_order == LIBFDATETIME_ENDIAN_BIG )
+	if( second_filetime_values == NULL )
 	{
-		byte_stream_copy_to_uint32_big_endian(
-		 byte_stream,
-		 internal_filetime->upper );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second FILETIME values.",
+		 function );
 
-		byte_stream += 4;
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 byte_stream,
-		 internal_filetime->lower );
+		return( -1 );
+	}
+	if( differences == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid differences.",
+		 function );
+
+		return( -1 );
+	}
+	/* The loop has no early exits so that it can be vectorized
+	 */
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		differences[ value_index ] = libfdatetime_internal_filetime_get_difference(
+		                              first_filetime_values[ value_index ],
+		                              second_filetime_values[ value_index ] );
 	}
 	return( 1 );
 }
 
-/* Converts a 64-bit value into a FILETIME
+/* Truncates a FILETIME to a unit
+ * The FILETIME is rounded down to the start of the second, minute, hour, day, month or year
  * Returns 1 if successful or -1 on error
  */
-int libfdatetime_filetime_copy_from_64bit(
-     libfdatetime_filetime_t *filetime,
-     uint64_t value_64bit,
+int libfdatetime_internal_filetime_truncate(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int unit,
      libcerror_error_t **error )
 {
-	libfdatetime_internal_filetime_t *internal_filetime = NULL;
-	static char *function                               = "libfdatetime_filetime_copy_from_64bit";
+	static char *function          = "libfdatetime_internal_filetime_truncate";
+	uint64_t timestamp             = 0;
+	uint64_t unit_size             = 0;
+	int64_t number_of_days         = 0;
+	int64_t unit_number_of_seconds = 0;
+	int result                     = 0;
 
-	if( filetime == NULL )
+	if( internal_filetime == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -300,24 +528,59 @@ int libfdatetime_filetime_copy_from_64bit(
 
 		return( -1 );
 	}
-	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          unit,
+	          &unit_number_of_seconds,
+	          error );
 
-	internal_filetime->upper = value_64bit >> 32;
-	internal_filetime->lower = value_64bit & 0xffffffffUL;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unit number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	timestamp   = internal_filetime->upper;
+	timestamp <<= 32;
+	timestamp  |= internal_filetime->lower;
+
+	if( result != 0 )
+	{
+		unit_size  = (uint64_t) unit_number_of_seconds * 10000000;
+		timestamp -= timestamp % unit_size;
+	}
+	else
+	{
+		/* 134774 is the number of days from January 1, 1601 to January 1, 1970
+		 * since January 1, 1601 is the start of a year the result cannot be negative
+		 */
+		number_of_days = libfdatetime_internal_truncate_number_of_days(
+		                  (int64_t) ( timestamp / 864000000000ULL ) - 134774,
+		                  unit );
+
+		timestamp = (uint64_t) ( number_of_days + 134774 ) * 864000000000ULL;
+	}
+	internal_filetime->upper = (uint32_t) ( timestamp >> 32 );
+	internal_filetime->lower = (uint32_t) ( timestamp & 0xffffffffUL );
 
 	return( 1 );
 }
 
-/* Converts a FILETIME into a 64-bit value
+/* Truncates a FILETIME to a unit
+ * The FILETIME is rounded down to the start of the second, minute, hour, day, month or year
+ * The sub-day units are truncated with integer arithmetic only
  * Returns 1 if successful or -1 on error
  */
-int libfdatetime_filetime_copy_to_64bit(
+int libfdatetime_filetime_truncate(
      libfdatetime_filetime_t *filetime,
-     uint64_t *value_64bit,
+     int unit,
      libcerror_error_t **error )
 {
-	libfdatetime_internal_filetime_t *internal_filetime = NULL;
-	static char *function                               = "libfdatetime_filetime_copy_to_64bit";
+	static char *function = "libfdatetime_filetime_truncate";
 
 	if( filetime == NULL )
 	{
@@ -330,23 +593,888 @@ int libfdatetime_filetime_copy_to_64bit(
 
 		return( -1 );
 	}
-	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
-
-	if( value_64bit == NULL )
+	if( libfdatetime_internal_filetime_truncate(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     unit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to truncate FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Truncates an array of 64-bit FILETIME values to a unit
+ * The FILETIME values and truncated FILETIME values can refer to the same array
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_array_truncate(
+     const uint64_t *filetime_values,
+     size_t number_of_values,
+     int unit,
+     uint64_t *truncated_filetime_values,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t internal_filetime;
+
+	static char *function = "libfdatetime_filetime_array_truncate";
+	size_t value_index    = 0;
+
+	if( filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( truncated_filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid truncated FILETIME values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_filetime.upper = (uint32_t) ( filetime_values[ value_index ] >> 32 );
+		internal_filetime.lower = (uint32_t) ( filetime_values[ value_index ] & 0xffffffffUL );
+
+		if( libfdatetime_internal_filetime_truncate(
+		     &internal_filetime,
+		     unit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to truncate value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		truncated_filetime_values[ value_index ]   = internal_filetime.upper;
+		truncated_filetime_values[ value_index ] <<= 32;
+		truncated_filetime_values[ value_index ]  |= internal_filetime.lower;
+	}
+	return( 1 );
+}
+
+/* Converts a byte stream into a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_from_byte_stream(
+     libfdatetime_filetime_t *filetime,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t *internal_filetime = NULL;
+	static char *function                               = "libfdatetime_filetime_copy_from_byte_stream";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBFDATETIME_ENDIAN_BIG )
+	 && ( byte_order != LIBFDATETIME_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order == LIBFDATETIME_ENDIAN_LITTLE )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 byte_stream,
+		 internal_filetime->lower );
+
+		byte_stream += 4;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 byte_stream,
+		 internal_filetime->upper );
+	}
+	else if( byte_order == LIBFDATETIME_ENDIAN_BIG )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 byte_stream,
+		 internal_filetime->upper );
+
+		byte_stream += 4;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 byte_stream,
+		 internal_filetime->lower );
+	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
+	return( 1 );
+}
+
+/* Converts a 64-bit value into a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_from_64bit(
+     libfdatetime_filetime_t *filetime,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t *internal_filetime = NULL;
+	static char *function                               = "libfdatetime_filetime_copy_from_64bit";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
+
+	internal_filetime->upper = value_64bit >> 32;
+	internal_filetime->lower = value_64bit & 0xffffffffUL;
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
+	return( 1 );
+}
+
+/* Converts a FILETIME into a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_to_64bit(
+     libfdatetime_filetime_t *filetime,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t *internal_filetime = NULL;
+	static char *function                               = "libfdatetime_filetime_copy_to_64bit";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
+
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit   = internal_filetime->upper;
+	*value_64bit <<= 32;
+	*value_64bit  |= internal_filetime->lower;
+
+	return( 1 );
+}
+
+/* Converts a number of seconds since January 1, 1970 00:00:00 into a FILETIME
+ * The number of nano seconds is stored with 100 nano seconds precision
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_filetime_copy_from_number_of_seconds(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int64_t number_of_seconds,
+     uint32_t number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_filetime_copy_from_number_of_seconds";
+	uint64_t fraction     = 0;
+	uint64_t timestamp    = 0;
+
+	if( internal_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds >= 1000000000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check the bounds before correcting the number of seconds
+	 * so that the correction itself cannot overflow
+	 */
+	if( ( number_of_seconds < -11644473600 )
+	 || ( number_of_seconds > ( (int64_t) ( UINT64_MAX / 10000000 ) - 11644473600 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Correct the number of seconds to be relative to January 1, 1601
+	 */
+	number_of_seconds += 11644473600;
+
+	timestamp = (uint64_t) number_of_seconds * 10000000;
+	fraction  = number_of_nano_seconds / 100;
+
+	if( timestamp > ( UINT64_MAX - fraction ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	timestamp += fraction;
+
+	internal_filetime->upper = (uint32_t) ( timestamp >> 32 );
+	internal_filetime->lower = (uint32_t) ( timestamp & 0xffffffffUL );
+
+	return( 1 );
+}
+
+/* Converts date time values into a FILETIME
+ * The date time values are considered to be in UTC, the nano seconds are stored
+ * with 100 nano seconds precision
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_filetime_copy_from_date_time_values(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_internal_filetime_copy_from_date_time_values";
+	int64_t number_of_seconds = 0;
+
+	if( internal_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_filetime_copy_from_number_of_seconds(
+	     internal_filetime,
+	     number_of_seconds,
+	     ( (uint32_t) date_time_values->milli_seconds * 1000000 )
+	     + ( (uint32_t) date_time_values->micro_seconds * 1000 )
+	     + (uint32_t) date_time_values->nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FILETIME from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts date time values into a FILETIME
+ * The fraction of seconds is specified as a number of nano seconds
+ * The date time values are considered to be in UTC, the nano seconds are stored
+ * with 100 nano seconds precision
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_from_date_time_values(
+     libfdatetime_filetime_t *filetime,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_filetime_copy_from_date_time_values";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_filetime_copy_from_date_time_values(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an UTF-8 string into a FILETIME
+ * The string format type determines if the string is parsed as ctime or ISO 8601
+ * The string can contain a fraction of seconds, which is stored with 100 nano seconds precision,
+ * and a timezone indicator: UTC for ctime or Z, +hh:mm or -hh:mm for ISO 8601
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_from_utf8_string(
+     libfdatetime_filetime_t *filetime,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function     = "libfdatetime_filetime_copy_from_utf8_string";
+	int64_t number_of_seconds = 0;
+	int16_t timezone_offset   = 0;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_copy_from_utf8_string(
+	     &date_time_values,
+	     utf8_string,
+	     utf8_string_size,
+	     string_format_flags,
+	     &timezone_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values from UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     &date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	/* Correct the number of seconds to UTC
+	 */
+	number_of_seconds -= (int64_t) timezone_offset * 60;
+
+	if( libfdatetime_internal_filetime_copy_from_number_of_seconds(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     number_of_seconds,
+	     ( (uint32_t) date_time_values.milli_seconds * 1000000 )
+	     + ( (uint32_t) date_time_values.micro_seconds * 1000 )
+	     + (uint32_t) date_time_values.nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FILETIME from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
+	return( 1 );
+}
+
+/* Converts an UTF-16 string into a FILETIME
+ * The string format type determines if the string is parsed as ctime or ISO 8601
+ * The string can contain a fraction of seconds, which is stored with 100 nano seconds precision,
+ * and a timezone indicator: UTC for ctime or Z, +hh:mm or -hh:mm for ISO 8601
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_from_utf16_string(
+     libfdatetime_filetime_t *filetime,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function     = "libfdatetime_filetime_copy_from_utf16_string";
+	int64_t number_of_seconds = 0;
+	int16_t timezone_offset   = 0;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_copy_from_utf16_string(
+	     &date_time_values,
+	     utf16_string,
+	     utf16_string_size,
+	     string_format_flags,
+	     &timezone_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values from UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     &date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	/* Correct the number of seconds to UTC
+	 */
+	number_of_seconds -= (int64_t) timezone_offset * 60;
+
+	if( libfdatetime_internal_filetime_copy_from_number_of_seconds(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     number_of_seconds,
+	     ( (uint32_t) date_time_values.milli_seconds * 1000000 )
+	     + ( (uint32_t) date_time_values.micro_seconds * 1000 )
+	     + (uint32_t) date_time_values.nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FILETIME from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
+	return( 1 );
+}
+
+/* Retrieves the number of seconds since January 1, 1970 00:00:00 of a FILETIME
+ * The number of seconds is rounded down, the remainder is returned as number of nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_filetime_get_number_of_seconds(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_filetime_get_number_of_seconds";
+	uint64_t timestamp    = 0;
+
+	if( internal_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	timestamp   = internal_filetime->upper;
+	timestamp <<= 32;
+	timestamp  |= internal_filetime->lower;
+
+	/* The FILETIME divided by 10000000 cannot exceed the maximum of a signed 64-bit integer
+	 */
+	*number_of_seconds      = (int64_t) ( timestamp / 10000000 ) - 11644473600;
+	*number_of_nano_seconds = (uint32_t) ( timestamp % 10000000 ) * 100;
+
+	return( 1 );
+}
+
+/* Converts a FILETIME into a POSIX time
+ * The fraction of seconds is truncated to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_copy_to_posix_time(
+     libfdatetime_filetime_t *filetime,
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfdatetime_filetime_copy_to_posix_time";
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_filetime_get_number_of_seconds(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     &number_of_seconds,
+	     &number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     number_of_seconds,
+	     number_of_nano_seconds,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an array of FILETIME values into an array of POSIX time values
+ * The POSIX time values are stored as by libfdatetime_posix_time_copy_to_64bit
+ * The fraction of seconds is truncated to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_array_copy_to_posix_time(
+     const uint64_t *filetime_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     uint64_t *posix_time_values,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t internal_filetime;
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	static char *function           = "libfdatetime_filetime_array_copy_to_posix_time";
+	size_t value_index              = 0;
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+
+	if( filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid 64-bit value.",
+		 "%s: invalid POSIX time values.",
 		 function );
 
 		return( -1 );
 	}
-	*value_64bit   = internal_filetime->upper;
-	*value_64bit <<= 32;
-	*value_64bit  |= internal_filetime->lower;
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_filetime.upper = (uint32_t) ( filetime_values[ value_index ] >> 32 );
+		internal_filetime.lower = (uint32_t) ( filetime_values[ value_index ] & 0xffffffffUL );
+
+		if( libfdatetime_internal_filetime_get_number_of_seconds(
+		     &internal_filetime,
+		     &number_of_seconds,
+		     &number_of_nano_seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of seconds of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+		     &internal_posix_time,
+		     number_of_seconds,
+		     number_of_nano_seconds,
+		     value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %" PRIzd " to POSIX time.",
+			 function,
+			 value_index );
 
+			return( -1 );
+		}
+		posix_time_values[ value_index ] = internal_posix_time.timestamp;
+	}
 	return( 1 );
 }
 
@@ -422,10 +1550,11 @@ int libfdatetime_internal_filetime_copy_to_date_time_values(
 
 	/* Determine the number of years starting at '1 Jan 1601 00:00:00'
 	 * correct the value to days within the year
+	 * Jan 1, 1700 is day 36160 and Dec 31, 1699 is day 36159
 	 */
 	date_time_values->year = 1601;
 
-	if( filetimestamp >= 36159 )
+	if( filetimestamp > 36159 )
 	{
 		date_time_values->year = 1700;
 
@@ -554,6 +1683,232 @@ int libfdatetime_internal_filetime_copy_to_date_time_values(
 	return( 1 );
 }
 
+/* Retrieves the sort key of a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_filetime_get_sort_key(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_filetime_get_sort_key";
+	uint64_t timestamp    = 0;
+
+	if( internal_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	timestamp   = internal_filetime->upper;
+	timestamp <<= 32;
+	timestamp  |= internal_filetime->lower;
+
+	/* The sort key is a FILETIME that is saturated to the range of a signed 64-bit integer
+	 */
+	if( timestamp >= (uint64_t) LIBFDATETIME_SORT_KEY_MAXIMUM )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_MAXIMUM;
+	}
+	else
+	{
+		*sort_key = (int64_t) timestamp;
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * Every FILETIME has a sort key, a FILETIME of 2^63 or more exceeds the range of a sort key
+ * and is saturated to LIBFDATETIME_SORT_KEY_MAXIMUM
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_get_sort_key(
+     libfdatetime_filetime_t *filetime,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_filetime_get_sort_key";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_filetime_get_sort_key(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of FILETIME values
+ * The FILETIME values are stored as by libfdatetime_filetime_copy_to_64bit
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_filetime_array_get_sort_keys(
+     const uint64_t *filetime_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t internal_filetime;
+
+	static char *function = "libfdatetime_filetime_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_filetime.upper = (uint32_t) ( filetime_values[ value_index ] >> 32 );
+		internal_filetime.lower = (uint32_t) ( filetime_values[ value_index ] & 0xffffffffUL );
+
+		if( libfdatetime_internal_filetime_get_sort_key(
+		     &internal_filetime,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two FILETIME
+ * Both values are compared by their 64-bit value, unlike the sort key this is not saturated
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_filetime_compare(
+     libfdatetime_filetime_t *first_filetime,
+     libfdatetime_filetime_t *second_filetime,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t *internal_first_filetime  = NULL;
+	libfdatetime_internal_filetime_t *internal_second_filetime = NULL;
+	static char *function                                      = "libfdatetime_filetime_compare";
+	uint64_t first_timestamp                                   = 0;
+	uint64_t second_timestamp                                  = 0;
+
+	if( first_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_filetime = (libfdatetime_internal_filetime_t *) first_filetime;
+
+	if( second_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_filetime = (libfdatetime_internal_filetime_t *) second_filetime;
+
+	first_timestamp   = internal_first_filetime->upper;
+	first_timestamp <<= 32;
+	first_timestamp  |= internal_first_filetime->lower;
+
+	second_timestamp   = internal_second_filetime->upper;
+	second_timestamp <<= 32;
+	second_timestamp  |= internal_second_filetime->lower;
+
+	if( first_timestamp < second_timestamp )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_timestamp > second_timestamp )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
 /* Deterimes the size of the string for the FILETIME
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -591,34 +1946,15 @@ int libfdatetime_filetime_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_filetime_copy_to_date_time_values(
 	          (libfdatetime_internal_filetime_t *) filetime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -826,6 +2162,10 @@ int libfdatetime_filetime_copy_to_utf8_string_with_index(
 	static char *function                               = "libfdatetime_filetime_copy_to_utf8_string_with_index";
 	int result                                          = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( filetime == NULL )
 	{
 		libcerror_error_set(
@@ -839,32 +2179,33 @@ int libfdatetime_filetime_copy_to_utf8_string_with_index(
 	}
 	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 filetime,
+	 LIBFDATETIME_PROBE_VALUE_FILETIME(
+	  internal_filetime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_filetime_copy_to_date_time_values(
 	          internal_filetime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -890,6 +2231,16 @@ int libfdatetime_filetime_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_PROBE_VALUE_FILETIME(
+		  internal_filetime ) )
+
 		result = libfdatetime_internal_filetime_copy_to_utf8_string_in_hexadecimal(
 		          internal_filetime,
 		          utf8_string,
@@ -909,6 +2260,23 @@ int libfdatetime_filetime_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 filetime,
+	 LIBFDATETIME_PROBE_VALUE_FILETIME(
+	  internal_filetime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1091,6 +2459,10 @@ int libfdatetime_filetime_copy_to_utf16_string_with_index(
 	static char *function                               = "libfdatetime_filetime_copy_to_utf16_string_with_index";
 	int result                                          = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( filetime == NULL )
 	{
 		libcerror_error_set(
@@ -1104,32 +2476,33 @@ int libfdatetime_filetime_copy_to_utf16_string_with_index(
 	}
 	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 filetime,
+	 LIBFDATETIME_PROBE_VALUE_FILETIME(
+	  internal_filetime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_filetime_copy_to_date_time_values(
 	          internal_filetime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1180,6 +2553,16 @@ int libfdatetime_filetime_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_PROBE_VALUE_FILETIME(
+		  internal_filetime ) )
+
 		result = libfdatetime_internal_filetime_copy_to_utf16_string_in_hexadecimal(
 		          internal_filetime,
 		          utf16_string,
@@ -1199,6 +2582,23 @@ int libfdatetime_filetime_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 filetime,
+	 LIBFDATETIME_PROBE_VALUE_FILETIME(
+	  internal_filetime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1381,6 +2781,10 @@ int libfdatetime_filetime_copy_to_utf32_string_with_index(
 	static char *function                               = "libfdatetime_filetime_copy_to_utf32_string_with_index";
 	int result                                          = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( filetime == NULL )
 	{
 		libcerror_error_set(
@@ -1394,32 +2798,33 @@ int libfdatetime_filetime_copy_to_utf32_string_with_index(
 	}
 	internal_filetime = (libfdatetime_internal_filetime_t *) filetime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 filetime,
+	 LIBFDATETIME_PROBE_VALUE_FILETIME(
+	  internal_filetime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_filetime_copy_to_date_time_values(
 	          internal_filetime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1445,6 +2850,16 @@ int libfdatetime_filetime_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+		 LIBFDATETIME_PROBE_VALUE_FILETIME(
+		  internal_filetime ) )
+
 		result = libfdatetime_internal_filetime_copy_to_utf32_string_in_hexadecimal(
 		          internal_filetime,
 		          utf32_string,
@@ -1464,6 +2879,23 @@ int libfdatetime_filetime_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 filetime,
+	 LIBFDATETIME_PROBE_VALUE_FILETIME(
+	  internal_filetime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
@@ -65,6 +65,56 @@ int libfdatetime_filetime_add(
      libfdatetime_filetime_t *additional_filetime,
      libcerror_error_t **error );
 
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_subtract(
+     libfdatetime_filetime_t *filetime,
+     libfdatetime_filetime_t *subtracted_filetime,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_add_number_of_ticks(
+     libfdatetime_filetime_t *filetime,
+     int64_t number_of_ticks,
+     libcerror_error_t **error );
+
+int64_t libfdatetime_internal_filetime_get_difference(
+         uint64_t first_value_64bit,
+         uint64_t second_value_64bit );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_get_difference(
+     libfdatetime_filetime_t *first_filetime,
+     libfdatetime_filetime_t *second_filetime,
+     int64_t *number_of_ticks,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_array_get_differences(
+     const uint64_t *first_filetime_values,
+     const uint64_t *second_filetime_values,
+     size_t number_of_values,
+     int64_t *differences,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_filetime_truncate(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_truncate(
+     libfdatetime_filetime_t *filetime,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_array_truncate(
+     const uint64_t *filetime_values,
+     size_t number_of_values,
+     int unit,
+     uint64_t *truncated_filetime_values,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_filetime_copy_from_byte_stream(
      libfdatetime_filetime_t *filetime,
@@ -85,11 +135,95 @@ int libfdatetime_filetime_copy_to_64bit(
      uint64_t *value_64bit,
      libcerror_error_t **error );
 
+int libfdatetime_internal_filetime_copy_from_number_of_seconds(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int64_t number_of_seconds,
+     uint32_t number_of_nano_seconds,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_filetime_copy_from_date_time_values(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_copy_from_utf8_string(
+     libfdatetime_filetime_t *filetime,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_copy_from_utf16_string(
+     libfdatetime_filetime_t *filetime,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_filetime_get_number_of_seconds(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_copy_to_posix_time(
+     libfdatetime_filetime_t *filetime,
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_array_copy_to_posix_time(
+     const uint64_t *filetime_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     uint64_t *posix_time_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_filetime_copy_to_date_time_values(
      libfdatetime_internal_filetime_t *internal_filetime,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+int libfdatetime_internal_filetime_get_sort_key(
+     libfdatetime_internal_filetime_t *internal_filetime,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_get_sort_key(
+     libfdatetime_filetime_t *filetime,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_array_get_sort_keys(
+     const uint64_t *filetime_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_copy_from_date_time_values(
+     libfdatetime_filetime_t *filetime,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_filetime_compare(
+     libfdatetime_filetime_t *first_filetime,
+     libfdatetime_filetime_t *second_filetime,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_filetime_get_string_size(
      libfdatetime_filetime_t *filetime,
@@ -28,6 +28,9 @@
 #include "libfdatetime_date_time_values.h"
 #include "libfdatetime_floatingtime.h"
 #include "libfdatetime_libcerror.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
 #include "libfdatetime_types.h"
 
 /* Creates a floatingtime
@@ -219,6 +222,11 @@ int libfdatetime_floatingtime_copy_from_byte_stream(
 		 byte_stream,
 		 internal_floatingtime->timestamp.integer );
 	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -248,6 +256,11 @@ int libfdatetime_floatingtime_copy_from_64bit(
 
 	internal_floatingtime->timestamp.integer = value_64bit;
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -291,6 +304,143 @@ int libfdatetime_floatingtime_copy_to_64bit(
 	return( 1 );
 }
 
+/* Converts date time values into a floatingtime
+ * The floatingtime can represent December 30, 1899 00:00:00 and later
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_floatingtime_copy_from_date_time_values(
+     libfdatetime_internal_floatingtime_t *internal_floatingtime,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfdatetime_internal_floatingtime_copy_from_date_time_values";
+	int64_t number_of_days            = 0;
+	int64_t number_of_seconds         = 0;
+	uint32_t number_of_seconds_in_day = 0;
+
+	if( internal_floatingtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of seconds is also used to validate the date time values
+	 */
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds_in_day = ( (uint32_t) date_time_values->hours * 3600 )
+	                         + ( (uint32_t) date_time_values->minutes * 60 )
+	                         + (uint32_t) date_time_values->seconds;
+
+	/* The floatingtime is relative to December 30, 1899 which is 25569 days before January 1, 1970
+	 */
+	number_of_days = ( ( number_of_seconds - number_of_seconds_in_day ) / 86400 ) + 25569;
+
+	if( number_of_days < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of days value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_floatingtime->timestamp.floating_point = (double) number_of_days
+	                                                + ( ( (double) number_of_seconds_in_day
+	                                                    + ( (double) date_time_values->milli_seconds / 1000.0 )
+	                                                    + ( (double) date_time_values->micro_seconds / 1000000.0 )
+	                                                    + ( (double) date_time_values->nano_seconds / 1000000000.0 ) ) / 86400.0 );
+
+	return( 1 );
+}
+
+/* Converts date time values into a floatingtime
+ * The fraction of seconds is specified as a number of nano seconds
+ * The floatingtime can represent December 30, 1899 00:00:00 and later
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_floatingtime_copy_from_date_time_values(
+     libfdatetime_floatingtime_t *floatingtime,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_floatingtime_copy_from_date_time_values";
+
+	if( floatingtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_floatingtime_copy_from_date_time_values(
+	     (libfdatetime_internal_floatingtime_t *) floatingtime,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Converts a floatingtime into date time values
  * Returns 1 if successful or -1 on error
  */
@@ -301,6 +451,7 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 {
 	static char *function    = "libfdatetime_internal_floatingtime_copy_to_date_time_values";
 	double floatingtimestamp = 0;
+	int32_t number_of_days   = 0;
 	uint32_t days_in_century = 0;
 	uint16_t days_in_year    = 0;
 	uint8_t days_in_month    = 0;
@@ -329,8 +480,10 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	}
 	floatingtimestamp = internal_floatingtime->timestamp.floating_point;
 
-	if( ( floatingtimestamp <= -3650000.0 )
-	 || ( floatingtimestamp >= 3650000.0 ) )
+	/* Note that a NaN fails both comparisons
+	 */
+	if( !( ( floatingtimestamp > -3650000.0 )
+	    && ( floatingtimestamp < 3650000.0 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -341,22 +494,49 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 
 		return( -1 );
 	}
-	/* Determine the number of years starting at '30 Dec 1899 00:00:00'
+	/* The integral part contains the number of days and the fractional part the time of day
+	 * Negative values represent days before 30 Dec 1899 with a positive time of day
+	 * e.g. -1.25 represents 29 Dec 1899 06:00:00
+	 */
+	number_of_days = (int32_t) floatingtimestamp;
+
+	if( floatingtimestamp < 0.0 )
+	{
+		floatingtimestamp = (double) number_of_days - floatingtimestamp;
+	}
+	else
+	{
+		floatingtimestamp -= (double) number_of_days;
+	}
+	/* Determine the number of years starting at '1 Jan 0000'
 	 * correct the value to days within the year
+	 * 30 Dec 1899 is 693959 days after 1 Jan 0000
 	 */
-	date_time_values->year  = 1899;
-	date_time_values->month = 12;
-	date_time_values->day   = 30;
+	number_of_days += 693959;
+
+	if( number_of_days < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid floatingtime - year value out of bounds.",
+		 function );
 
-	if( floatingtimestamp >= 2.0 )
+		return( -1 );
+	}
+	date_time_values->year  = 0;
+	date_time_values->month = 1;
+
+	/* 1 Jan 1900 is 693961 days after 1 Jan 0000
+	 */
+	if( number_of_days >= 693961 )
 	{
-		date_time_values->year  = 1900;
-		date_time_values->month = 1;
-		date_time_values->day   = 1;
+		date_time_values->year = 1900;
 
-		floatingtimestamp -= 2.0;
+		number_of_days -= 693961;
 	}
-	while( floatingtimestamp > 0.0 )
+	while( number_of_days > 0 )
 	{
 		if( ( date_time_values->year % 400 ) == 0 )
 		{
@@ -366,15 +546,15 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 		{
 			days_in_century = 36524;
 		}
-		if( floatingtimestamp <= days_in_century )
+		if( number_of_days < (int32_t) days_in_century )
 		{
 			break;
 		}
-		floatingtimestamp -= days_in_century;
+		number_of_days -= days_in_century;
 
 		date_time_values->year += 100;
 	}
-	while( floatingtimestamp > 0.0 )
+	while( number_of_days > 0 )
 	{
 		/* Check for a leap year
 		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
@@ -389,11 +569,11 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 		{
 			days_in_year = 365;
 		}
-		if( floatingtimestamp <= days_in_year )
+		if( number_of_days < (int32_t) days_in_year )
 		{
 			break;
 		}
-		floatingtimestamp -= days_in_year;
+		number_of_days -= days_in_year;
 
 		date_time_values->year += 1;
 	}
@@ -410,7 +590,7 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	}
 	/* Determine the month correct the value to days within the month
 	 */
-	while( floatingtimestamp > 0.0 )
+	while( number_of_days > 0 )
 	{
 		/* February (2)
 		 */
@@ -462,18 +642,17 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 
 			return( -1 );
 		}
-		if( floatingtimestamp < days_in_month )
+		if( number_of_days < (int32_t) days_in_month )
 		{
 			break;
 		}
-		floatingtimestamp -= days_in_month;
+		number_of_days -= days_in_month;
 
 		date_time_values->month += 1;
 	}
 	/* Determine the day
 	 */
-	date_time_values->day += (uint8_t) floatingtimestamp;
-	floatingtimestamp     -= (int) floatingtimestamp;
+	date_time_values->day = (uint8_t) ( number_of_days + 1 );
 
 	/* There are 24 hours in a day correct the value to hours
 	 */
@@ -513,6 +692,259 @@ int libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	return( 1 );
 }
 
+/* Retrieves the sort key of a floatingtime
+ * The fraction of a day is rounded to the nearest 100 nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_floatingtime_get_sort_key(
+     libfdatetime_internal_floatingtime_t *internal_floatingtime,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfdatetime_internal_floatingtime_get_sort_key";
+	double fraction_of_day   = 0;
+	double floatingtimestamp = 0;
+	int64_t number_of_days   = 0;
+
+	if( internal_floatingtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	floatingtimestamp = internal_floatingtime->timestamp.floating_point;
+
+	/* Note that a NaN fails both comparisons
+	 */
+	if( !( ( floatingtimestamp > -3650000.0 )
+	    && ( floatingtimestamp < 3650000.0 ) ) )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+
+		return( 1 );
+	}
+	/* The integer part is the number of days relative to December 30, 1899
+	 * the fraction of the day is positive, also for a negative number of days
+	 */
+	number_of_days  = (int64_t) floatingtimestamp;
+	fraction_of_day = floatingtimestamp - (double) number_of_days;
+
+	if( fraction_of_day < 0.0 )
+	{
+		fraction_of_day = -fraction_of_day;
+	}
+	/* December 30, 1899 is 109205 days after January 1, 1601
+	 * a day consists of 864000000000 intervals of 100 nano seconds
+	 */
+	*sort_key = ( ( number_of_days + 109205 ) * 864000000000 )
+	          + (int64_t) ( ( fraction_of_day * 864000000000.0 ) + 0.5 );
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A floatingtime that does not represent a date and time maps to LIBFDATETIME_SORT_KEY_INVALID
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_floatingtime_get_sort_key(
+     libfdatetime_floatingtime_t *floatingtime,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_floatingtime_get_sort_key";
+
+	if( floatingtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_floatingtime_get_sort_key(
+	     (libfdatetime_internal_floatingtime_t *) floatingtime,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of floatingtime values
+ * The floatingtime values are stored as by libfdatetime_floatingtime_copy_to_64bit
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_floatingtime_array_get_sort_keys(
+     const uint64_t *floatingtime_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_floatingtime_t internal_floatingtime;
+
+	static char *function = "libfdatetime_floatingtime_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( floatingtime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid floatingtime values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_floatingtime.timestamp.integer = floatingtime_values[ value_index ];
+
+		if( libfdatetime_internal_floatingtime_get_sort_key(
+		     &internal_floatingtime,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two floatingtime
+ * Both values are compared by their sort key
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_floatingtime_compare(
+     libfdatetime_floatingtime_t *first_floatingtime,
+     libfdatetime_floatingtime_t *second_floatingtime,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_floatingtime_compare";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_floatingtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_floatingtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second floatingtime.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_floatingtime_get_sort_key(
+	     (libfdatetime_internal_floatingtime_t *) first_floatingtime,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_floatingtime_get_sort_key(
+	     (libfdatetime_internal_floatingtime_t *) second_floatingtime,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
 /* Deterimes the size of the string for the floatingtime
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -550,34 +982,15 @@ int libfdatetime_floatingtime_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	          (libfdatetime_internal_floatingtime_t *) floatingtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -763,6 +1176,10 @@ int libfdatetime_floatingtime_copy_to_utf8_string_with_index(
 	static char *function                                       = "libfdatetime_floatingtime_copy_to_utf8_string_with_index";
 	int result                                                  = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( floatingtime == NULL )
 	{
 		libcerror_error_set(
@@ -776,32 +1193,33 @@ int libfdatetime_floatingtime_copy_to_utf8_string_with_index(
 	}
 	internal_floatingtime = (libfdatetime_internal_floatingtime_t *) floatingtime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 floatingtime,
+	 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+	  internal_floatingtime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	          internal_floatingtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -827,6 +1245,16 @@ int libfdatetime_floatingtime_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+		  internal_floatingtime ) )
+
 		result = libfdatetime_internal_floatingtime_copy_to_utf8_string_in_hexadecimal(
 		          internal_floatingtime,
 		          utf8_string,
@@ -846,6 +1274,23 @@ int libfdatetime_floatingtime_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 floatingtime,
+	 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+	  internal_floatingtime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1006,6 +1451,10 @@ int libfdatetime_floatingtime_copy_to_utf16_string_with_index(
 	static char *function                                       = "libfdatetime_floatingtime_copy_to_utf16_string_with_index";
 	int result                                                  = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( floatingtime == NULL )
 	{
 		libcerror_error_set(
@@ -1019,32 +1468,33 @@ int libfdatetime_floatingtime_copy_to_utf16_string_with_index(
 	}
 	internal_floatingtime = (libfdatetime_internal_floatingtime_t *) floatingtime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 floatingtime,
+	 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+	  internal_floatingtime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	          internal_floatingtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1070,6 +1520,16 @@ int libfdatetime_floatingtime_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+		  internal_floatingtime ) )
+
 		result = libfdatetime_internal_floatingtime_copy_to_utf16_string_in_hexadecimal(
 		          internal_floatingtime,
 		          utf16_string,
@@ -1089,6 +1549,23 @@ int libfdatetime_floatingtime_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 floatingtime,
+	 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+	  internal_floatingtime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1249,6 +1726,10 @@ int libfdatetime_floatingtime_copy_to_utf32_string_with_index(
 	static char *function                                       = "libfdatetime_floatingtime_copy_to_utf32_string_with_index";
 	int result                                                  = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( floatingtime == NULL )
 	{
 		libcerror_error_set(
@@ -1262,32 +1743,33 @@ int libfdatetime_floatingtime_copy_to_utf32_string_with_index(
 	}
 	internal_floatingtime = (libfdatetime_internal_floatingtime_t *) floatingtime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 floatingtime,
+	 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+	  internal_floatingtime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
 	          internal_floatingtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1313,6 +1795,16 @@ int libfdatetime_floatingtime_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+		 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+		  internal_floatingtime ) )
+
 		result = libfdatetime_internal_floatingtime_copy_to_utf32_string_in_hexadecimal(
 		          internal_floatingtime,
 		          utf32_string,
@@ -1332,6 +1824,23 @@ int libfdatetime_floatingtime_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 floatingtime,
+	 LIBFDATETIME_PROBE_VALUE_FLOATINGTIME(
+	  internal_floatingtime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
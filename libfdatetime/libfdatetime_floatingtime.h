@@ -76,11 +76,52 @@ int libfdatetime_floatingtime_copy_to_64bit(
      uint64_t *value_64bit,
      libcerror_error_t **error );
 
+int libfdatetime_internal_floatingtime_copy_from_date_time_values(
+     libfdatetime_internal_floatingtime_t *internal_floatingtime,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_floatingtime_copy_to_date_time_values(
      libfdatetime_internal_floatingtime_t *internal_floatingtime,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+int libfdatetime_internal_floatingtime_get_sort_key(
+     libfdatetime_internal_floatingtime_t *internal_floatingtime,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_floatingtime_get_sort_key(
+     libfdatetime_floatingtime_t *floatingtime,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_floatingtime_array_get_sort_keys(
+     const uint64_t *floatingtime_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_floatingtime_copy_from_date_time_values(
+     libfdatetime_floatingtime_t *floatingtime,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_floatingtime_compare(
+     libfdatetime_floatingtime_t *first_floatingtime,
+     libfdatetime_floatingtime_t *second_floatingtime,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_floatingtime_get_string_size(
      libfdatetime_floatingtime_t *floatingtime,
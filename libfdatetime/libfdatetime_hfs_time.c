@@ -26,8 +26,15 @@
 
 #include "libfdatetime_definitions.h"
 #include "libfdatetime_date_time_values.h"
+#include "libfdatetime_duration.h"
+#include "libfdatetime_filetime.h"
 #include "libfdatetime_hfs_time.h"
 #include "libfdatetime_libcerror.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
+#include "libfdatetime_truncate.h"
 #include "libfdatetime_types.h"
 
 /* Creates a HFS time
@@ -222,6 +229,11 @@ int libfdatetime_hfs_time_copy_from_byte_stream(
 	}
 	internal_hfs_time->timestamp = value_32bit;
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -233,10 +245,878 @@ int libfdatetime_hfs_time_copy_from_32bit(
      uint32_t value_32bit,
      libcerror_error_t **error )
 {
-	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
-	static char *function                               = "libfdatetime_hfs_time_copy_from_32bit";
+	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
+	static char *function                               = "libfdatetime_hfs_time_copy_from_32bit";
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
+
+	internal_hfs_time->timestamp = value_32bit;
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
+	return( 1 );
+}
+
+/* Converts a HFS time into a 32-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_copy_to_32bit(
+     libfdatetime_hfs_time_t *hfs_time,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
+	static char *function                               = "libfdatetime_hfs_time_copy_to_32bit";
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
+
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	*value_32bit = internal_hfs_time->timestamp;
+
+	return( 1 );
+}
+
+/* Converts date time values into a HFS time
+ * The HFS time can represent January 1, 1904 00:00:00 through February 6, 2040 06:28:15,
+ * the fraction of seconds is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_hfs_time_copy_from_date_time_values(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_internal_hfs_time_copy_from_date_time_values";
+	int64_t number_of_seconds = 0;
+
+	if( internal_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of seconds is also used to validate the date time values
+	 */
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	/* Correct the number of seconds to be relative to January 1, 1904
+	 */
+	number_of_seconds += 2082844800;
+
+	if( ( number_of_seconds < 0 )
+	 || ( number_of_seconds > (int64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time->timestamp = (uint32_t) number_of_seconds;
+
+	return( 1 );
+}
+
+/* Converts date time values into a HFS time
+ * The fraction of seconds is specified as a number of nano seconds
+ * The HFS time can represent January 1, 1904 00:00:00 through February 6, 2040 06:28:15,
+ * the fraction of seconds is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_copy_from_date_time_values(
+     libfdatetime_hfs_time_t *hfs_time,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_hfs_time_copy_from_date_time_values";
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_hfs_time_copy_from_date_time_values(
+	     (libfdatetime_internal_hfs_time_t *) hfs_time,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a HFS time into a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_copy_to_filetime(
+     libfdatetime_hfs_time_t *hfs_time,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
+	static char *function                               = "libfdatetime_hfs_time_copy_to_filetime";
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
+
+	/* The HFS time is relative to January 1, 1904 hence the FILETIME cannot overflow
+	 */
+	if( libfdatetime_internal_filetime_copy_from_number_of_seconds(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     (int64_t) internal_hfs_time->timestamp - 2082844800,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FILETIME from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a HFS time into a POSIX time
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_copy_to_posix_time(
+     libfdatetime_hfs_time_t *hfs_time,
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
+	static char *function                               = "libfdatetime_hfs_time_copy_to_posix_time";
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
+
+	if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     (int64_t) internal_hfs_time->timestamp - 2082844800,
+	     0,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an array of HFS time values into an array of FILETIME values
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_array_copy_to_filetime(
+     const uint32_t *hfs_time_values,
+     size_t number_of_values,
+     uint64_t *filetime_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_hfs_time_array_copy_to_filetime";
+	size_t value_index    = 0;
+
+	if( hfs_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The HFS time is relative to January 1, 1904 which is 9561628800 seconds
+	 * after January 1, 1601 hence the FILETIME cannot overflow
+	 */
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		filetime_values[ value_index ] = ( (uint64_t) hfs_time_values[ value_index ] + 9561628800 ) * 10000000;
+	}
+	return( 1 );
+}
+
+/* Converts a HFS time into date time values
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_hfs_time_copy_to_date_time_values(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfdatetime_internal_hfs_time_copy_to_date_time_values";
+	uint32_t hfs_timestamp = 0;
+	uint16_t days_in_year  = 0;
+	uint8_t days_in_month  = 0;
+
+	if( internal_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	hfs_timestamp = internal_hfs_time->timestamp;
+
+        date_time_values->micro_seconds = 0;
+        date_time_values->milli_seconds = 0;
+        date_time_values->nano_seconds  = 0;
+
+	/* There are 60 seconds in a minute correct the value to minutes
+	 */
+	date_time_values->seconds = hfs_timestamp % 60;
+	hfs_timestamp            /= 60;
+
+	/* There are 60 minutes in an hour correct the value to hours
+	 */
+	date_time_values->minutes = hfs_timestamp % 60;
+	hfs_timestamp            /= 60;
+
+	/* There are 24 hours in a day correct the value to days
+	 */
+	date_time_values->hours = hfs_timestamp % 24;
+	hfs_timestamp          /= 24;
+
+	/* Determine the number of years starting at 'Jan 1, 1904 00:00:00'
+	 * correct the value to days within the year
+	 */
+	/* Add 1 day to compensate that Jan 1, 1904 is represented as 0
+	 */
+	hfs_timestamp += 1;
+
+	date_time_values->year = 1904;
+
+	/* January 1, 2000 is day 35065 since January 1, 1904 is represented as day 1
+	 */
+	if( hfs_timestamp > 35064 )
+	{
+		date_time_values->year = 2000;
+
+		hfs_timestamp -= 35064;
+	}
+	while( hfs_timestamp > 0 )
+	{
+		/* Check for a leap year
+		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+		 */
+		if( ( ( ( date_time_values->year % 4 ) == 0 )
+		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+		 || ( ( date_time_values->year % 400 ) == 0 ) )
+		{
+			days_in_year = 366;
+		}
+		else
+		{
+			days_in_year = 365;
+		}
+		if( hfs_timestamp <= days_in_year )
+		{
+			break;
+		}
+		hfs_timestamp -= days_in_year;
+
+		date_time_values->year += 1;
+	}
+
+	/* Determine the month correct the value to days within the month
+	 */
+	date_time_values->month = 1;
+
+	do
+	{
+		/* February (2)
+		 */
+		if( date_time_values->month == 2 )
+		{
+			if( ( ( ( date_time_values->year % 4 ) == 0 )
+			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+			 || ( ( date_time_values->year % 400 ) == 0 ) )
+			{
+				days_in_month = 29;
+			}
+			else
+			{
+				days_in_month = 28;
+			}
+		}
+		/* April (4), June (6), September (9), November (11)
+		 */
+		else if( ( date_time_values->month == 4 )
+		      || ( date_time_values->month == 6 )
+		      || ( date_time_values->month == 9 )
+		      || ( date_time_values->month == 11 ) )
+		{
+			days_in_month = 30;
+		}
+		/* January (1), March (3), May (5), July (7), August (8), October (10), December (12)
+		 */
+		else if( ( date_time_values->month == 1 )
+		      || ( date_time_values->month == 3 )
+		      || ( date_time_values->month == 5 )
+		      || ( date_time_values->month == 7 )
+		      || ( date_time_values->month == 8 )
+		      || ( date_time_values->month == 10 )
+		      || ( date_time_values->month == 12 ) )
+		{
+			days_in_month = 31;
+		}
+		/* This should never happen, but just in case
+		 */
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported month: %d.",
+			 function,
+			 date_time_values->month );
+
+			return( -1 );
+		}
+		if( hfs_timestamp <= days_in_month )
+		{
+			break;
+		}
+		hfs_timestamp -= days_in_month;
+
+		date_time_values->month += 1;
+	}
+	while( hfs_timestamp > 0 );
+
+	/* Determine the day
+	 */
+	date_time_values->day = (uint8_t) hfs_timestamp;
+
+	return( 1 );
+}
+
+/* Retrieves the sort key of a HFS time
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_hfs_time_get_sort_key(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_hfs_time_get_sort_key";
+
+	if( internal_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	/* The HFS time is relative to January 1, 1904 which is 2082844800 seconds before January 1, 1970
+	 */
+	*sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+	             (int64_t) internal_hfs_time->timestamp - 2082844800,
+	             0 );
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A HFS time that does not represent a date and time maps to LIBFDATETIME_SORT_KEY_INVALID
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_get_sort_key(
+     libfdatetime_hfs_time_t *hfs_time,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_hfs_time_get_sort_key";
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_hfs_time_get_sort_key(
+	     (libfdatetime_internal_hfs_time_t *) hfs_time,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of HFS time values
+ * The HFS time values are stored as by libfdatetime_hfs_time_copy_to_32bit
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_array_get_sort_keys(
+     const uint32_t *hfs_time_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_hfs_time_t internal_hfs_time;
+
+	static char *function = "libfdatetime_hfs_time_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( hfs_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_hfs_time.timestamp = hfs_time_values[ value_index ];
+
+		if( libfdatetime_internal_hfs_time_get_sort_key(
+		     &internal_hfs_time,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two HFS time
+ * Both values are compared by their sort key
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_hfs_time_compare(
+     libfdatetime_hfs_time_t *first_hfs_time,
+     libfdatetime_hfs_time_t *second_hfs_time,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_hfs_time_compare";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_hfs_time_get_sort_key(
+	     (libfdatetime_internal_hfs_time_t *) first_hfs_time,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_hfs_time_get_sort_key(
+	     (libfdatetime_internal_hfs_time_t *) second_hfs_time,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
+/* Adds a number of nano seconds to the HFS time
+ * The number of nano seconds can be negative
+ * The result is rounded down to seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_add_number_of_nano_seconds(
+     libfdatetime_hfs_time_t *hfs_time,
+     int64_t number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
+	static char *function                               = "libfdatetime_hfs_time_add_number_of_nano_seconds";
+	int64_t hfs_number_of_seconds                       = 0;
+	uint32_t hfs_number_of_nano_seconds                 = 0;
+
+	if( hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
+
+	hfs_number_of_seconds = (int64_t) internal_hfs_time->timestamp;
+
+	if( libfdatetime_internal_duration_add_to_number_of_seconds(
+	     &hfs_number_of_seconds,
+	     &hfs_number_of_nano_seconds,
+	     number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hfs_number_of_seconds < 0 )
+	 || ( hfs_number_of_seconds > (int64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hfs_time->timestamp = (uint32_t) hfs_number_of_seconds;
+
+	return( 1 );
+}
+
+/* Retrieves the difference between two HFS times
+ * The difference is the first HFS time minus the second HFS time in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_hfs_time_get_difference(
+     libfdatetime_hfs_time_t *first_hfs_time,
+     libfdatetime_hfs_time_t *second_hfs_time,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_hfs_time_get_difference";
+
+	if( first_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_hfs_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second HFS time.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The difference of two 32-bit number of seconds always fits in 64-bit nano seconds
+	 */
+	*number_of_nano_seconds = libfdatetime_get_duration_from_number_of_seconds(
+	                           (int64_t) ( (libfdatetime_internal_hfs_time_t *) first_hfs_time )->timestamp,
+	                           0,
+	                           (int64_t) ( (libfdatetime_internal_hfs_time_t *) second_hfs_time )->timestamp,
+	                           0 );
+
+	return( 1 );
+}
+
+/* Truncates a HFS time to a unit
+ * The HFS time is rounded down to the start of the second, minute, hour, day, month or year
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_hfs_time_truncate(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     int unit,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfdatetime_internal_hfs_time_truncate";
+	int64_t number_of_days         = 0;
+	int64_t unit_number_of_seconds = 0;
+	int result                     = 0;
 
-	if( hfs_time == NULL )
+	if( internal_hfs_time == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -247,23 +1127,51 @@ int libfdatetime_hfs_time_copy_from_32bit(
 
 		return( -1 );
 	}
-	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          unit,
+	          &unit_number_of_seconds,
+	          error );
 
-	internal_hfs_time->timestamp = value_32bit;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unit number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		internal_hfs_time->timestamp -= internal_hfs_time->timestamp % (uint32_t) unit_number_of_seconds;
+	}
+	else
+	{
+		/* 24107 is the number of days from January 1, 1904 to January 1, 1970
+		 * since January 1, 1904 is the start of a year the result cannot be negative
+		 */
+		number_of_days = libfdatetime_internal_truncate_number_of_days(
+		                  (int64_t) ( internal_hfs_time->timestamp / 86400 ) - 24107,
+		                  unit );
 
+		internal_hfs_time->timestamp = (uint32_t) ( ( number_of_days + 24107 ) * 86400 );
+	}
 	return( 1 );
 }
 
-/* Converts a HFS time into a 32-bit value
+/* Truncates a HFS time to a unit
+ * The HFS time is rounded down to the start of the second, minute, hour, day, month or year
+ * The sub-day units are truncated with integer arithmetic only
  * Returns 1 if successful or -1 on error
  */
-int libfdatetime_hfs_time_copy_to_32bit(
+int libfdatetime_hfs_time_truncate(
      libfdatetime_hfs_time_t *hfs_time,
-     uint32_t *value_32bit,
+     int unit,
      libcerror_error_t **error )
 {
-	libfdatetime_internal_hfs_time_t *internal_hfs_time = NULL;
-	static char *function                               = "libfdatetime_hfs_time_copy_to_32bit";
+	static char *function = "libfdatetime_hfs_time_truncate";
 
 	if( hfs_time == NULL )
 	{
@@ -276,189 +1184,95 @@ int libfdatetime_hfs_time_copy_to_32bit(
 
 		return( -1 );
 	}
-	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
-
-	if( value_32bit == NULL )
+	if( libfdatetime_internal_hfs_time_truncate(
+	     (libfdatetime_internal_hfs_time_t *) hfs_time,
+	     unit,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid 32-bit value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to truncate HFS time.",
 		 function );
 
 		return( -1 );
 	}
-	*value_32bit = internal_hfs_time->timestamp;
-
 	return( 1 );
 }
 
-/* Converts a HFS time into date time values
+/* Truncates an array of 32-bit HFS time values to a unit
+ * The HFS time values and truncated HFS time values can refer to the same array
  * Returns 1 if successful or -1 on error
  */
-int libfdatetime_internal_hfs_time_copy_to_date_time_values(
-     libfdatetime_internal_hfs_time_t *internal_hfs_time,
-     libfdatetime_date_time_values_t *date_time_values,
+int libfdatetime_hfs_time_array_truncate(
+     const uint32_t *hfs_time_values,
+     size_t number_of_values,
+     int unit,
+     uint32_t *truncated_hfs_time_values,
      libcerror_error_t **error )
 {
-	static char *function  = "libfdatetime_internal_hfs_time_copy_to_date_time_values";
-	uint32_t hfs_timestamp = 0;
-	uint16_t days_in_year  = 0;
-	uint8_t days_in_month  = 0;
+	libfdatetime_internal_hfs_time_t internal_hfs_time;
 
-	if( internal_hfs_time == NULL )
+	static char *function = "libfdatetime_hfs_time_array_truncate";
+	size_t value_index    = 0;
+
+	if( hfs_time_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid HFS time.",
+		 "%s: invalid HFS time values.",
 		 function );
 
 		return( -1 );
 	}
-	if( date_time_values == NULL )
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint32_t ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid date time values.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	hfs_timestamp = internal_hfs_time->timestamp;
-
-        date_time_values->micro_seconds = 0;
-        date_time_values->milli_seconds = 0;
-        date_time_values->nano_seconds  = 0;
-
-	/* There are 60 seconds in a minute correct the value to minutes
-	 */
-	date_time_values->seconds = hfs_timestamp % 60;
-	hfs_timestamp            /= 60;
-
-	/* There are 60 minutes in an hour correct the value to hours
-	 */
-	date_time_values->minutes = hfs_timestamp % 60;
-	hfs_timestamp            /= 60;
-
-	/* There are 24 hours in a day correct the value to days
-	 */
-	date_time_values->hours = hfs_timestamp % 24;
-	hfs_timestamp          /= 24;
-
-	/* Determine the number of years starting at 'Jan 1, 1904 00:00:00'
-	 * correct the value to days within the year
-	 */
-	/* Add 1 day to compensate that Jan 1, 1904 is represented as 0
-	 */
-	hfs_timestamp += 1;
-
-	date_time_values->year = 1904;
-
-	if( hfs_timestamp >= 35064 )
+	if( truncated_hfs_time_values == NULL )
 	{
-		date_time_values->year = 2000;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid truncated HFS time values.",
+		 function );
 
-		hfs_timestamp -= 35064;
+		return( -1 );
 	}
-	while( hfs_timestamp > 0 )
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
 	{
-		/* Check for a leap year
-		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
-		 */
-		if( ( ( ( date_time_values->year % 4 ) == 0 )
-		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
-		 || ( ( date_time_values->year % 400 ) == 0 ) )
-		{
-			days_in_year = 366;
-		}
-		else
-		{
-			days_in_year = 365;
-		}
-		if( hfs_timestamp <= days_in_year )
-		{
-			break;
-		}
-		hfs_timestamp -= days_in_year;
-
-		date_time_values->year += 1;
-	}
+		internal_hfs_time.timestamp = hfs_time_values[ value_index ];
 
-	/* Determine the month correct the value to days within the month
-	 */
-	date_time_values->month = 1;
-
-	do
-	{
-		/* February (2)
-		 */
-		if( date_time_values->month == 2 )
-		{
-			if( ( ( ( date_time_values->year % 4 ) == 0 )
-			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
-			 || ( ( date_time_values->year % 400 ) == 0 ) )
-			{
-				days_in_month = 29;
-			}
-			else
-			{
-				days_in_month = 28;
-			}
-		}
-		/* April (4), June (6), September (9), November (11)
-		 */
-		else if( ( date_time_values->month == 4 )
-		      || ( date_time_values->month == 6 )
-		      || ( date_time_values->month == 9 )
-		      || ( date_time_values->month == 11 ) )
-		{
-			days_in_month = 30;
-		}
-		/* January (1), March (3), May (5), July (7), August (8), October (10), December (12)
-		 */
-		else if( ( date_time_values->month == 1 )
-		      || ( date_time_values->month == 3 )
-		      || ( date_time_values->month == 5 )
-		      || ( date_time_values->month == 7 )
-		      || ( date_time_values->month == 8 )
-		      || ( date_time_values->month == 10 )
-		      || ( date_time_values->month == 12 ) )
-		{
-			days_in_month = 31;
-		}
-		/* This should never happen, but just in case
-		 */
-		else
+		if( libfdatetime_internal_hfs_time_truncate(
+		     &internal_hfs_time,
+		     unit,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported month: %d.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to truncate value: %" PRIzd ".",
 			 function,
-			 date_time_values->month );
+			 value_index );
 
 			return( -1 );
 		}
-		if( hfs_timestamp <= days_in_month )
-		{
-			break;
-		}
-		hfs_timestamp -= days_in_month;
-
-		date_time_values->month += 1;
+		truncated_hfs_time_values[ value_index ] = internal_hfs_time.timestamp;
 	}
-	while( hfs_timestamp > 0 );
-
-	/* Determine the day
-	 */
-	date_time_values->day = (uint8_t) hfs_timestamp;
-
 	return( 1 );
 }
 
@@ -499,34 +1313,15 @@ int libfdatetime_hfs_time_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
 	          (libfdatetime_internal_hfs_time_t *) hfs_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -712,6 +1507,10 @@ int libfdatetime_hfs_time_copy_to_utf8_string_with_index(
 	static char *function                               = "libfdatetime_hfs_time_copy_to_utf8_string_with_index";
 	int result                                          = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( hfs_time == NULL )
 	{
 		libcerror_error_set(
@@ -725,32 +1524,33 @@ int libfdatetime_hfs_time_copy_to_utf8_string_with_index(
 	}
 	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 hfs_time,
+	 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+	  internal_hfs_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
 	          internal_hfs_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -776,6 +1576,16 @@ int libfdatetime_hfs_time_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+		  internal_hfs_time ) )
+
 		result = libfdatetime_internal_hfs_time_copy_to_utf8_string_in_hexadecimal(
 		          internal_hfs_time,
 		          utf8_string,
@@ -795,6 +1605,23 @@ int libfdatetime_hfs_time_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 hfs_time,
+	 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+	  internal_hfs_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -955,6 +1782,10 @@ int libfdatetime_hfs_time_copy_to_utf16_string_with_index(
 	static char *function                               = "libfdatetime_hfs_time_copy_to_utf16_string_with_index";
 	int result                                          = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( hfs_time == NULL )
 	{
 		libcerror_error_set(
@@ -968,32 +1799,33 @@ int libfdatetime_hfs_time_copy_to_utf16_string_with_index(
 	}
 	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 hfs_time,
+	 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+	  internal_hfs_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
 	          internal_hfs_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1066,6 +1898,16 @@ int libfdatetime_hfs_time_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+		  internal_hfs_time ) )
+
 		result = libfdatetime_internal_hfs_time_copy_to_utf16_string_in_hexadecimal(
 		          internal_hfs_time,
 		          utf16_string,
@@ -1085,6 +1927,23 @@ int libfdatetime_hfs_time_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 hfs_time,
+	 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+	  internal_hfs_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1245,6 +2104,10 @@ int libfdatetime_hfs_time_copy_to_utf32_string_with_index(
 	static char *function                               = "libfdatetime_hfs_time_copy_to_utf32_string_with_index";
 	int result                                          = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( hfs_time == NULL )
 	{
 		libcerror_error_set(
@@ -1258,32 +2121,33 @@ int libfdatetime_hfs_time_copy_to_utf32_string_with_index(
 	}
 	internal_hfs_time = (libfdatetime_internal_hfs_time_t *) hfs_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 hfs_time,
+	 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+	  internal_hfs_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
 	          internal_hfs_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1309,6 +2173,16 @@ int libfdatetime_hfs_time_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+		 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+		  internal_hfs_time ) )
+
 		result = libfdatetime_internal_hfs_time_copy_to_utf32_string_in_hexadecimal(
 		          internal_hfs_time,
 		          utf32_string,
@@ -1328,6 +2202,23 @@ int libfdatetime_hfs_time_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 hfs_time,
+	 LIBFDATETIME_PROBE_VALUE_HFS_TIME(
+	  internal_hfs_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
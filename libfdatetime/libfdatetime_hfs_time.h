@@ -74,11 +74,104 @@ int libfdatetime_hfs_time_copy_to_32bit(
      uint32_t *value_32bit,
      libcerror_error_t **error );
 
+int libfdatetime_internal_hfs_time_copy_from_date_time_values(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_copy_to_filetime(
+     libfdatetime_hfs_time_t *hfs_time,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_copy_to_posix_time(
+     libfdatetime_hfs_time_t *hfs_time,
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_array_copy_to_filetime(
+     const uint32_t *hfs_time_values,
+     size_t number_of_values,
+     uint64_t *filetime_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_hfs_time_copy_to_date_time_values(
      libfdatetime_internal_hfs_time_t *internal_hfs_time,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+int libfdatetime_internal_hfs_time_get_sort_key(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_get_sort_key(
+     libfdatetime_hfs_time_t *hfs_time,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_array_get_sort_keys(
+     const uint32_t *hfs_time_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_copy_from_date_time_values(
+     libfdatetime_hfs_time_t *hfs_time,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_compare(
+     libfdatetime_hfs_time_t *first_hfs_time,
+     libfdatetime_hfs_time_t *second_hfs_time,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_add_number_of_nano_seconds(
+     libfdatetime_hfs_time_t *hfs_time,
+     int64_t number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_get_difference(
+     libfdatetime_hfs_time_t *first_hfs_time,
+     libfdatetime_hfs_time_t *second_hfs_time,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_hfs_time_truncate(
+     libfdatetime_internal_hfs_time_t *internal_hfs_time,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_truncate(
+     libfdatetime_hfs_time_t *hfs_time,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_hfs_time_array_truncate(
+     const uint32_t *hfs_time_values,
+     size_t number_of_values,
+     int unit,
+     uint32_t *truncated_hfs_time_values,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_hfs_time_get_string_size(
      libfdatetime_hfs_time_t *hfs_time,
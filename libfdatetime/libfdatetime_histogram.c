@@ -0,0 +1,740 @@
+/*
+ * Histogram functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_filetime.h"
+#include "libfdatetime_floatingtime.h"
+#include "libfdatetime_histogram.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_nsf_timedate.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_sort.h"
+
+/* Retrieves the size of a bucket and of a cycle of buckets in 100 nano seconds intervals
+ * The cycle size is 0 if the buckets are not cyclic
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_histogram_get_bucket_size(
+     int bucket_unit,
+     int64_t *bucket_size,
+     int64_t *cycle_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_histogram_get_bucket_size";
+
+	if( bucket_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket size.",
+		 function );
+
+		return( -1 );
+	}
+	if( cycle_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cycle size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( bucket_unit )
+	{
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_SECOND:
+			*bucket_size = 10000000;
+			*cycle_size  = 0;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_MINUTE:
+			*bucket_size = 600000000;
+			*cycle_size  = 0;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR:
+			*bucket_size = 36000000000;
+			*cycle_size  = 0;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY:
+			*bucket_size = 864000000000;
+			*cycle_size  = 0;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_WEEK:
+			*bucket_size = 6048000000000;
+			*cycle_size  = 0;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR_OF_DAY:
+			*bucket_size = 36000000000;
+			*cycle_size  = 864000000000;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY_OF_WEEK:
+			*bucket_size = 864000000000;
+			*cycle_size  = 6048000000000;
+			break;
+
+		case LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR_OF_WEEK:
+			*bucket_size = 36000000000;
+			*cycle_size  = 6048000000000;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported bucket unit: %d.",
+			 function,
+			 bucket_unit );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Counts sort keys in the counts of a histogram worker
+ * The bucket index is determined without branches so that the loop does not depend on
+ * the distribution of the sort keys, sort keys outside the range of the histogram and
+ * the minimum, maximum and invalid sort keys are counted in the last entry of the counts
+ */
+void libfdatetime_internal_histogram_worker_count_sort_keys(
+      libfdatetime_internal_histogram_worker_t *histogram_worker,
+      const int64_t *sort_keys,
+      size_t number_of_sort_keys )
+{
+	uint64_t *counts          = NULL;
+	size_t sort_key_index     = 0;
+	uint64_t bucket_index     = 0;
+	uint64_t bucket_size      = 0;
+	uint64_t is_in_range      = 0;
+	uint64_t number_of_counts = 0;
+	int64_t cycle_origin      = 0;
+	int64_t cycle_size        = 0;
+	int64_t offset            = 0;
+	int64_t origin            = 0;
+	int64_t sort_key          = 0;
+
+	if( ( histogram_worker == NULL )
+	 || ( sort_keys == NULL ) )
+	{
+		return;
+	}
+	counts           = histogram_worker->counts;
+	number_of_counts = (uint64_t) histogram_worker->number_of_counts;
+	bucket_size      = (uint64_t) histogram_worker->bucket_size;
+	cycle_size       = histogram_worker->cycle_size;
+	origin           = histogram_worker->origin;
+
+	if( cycle_size == 0 )
+	{
+		for( sort_key_index = 0;
+		     sort_key_index < number_of_sort_keys;
+		     sort_key_index++ )
+		{
+			sort_key = sort_keys[ sort_key_index ];
+
+			/* The difference is determined unsigned since it cannot overflow
+			 * when the sort key is not before the origin
+			 */
+			bucket_index = ( (uint64_t) sort_key - (uint64_t) origin ) / bucket_size;
+
+			is_in_range = (uint64_t) ( ( sort_key > LIBFDATETIME_SORT_KEY_MINIMUM )
+			                         & ( sort_key < LIBFDATETIME_SORT_KEY_MAXIMUM )
+			                         & ( sort_key >= origin )
+			                         & ( bucket_index < number_of_counts ) );
+
+			bucket_index = ( bucket_index & ( 0 - is_in_range ) )
+			             | ( number_of_counts & ( is_in_range - 1 ) );
+
+			counts[ bucket_index ] += 1;
+		}
+	}
+	else
+	{
+		cycle_origin = origin % cycle_size;
+
+		if( cycle_origin < 0 )
+		{
+			cycle_origin += cycle_size;
+		}
+		for( sort_key_index = 0;
+		     sort_key_index < number_of_sort_keys;
+		     sort_key_index++ )
+		{
+			sort_key = sort_keys[ sort_key_index ];
+
+			/* Determine the offset of the sort key in the cycle relative to the origin
+			 * the remainders are rounded down for sort keys before the origin
+			 */
+			offset  = sort_key % cycle_size;
+			offset += cycle_size & ( 0 - (int64_t) ( offset < 0 ) );
+			offset -= cycle_origin;
+			offset += cycle_size & ( 0 - (int64_t) ( offset < 0 ) );
+
+			bucket_index = (uint64_t) offset / bucket_size;
+
+			is_in_range = (uint64_t) ( ( sort_key > LIBFDATETIME_SORT_KEY_MINIMUM )
+			                         & ( sort_key < LIBFDATETIME_SORT_KEY_MAXIMUM ) );
+
+			bucket_index = ( bucket_index & ( 0 - is_in_range ) )
+			             | ( number_of_counts & ( is_in_range - 1 ) );
+
+			counts[ bucket_index ] += 1;
+		}
+	}
+}
+
+/* Counts the values of a histogram worker
+ * The values are converted into sort keys in chunks so that no additional memory is needed
+ */
+void libfdatetime_internal_histogram_worker_count(
+      libfdatetime_internal_histogram_worker_t *histogram_worker )
+{
+	int64_t sort_keys[ LIBFDATETIME_HISTOGRAM_CHUNK_SIZE ];
+
+	const uint64_t *values = NULL;
+	size_t chunk_index     = 0;
+	size_t chunk_size      = 0;
+	size_t last_index      = 0;
+	size_t value_index     = 0;
+	int result             = 0;
+
+	if( histogram_worker == NULL )
+	{
+		return;
+	}
+	histogram_worker->result = 1;
+
+	if( histogram_worker->sort_keys != NULL )
+	{
+		libfdatetime_internal_histogram_worker_count_sort_keys(
+		 histogram_worker,
+		 &( histogram_worker->sort_keys[ histogram_worker->first_value_index ] ),
+		 histogram_worker->number_of_values );
+
+		return;
+	}
+	last_index = histogram_worker->first_value_index + histogram_worker->number_of_values;
+
+	for( value_index = histogram_worker->first_value_index;
+	     value_index < last_index;
+	     value_index += chunk_size )
+	{
+		chunk_size = last_index - value_index;
+
+		if( chunk_size > LIBFDATETIME_HISTOGRAM_CHUNK_SIZE )
+		{
+			chunk_size = LIBFDATETIME_HISTOGRAM_CHUNK_SIZE;
+		}
+		values = &( histogram_worker->values[ value_index ] );
+
+		switch( histogram_worker->timestamp_type )
+		{
+			case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+				/* The sort key is a FILETIME that is saturated to the range of a signed 64-bit integer
+				 */
+				for( chunk_index = 0;
+				     chunk_index < chunk_size;
+				     chunk_index++ )
+				{
+					sort_keys[ chunk_index ] = ( values[ chunk_index ] >= (uint64_t) LIBFDATETIME_SORT_KEY_MAXIMUM ) ? LIBFDATETIME_SORT_KEY_MAXIMUM : (int64_t) values[ chunk_index ];
+				}
+				result = 1;
+
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+				result = libfdatetime_floatingtime_array_get_sort_keys(
+				          values,
+				          chunk_size,
+				          sort_keys,
+				          NULL );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+				result = libfdatetime_nsf_timedate_array_get_sort_keys(
+				          values,
+				          chunk_size,
+				          sort_keys,
+				          NULL );
+				break;
+
+			case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+				result = libfdatetime_posix_time_array_get_sort_keys(
+				          values,
+				          chunk_size,
+				          histogram_worker->value_type,
+				          sort_keys,
+				          NULL );
+				break;
+
+			default:
+				result = -1;
+
+				break;
+		}
+		if( result != 1 )
+		{
+			histogram_worker->result = -1;
+
+			return;
+		}
+		libfdatetime_internal_histogram_worker_count_sort_keys(
+		 histogram_worker,
+		 sort_keys,
+		 chunk_size );
+	}
+}
+
+/* The start function of a histogram worker
+ * Returns NULL
+ */
+static void *libfdatetime_internal_histogram_worker_start_function(
+              void *arguments )
+{
+	libfdatetime_internal_histogram_worker_count(
+	 (libfdatetime_internal_histogram_worker_t *) arguments );
+
+	return( NULL );
+}
+
+/* Builds a histogram of values or sort keys
+ * Every worker counts its part of the values in its own partial counts,
+ * which are added to the counts when all workers have finished
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_histogram_build(
+     int timestamp_type,
+     const uint64_t *values,
+     const int64_t *sort_keys,
+     size_t number_of_values,
+     uint8_t value_type,
+     int bucket_unit,
+     int64_t origin,
+     uint64_t *counts,
+     size_t number_of_counts,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_histogram_worker_t *histogram_workers = NULL;
+	uint64_t *partial_counts                                    = NULL;
+	static char *function                                       = "libfdatetime_internal_histogram_build";
+	size_t count_index                                          = 0;
+	size_t number_of_partial_counts                             = 0;
+	size_t number_of_values_per_worker                          = 0;
+	int64_t bucket_size                                         = 0;
+	int64_t cycle_size                                          = 0;
+	int number_of_workers                                       = 0;
+	int worker_index                                            = 0;
+
+	if( ( values == NULL )
+	 && ( sort_keys == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_counts == 0 )
+	 || ( number_of_counts > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of counts value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		if( ( timestamp_type != LIBFDATETIME_TIMESTAMP_TYPE_FILETIME )
+		 && ( timestamp_type != LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME )
+		 && ( timestamp_type != LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE )
+		 && ( timestamp_type != LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timestamp type.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( timestamp_type == LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+		 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfdatetime_internal_histogram_get_bucket_size(
+	     bucket_unit,
+	     &bucket_size,
+	     &cycle_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cycle_size != 0 )
+	 && ( number_of_counts < (size_t) ( cycle_size / bucket_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of counts value too small for bucket unit.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	number_of_workers = number_of_threads;
+
+	if( (size_t) number_of_workers > ( number_of_values / LIBFDATETIME_HISTOGRAM_MINIMUM_NUMBER_OF_VALUES_PER_THREAD ) )
+	{
+		number_of_workers = (int) ( number_of_values / LIBFDATETIME_HISTOGRAM_MINIMUM_NUMBER_OF_VALUES_PER_THREAD );
+	}
+	if( number_of_workers == 0 )
+	{
+		number_of_workers = 1;
+	}
+	/* Every worker has its own partial counts so that the workers do not share cache lines,
+	 * the additional entry of the partial counts is used for values outside the range of the histogram
+	 */
+	number_of_partial_counts = number_of_counts + 1;
+
+	if( ( (size_t) number_of_workers * number_of_partial_counts ) > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+	{
+		number_of_workers = (int) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) / number_of_partial_counts );
+	}
+	histogram_workers = (libfdatetime_internal_histogram_worker_t *) memory_allocate(
+	                                                                  sizeof( libfdatetime_internal_histogram_worker_t ) * number_of_workers );
+
+	if( histogram_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create histogram workers.",
+		 function );
+
+		goto on_error;
+	}
+	partial_counts = (uint64_t *) memory_allocate(
+	                               sizeof( uint64_t ) * number_of_workers * number_of_partial_counts );
+
+	if( partial_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partial counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     partial_counts,
+	     0,
+	     sizeof( uint64_t ) * number_of_workers * number_of_partial_counts ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partial counts.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_values_per_worker = number_of_values / number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		histogram_workers[ worker_index ].timestamp_type    = timestamp_type;
+		histogram_workers[ worker_index ].values            = values;
+		histogram_workers[ worker_index ].sort_keys         = sort_keys;
+		histogram_workers[ worker_index ].value_type        = value_type;
+		histogram_workers[ worker_index ].first_value_index = number_of_values_per_worker * worker_index;
+		histogram_workers[ worker_index ].number_of_values  = number_of_values_per_worker;
+		histogram_workers[ worker_index ].origin            = origin;
+		histogram_workers[ worker_index ].bucket_size       = bucket_size;
+		histogram_workers[ worker_index ].cycle_size        = cycle_size;
+		histogram_workers[ worker_index ].counts            = &( partial_counts[ worker_index * number_of_partial_counts ] );
+		histogram_workers[ worker_index ].number_of_counts  = number_of_counts;
+		histogram_workers[ worker_index ].result            = 0;
+	}
+	histogram_workers[ number_of_workers - 1 ].number_of_values = number_of_values - histogram_workers[ number_of_workers - 1 ].first_value_index;
+
+	libfdatetime_internal_sort_run_workers(
+	 (void *) histogram_workers,
+	 sizeof( libfdatetime_internal_histogram_worker_t ),
+	 number_of_workers,
+	 &libfdatetime_internal_histogram_worker_start_function );
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( histogram_workers[ worker_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to count values of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	/* The counts are only changed when all workers were successful
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		for( count_index = 0;
+		     count_index < number_of_counts;
+		     count_index++ )
+		{
+			counts[ count_index ] += histogram_workers[ worker_index ].counts[ count_index ];
+		}
+	}
+	memory_free(
+	 partial_counts );
+
+	memory_free(
+	 histogram_workers );
+
+	return( 1 );
+
+on_error:
+	if( partial_counts != NULL )
+	{
+		memory_free(
+		 partial_counts );
+	}
+	if( histogram_workers != NULL )
+	{
+		memory_free(
+		 histogram_workers );
+	}
+	return( -1 );
+}
+
+/* Builds a histogram of timestamp values
+ * The timestamp type is either FILETIME, floatingtime, NSF timedate or POSIX time,
+ * the value type is only used by the POSIX time timestamp type and should be 0 otherwise
+ * The value with sort key K is counted in bucket floor( ( K - origin ) / bucket size ),
+ * where the origin is a sort key, the number of 100 nano seconds intervals since January 1, 1601
+ * For the cyclic bucket units the bucket is taken modulo the number of buckets in the cycle,
+ * e.g. for LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY_OF_WEEK and an origin of 0 bucket 0 contains Mondays
+ * The counts are added to, so that a histogram can be built over multiple calls,
+ * values outside the range of the counts and values without a valid sort key are not counted
+ * The values are split over number of threads worker threads, if supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_histogram_build(
+     int timestamp_type,
+     const uint64_t *values,
+     size_t number_of_values,
+     uint8_t value_type,
+     int bucket_unit,
+     int64_t origin,
+     uint64_t *counts,
+     size_t number_of_counts,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_histogram_build";
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_histogram_build(
+	     timestamp_type,
+	     values,
+	     NULL,
+	     number_of_values,
+	     value_type,
+	     bucket_unit,
+	     origin,
+	     counts,
+	     number_of_counts,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build histogram.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds a histogram of sort keys
+ * The sort keys are counted in the same way as by libfdatetime_histogram_build
+ * which allows to build a histogram of timestamps of any type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_sort_keys_build_histogram(
+     const int64_t *sort_keys,
+     size_t number_of_sort_keys,
+     int bucket_unit,
+     int64_t origin,
+     uint64_t *counts,
+     size_t number_of_counts,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_sort_keys_build_histogram";
+
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_histogram_build(
+	     LIBFDATETIME_TIMESTAMP_TYPE_UNDEFINED,
+	     NULL,
+	     sort_keys,
+	     number_of_sort_keys,
+	     0,
+	     bucket_unit,
+	     origin,
+	     counts,
+	     number_of_counts,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build histogram.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,153 @@
+/*
+ * Histogram functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_HISTOGRAM_H )
+#define _LIBFDATETIME_HISTOGRAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of values that are converted into sort keys at a time by a histogram worker
+ */
+#define LIBFDATETIME_HISTOGRAM_CHUNK_SIZE			256
+
+/* The minimum number of values handled by a histogram worker thread
+ */
+#define LIBFDATETIME_HISTOGRAM_MINIMUM_NUMBER_OF_VALUES_PER_THREAD	16384
+
+typedef struct libfdatetime_internal_histogram_worker libfdatetime_internal_histogram_worker_t;
+
+struct libfdatetime_internal_histogram_worker
+{
+	/* The timestamp type
+	 */
+	int timestamp_type;
+
+	/* The values
+	 */
+	const uint64_t *values;
+
+	/* The sort keys, used instead of the values if not NULL
+	 */
+	const int64_t *sort_keys;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The index of the first value handled by the worker
+	 */
+	size_t first_value_index;
+
+	/* The number of values handled by the worker
+	 */
+	size_t number_of_values;
+
+	/* The origin sort key
+	 */
+	int64_t origin;
+
+	/* The bucket size in 100 nano seconds intervals
+	 */
+	int64_t bucket_size;
+
+	/* The cycle size in 100 nano seconds intervals, 0 if the buckets are not cyclic
+	 */
+	int64_t cycle_size;
+
+	/* The counts, contains number of counts + 1 entries, where the last entry
+	 * counts the values that are outside the range of the histogram
+	 */
+	uint64_t *counts;
+
+	/* The number of counts
+	 */
+	size_t number_of_counts;
+
+	/* The result of the worker, 1 if successful or -1 on error
+	 */
+	int result;
+};
+
+int libfdatetime_internal_histogram_get_bucket_size(
+     int bucket_unit,
+     int64_t *bucket_size,
+     int64_t *cycle_size,
+     libcerror_error_t **error );
+
+void libfdatetime_internal_histogram_worker_count_sort_keys(
+      libfdatetime_internal_histogram_worker_t *histogram_worker,
+      const int64_t *sort_keys,
+      size_t number_of_sort_keys );
+
+void libfdatetime_internal_histogram_worker_count(
+      libfdatetime_internal_histogram_worker_t *histogram_worker );
+
+int libfdatetime_internal_histogram_build(
+     int timestamp_type,
+     const uint64_t *values,
+     const int64_t *sort_keys,
+     size_t number_of_values,
+     uint8_t value_type,
+     int bucket_unit,
+     int64_t origin,
+     uint64_t *counts,
+     size_t number_of_counts,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_histogram_build(
+     int timestamp_type,
+     const uint64_t *values,
+     size_t number_of_values,
+     uint8_t value_type,
+     int bucket_unit,
+     int64_t origin,
+     uint64_t *counts,
+     size_t number_of_counts,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_sort_keys_build_histogram(
+     const int64_t *sort_keys,
+     size_t number_of_sort_keys,
+     int bucket_unit,
+     int64_t origin,
+     uint64_t *counts,
+     size_t number_of_counts,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_HISTOGRAM_H ) */
+
@@ -26,8 +26,12 @@
 
 #include "libfdatetime_definitions.h"
 #include "libfdatetime_date_time_values.h"
+#include "libfdatetime_duration.h"
 #include "libfdatetime_libcerror.h"
 #include "libfdatetime_nsf_timedate.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
 #include "libfdatetime_types.h"
 
 /* Creates a NSF timedate
@@ -231,6 +235,11 @@ int libfdatetime_nsf_timedate_copy_from_byte_stream(
 		byte_stream,
 		internal_nsf_timedate->lower );
 	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -261,6 +270,11 @@ int libfdatetime_nsf_timedate_copy_from_64bit(
 	internal_nsf_timedate->upper = value_64bit >> 32;
 	internal_nsf_timedate->lower = value_64bit & 0xffffffffUL;
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -306,6 +320,144 @@ int libfdatetime_nsf_timedate_copy_to_64bit(
 	return( 1 );
 }
 
+/* Converts date time values into a NSF timedate
+ * The date time values are considered to be in UTC and the timezone and daylight savings
+ * bits of the NSF timedate are cleared, the fraction of seconds is truncated to 10 milli seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+     libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfdatetime_internal_nsf_timedate_copy_from_date_time_values";
+	int64_t number_of_days            = 0;
+	int64_t number_of_seconds         = 0;
+	uint32_t number_of_seconds_in_day = 0;
+
+	if( internal_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of seconds is also used to validate the date time values
+	 */
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds_in_day = ( (uint32_t) date_time_values->hours * 3600 )
+	                         + ( (uint32_t) date_time_values->minutes * 60 )
+	                         + (uint32_t) date_time_values->seconds;
+
+	/* The NSF Julian day of January 1, 1970 is 2440588
+	 */
+	number_of_days = ( ( number_of_seconds - number_of_seconds_in_day ) / 86400 ) + 2440588;
+
+	if( ( number_of_days < 0 )
+	 || ( number_of_days > (int64_t) 0x00ffffffL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of days value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_nsf_timedate->upper = (uint32_t) number_of_days;
+	internal_nsf_timedate->lower = ( number_of_seconds_in_day * 100 )
+	                             + ( (uint32_t) date_time_values->milli_seconds / 10 );
+
+	return( 1 );
+}
+
+/* Converts date time values into a NSF timedate
+ * The fraction of seconds is specified as a number of nano seconds
+ * The date time values are considered to be in UTC and the timezone and daylight savings
+ * bits of the NSF timedate are cleared, the fraction of seconds is truncated to 10 milli seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_nsf_timedate_copy_from_date_time_values(
+     libfdatetime_nsf_timedate_t *nsf_timedate,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_nsf_timedate_copy_from_date_time_values";
+
+	if( nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+	     (libfdatetime_internal_nsf_timedate_t *) nsf_timedate,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Converts a NSF timedate into date time values
  * Returns 1 if successful or -1 on error
  */
@@ -473,6 +625,510 @@ int libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
 	return( 1 );
 }
 
+/* Retrieves the sort key of a NSF timedate
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_nsf_timedate_get_sort_key(
+     libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_internal_nsf_timedate_get_sort_key";
+	int64_t number_of_seconds = 0;
+	uint32_t nsf_julian_day   = 0;
+
+	if( internal_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	/* Retrieve the Julian day value which is stored in the 24 LSB of the upper value
+	 */
+	nsf_julian_day = internal_nsf_timedate->upper & 0x00ffffffUL;
+
+	/* Julian day 1721060 is January 1, 0000 and Julian day 5373484 is December 31, 9999
+	 * which is the range of years supported by the NSF timedate
+	 * the lower value contains the number of 10 milli seconds in the day
+	 */
+	if( ( nsf_julian_day < 1721060 )
+	 || ( nsf_julian_day > 5373484 )
+	 || ( internal_nsf_timedate->lower >= 8640000 ) )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+
+		return( 1 );
+	}
+	/* Julian day 2440588 is January 1, 1970
+	 */
+	number_of_seconds = ( ( (int64_t) nsf_julian_day - 2440588 ) * 86400 )
+	                  + (int64_t) ( internal_nsf_timedate->lower / 100 );
+
+	*sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+	             number_of_seconds,
+	             ( internal_nsf_timedate->lower % 100 ) * 10000000 );
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A NSF timedate that does not represent a date and time maps to LIBFDATETIME_SORT_KEY_INVALID
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_nsf_timedate_get_sort_key(
+     libfdatetime_nsf_timedate_t *nsf_timedate,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_nsf_timedate_get_sort_key";
+
+	if( nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_nsf_timedate_get_sort_key(
+	     (libfdatetime_internal_nsf_timedate_t *) nsf_timedate,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of NSF timedate values
+ * The NSF timedate values are stored as by libfdatetime_nsf_timedate_copy_to_64bit
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_nsf_timedate_array_get_sort_keys(
+     const uint64_t *nsf_timedate_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_nsf_timedate_t internal_nsf_timedate;
+
+	static char *function = "libfdatetime_nsf_timedate_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( nsf_timedate_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_nsf_timedate.upper = (uint32_t) ( nsf_timedate_values[ value_index ] >> 32 );
+		internal_nsf_timedate.lower = (uint32_t) ( nsf_timedate_values[ value_index ] & 0xffffffffUL );
+
+		if( libfdatetime_internal_nsf_timedate_get_sort_key(
+		     &internal_nsf_timedate,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two NSF timedate
+ * Both values are compared by their sort key
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_nsf_timedate_compare(
+     libfdatetime_nsf_timedate_t *first_nsf_timedate,
+     libfdatetime_nsf_timedate_t *second_nsf_timedate,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_nsf_timedate_compare";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_nsf_timedate_get_sort_key(
+	     (libfdatetime_internal_nsf_timedate_t *) first_nsf_timedate,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_nsf_timedate_get_sort_key(
+	     (libfdatetime_internal_nsf_timedate_t *) second_nsf_timedate,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
+/* Retrieves the number of seconds since January 1, 1970 00:00:00 of a NSF timedate
+ * The timezone is ignored, the remainder is returned as number of nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_nsf_timedate_get_number_of_seconds(
+     libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_internal_nsf_timedate_get_number_of_seconds";
+	uint32_t nsf_julian_day = 0;
+
+	if( internal_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	nsf_julian_day = internal_nsf_timedate->upper & 0x00ffffffUL;
+
+	if( ( nsf_julian_day < 1721060 )
+	 || ( nsf_julian_day > 5373484 )
+	 || ( internal_nsf_timedate->lower >= 8640000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid NSF timedate value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Julian day 2440588 is January 1, 1970
+	 */
+	*number_of_seconds = ( ( (int64_t) nsf_julian_day - 2440588 ) * 86400 )
+	                   + (int64_t) ( internal_nsf_timedate->lower / 100 );
+
+	*number_of_nano_seconds = ( internal_nsf_timedate->lower % 100 ) * 10000000;
+
+	return( 1 );
+}
+
+/* Adds a number of nano seconds to the NSF timedate
+ * The number of nano seconds can be negative
+ * The result is rounded down to 100th seconds, the timezone is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+     libfdatetime_nsf_timedate_t *nsf_timedate,
+     int64_t number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate = NULL;
+	static char *function                                       = "libfdatetime_nsf_timedate_add_number_of_nano_seconds";
+	int64_t nsf_julian_day                                      = 0;
+	int64_t nsf_number_of_seconds                               = 0;
+	int64_t remainder                                           = 0;
+	uint32_t nsf_number_of_nano_seconds                         = 0;
+
+	if( nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	internal_nsf_timedate = (libfdatetime_internal_nsf_timedate_t *) nsf_timedate;
+
+	if( libfdatetime_internal_nsf_timedate_get_number_of_seconds(
+	     internal_nsf_timedate,
+	     &nsf_number_of_seconds,
+	     &nsf_number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_duration_add_to_number_of_seconds(
+	     &nsf_number_of_seconds,
+	     &nsf_number_of_nano_seconds,
+	     number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	nsf_julian_day = nsf_number_of_seconds / 86400;
+	remainder      = nsf_number_of_seconds % 86400;
+
+	/* Round the number of days down for dates before January 1, 1970
+	 */
+	if( remainder < 0 )
+	{
+		nsf_julian_day -= 1;
+		remainder      += 86400;
+	}
+	nsf_julian_day += 2440588;
+
+	if( ( nsf_julian_day < 1721060 )
+	 || ( nsf_julian_day > 5373484 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_nsf_timedate->upper = ( internal_nsf_timedate->upper & 0xff000000UL )
+	                             | (uint32_t) nsf_julian_day;
+
+	internal_nsf_timedate->lower = ( (uint32_t) remainder * 100 )
+	                             + ( nsf_number_of_nano_seconds / 10000000 );
+
+	return( 1 );
+}
+
+/* Retrieves the difference between two NSF timedates
+ * The timezones are ignored
+ * The difference is the first NSF timedate minus the second NSF timedate in nano seconds
+ * and is saturated to the range of a signed 64-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_nsf_timedate_get_difference(
+     libfdatetime_nsf_timedate_t *first_nsf_timedate,
+     libfdatetime_nsf_timedate_t *second_nsf_timedate,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libfdatetime_nsf_timedate_get_difference";
+	int64_t first_number_of_seconds        = 0;
+	int64_t second_number_of_seconds       = 0;
+	uint32_t first_number_of_nano_seconds  = 0;
+	uint32_t second_number_of_nano_seconds = 0;
+
+	if( first_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_nsf_timedate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second NSF timedate.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_nsf_timedate_get_number_of_seconds(
+	     (libfdatetime_internal_nsf_timedate_t *) first_nsf_timedate,
+	     &first_number_of_seconds,
+	     &first_number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_nsf_timedate_get_number_of_seconds(
+	     (libfdatetime_internal_nsf_timedate_t *) second_nsf_timedate,
+	     &second_number_of_seconds,
+	     &second_number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nano_seconds = libfdatetime_get_duration_from_number_of_seconds(
+	                           first_number_of_seconds,
+	                           first_number_of_nano_seconds,
+	                           second_number_of_seconds,
+	                           second_number_of_nano_seconds );
+
+	return( 1 );
+}
+
 /* Deterimes the size of the string for the NSF timedate
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -510,34 +1166,15 @@ int libfdatetime_nsf_timedate_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
 	          (libfdatetime_internal_nsf_timedate_t *) nsf_timedate,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -745,6 +1382,10 @@ int libfdatetime_nsf_timedate_copy_to_utf8_string_with_index(
 	static char *function                                       = "libfdatetime_nsf_timedate_copy_to_utf8_string_with_index";
 	int result                                                  = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( nsf_timedate == NULL )
 	{
 		libcerror_error_set(
@@ -758,32 +1399,33 @@ int libfdatetime_nsf_timedate_copy_to_utf8_string_with_index(
 	}
 	internal_nsf_timedate = (libfdatetime_internal_nsf_timedate_t *) nsf_timedate;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 nsf_timedate,
+	 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+	  internal_nsf_timedate ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
 	          internal_nsf_timedate,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -809,6 +1451,16 @@ int libfdatetime_nsf_timedate_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+		  internal_nsf_timedate ) )
+
 		result = libfdatetime_internal_nsf_timedate_copy_to_utf8_string_in_hexadecimal(
 		          internal_nsf_timedate,
 		          utf8_string,
@@ -828,6 +1480,23 @@ int libfdatetime_nsf_timedate_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 nsf_timedate,
+	 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+	  internal_nsf_timedate ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1010,6 +1679,10 @@ int libfdatetime_nsf_timedate_copy_to_utf16_string_with_index(
 	static char *function                                       = "libfdatetime_nsf_timedate_copy_to_utf16_string_with_index";
 	int result                                                  = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( nsf_timedate == NULL )
 	{
 		libcerror_error_set(
@@ -1023,32 +1696,33 @@ int libfdatetime_nsf_timedate_copy_to_utf16_string_with_index(
 	}
 	internal_nsf_timedate = (libfdatetime_internal_nsf_timedate_t *) nsf_timedate;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 nsf_timedate,
+	 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+	  internal_nsf_timedate ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
 	          internal_nsf_timedate,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1074,6 +1748,16 @@ int libfdatetime_nsf_timedate_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+		  internal_nsf_timedate ) )
+
 		result = libfdatetime_internal_nsf_timedate_copy_to_utf16_string_in_hexadecimal(
 		          internal_nsf_timedate,
 		          utf16_string,
@@ -1093,6 +1777,23 @@ int libfdatetime_nsf_timedate_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 nsf_timedate,
+	 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+	  internal_nsf_timedate ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1275,6 +1976,10 @@ int libfdatetime_nsf_timedate_copy_to_utf32_string_with_index(
 	static char *function                                       = "libfdatetime_nsf_timedate_copy_to_utf32_string_with_index";
 	int result                                                  = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( nsf_timedate == NULL )
 	{
 		libcerror_error_set(
@@ -1288,32 +1993,33 @@ int libfdatetime_nsf_timedate_copy_to_utf32_string_with_index(
 	}
 	internal_nsf_timedate = (libfdatetime_internal_nsf_timedate_t *) nsf_timedate;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 nsf_timedate,
+	 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+	  internal_nsf_timedate ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
 	          internal_nsf_timedate,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1353,6 +2059,16 @@ int libfdatetime_nsf_timedate_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+		 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+		  internal_nsf_timedate ) )
+
 		result = libfdatetime_internal_nsf_timedate_copy_to_utf32_string_in_hexadecimal(
 		          internal_nsf_timedate,
 		          utf32_string,
@@ -1372,6 +2088,23 @@ int libfdatetime_nsf_timedate_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 nsf_timedate,
+	 LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE(
+	  internal_nsf_timedate ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
@@ -85,11 +85,71 @@ int libfdatetime_nsf_timedate_copy_to_64bit(
      uint64_t *value_64bit,
      libcerror_error_t **error );
 
+int libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+     libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
      libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+int libfdatetime_internal_nsf_timedate_get_sort_key(
+     libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_nsf_timedate_get_sort_key(
+     libfdatetime_nsf_timedate_t *nsf_timedate,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_nsf_timedate_array_get_sort_keys(
+     const uint64_t *nsf_timedate_values,
+     size_t number_of_values,
+     int64_t *sort_keys,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_nsf_timedate_copy_from_date_time_values(
+     libfdatetime_nsf_timedate_t *nsf_timedate,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_nsf_timedate_compare(
+     libfdatetime_nsf_timedate_t *first_nsf_timedate,
+     libfdatetime_nsf_timedate_t *second_nsf_timedate,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_nsf_timedate_get_number_of_seconds(
+     libfdatetime_internal_nsf_timedate_t *internal_nsf_timedate,
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+     libfdatetime_nsf_timedate_t *nsf_timedate,
+     int64_t number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_nsf_timedate_get_difference(
+     libfdatetime_nsf_timedate_t *first_nsf_timedate,
+     libfdatetime_nsf_timedate_t *second_nsf_timedate,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_nsf_timedate_get_string_size(
      libfdatetime_nsf_timedate_t *nsf_timedate,
@@ -0,0 +1,297 @@
+/*
+ * Line parsing functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_filetime.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_parse.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_types.h"
+
+/* Parses newline separated date and time strings into timestamp values
+ * Parsing starts at utf8_buffer_index and stops at the end of the buffer or when
+ * number_of_values lines have been parsed, utf8_buffer_index is set to the offset
+ * of the first line that was not parsed so that the buffer can be parsed in passes
+ * Lines are separated by a line feed, an optional trailing carriage return is ignored
+ * The timestamp type is either FILETIME or POSIX time, the value type is only used
+ * by the POSIX time timestamp type and should be 0 otherwise
+ * The value of the line with index N is stored in values[ N ] and the bit N of
+ * the error bitmap is set if the line could not be parsed, in which case the value is 0
+ * The error bitmap should contain at least ( number_of_values + 7 ) / 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_parse_lines(
+     const uint8_t *utf8_buffer,
+     size_t utf8_buffer_size,
+     size_t *utf8_buffer_index,
+     int timestamp_type,
+     uint8_t value_type,
+     uint32_t string_format_flags,
+     uint64_t *values,
+     uint8_t *error_bitmap,
+     size_t number_of_values,
+     size_t *number_of_lines,
+     size_t *number_of_invalid_lines,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t internal_filetime;
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	const uint8_t *line_end             = NULL;
+	const uint8_t *line_start           = NULL;
+	static char *function               = "libfdatetime_parse_lines";
+	size_t buffer_index                 = 0;
+	size_t line_index                   = 0;
+	size_t line_length                  = 0;
+	size_t safe_number_of_invalid_lines = 0;
+	int result                          = 0;
+
+	if( utf8_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_buffer_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 buffer index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_buffer_index > utf8_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 buffer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( timestamp_type != LIBFDATETIME_TIMESTAMP_TYPE_FILETIME )
+	 && ( timestamp_type != LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported timestamp type.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lines == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lines.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_invalid_lines == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of invalid lines.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( timestamp_type == LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	 && ( value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     error_bitmap,
+	     0,
+	     ( number_of_values + 7 ) / 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear error bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_index = *utf8_buffer_index;
+
+	while( ( buffer_index < utf8_buffer_size )
+	    && ( line_index < number_of_values ) )
+	{
+		line_start = &( utf8_buffer[ buffer_index ] );
+
+		line_end = (const uint8_t *) narrow_string_search_character(
+		                              (const char *) line_start,
+		                              '\n',
+		                              utf8_buffer_size - buffer_index );
+
+		if( line_end == NULL )
+		{
+			line_length  = utf8_buffer_size - buffer_index;
+			buffer_index = utf8_buffer_size;
+		}
+		else
+		{
+			line_length   = (size_t) ( line_end - line_start );
+			buffer_index += line_length + 1;
+		}
+		if( ( line_length > 0 )
+		 && ( line_start[ line_length - 1 ] == (uint8_t) '\r' ) )
+		{
+			line_length--;
+		}
+		/* The error is not set on a per line basis to prevent an allocation for every invalid line
+		 */
+		result = -1;
+
+		if( line_length > 0 )
+		{
+			if( timestamp_type == LIBFDATETIME_TIMESTAMP_TYPE_FILETIME )
+			{
+				result = libfdatetime_filetime_copy_from_utf8_string(
+				          (libfdatetime_filetime_t *) &internal_filetime,
+				          line_start,
+				          line_length,
+				          string_format_flags,
+				          NULL );
+
+				if( result == 1 )
+				{
+					values[ line_index ] = ( (uint64_t) internal_filetime.upper << 32 )
+					                     | internal_filetime.lower;
+				}
+			}
+			else
+			{
+				result = libfdatetime_posix_time_copy_from_utf8_string(
+				          (libfdatetime_posix_time_t *) &internal_posix_time,
+				          line_start,
+				          line_length,
+				          string_format_flags,
+				          value_type,
+				          NULL );
+
+				if( result == 1 )
+				{
+					values[ line_index ] = internal_posix_time.timestamp;
+				}
+			}
+		}
+		if( result != 1 )
+		{
+			values[ line_index ] = 0;
+
+			error_bitmap[ line_index / 8 ] |= (uint8_t) ( 1 << ( line_index % 8 ) );
+
+			safe_number_of_invalid_lines++;
+		}
+		line_index++;
+	}
+	*utf8_buffer_index       = buffer_index;
+	*number_of_lines         = line_index;
+	*number_of_invalid_lines = safe_number_of_invalid_lines;
+
+	return( 1 );
+}
+
@@ -0,0 +1,55 @@
+/*
+ * Line parsing functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_PARSE_H )
+#define _LIBFDATETIME_PARSE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_parse_lines(
+     const uint8_t *utf8_buffer,
+     size_t utf8_buffer_size,
+     size_t *utf8_buffer_index,
+     int timestamp_type,
+     uint8_t value_type,
+     uint32_t string_format_flags,
+     uint64_t *values,
+     uint8_t *error_bitmap,
+     size_t number_of_values,
+     size_t *number_of_lines,
+     size_t *number_of_invalid_lines,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_PARSE_H ) */
+
@@ -26,8 +26,14 @@
 
 #include "libfdatetime_definitions.h"
 #include "libfdatetime_date_time_values.h"
+#include "libfdatetime_duration.h"
+#include "libfdatetime_filetime.h"
 #include "libfdatetime_libcerror.h"
 #include "libfdatetime_posix_time.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
+#include "libfdatetime_truncate.h"
 #include "libfdatetime_types.h"
 
 /* Creates a POSIX time
@@ -150,7 +156,6 @@ int libfdatetime_posix_time_copy_from_byte_stream(
 	libfdatetime_internal_posix_time_t *internal_posix_time = NULL;
 	static char *function                                   = "libfdatetime_posix_time_copy_from_byte_stream";
 	uint64_t value_64bit                                    = 0;
-	uint8_t is_signed                                       = 0;
 
 	if( posix_time == NULL )
 	{
@@ -225,10 +230,10 @@ int libfdatetime_posix_time_copy_from_byte_stream(
 			 byte_stream,
 			 value_64bit );
 		}
-		is_signed = (uint8_t) ( value_64bit >> 31 );
-
-		if( ( is_signed != 0 )
-		 && ( ( value_64bit & 0x7fffffffUL ) == 0 ) )
+		/* The minimum value of a signed value type is not supported
+		 */
+		if( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+		 && ( value_64bit == 0x80000000UL ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -270,14 +275,15 @@ int libfdatetime_posix_time_copy_from_byte_stream(
 			 byte_stream,
 			 value_64bit );
 		}
-		is_signed = (uint8_t) ( value_64bit >> 63 );
-
+		/* The minimum value of a signed value type is not supported
+		 */
+		if( ( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+		  || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+		  || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED ) )
 #if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
-		if( ( is_signed != 0 )
-		 && ( ( value_64bit & 0x7fffffffffffffffUL ) == 0 ) )
+		 && ( value_64bit == 0x8000000000000000UL ) )
 #else
-		if( ( is_signed != 0 )
-		 && ( ( value_64bit & 0x7fffffffffffffffULL ) == 0 ) )
+		 && ( value_64bit == 0x8000000000000000ULL ) )
 #endif
 		{
 			libcerror_error_set(
@@ -304,6 +310,11 @@ int libfdatetime_posix_time_copy_from_byte_stream(
 	internal_posix_time->timestamp  = value_64bit;
 	internal_posix_time->value_type = value_type;
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -318,7 +329,6 @@ int libfdatetime_posix_time_copy_from_32bit(
 {
 	libfdatetime_internal_posix_time_t *internal_posix_time = NULL;
 	static char *function                                   = "libfdatetime_posix_time_copy_from_32bit";
-	uint8_t is_signed                                       = 0;
 
 	if( posix_time == NULL )
 	{
@@ -345,10 +355,10 @@ int libfdatetime_posix_time_copy_from_32bit(
 
 		return( -1 );
 	}
-	is_signed = (uint8_t) ( value_32bit >> 31 );
-
-	if( ( is_signed != 0 )
-	 && ( ( value_32bit & 0x7fffffffUL ) == 0 ) )
+	/* The minimum value of a signed value type is not supported
+	 */
+	if( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 && ( value_32bit == 0x80000000UL ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -362,6 +372,11 @@ int libfdatetime_posix_time_copy_from_32bit(
 	internal_posix_time->timestamp  = (uint64_t) value_32bit;
 	internal_posix_time->value_type = value_type;
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -441,7 +456,6 @@ int libfdatetime_posix_time_copy_from_64bit(
 {
 	libfdatetime_internal_posix_time_t *internal_posix_time = NULL;
 	static char *function                                   = "libfdatetime_posix_time_copy_from_64bit";
-	uint8_t is_signed                                       = 0;
 
 	if( posix_time == NULL )
 	{
@@ -472,14 +486,15 @@ int libfdatetime_posix_time_copy_from_64bit(
 
 		return( -1 );
 	}
-	is_signed = (uint8_t) ( value_64bit >> 63 );
-
+	/* The minimum value of a signed value type is not supported
+	 */
+	if( ( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+	  || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	  || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED ) )
 #if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
-	if( ( is_signed != 0 )
-	 && ( ( value_64bit & 0x7fffffffffffffffUL ) == 0 ) )
+	 && ( value_64bit == 0x8000000000000000UL ) )
 #else
-	if( ( is_signed != 0 )
-	 && ( ( value_64bit & 0x7fffffffffffffffULL ) == 0 ) )
+	 && ( value_64bit == 0x8000000000000000ULL ) )
 #endif
 	{
 		libcerror_error_set(
@@ -494,6 +509,11 @@ int libfdatetime_posix_time_copy_from_64bit(
 	internal_posix_time->timestamp  = value_64bit;
 	internal_posix_time->value_type = value_type;
 
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
 	return( 1 );
 }
 
@@ -566,21 +586,21 @@ int libfdatetime_posix_time_copy_to_64bit(
 	return( 1 );
 }
 
-/* Converts a POSIX time into date time values
+/* Converts a number of seconds since January 1, 1970 00:00:00 into a POSIX time
+ * The number of nano seconds is truncated to the precision of the value type
  * Returns 1 if successful or -1 on error
  */
-int libfdatetime_internal_posix_time_copy_to_date_time_values(
+int libfdatetime_internal_posix_time_copy_from_number_of_seconds(
      libfdatetime_internal_posix_time_t *internal_posix_time,
-     libfdatetime_date_time_values_t *date_time_values,
+     int64_t number_of_seconds,
+     uint32_t number_of_nano_seconds,
+     uint8_t value_type,
      libcerror_error_t **error )
 {
-	static char *function    = "libfdatetime_internal_posix_time_copy_to_date_time_values";
-	uint64_t posix_timestamp = 0;
-	uint64_t remaining_years = 0;
-	uint32_t days_in_century = 0;
-	uint16_t days_in_year    = 0;
-	uint8_t days_in_month    = 0;
-	uint8_t is_signed        = 0;
+	static char *function             = "libfdatetime_internal_posix_time_copy_from_number_of_seconds";
+	int64_t maximum_number_of_seconds = 0;
+	int64_t minimum_number_of_seconds = 0;
+	int64_t timestamp                 = 0;
 
 	if( internal_posix_time == NULL )
 	{
@@ -593,369 +613,1489 @@ int libfdatetime_internal_posix_time_copy_to_date_time_values(
 
 		return( -1 );
 	}
-	if( ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
-	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	if( number_of_nano_seconds >= 1000000000 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid POSIX time - unsupported value type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nano seconds value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( date_time_values == NULL )
+	switch( value_type )
+	{
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED:
+			minimum_number_of_seconds = -( (int64_t) INT32_MAX );
+			maximum_number_of_seconds = (int64_t) INT32_MAX;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED:
+			minimum_number_of_seconds = 0;
+			maximum_number_of_seconds = (int64_t) UINT32_MAX;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED:
+			minimum_number_of_seconds = -( (int64_t) INT64_MAX );
+			maximum_number_of_seconds = (int64_t) INT64_MAX;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED:
+			minimum_number_of_seconds = 0;
+			maximum_number_of_seconds = (int64_t) INT64_MAX;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type.",
+			 function );
+
+			return( -1 );
+	}
+	/* Make sure the timestamp in micro or nano seconds, including the fraction of seconds, cannot overflow
+	 */
+	if( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	 || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		maximum_number_of_seconds = ( maximum_number_of_seconds - 999999 ) / 1000000;
+		minimum_number_of_seconds = minimum_number_of_seconds / 1000000;
+	}
+	else if( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	      || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		maximum_number_of_seconds = ( maximum_number_of_seconds - 999999999 ) / 1000000000;
+		minimum_number_of_seconds = minimum_number_of_seconds / 1000000000;
+	}
+	if( ( number_of_seconds < minimum_number_of_seconds )
+	 || ( number_of_seconds > maximum_number_of_seconds ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid date time values.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	posix_timestamp = internal_posix_time->timestamp;
-
-	if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
-	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED ) )
+	switch( value_type )
 	{
-		is_signed = (uint8_t) ( posix_timestamp >> 31 );
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED:
+			internal_posix_time->timestamp = (uint64_t) ( (uint32_t) number_of_seconds );
+			break;
 
-		if( is_signed != 0 )
-		{
-			if( ( posix_timestamp & 0x7fffffffUL ) == 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported timestamp.",
-				 function );
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED:
+			timestamp = ( number_of_seconds * 1000000 )
+			          + (int64_t) ( number_of_nano_seconds / 1000 );
 
-				return( -1 );
-			}
-			posix_timestamp = -( (int32_t) posix_timestamp );
-		}
-	}
-	else if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
-	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
-	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
-	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
-	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
-	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
-	{
-		is_signed = (uint8_t) ( posix_timestamp >> 63 );
+			internal_posix_time->timestamp = (uint64_t) timestamp;
+			break;
 
-		if( is_signed != 0 )
-		{
-#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
-			if( ( posix_timestamp & 0x7fffffffffffffffUL ) == 0 )
-#else
-			if( ( posix_timestamp & 0x7fffffffffffffffULL ) == 0 )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported timestamp.",
-				 function );
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED:
+			timestamp = ( number_of_seconds * 1000000000 )
+			          + (int64_t) number_of_nano_seconds;
 
-				return( -1 );
-			}
-			posix_timestamp = -( (int64_t) posix_timestamp );
-		}
+			internal_posix_time->timestamp = (uint64_t) timestamp;
+			break;
+
+		default:
+			internal_posix_time->timestamp = (uint64_t) number_of_seconds;
+			break;
 	}
-        date_time_values->nano_seconds = 0;
+	internal_posix_time->value_type = value_type;
+
+	return( 1 );
+}
+
+/* Converts date time values into a POSIX time
+ * The date time values are considered to be in UTC, the fraction of seconds
+ * is truncated to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_posix_time_copy_from_date_time_values(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_internal_posix_time_copy_from_date_time_values";
+	int64_t number_of_seconds = 0;
 
-	if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
-	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	if( internal_posix_time == NULL )
 	{
-		/* The timestamp is in units of nano seconds correct the value to seconds
-		 */
-		date_time_values->nano_seconds = posix_timestamp % 1000;
-		posix_timestamp /= 1000;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
 
-		if( ( is_signed != 0 )
-		 && ( date_time_values->nano_seconds > 0 ) )
-		{
-			date_time_values->nano_seconds = 999 - date_time_values->nano_seconds;
-		}
+		return( -1 );
 	}
-	if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
-	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
-	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
-	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
 	{
-		/* The timestamp is in units of micro seconds correct the value to seconds
-		 */
-		date_time_values->micro_seconds = posix_timestamp % 1000;
-		posix_timestamp /= 1000;
-
-		if( ( is_signed != 0 )
-		 && ( date_time_values->micro_seconds > 0 ) )
-		{
-			date_time_values->micro_seconds = 999 - date_time_values->micro_seconds;
-		}
-		date_time_values->milli_seconds = posix_timestamp % 1000;
-		posix_timestamp /= 1000;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
 
-		if( ( is_signed != 0 )
-		 && ( date_time_values->milli_seconds > 0 ) )
-		{
-			date_time_values->milli_seconds = 999 - date_time_values->milli_seconds;
-		}
+		return( -1 );
 	}
-	else
+	if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+	     internal_posix_time,
+	     number_of_seconds,
+	     ( (uint32_t) date_time_values->milli_seconds * 1000000 )
+	     + ( (uint32_t) date_time_values->micro_seconds * 1000 )
+	     + (uint32_t) date_time_values->nano_seconds,
+	     value_type,
+	     error ) != 1 )
 	{
-	        date_time_values->micro_seconds = 0;
-	        date_time_values->milli_seconds = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time from number of seconds.",
+		 function );
+
+		return( -1 );
 	}
-	if( is_signed != 0 )
+	return( 1 );
+}
+
+/* Converts date time values into a POSIX time
+ * The fraction of seconds is specified as a number of nano seconds
+ * The date time values are considered to be in UTC, the fraction of seconds
+ * is truncated to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_copy_from_date_time_values(
+     libfdatetime_posix_time_t *posix_time,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_posix_time_copy_from_date_time_values";
+
+	if( posix_time == NULL )
 	{
-		posix_timestamp -= 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
 	}
-	/* There are 60 seconds in a minute correct the value to minutes
-	 */
-	date_time_values->seconds = posix_timestamp % 60;
-	posix_timestamp          /= 60;
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
 
-	if( ( is_signed != 0 )
-	 && ( date_time_values->seconds > 0 ) )
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_copy_from_date_time_values(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     &date_time_values,
+	     value_type,
+	     error ) != 1 )
 	{
-		date_time_values->seconds = 59 - date_time_values->seconds;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to POSIX time.",
+		 function );
+
+		return( -1 );
 	}
-	/* There are 60 minutes in an hour correct the value to hours
-	 */
-	date_time_values->minutes = posix_timestamp % 60;
-	posix_timestamp          /= 60;
+	return( 1 );
+}
+
+/* Converts an UTF-8 string into a POSIX time
+ * The string format type determines if the string is parsed as ctime or ISO 8601
+ * The string can contain a fraction of seconds and a timezone indicator:
+ * UTC for ctime or Z, +hh:mm or -hh:mm for ISO 8601
+ * The fraction of seconds is truncated to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_copy_from_utf8_string(
+     libfdatetime_posix_time_t *posix_time,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function     = "libfdatetime_posix_time_copy_from_utf8_string";
+	int64_t number_of_seconds = 0;
+	int16_t timezone_offset   = 0;
 
-	if( ( is_signed != 0 )
-	 && ( date_time_values->minutes > 0 ) )
+	if( posix_time == NULL )
 	{
-		date_time_values->minutes = 59 - date_time_values->minutes;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
 	}
-	/* There are 24 hours in a day correct the value to days
-	 */
-	date_time_values->hours = posix_timestamp % 24;
-	posix_timestamp        /= 24;
+	if( libfdatetime_date_time_values_copy_from_utf8_string(
+	     &date_time_values,
+	     utf8_string,
+	     utf8_string_size,
+	     string_format_flags,
+	     &timezone_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values from UTF-8 string.",
+		 function );
 
-	if( ( is_signed != 0 )
-	 && ( date_time_values->hours > 0 ) )
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     &date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
 	{
-		date_time_values->hours = 23 - date_time_values->hours;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
 	}
-	/* Determine the number of years starting at 'Jan 1, 1970 00:00:00'
-	 * correct the value to days within the year
+	/* Correct the number of seconds to UTC
 	 */
-	if( is_signed == 0 )
+	number_of_seconds -= (int64_t) timezone_offset * 60;
+
+	if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     number_of_seconds,
+	     ( (uint32_t) date_time_values.milli_seconds * 1000000 )
+	     + ( (uint32_t) date_time_values.micro_seconds * 1000 )
+	     + (uint32_t) date_time_values.nano_seconds,
+	     value_type,
+	     error ) != 1 )
 	{
-		/* Add 1 day to compensate that Jan 1, 1970 is represented as 0
-		 */
-		posix_timestamp += 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time from number of seconds.",
+		 function );
 
-		if( posix_timestamp >= 10957 )
-		{
-			date_time_values->year = 2000;
+		return( -1 );
+	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
 
-			posix_timestamp -= 10957;
-		}
-		else
-		{
-			date_time_values->year = 1970;
-		}
+	return( 1 );
+}
+
+/* Retrieves the number of seconds since January 1, 1970 00:00:00 of a POSIX time
+ * The number of seconds is rounded down, the remainder is returned as number of nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_posix_time_get_number_of_seconds(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_posix_time_get_number_of_seconds";
+	int64_t remainder     = 0;
+	int64_t timestamp     = 0;
+
+	if( internal_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( number_of_seconds == NULL )
 	{
-		date_time_values->year = 1969;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
 	}
-	remaining_years = posix_timestamp % 100;
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_posix_time->value_type )
+	{
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED:
+			*number_of_seconds      = (int64_t) ( (int32_t) ( internal_posix_time->timestamp & 0xffffffffUL ) );
+			*number_of_nano_seconds = 0;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED:
+			*number_of_seconds      = (int64_t) ( internal_posix_time->timestamp & 0xffffffffUL );
+			*number_of_nano_seconds = 0;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED:
+			*number_of_seconds      = (int64_t) internal_posix_time->timestamp;
+			*number_of_nano_seconds = 0;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED:
+			if( internal_posix_time->timestamp > (uint64_t) INT64_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid POSIX time - timestamp value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			*number_of_seconds      = (int64_t) internal_posix_time->timestamp;
+			*number_of_nano_seconds = 0;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED:
+			timestamp          = (int64_t) internal_posix_time->timestamp;
+			*number_of_seconds = timestamp / 1000000;
+			remainder          = timestamp % 1000000;
+
+			/* Round the number of seconds down for negative timestamps
+			 */
+			if( remainder < 0 )
+			{
+				*number_of_seconds -= 1;
+				remainder          += 1000000;
+			}
+			*number_of_nano_seconds = (uint32_t) remainder * 1000;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED:
+			*number_of_seconds      = (int64_t) ( internal_posix_time->timestamp / 1000000 );
+			*number_of_nano_seconds = (uint32_t) ( internal_posix_time->timestamp % 1000000 ) * 1000;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED:
+			timestamp          = (int64_t) internal_posix_time->timestamp;
+			*number_of_seconds = timestamp / 1000000000;
+			remainder          = timestamp % 1000000000;
+
+			/* Round the number of seconds down for negative timestamps
+			 */
+			if( remainder < 0 )
+			{
+				*number_of_seconds -= 1;
+				remainder          += 1000000000;
+			}
+			*number_of_nano_seconds = (uint32_t) remainder;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED:
+			*number_of_seconds      = (int64_t) ( internal_posix_time->timestamp / 1000000000 );
+			*number_of_nano_seconds = (uint32_t) ( internal_posix_time->timestamp % 1000000000 );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a POSIX time into a FILETIME
+ * The fraction of seconds is stored with 100 nano seconds precision
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_copy_to_filetime(
+     libfdatetime_posix_time_t *posix_time,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfdatetime_posix_time_copy_to_filetime";
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     &number_of_seconds,
+	     &number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_filetime_copy_from_number_of_seconds(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     number_of_seconds,
+	     number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FILETIME from number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an array of POSIX time values into an array of FILETIME values
+ * The POSIX time values are stored as by libfdatetime_posix_time_copy_to_64bit
+ * The fraction of seconds is stored with 100 nano seconds precision
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_array_copy_to_filetime(
+     const uint64_t *posix_time_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     uint64_t *filetime_values,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_filetime_t internal_filetime;
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	static char *function           = "libfdatetime_posix_time_array_copy_to_filetime";
+	size_t value_index              = 0;
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+
+	if( posix_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_posix_time.value_type = value_type;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_posix_time.timestamp = posix_time_values[ value_index ];
+
+		if( libfdatetime_internal_posix_time_get_number_of_seconds(
+		     &internal_posix_time,
+		     &number_of_seconds,
+		     &number_of_nano_seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of seconds of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( libfdatetime_internal_filetime_copy_from_number_of_seconds(
+		     &internal_filetime,
+		     number_of_seconds,
+		     number_of_nano_seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %" PRIzd " to FILETIME.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		filetime_values[ value_index ]   = internal_filetime.upper;
+		filetime_values[ value_index ] <<= 32;
+		filetime_values[ value_index ]  |= internal_filetime.lower;
+	}
+	return( 1 );
+}
+
+/* Converts a POSIX time into date time values
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_posix_time_copy_to_date_time_values(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfdatetime_internal_posix_time_copy_to_date_time_values";
+	int64_t number_of_days          = 0;
+	int64_t number_of_eras          = 0;
+	int64_t number_of_seconds       = 0;
+	int64_t seconds_in_day          = 0;
+	uint64_t posix_timestamp        = 0;
+	uint32_t days_in_century        = 0;
+	uint32_t number_of_nano_seconds = 0;
+	uint16_t days_in_year           = 0;
+	uint8_t days_in_month           = 0;
+
+	if( internal_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid POSIX time - unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of seconds is rounded down for timestamps before Jan 1, 1970
+	 * hence the remaining number of nano seconds is never negative
+	 */
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     internal_posix_time,
+	     &number_of_seconds,
+	     &number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	date_time_values->nano_seconds  = (uint16_t) ( number_of_nano_seconds % 1000 );
+	number_of_nano_seconds         /= 1000;
+	date_time_values->micro_seconds = (uint16_t) ( number_of_nano_seconds % 1000 );
+	date_time_values->milli_seconds = (uint16_t) ( number_of_nano_seconds / 1000 );
+
+	/* There are 86400 seconds in a day correct the value to days
+	 */
+	number_of_days = number_of_seconds / 86400;
+	seconds_in_day = number_of_seconds % 86400;
+
+	if( seconds_in_day < 0 )
+	{
+		number_of_days -= 1;
+		seconds_in_day += 86400;
+	}
+	/* The date time values support years 0 through 9999
+	 * Jan 1, 0000 is day -719528 and Jan 1, 10000 is day 2932897
+	 */
+	if( ( number_of_days < -719528 )
+	 || ( number_of_days >= 2932897 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time - timestamp value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	date_time_values->seconds = (uint8_t) ( seconds_in_day % 60 );
+	seconds_in_day           /= 60;
+	date_time_values->minutes = (uint8_t) ( seconds_in_day % 60 );
+	seconds_in_day           /= 60;
+	date_time_values->hours   = (uint8_t) seconds_in_day;
+
+	/* Determine the number of years starting at 'Jan 1, 2000 00:00:00'
+	 * The Gregorian calendar repeats every 400 years (146097 days), hence
+	 * the value is first reduced to the days within a 400 year period
+	 * Jan 1, 2000 is day 10957
+	 */
+	number_of_days -= 10957;
+
+	if( number_of_days >= 0 )
+	{
+		number_of_eras = number_of_days / 146097;
+	}
+	else
+	{
+		number_of_eras = ( number_of_days - 146096 ) / 146097;
+	}
+	posix_timestamp        = (uint64_t) ( number_of_days - ( number_of_eras * 146097 ) );
+	date_time_values->year = (uint16_t) ( 2000 + ( number_of_eras * 400 ) );
+
+	while( posix_timestamp > 0 )
+	{
+		/* The first century of a 400 year period contains an additional leap year
+		 */
+		if( ( date_time_values->year % 400 ) == 0 )
+		{
+			days_in_century = 36525;
+		}
+		else
+		{
+			days_in_century = 36524;
+		}
+		if( posix_timestamp < days_in_century )
+		{
+			break;
+		}
+		posix_timestamp        -= days_in_century;
+		date_time_values->year += 100;
+	}
+	while( posix_timestamp > 0 )
+	{
+		/* Check for a leap year
+		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+		 */
+		if( ( ( ( date_time_values->year % 4 ) == 0 )
+		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+		 || ( ( date_time_values->year % 400 ) == 0 ) )
+		{
+			days_in_year = 366;
+		}
+		else
+		{
+			days_in_year = 365;
+		}
+		if( posix_timestamp < days_in_year )
+		{
+			break;
+		}
+		posix_timestamp        -= days_in_year;
+		date_time_values->year += 1;
+	}
+	/* Add 1 day to compensate that Jan 1 is represented as 0
+	 */
+	posix_timestamp += 1;
+
+	/* Determine the month correct the value to days within the month
+	 */
+	date_time_values->month = 1;
+
+	do
+	{
+		/* February (2)
+		 */
+		if( date_time_values->month == 2 )
+		{
+			if( ( ( ( date_time_values->year % 4 ) == 0 )
+			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+			 || ( ( date_time_values->year % 400 ) == 0 ) )
+			{
+				days_in_month = 29;
+			}
+			else
+			{
+				days_in_month = 28;
+			}
+		}
+		/* April (4), June (6), September (9), November (11)
+		 */
+		else if( ( date_time_values->month == 4 )
+		      || ( date_time_values->month == 6 )
+		      || ( date_time_values->month == 9 )
+		      || ( date_time_values->month == 11 ) )
+		{
+			days_in_month = 30;
+		}
+		/* January (1), March (3), May (5), July (7), August (8), October (10), December (12)
+		 */
+		else if( ( date_time_values->month == 1 )
+		      || ( date_time_values->month == 3 )
+		      || ( date_time_values->month == 5 )
+		      || ( date_time_values->month == 7 )
+		      || ( date_time_values->month == 8 )
+		      || ( date_time_values->month == 10 )
+		      || ( date_time_values->month == 12 ) )
+		{
+			days_in_month = 31;
+		}
+		/* This should never happen, but just in case
+		 */
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported month: %d.",
+			 function,
+			 date_time_values->month );
+
+			return( -1 );
+		}
+		if( posix_timestamp <= days_in_month )
+		{
+			break;
+		}
+		posix_timestamp         -= days_in_month;
+		date_time_values->month += 1;
+	}
+	while( posix_timestamp > 0 );
+
+	/* Determine the day
+	 */
+	date_time_values->day = (uint8_t) posix_timestamp;
+
+	return( 1 );
+}
+
+/* Retrieves the sort key of a POSIX time
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_posix_time_get_sort_key(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfdatetime_internal_posix_time_get_sort_key";
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+
+	if( internal_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	/* The error is not set since a POSIX time with an unsupported value type
+	 * maps to the invalid sort key
+	 */
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     internal_posix_time,
+	     &number_of_seconds,
+	     &number_of_nano_seconds,
+	     NULL ) == 1 )
+	{
+		*sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+		             number_of_seconds,
+		             number_of_nano_seconds );
+	}
+	/* An unsigned 64-bit number of seconds that exceeds the maximum of a signed 64-bit integer
+	 */
+	else if( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_MAXIMUM;
+	}
+	else
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A POSIX time that does not represent a date and time maps to LIBFDATETIME_SORT_KEY_INVALID
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_get_sort_key(
+     libfdatetime_posix_time_t *posix_time,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_posix_time_get_sort_key";
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_sort_key(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of POSIX time values
+ * The POSIX time values are stored as by libfdatetime_posix_time_copy_to_64bit
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_array_get_sort_keys(
+     const uint64_t *posix_time_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     int64_t *sort_keys,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	static char *function = "libfdatetime_posix_time_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( posix_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	internal_posix_time.value_type = value_type;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		internal_posix_time.timestamp = posix_time_values[ value_index ];
+
+		if( libfdatetime_internal_posix_time_get_sort_key(
+		     &internal_posix_time,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two POSIX time
+ * Both values are compared by their sort key
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_posix_time_compare(
+     libfdatetime_posix_time_t *first_posix_time,
+     libfdatetime_posix_time_t *second_posix_time,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_posix_time_compare";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_sort_key(
+	     (libfdatetime_internal_posix_time_t *) first_posix_time,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_sort_key(
+	     (libfdatetime_internal_posix_time_t *) second_posix_time,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
+/* Adds a number of nano seconds to the POSIX time
+ * The number of nano seconds can be negative
+ * The result is rounded down to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_add_number_of_nano_seconds(
+     libfdatetime_posix_time_t *posix_time,
+     int64_t number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_posix_time_t *internal_posix_time = NULL;
+	static char *function                                   = "libfdatetime_posix_time_add_number_of_nano_seconds";
+	int64_t posix_number_of_seconds                         = 0;
+	uint32_t posix_number_of_nano_seconds                   = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_posix_time = (libfdatetime_internal_posix_time_t *) posix_time;
+
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     internal_posix_time,
+	     &posix_number_of_seconds,
+	     &posix_number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_duration_add_to_number_of_seconds(
+	     &posix_number_of_seconds,
+	     &posix_number_of_nano_seconds,
+	     number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+	     internal_posix_time,
+	     posix_number_of_seconds,
+	     posix_number_of_nano_seconds,
+	     internal_posix_time->value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of seconds to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the difference between two POSIX times
+ * The POSIX times can have different value types
+ * The difference is the first POSIX time minus the second POSIX time in nano seconds
+ * and is saturated to the range of a signed 64-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_get_difference(
+     libfdatetime_posix_time_t *first_posix_time,
+     libfdatetime_posix_time_t *second_posix_time,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libfdatetime_posix_time_get_difference";
+	int64_t first_number_of_seconds        = 0;
+	int64_t second_number_of_seconds       = 0;
+	uint32_t first_number_of_nano_seconds  = 0;
+	uint32_t second_number_of_nano_seconds = 0;
+
+	if( first_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     (libfdatetime_internal_posix_time_t *) first_posix_time,
+	     &first_number_of_seconds,
+	     &first_number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     (libfdatetime_internal_posix_time_t *) second_posix_time,
+	     &second_number_of_seconds,
+	     &second_number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nano_seconds = libfdatetime_get_duration_from_number_of_seconds(
+	                           first_number_of_seconds,
+	                           first_number_of_nano_seconds,
+	                           second_number_of_seconds,
+	                           second_number_of_nano_seconds );
+
+	return( 1 );
+}
+
+/* Truncates a POSIX time to a unit
+ * The POSIX time is rounded down to the start of the second, minute, hour, day, month or year
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_posix_time_truncate(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int unit,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfdatetime_internal_posix_time_truncate";
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+
+	if( internal_posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_get_number_of_seconds(
+	     internal_posix_time,
+	     &number_of_seconds,
+	     &number_of_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_truncate_number_of_seconds(
+	     &number_of_seconds,
+	     &number_of_nano_seconds,
+	     unit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to truncate number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+	     internal_posix_time,
+	     number_of_seconds,
+	     number_of_nano_seconds,
+	     internal_posix_time->value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of seconds to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Truncates a POSIX time to a unit
+ * The POSIX time is rounded down to the start of the second, minute, hour, day, month or year
+ * and keeps its value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_truncate(
+     libfdatetime_posix_time_t *posix_time,
+     int unit,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_posix_time_truncate";
 
-	while( remaining_years > 0 )
+	if( posix_time == NULL )
 	{
-		/* Check for a leap year
-		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
-		 */
-		if( ( ( ( date_time_values->year % 4 ) == 0 )
-		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
-		 || ( ( date_time_values->year % 400 ) == 0 ) )
-		{
-			days_in_year = 366;
-		}
-		else
-		{
-			days_in_year = 365;
-		}
-		if( posix_timestamp <= days_in_year )
-		{
-			break;
-		}
-		posix_timestamp -= days_in_year;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
 
-		if( is_signed == 0 )
-		{
-			date_time_values->year += 1;
-		}
-		else
-		{
-			date_time_values->year -= 1;
-		}
-		remaining_years -= 1;
+		return( -1 );
 	}
-	while( posix_timestamp > 0 )
+	if( libfdatetime_internal_posix_time_truncate(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     unit,
+	     error ) != 1 )
 	{
-		/* Check for a leap year
-		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
-		 */
-		if( ( ( ( date_time_values->year % 4 ) == 0 )
-		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
-		 || ( ( date_time_values->year % 400 ) == 0 ) )
-		{
-			days_in_century = 36525;
-		}
-		else
-		{
-			days_in_century = 36524;
-		}
-		if( posix_timestamp <= days_in_century )
-		{
-			break;
-		}
-		posix_timestamp -= days_in_century;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to truncate POSIX time.",
+		 function );
 
-		if( is_signed == 0 )
-		{
-			date_time_values->year += 100;
-		}
-		else
-		{
-			date_time_values->year -= 100;
-		}
+		return( -1 );
 	}
-	while( posix_timestamp > 0 )
+	return( 1 );
+}
+
+/* Truncates an array of POSIX time values of the same value type to a unit
+ * The POSIX time values and truncated POSIX time values can refer to the same array
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_posix_time_array_truncate(
+     const uint64_t *posix_time_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     int unit,
+     uint64_t *truncated_posix_time_values,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	static char *function = "libfdatetime_posix_time_array_truncate";
+	size_t value_index    = 0;
+
+	if( posix_time_values == NULL )
 	{
-		/* Check for a leap year
-		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
-		 */
-		if( ( ( ( date_time_values->year % 4 ) == 0 )
-		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
-		 || ( ( date_time_values->year % 400 ) == 0 ) )
-		{
-			days_in_year = 366;
-		}
-		else
-		{
-			days_in_year = 365;
-		}
-		if( posix_timestamp <= days_in_year )
-		{
-			break;
-		}
-		posix_timestamp -= days_in_year;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time values.",
+		 function );
 
-		if( is_signed == 0 )
-		{
-			date_time_values->year += 1;
-		}
-		else
-		{
-			date_time_values->year -= 1;
-		}
+		return( -1 );
 	}
-	/* Determine the month correct the value to days within the month
-	 */
-	if( is_signed == 0 )
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
 	{
-		date_time_values->month = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( truncated_posix_time_values == NULL )
 	{
-		date_time_values->month = 12;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid truncated POSIX time values.",
+		 function );
+
+		return( -1 );
 	}
-	do
+	internal_posix_time.value_type = value_type;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
 	{
-		/* February (2)
-		 */
-		if( date_time_values->month == 2 )
-		{
-			if( ( ( ( date_time_values->year % 4 ) == 0 )
-			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
-			 || ( ( date_time_values->year % 400 ) == 0 ) )
-			{
-				days_in_month = 29;
-			}
-			else
-			{
-				days_in_month = 28;
-			}
-		}
-		/* April (4), June (6), September (9), November (11)
-		 */
-		else if( ( date_time_values->month == 4 )
-		      || ( date_time_values->month == 6 )
-		      || ( date_time_values->month == 9 )
-		      || ( date_time_values->month == 11 ) )
-		{
-			days_in_month = 30;
-		}
-		/* January (1), March (3), May (5), July (7), August (8), October (10), December (12)
-		 */
-		else if( ( date_time_values->month == 1 )
-		      || ( date_time_values->month == 3 )
-		      || ( date_time_values->month == 5 )
-		      || ( date_time_values->month == 7 )
-		      || ( date_time_values->month == 8 )
-		      || ( date_time_values->month == 10 )
-		      || ( date_time_values->month == 12 ) )
-		{
-			days_in_month = 31;
-		}
-		/* This should never happen, but just in case
-		 */
-		else
+		internal_posix_time.timestamp = posix_time_values[ value_index ];
+
+		if( libfdatetime_internal_posix_time_truncate(
+		     &internal_posix_time,
+		     unit,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported month: %d.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to truncate value: %" PRIzd ".",
 			 function,
-			 date_time_values->month );
+			 value_index );
 
 			return( -1 );
 		}
-		if( posix_timestamp <= days_in_month )
-		{
-			break;
-		}
-		posix_timestamp -= days_in_month;
-
-		if( is_signed == 0 )
-		{
-			date_time_values->month += 1;
-		}
-		else
-		{
-			date_time_values->month -= 1;
-		}
-	}
-	while( posix_timestamp > 0 );
-
-	/* Determine the day
-	 */
-	date_time_values->day = (uint8_t) posix_timestamp;
-
-	if( is_signed != 0 )
-	{
-		date_time_values->day = days_in_month - date_time_values->day;
+		truncated_posix_time_values[ value_index ] = internal_posix_time.timestamp;
 	}
 	return( 1 );
 }
@@ -1018,34 +2158,15 @@ int libfdatetime_posix_time_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
 	          (libfdatetime_internal_posix_time_t *) posix_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -1267,6 +2388,10 @@ int libfdatetime_posix_time_copy_to_utf8_string_with_index(
 	static char *function                                   = "libfdatetime_posix_time_copy_to_utf8_string_with_index";
 	int result                                              = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( posix_time == NULL )
 	{
 		libcerror_error_set(
@@ -1280,32 +2405,33 @@ int libfdatetime_posix_time_copy_to_utf8_string_with_index(
 	}
 	internal_posix_time = (libfdatetime_internal_posix_time_t *) posix_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 posix_time,
+	 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+	  internal_posix_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
 	          internal_posix_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1331,6 +2457,16 @@ int libfdatetime_posix_time_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+		  internal_posix_time ) )
+
 		result = libfdatetime_internal_posix_time_copy_to_utf8_string_in_hexadecimal(
 		          internal_posix_time,
 		          utf8_string,
@@ -1350,6 +2486,23 @@ int libfdatetime_posix_time_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 posix_time,
+	 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+	  internal_posix_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1538,6 +2691,10 @@ int libfdatetime_posix_time_copy_to_utf16_string_with_index(
 	static char *function                                   = "libfdatetime_posix_time_copy_to_utf16_string_with_index";
 	int result                                              = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( posix_time == NULL )
 	{
 		libcerror_error_set(
@@ -1551,32 +2708,33 @@ int libfdatetime_posix_time_copy_to_utf16_string_with_index(
 	}
 	internal_posix_time = (libfdatetime_internal_posix_time_t *) posix_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 posix_time,
+	 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+	  internal_posix_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
 	          internal_posix_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1602,6 +2760,16 @@ int libfdatetime_posix_time_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+		  internal_posix_time ) )
+
 		result = libfdatetime_internal_posix_time_copy_to_utf16_string_in_hexadecimal(
 		          internal_posix_time,
 		          utf16_string,
@@ -1621,6 +2789,23 @@ int libfdatetime_posix_time_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 posix_time,
+	 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+	  internal_posix_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1809,6 +2994,10 @@ int libfdatetime_posix_time_copy_to_utf32_string_with_index(
 	static char *function                                   = "libfdatetime_posix_time_copy_to_utf32_string_with_index";
 	int result                                              = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( posix_time == NULL )
 	{
 		libcerror_error_set(
@@ -1822,32 +3011,33 @@ int libfdatetime_posix_time_copy_to_utf32_string_with_index(
 	}
 	internal_posix_time = (libfdatetime_internal_posix_time_t *) posix_time;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 posix_time,
+	 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+	  internal_posix_time ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
 	          internal_posix_time,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1898,6 +3088,16 @@ int libfdatetime_posix_time_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+		  internal_posix_time ) )
+
 		result = libfdatetime_internal_posix_time_copy_to_utf32_string_in_hexadecimal(
 		          internal_posix_time,
 		          utf32_string,
@@ -1917,6 +3117,23 @@ int libfdatetime_posix_time_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 posix_time,
+	 LIBFDATETIME_PROBE_VALUE_POSIX_TIME(
+	  internal_posix_time ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
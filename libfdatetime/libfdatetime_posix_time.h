@@ -97,11 +97,124 @@ int libfdatetime_posix_time_copy_to_64bit(
      uint8_t *value_type,
      libcerror_error_t **error );
 
+int libfdatetime_internal_posix_time_copy_from_number_of_seconds(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int64_t number_of_seconds,
+     uint32_t number_of_nano_seconds,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_posix_time_copy_from_date_time_values(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     libfdatetime_date_time_values_t *date_time_values,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_copy_from_utf8_string(
+     libfdatetime_posix_time_t *posix_time,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_posix_time_get_number_of_seconds(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_copy_to_filetime(
+     libfdatetime_posix_time_t *posix_time,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_array_copy_to_filetime(
+     const uint64_t *posix_time_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     uint64_t *filetime_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_posix_time_copy_to_date_time_values(
      libfdatetime_internal_posix_time_t *internal_posix_time,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+int libfdatetime_internal_posix_time_get_sort_key(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_get_sort_key(
+     libfdatetime_posix_time_t *posix_time,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_array_get_sort_keys(
+     const uint64_t *posix_time_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     int64_t *sort_keys,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_copy_from_date_time_values(
+     libfdatetime_posix_time_t *posix_time,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_compare(
+     libfdatetime_posix_time_t *first_posix_time,
+     libfdatetime_posix_time_t *second_posix_time,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_add_number_of_nano_seconds(
+     libfdatetime_posix_time_t *posix_time,
+     int64_t number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_get_difference(
+     libfdatetime_posix_time_t *first_posix_time,
+     libfdatetime_posix_time_t *second_posix_time,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_posix_time_truncate(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_truncate(
+     libfdatetime_posix_time_t *posix_time,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_posix_time_array_truncate(
+     const uint64_t *posix_time_values,
+     size_t number_of_values,
+     uint8_t value_type,
+     int unit,
+     uint64_t *truncated_posix_time_values,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_posix_time_get_string_size(
      libfdatetime_posix_time_t *posix_time,
@@ -0,0 +1,105 @@
+/*
+ * Static (USDT) probes
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_PROBES_H )
+#define _LIBFDATETIME_PROBES_H
+
+#include <common.h>
+#include <types.h>
+
+/* The probes are defined in the fdatetime provider:
+ *
+ * <type>_format_begin( value, string_format_flags )
+ *   fired when a copy_to_utf8_string, copy_to_utf16_string or copy_to_utf32_string
+ *   function of a timestamp type starts formatting a string
+ *
+ * <type>_format_end( value, string_format_flags )
+ *   fired when the string was formatted successfully
+ *
+ * fallback_hex( timestamp_type, value )
+ *   fired when a timestamp cannot be represented as a date and time string
+ *   and is formatted in hexadecimal instead
+ *
+ * Where <type> is the name of the timestamp type, such as filetime or posix_time,
+ * timestamp_type is a LIBFDATETIME_TIMESTAMP_TYPE value and value is the raw
+ * 64-bit value of the timestamp as defined by the LIBFDATETIME_PROBE_VALUE_ macros,
+ * for example: bpftrace -e 'usdt:libfdatetime.so:fdatetime:filetime_format_begin { ... }'
+ */
+
+#if defined( HAVE_LIBFDATETIME_SDT_PROBES ) && defined( HAVE_SYS_SDT_H )
+#include <sys/sdt.h>
+
+#define LIBFDATETIME_PROBE_FORMAT_BEGIN( type_name, value, string_format_flags ) \
+	DTRACE_PROBE2( fdatetime, type_name ## _format_begin, value, string_format_flags );
+
+#define LIBFDATETIME_PROBE_FORMAT_END( type_name, value, string_format_flags ) \
+	DTRACE_PROBE2( fdatetime, type_name ## _format_end, value, string_format_flags );
+
+#define LIBFDATETIME_PROBE_FALLBACK_HEX( timestamp_type, value ) \
+	DTRACE_PROBE2( fdatetime, fallback_hex, timestamp_type, value );
+
+#else
+#define LIBFDATETIME_PROBE_FORMAT_BEGIN( type_name, value, string_format_flags ) \
+	/* Static probes are disabled */
+
+#define LIBFDATETIME_PROBE_FORMAT_END( type_name, value, string_format_flags ) \
+	/* Static probes are disabled */
+
+#define LIBFDATETIME_PROBE_FALLBACK_HEX( timestamp_type, value ) \
+	/* Static probes are disabled */
+
+#endif /* defined( HAVE_LIBFDATETIME_SDT_PROBES ) && defined( HAVE_SYS_SDT_H ) */
+
+/* The FAT date and time value contains the date in the upper 16 bits and the time in the lower 16 bits
+ */
+#define LIBFDATETIME_PROBE_VALUE_FAT_DATE_TIME( internal_fat_date_time ) \
+	( ( (uint64_t) ( internal_fat_date_time )->date << 16 ) | ( internal_fat_date_time )->time )
+
+#define LIBFDATETIME_PROBE_VALUE_FILETIME( internal_filetime ) \
+	( ( (uint64_t) ( internal_filetime )->upper << 32 ) | ( internal_filetime )->lower )
+
+/* The floatingtime value contains the bits of the 64-bit floating-point value
+ */
+#define LIBFDATETIME_PROBE_VALUE_FLOATINGTIME( internal_floatingtime ) \
+	( ( internal_floatingtime )->timestamp.integer )
+
+#define LIBFDATETIME_PROBE_VALUE_HFS_TIME( internal_hfs_time ) \
+	( (uint64_t) ( internal_hfs_time )->timestamp )
+
+#define LIBFDATETIME_PROBE_VALUE_NSF_TIMEDATE( internal_nsf_timedate ) \
+	( ( (uint64_t) ( internal_nsf_timedate )->upper << 32 ) | ( internal_nsf_timedate )->lower )
+
+#define LIBFDATETIME_PROBE_VALUE_POSIX_TIME( internal_posix_time ) \
+	( ( internal_posix_time )->timestamp )
+
+/* The SYSTEMTIME value contains the year, month, day of month, hours, minutes and seconds
+ * in 16, 8, 8, 8, 8 and 8 bits respectively, the milli seconds are not included
+ */
+#define LIBFDATETIME_PROBE_VALUE_SYSTEMTIME( internal_systemtime ) \
+	( ( (uint64_t) ( internal_systemtime )->year << 40 ) \
+	| ( (uint64_t) ( ( internal_systemtime )->month & 0xff ) << 32 ) \
+	| ( (uint64_t) ( ( internal_systemtime )->day_of_month & 0xff ) << 24 ) \
+	| ( (uint64_t) ( ( internal_systemtime )->hours & 0xff ) << 16 ) \
+	| ( (uint64_t) ( ( internal_systemtime )->minutes & 0xff ) << 8 ) \
+	| (uint64_t) ( ( internal_systemtime )->seconds & 0xff ) )
+
+#endif /* !defined( _LIBFDATETIME_PROBES_H ) */
+
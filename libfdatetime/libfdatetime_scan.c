@@ -0,0 +1,374 @@
+/*
+ * Scan functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_scan.h"
+
+/* Retrieves the range of FILETIME values of a range of years
+ * The lower bound is January 1 00:00:00 of the minimum year and the upper bound,
+ * which is not part of the range, January 1 00:00:00 of the year after the maximum year
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_scan_get_filetime_range(
+     uint16_t minimum_year,
+     uint16_t maximum_year,
+     uint64_t *lower_bound,
+     uint64_t *upper_bound,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function  = "libfdatetime_internal_scan_get_filetime_range";
+	int64_t number_of_days = 0;
+
+	if( minimum_year > maximum_year )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum year value exceeds maximum year.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_year > 9999 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum year value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( lower_bound == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lower bound.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_bound == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper bound.",
+		 function );
+
+		return( -1 );
+	}
+	date_time_values.month = 12;
+	date_time_values.day   = 31;
+
+	/* The FILETIME cannot represent dates before January 1, 1601
+	 * which is 134774 days before January 1, 1970
+	 */
+	if( maximum_year < 1601 )
+	{
+		*lower_bound = 0;
+		*upper_bound = 0;
+
+		return( 1 );
+	}
+	date_time_values.year = maximum_year;
+
+	if( libfdatetime_date_time_values_get_number_of_days_since_1970(
+	     &date_time_values,
+	     &number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of days of maximum year.",
+		 function );
+
+		return( -1 );
+	}
+	*upper_bound = (uint64_t) ( number_of_days + 1 + 134774 ) * 864000000000ULL;
+
+	if( minimum_year < 1601 )
+	{
+		*lower_bound = 0;
+
+		return( 1 );
+	}
+	date_time_values.year  = minimum_year;
+	date_time_values.month = 1;
+	date_time_values.day   = 1;
+
+	if( libfdatetime_date_time_values_get_number_of_days_since_1970(
+	     &date_time_values,
+	     &number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of days of minimum year.",
+		 function );
+
+		return( -1 );
+	}
+	*lower_bound = (uint64_t) ( number_of_days + 134774 ) * 864000000000ULL;
+
+	return( 1 );
+}
+
+/* Scans a buffer for FILETIME values within a range of years
+ * Every window of 8 bytes at a multitude of the alignment is read as a little-endian
+ * FILETIME, the offsets of the windows with a value in the range are stored in the
+ * offsets array. The scan stops when the offsets array is full, the scanned size
+ * then contains the offset of the first value that was not stored, which is a
+ * multitude of the alignment, so that the scan can be resumed from there
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_scan_filetimes(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t alignment,
+     uint16_t minimum_year,
+     uint16_t maximum_year,
+     size_t *offsets,
+     size_t maximum_number_of_offsets,
+     size_t *number_of_offsets,
+     size_t *scanned_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_scan_filetimes";
+	const uint8_t *block_data = NULL;
+	size_t buffer_offset      = 0;
+	size_t last_offset        = 0;
+	size_t number_of_windows  = 0;
+	size_t window_index       = 0;
+	size_t window_offset      = 0;
+	uint64_t lower_bound      = 0;
+	uint64_t range_size       = 0;
+	uint64_t upper_bound      = 0;
+	uint64_t value_64bit      = 0;
+	uint8_t byte_value_range  = 0;
+	uint8_t has_candidates    = 0;
+	uint8_t lower_byte_value  = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment == 0 )
+	 || ( alignment > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_offsets == 0 )
+	 || ( maximum_number_of_offsets > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of offsets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanned_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanned size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_scan_get_filetime_range(
+	     minimum_year,
+	     maximum_year,
+	     &lower_bound,
+	     &upper_bound,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve FILETIME range.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_offsets = 0;
+	*scanned_size      = buffer_size;
+
+	if( ( buffer_size < 8 )
+	 || ( lower_bound == upper_bound ) )
+	{
+		return( 1 );
+	}
+	/* A value is in the range if the value minus the lower bound is smaller than the range size,
+	 * since values below the lower bound wrap around to large unsigned values
+	 */
+	range_size  = upper_bound - lower_bound;
+	last_offset = buffer_size - 8;
+
+	/* The most significant byte of a value in the range is within the range of
+	 * the most significant bytes of the lower and upper bound
+	 */
+	lower_byte_value = (uint8_t) ( lower_bound >> 56 );
+	byte_value_range = (uint8_t) ( ( ( upper_bound - 1 ) >> 56 ) - lower_byte_value );
+
+	while( buffer_offset <= last_offset )
+	{
+		number_of_windows = ( ( last_offset - buffer_offset ) / alignment ) + 1;
+
+		if( number_of_windows > LIBFDATETIME_SCAN_BLOCK_SIZE )
+		{
+			number_of_windows = LIBFDATETIME_SCAN_BLOCK_SIZE;
+		}
+		/* The most significant bytes of the windows of a block are compared without branches,
+		 * so that the compiler can vectorize the comparisons, most blocks do not contain
+		 * a candidate and are rejected as a whole
+		 */
+		has_candidates = 0;
+
+		if( ( alignment == 1 )
+		 && ( number_of_windows == LIBFDATETIME_SCAN_BLOCK_SIZE ) )
+		{
+			/* The most significant bytes of windows that are not aligned are consecutive
+			 * and a full block has a fixed number of comparisons
+			 */
+			block_data = &( buffer[ buffer_offset + 7 ] );
+
+			for( window_index = 0;
+			     window_index < LIBFDATETIME_SCAN_BLOCK_SIZE;
+			     window_index++ )
+			{
+				has_candidates |= (uint8_t) ( (uint8_t) ( block_data[ window_index ] - lower_byte_value ) <= byte_value_range );
+			}
+		}
+		else
+		{
+			window_offset = buffer_offset + 7;
+
+			for( window_index = 0;
+			     window_index < number_of_windows;
+			     window_index++ )
+			{
+				has_candidates |= (uint8_t) ( (uint8_t) ( buffer[ window_offset ] - lower_byte_value ) <= byte_value_range );
+
+				window_offset += alignment;
+			}
+		}
+		if( has_candidates != 0 )
+		{
+			window_offset = buffer_offset;
+
+			for( window_index = 0;
+			     window_index < number_of_windows;
+			     window_index++ )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( buffer[ window_offset ] ),
+				 value_64bit );
+
+				if( ( value_64bit - lower_bound ) < range_size )
+				{
+					if( *number_of_offsets >= maximum_number_of_offsets )
+					{
+						*scanned_size = window_offset;
+
+						return( 1 );
+					}
+					offsets[ *number_of_offsets ] = window_offset;
+
+					*number_of_offsets += 1;
+				}
+				window_offset += alignment;
+			}
+		}
+		buffer_offset += number_of_windows * alignment;
+	}
+	return( 1 );
+}
+
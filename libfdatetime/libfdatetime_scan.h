@@ -0,0 +1,64 @@
+/*
+ * Scan functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_SCAN_H )
+#define _LIBFDATETIME_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of windows that are compared before the candidates of a block are collected
+ */
+#define LIBFDATETIME_SCAN_BLOCK_SIZE	64
+
+int libfdatetime_internal_scan_get_filetime_range(
+     uint16_t minimum_year,
+     uint16_t maximum_year,
+     uint64_t *lower_bound,
+     uint64_t *upper_bound,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_scan_filetimes(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t alignment,
+     uint16_t minimum_year,
+     uint16_t maximum_year,
+     size_t *offsets,
+     size_t maximum_number_of_offsets,
+     size_t *number_of_offsets,
+     size_t *scanned_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_SCAN_H ) */
+
@@ -0,0 +1,1196 @@
+/*
+ * Sort functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfdatetime_date_time_values.h"
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_fat_date_time.h"
+#include "libfdatetime_filetime.h"
+#include "libfdatetime_floatingtime.h"
+#include "libfdatetime_hfs_time.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_nsf_timedate.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_systemtime.h"
+#include "libfdatetime_types.h"
+
+/* Determines the sort key of a number of seconds since January 1, 1970 00:00:00
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A number of seconds outside the range of the sort key is saturated
+ * to LIBFDATETIME_SORT_KEY_MINIMUM or LIBFDATETIME_SORT_KEY_MAXIMUM
+ * Returns the sort key
+ */
+int64_t libfdatetime_get_sort_key_from_number_of_seconds(
+         int64_t number_of_seconds,
+         uint32_t number_of_nano_seconds )
+{
+	/* The bounds are 1 second within the range of the sort key
+	 * so that the fraction of seconds cannot overflow
+	 */
+	if( number_of_seconds > ( ( LIBFDATETIME_SORT_KEY_MAXIMUM / 10000000 ) - 11644473600 - 1 ) )
+	{
+		return( LIBFDATETIME_SORT_KEY_MAXIMUM );
+	}
+	if( number_of_seconds < ( ( LIBFDATETIME_SORT_KEY_MINIMUM / 10000000 ) - 11644473600 + 1 ) )
+	{
+		return( LIBFDATETIME_SORT_KEY_MINIMUM );
+	}
+	return( ( ( number_of_seconds + 11644473600 ) * 10000000 )
+	       + (int64_t) ( number_of_nano_seconds / 100 ) );
+}
+
+
+/* Retrieves the sort key of a timestamp of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_get_sort_key(
+     int timestamp_type,
+     intptr_t *timestamp,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_get_sort_key";
+	int result            = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			result = libfdatetime_internal_fat_date_time_get_sort_key(
+			          (libfdatetime_internal_fat_date_time_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			result = libfdatetime_internal_filetime_get_sort_key(
+			          (libfdatetime_internal_filetime_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			result = libfdatetime_internal_floatingtime_get_sort_key(
+			          (libfdatetime_internal_floatingtime_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			result = libfdatetime_internal_hfs_time_get_sort_key(
+			          (libfdatetime_internal_hfs_time_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			result = libfdatetime_internal_nsf_timedate_get_sort_key(
+			          (libfdatetime_internal_nsf_timedate_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			result = libfdatetime_internal_posix_time_get_sort_key(
+			          (libfdatetime_internal_posix_time_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			result = libfdatetime_internal_systemtime_get_sort_key(
+			          (libfdatetime_internal_systemtime_t *) timestamp,
+			          sort_key,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timestamp type.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares two timestamps that can be of different types
+ * Both timestamps are compared by their sort key, which for all types except
+ * the FAT date time and SYSTEMTIME is determined without decoding the date and time values
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_compare_any(
+     int first_timestamp_type,
+     intptr_t *first_timestamp,
+     int second_timestamp_type,
+     intptr_t *second_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_compare_any";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( libfdatetime_internal_get_sort_key(
+	     first_timestamp_type,
+	     first_timestamp,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_get_sort_key(
+	     second_timestamp_type,
+	     second_timestamp,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
+/* Counts the number of sort keys per digit value of the sort keys of a sort worker
+ */
+void libfdatetime_internal_sort_worker_count_digit_values(
+      libfdatetime_internal_sort_worker_t *sort_worker )
+{
+	const int64_t *sort_keys = NULL;
+	size_t sort_key_index    = 0;
+	uint8_t digit_value      = 0;
+
+	if( sort_worker == NULL )
+	{
+		return;
+	}
+	sort_keys = &( sort_worker->source_sort_keys[ sort_worker->first_sort_key_index ] );
+
+	for( sort_key_index = 0;
+	     sort_key_index < sort_worker->number_of_sort_keys;
+	     sort_key_index++ )
+	{
+		digit_value = libfdatetime_sort_key_get_digit_value(
+		               sort_keys[ sort_key_index ],
+		               sort_worker->digit_index );
+
+		sort_worker->digit_values[ digit_value ] += 1;
+	}
+}
+
+/* Moves the sort keys of a sort worker to their destination
+ * The digit values of the sort worker should contain the destination index per digit value
+ */
+void libfdatetime_internal_sort_worker_scatter(
+      libfdatetime_internal_sort_worker_t *sort_worker )
+{
+	size_t destination_index = 0;
+	size_t last_index        = 0;
+	size_t sort_key_index    = 0;
+	int64_t sort_key         = 0;
+	uint8_t digit_value      = 0;
+
+	if( sort_worker == NULL )
+	{
+		return;
+	}
+	last_index = sort_worker->first_sort_key_index + sort_worker->number_of_sort_keys;
+
+	for( sort_key_index = sort_worker->first_sort_key_index;
+	     sort_key_index < last_index;
+	     sort_key_index++ )
+	{
+		sort_key    = sort_worker->source_sort_keys[ sort_key_index ];
+		digit_value = libfdatetime_sort_key_get_digit_value(
+		               sort_key,
+		               sort_worker->digit_index );
+
+		destination_index = sort_worker->digit_values[ digit_value ];
+
+		sort_worker->digit_values[ digit_value ] += 1;
+
+		sort_worker->destination_sort_keys[ destination_index ] = sort_key;
+
+		if( sort_worker->source_permutation != NULL )
+		{
+			sort_worker->destination_permutation[ destination_index ] = sort_worker->source_permutation[ sort_key_index ];
+		}
+	}
+}
+
+/* The start function of a sort worker that counts digit values
+ * Returns NULL
+ */
+static void *libfdatetime_internal_sort_worker_count_digit_values_start_function(
+              void *arguments )
+{
+	libfdatetime_internal_sort_worker_count_digit_values(
+	 (libfdatetime_internal_sort_worker_t *) arguments );
+
+	return( NULL );
+}
+
+/* The start function of a sort worker that moves sort keys
+ * Returns NULL
+ */
+static void *libfdatetime_internal_sort_worker_scatter_start_function(
+              void *arguments )
+{
+	libfdatetime_internal_sort_worker_scatter(
+	 (libfdatetime_internal_sort_worker_t *) arguments );
+
+	return( NULL );
+}
+
+/* The start function of a merge worker
+ * Returns NULL
+ */
+static void *libfdatetime_internal_merge_worker_start_function(
+              void *arguments )
+{
+	libfdatetime_internal_merge_worker_merge(
+	 (libfdatetime_internal_merge_worker_t *) arguments );
+
+	return( NULL );
+}
+
+/* Runs the start function for every worker
+ * The calling thread runs the first worker and every worker for which a thread cannot be created
+ * This function returns when all workers have finished
+ */
+void libfdatetime_internal_sort_run_workers(
+      void *workers,
+      size_t worker_size,
+      int number_of_workers,
+      void *(*start_function)(
+               void *arguments ) )
+{
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	pthread_t worker_threads[ LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS ];
+	uint8_t worker_thread_is_running[ LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	int worker_index = 0;
+
+	if( ( workers == NULL )
+	 || ( start_function == NULL ) )
+	{
+		return;
+	}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	if( number_of_workers > LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		number_of_workers = LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS;
+	}
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker_thread_is_running[ worker_index ] = (uint8_t) ( pthread_create(
+		                                                        &( worker_threads[ worker_index ] ),
+		                                                        NULL,
+		                                                        start_function,
+		                                                        (void *) &( ( (uint8_t *) workers )[ worker_index * worker_size ] ) ) == 0 );
+	}
+	if( number_of_workers > 0 )
+	{
+		start_function(
+		 workers );
+	}
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( worker_thread_is_running[ worker_index ] != 0 )
+		{
+			pthread_join(
+			 worker_threads[ worker_index ],
+			 NULL );
+		}
+		else
+		{
+			start_function(
+			 (void *) &( ( (uint8_t *) workers )[ worker_index * worker_size ] ) );
+		}
+	}
+#else
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		start_function(
+		 (void *) &( ( (uint8_t *) workers )[ worker_index * worker_size ] ) );
+	}
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+}
+
+/* Sorts sort keys in ascending order
+ * The sort is a stable least significant digit radix sort that uses the scratch buffers,
+ * which should contain number of sort keys entries, to move the sort keys between passes
+ * If permutation is not NULL it is set to the original index of every sorted sort key,
+ * which requires the scratch permutation
+ * The passes are split over number of threads worker threads, if supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_sort_keys(
+     int64_t *sort_keys,
+     size_t *permutation,
+     size_t number_of_sort_keys,
+     int64_t *scratch_sort_keys,
+     size_t *scratch_permutation,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	size_t digit_values[ LIBFDATETIME_SORT_NUMBER_OF_DIGITS ][ LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES ];
+
+	libfdatetime_internal_sort_worker_t *sort_workers = NULL;
+	int64_t *destination_sort_keys                    = NULL;
+	int64_t *source_sort_keys                         = NULL;
+	size_t *destination_permutation                   = NULL;
+	size_t *source_permutation                        = NULL;
+	static char *function                             = "libfdatetime_sort_keys";
+	size_t digit_value_index                          = 0;
+	size_t number_of_sort_keys_per_worker             = 0;
+	size_t number_of_values                           = 0;
+	size_t sort_key_index                             = 0;
+	int64_t sort_key                                  = 0;
+	int digit_index                                   = 0;
+	int digit_value                                   = 0;
+	int number_of_workers                             = 0;
+	int worker_index                                  = 0;
+
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sort_keys > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sort keys value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( permutation != NULL )
+	 && ( scratch_permutation == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch permutation.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( permutation != NULL )
+	{
+		for( sort_key_index = 0;
+		     sort_key_index < number_of_sort_keys;
+		     sort_key_index++ )
+		{
+			permutation[ sort_key_index ] = sort_key_index;
+		}
+	}
+	if( number_of_sort_keys < 2 )
+	{
+		return( 1 );
+	}
+	/* Count the digit values of all digits in a single pass
+	 * the counts do not change when the sort keys are moved
+	 */
+	if( memory_set(
+	     digit_values,
+	     0,
+	     sizeof( size_t ) * LIBFDATETIME_SORT_NUMBER_OF_DIGITS * LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digit values.",
+		 function );
+
+		return( -1 );
+	}
+	for( sort_key_index = 0;
+	     sort_key_index < number_of_sort_keys;
+	     sort_key_index++ )
+	{
+		sort_key = sort_keys[ sort_key_index ];
+
+		for( digit_index = 0;
+		     digit_index < LIBFDATETIME_SORT_NUMBER_OF_DIGITS;
+		     digit_index++ )
+		{
+			digit_value = libfdatetime_sort_key_get_digit_value(
+			               sort_key,
+			               digit_index );
+
+			digit_values[ digit_index ][ digit_value ] += 1;
+		}
+	}
+	number_of_workers = number_of_threads;
+
+	if( (size_t) number_of_workers > ( number_of_sort_keys / LIBFDATETIME_SORT_MINIMUM_NUMBER_OF_VALUES_PER_THREAD ) )
+	{
+		number_of_workers = (int) ( number_of_sort_keys / LIBFDATETIME_SORT_MINIMUM_NUMBER_OF_VALUES_PER_THREAD );
+	}
+	if( number_of_workers == 0 )
+	{
+		number_of_workers = 1;
+	}
+	sort_workers = (libfdatetime_internal_sort_worker_t *) memory_allocate(
+	                                                        sizeof( libfdatetime_internal_sort_worker_t ) * number_of_workers );
+
+	if( sort_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sort workers.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_sort_keys_per_worker = number_of_sort_keys / number_of_workers;
+
+	source_sort_keys        = sort_keys;
+	destination_sort_keys   = scratch_sort_keys;
+	source_permutation      = permutation;
+	destination_permutation = scratch_permutation;
+
+	for( digit_index = 0;
+	     digit_index < LIBFDATETIME_SORT_NUMBER_OF_DIGITS;
+	     digit_index++ )
+	{
+		/* A digit for which all sort keys have the same value does not change the order
+		 */
+		digit_value = libfdatetime_sort_key_get_digit_value(
+		               source_sort_keys[ 0 ],
+		               digit_index );
+
+		if( digit_values[ digit_index ][ digit_value ] == number_of_sort_keys )
+		{
+			continue;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			sort_workers[ worker_index ].source_sort_keys        = source_sort_keys;
+			sort_workers[ worker_index ].destination_sort_keys   = destination_sort_keys;
+			sort_workers[ worker_index ].source_permutation      = source_permutation;
+			sort_workers[ worker_index ].destination_permutation = destination_permutation;
+			sort_workers[ worker_index ].first_sort_key_index    = number_of_sort_keys_per_worker * worker_index;
+			sort_workers[ worker_index ].number_of_sort_keys     = number_of_sort_keys_per_worker;
+			sort_workers[ worker_index ].digit_index             = digit_index;
+
+			if( memory_set(
+			     sort_workers[ worker_index ].digit_values,
+			     0,
+			     sizeof( size_t ) * LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear sort worker: %d digit values.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		sort_workers[ number_of_workers - 1 ].number_of_sort_keys = number_of_sort_keys - sort_workers[ number_of_workers - 1 ].first_sort_key_index;
+
+		if( number_of_workers == 1 )
+		{
+			if( memory_copy(
+			     sort_workers[ 0 ].digit_values,
+			     digit_values[ digit_index ],
+			     sizeof( size_t ) * LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy digit values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			libfdatetime_internal_sort_run_workers(
+			 (void *) sort_workers,
+			 sizeof( libfdatetime_internal_sort_worker_t ),
+			 number_of_workers,
+			 &libfdatetime_internal_sort_worker_count_digit_values_start_function );
+		}
+		/* Convert the counts into the destination index per digit value per worker,
+		 * sort keys with the same digit value keep their order
+		 */
+		digit_value_index = 0;
+
+		for( digit_value = 0;
+		     digit_value < LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES;
+		     digit_value++ )
+		{
+			for( worker_index = 0;
+			     worker_index < number_of_workers;
+			     worker_index++ )
+			{
+				number_of_values = sort_workers[ worker_index ].digit_values[ digit_value ];
+
+				sort_workers[ worker_index ].digit_values[ digit_value ] = digit_value_index;
+
+				digit_value_index += number_of_values;
+			}
+		}
+		libfdatetime_internal_sort_run_workers(
+		 (void *) sort_workers,
+		 sizeof( libfdatetime_internal_sort_worker_t ),
+		 number_of_workers,
+		 &libfdatetime_internal_sort_worker_scatter_start_function );
+
+		source_sort_keys      = destination_sort_keys;
+		destination_sort_keys = ( source_sort_keys == sort_keys ) ? scratch_sort_keys : sort_keys;
+
+		if( permutation != NULL )
+		{
+			source_permutation      = destination_permutation;
+			destination_permutation = ( source_permutation == permutation ) ? scratch_permutation : permutation;
+		}
+	}
+	memory_free(
+	 sort_workers );
+
+	sort_workers = NULL;
+
+	if( source_sort_keys != sort_keys )
+	{
+		if( memory_copy(
+		     sort_keys,
+		     source_sort_keys,
+		     sizeof( int64_t ) * number_of_sort_keys ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sort keys.",
+			 function );
+
+			goto on_error;
+		}
+		if( permutation != NULL )
+		{
+			if( memory_copy(
+			     permutation,
+			     source_permutation,
+			     sizeof( size_t ) * number_of_sort_keys ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy permutation.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sort_workers != NULL )
+	{
+		memory_free(
+		 sort_workers );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the first sort key in a sorted stream that is greater than
+ * the sort key, or greater than or equal if include_equal is 0
+ * Returns the stream index
+ */
+size_t libfdatetime_internal_merge_get_stream_index(
+        const int64_t *stream,
+        size_t stream_size,
+        int64_t sort_key,
+        uint8_t include_equal )
+{
+	size_t lower_index  = 0;
+	size_t middle_index = 0;
+	size_t upper_index  = stream_size;
+
+	if( stream == NULL )
+	{
+		return( 0 );
+	}
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( ( stream[ middle_index ] < sort_key )
+		 || ( ( include_equal != 0 )
+		  && ( stream[ middle_index ] == sort_key ) ) )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	return( lower_index );
+}
+
+/* Determines the index per stream of the first sort key that is merged at or after the merged index
+ * Sort keys with the same value are merged in stream order
+ */
+void libfdatetime_internal_merge_get_split(
+      const int64_t **streams,
+      const size_t *stream_sizes,
+      int number_of_streams,
+      size_t merged_index,
+      size_t *stream_indexes )
+{
+	size_t number_of_equal_sort_keys = 0;
+	size_t number_of_sort_keys       = 0;
+	size_t remaining_index           = 0;
+	int64_t lower_sort_key           = LIBFDATETIME_SORT_KEY_INVALID;
+	int64_t middle_sort_key          = 0;
+	int64_t upper_sort_key           = LIBFDATETIME_SORT_KEY_MAXIMUM;
+	int stream_index                 = 0;
+
+	if( ( streams == NULL )
+	 || ( stream_sizes == NULL )
+	 || ( stream_indexes == NULL ) )
+	{
+		return;
+	}
+	if( merged_index == 0 )
+	{
+		for( stream_index = 0;
+		     stream_index < number_of_streams;
+		     stream_index++ )
+		{
+			stream_indexes[ stream_index ] = 0;
+		}
+		return;
+	}
+	/* Determine the smallest sort key for which the number of sort keys that are
+	 * less than or equal is at least the merged index
+	 */
+	while( lower_sort_key < upper_sort_key )
+	{
+		middle_sort_key = (int64_t) ( (uint64_t) lower_sort_key + ( ( (uint64_t) upper_sort_key - (uint64_t) lower_sort_key ) / 2 ) );
+
+		number_of_sort_keys = 0;
+
+		for( stream_index = 0;
+		     stream_index < number_of_streams;
+		     stream_index++ )
+		{
+			number_of_sort_keys += libfdatetime_internal_merge_get_stream_index(
+			                        streams[ stream_index ],
+			                        stream_sizes[ stream_index ],
+			                        middle_sort_key,
+			                        1 );
+		}
+		if( number_of_sort_keys >= merged_index )
+		{
+			upper_sort_key = middle_sort_key;
+		}
+		else
+		{
+			lower_sort_key = middle_sort_key + 1;
+		}
+	}
+	/* All sort keys less than the split sort key are merged before the merged index,
+	 * the remainder is taken from the sort keys equal to the split sort key in stream order
+	 */
+	remaining_index = merged_index;
+
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		stream_indexes[ stream_index ] = libfdatetime_internal_merge_get_stream_index(
+		                                  streams[ stream_index ],
+		                                  stream_sizes[ stream_index ],
+		                                  lower_sort_key,
+		                                  0 );
+
+		remaining_index -= stream_indexes[ stream_index ];
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( remaining_index == 0 )
+		{
+			break;
+		}
+		number_of_equal_sort_keys = libfdatetime_internal_merge_get_stream_index(
+		                             streams[ stream_index ],
+		                             stream_sizes[ stream_index ],
+		                             lower_sort_key,
+		                             1 )
+		                          - stream_indexes[ stream_index ];
+
+		if( number_of_equal_sort_keys > remaining_index )
+		{
+			number_of_equal_sort_keys = remaining_index;
+		}
+		stream_indexes[ stream_index ] += number_of_equal_sort_keys;
+		remaining_index                -= number_of_equal_sort_keys;
+	}
+}
+
+/* Determines if the next sort key of the first stream is merged before that of the second stream
+ * The stream index number of streams is used as a sentinel that is merged before any other stream
+ * Returns 1 if merged before or 0 if not
+ */
+int libfdatetime_internal_merge_worker_is_before(
+     libfdatetime_internal_merge_worker_t *merge_worker,
+     size_t first_stream_index,
+     size_t second_stream_index )
+{
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_stream_index == (size_t) merge_worker->number_of_streams )
+	{
+		return( 1 );
+	}
+	if( second_stream_index == (size_t) merge_worker->number_of_streams )
+	{
+		return( 0 );
+	}
+	if( merge_worker->stream_indexes[ first_stream_index ] >= merge_worker->stream_end_indexes[ first_stream_index ] )
+	{
+		return( 0 );
+	}
+	if( merge_worker->stream_indexes[ second_stream_index ] >= merge_worker->stream_end_indexes[ second_stream_index ] )
+	{
+		return( 1 );
+	}
+	first_sort_key  = merge_worker->streams[ first_stream_index ][ merge_worker->stream_indexes[ first_stream_index ] ];
+	second_sort_key = merge_worker->streams[ second_stream_index ][ merge_worker->stream_indexes[ second_stream_index ] ];
+
+	if( first_sort_key != second_sort_key )
+	{
+		return( (int) ( first_sort_key < second_sort_key ) );
+	}
+	return( (int) ( first_stream_index < second_stream_index ) );
+}
+
+/* Moves a stream from its leaf up the loser tree of a merge worker
+ * The loser is kept at every node on the path and the winner is stored at the root
+ */
+void libfdatetime_internal_merge_worker_adjust(
+      libfdatetime_internal_merge_worker_t *merge_worker,
+      size_t stream_index )
+{
+	size_t loser_tree_index  = 0;
+	size_t stream_index_swap = 0;
+
+	loser_tree_index = ( stream_index + (size_t) merge_worker->number_of_streams ) / 2;
+
+	while( loser_tree_index > 0 )
+	{
+		if( libfdatetime_internal_merge_worker_is_before(
+		     merge_worker,
+		     merge_worker->loser_tree[ loser_tree_index ],
+		     stream_index ) != 0 )
+		{
+			stream_index_swap                            = merge_worker->loser_tree[ loser_tree_index ];
+			merge_worker->loser_tree[ loser_tree_index ] = stream_index;
+			stream_index                                 = stream_index_swap;
+		}
+		loser_tree_index /= 2;
+	}
+	merge_worker->loser_tree[ 0 ] = stream_index;
+}
+
+/* Merges the sort keys of the range of merged indexes of a merge worker
+ */
+void libfdatetime_internal_merge_worker_merge(
+      libfdatetime_internal_merge_worker_t *merge_worker )
+{
+	size_t merged_index      = 0;
+	size_t number_of_streams = 0;
+	size_t stream_index      = 0;
+
+	if( merge_worker == NULL )
+	{
+		return;
+	}
+	number_of_streams = (size_t) merge_worker->number_of_streams;
+
+	libfdatetime_internal_merge_get_split(
+	 merge_worker->streams,
+	 merge_worker->stream_sizes,
+	 merge_worker->number_of_streams,
+	 merge_worker->first_merged_index,
+	 merge_worker->stream_indexes );
+
+	libfdatetime_internal_merge_get_split(
+	 merge_worker->streams,
+	 merge_worker->stream_sizes,
+	 merge_worker->number_of_streams,
+	 merge_worker->last_merged_index,
+	 merge_worker->stream_end_indexes );
+
+	/* Build the loser tree starting with sentinels that are replaced by the streams
+	 */
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		merge_worker->loser_tree[ stream_index ] = number_of_streams;
+	}
+	for( stream_index = number_of_streams;
+	     stream_index > 0;
+	     stream_index-- )
+	{
+		libfdatetime_internal_merge_worker_adjust(
+		 merge_worker,
+		 stream_index - 1 );
+	}
+	for( merged_index = merge_worker->first_merged_index;
+	     merged_index < merge_worker->last_merged_index;
+	     merged_index++ )
+	{
+		stream_index = merge_worker->loser_tree[ 0 ];
+
+		merge_worker->merged_sort_keys[ merged_index ] = merge_worker->streams[ stream_index ][ merge_worker->stream_indexes[ stream_index ] ];
+
+		if( merge_worker->merged_stream_indexes != NULL )
+		{
+			merge_worker->merged_stream_indexes[ merged_index ] = (int) stream_index;
+		}
+		merge_worker->stream_indexes[ stream_index ] += 1;
+
+		libfdatetime_internal_merge_worker_adjust(
+		 merge_worker,
+		 stream_index );
+	}
+}
+
+/* Merges streams of sorted sort keys into a single sorted array of sort keys
+ * The merge uses a loser tree, sort keys with the same value are merged in stream order
+ * If merged stream indexes is not NULL it is set to the index of the stream of every merged sort key
+ * The number of merged sort keys should be at least the sum of the stream sizes
+ * The scratch buffer should contain at least 3 x number of streams x number of threads entries
+ * The merge is split over number of threads worker threads, if supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_merge_sorted_streams(
+     const int64_t **streams,
+     const size_t *stream_sizes,
+     int number_of_streams,
+     int64_t *merged_sort_keys,
+     int *merged_stream_indexes,
+     size_t number_of_merged_sort_keys,
+     size_t *scratch_buffer,
+     size_t scratch_buffer_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_merge_worker_t *merge_workers = NULL;
+	static char *function                               = "libfdatetime_merge_sorted_streams";
+	size_t number_of_sort_keys                          = 0;
+	size_t number_of_sort_keys_per_worker               = 0;
+	size_t scratch_index                                = 0;
+	int number_of_workers                               = 0;
+	int stream_index                                    = 0;
+	int worker_index                                    = 0;
+
+	if( streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_streams <= 0 )
+	 || ( (size_t) number_of_streams > ( (size_t) SSIZE_MAX / ( 3 * sizeof( size_t ) * LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of streams value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( merged_sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merged sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_merged_sort_keys > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of merged sort keys value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_buffer_size < ( 3 * (size_t) number_of_streams * (size_t) number_of_threads ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid scratch buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( ( streams[ stream_index ] == NULL )
+		 && ( stream_sizes[ stream_index ] > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid stream: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( stream_sizes[ stream_index ] > ( number_of_merged_sort_keys - number_of_sort_keys ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid number of merged sort keys value too small.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_sort_keys += stream_sizes[ stream_index ];
+	}
+	if( number_of_sort_keys == 0 )
+	{
+		return( 1 );
+	}
+	number_of_workers = number_of_threads;
+
+	if( (size_t) number_of_workers > ( number_of_sort_keys / LIBFDATETIME_SORT_MINIMUM_NUMBER_OF_VALUES_PER_THREAD ) )
+	{
+		number_of_workers = (int) ( number_of_sort_keys / LIBFDATETIME_SORT_MINIMUM_NUMBER_OF_VALUES_PER_THREAD );
+	}
+	if( number_of_workers == 0 )
+	{
+		number_of_workers = 1;
+	}
+	merge_workers = (libfdatetime_internal_merge_worker_t *) memory_allocate(
+	                                                          sizeof( libfdatetime_internal_merge_worker_t ) * number_of_workers );
+
+	if( merge_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merge workers.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sort_keys_per_worker = number_of_sort_keys / number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		merge_workers[ worker_index ].streams               = streams;
+		merge_workers[ worker_index ].stream_sizes          = stream_sizes;
+		merge_workers[ worker_index ].number_of_streams     = number_of_streams;
+		merge_workers[ worker_index ].merged_sort_keys      = merged_sort_keys;
+		merge_workers[ worker_index ].merged_stream_indexes = merged_stream_indexes;
+		merge_workers[ worker_index ].first_merged_index    = number_of_sort_keys_per_worker * worker_index;
+		merge_workers[ worker_index ].last_merged_index     = number_of_sort_keys_per_worker * ( worker_index + 1 );
+		merge_workers[ worker_index ].loser_tree            = &( scratch_buffer[ scratch_index ] );
+		merge_workers[ worker_index ].stream_indexes        = &( scratch_buffer[ scratch_index + number_of_streams ] );
+		merge_workers[ worker_index ].stream_end_indexes    = &( scratch_buffer[ scratch_index + ( 2 * number_of_streams ) ] );
+
+		scratch_index += 3 * (size_t) number_of_streams;
+	}
+	merge_workers[ number_of_workers - 1 ].last_merged_index = number_of_sort_keys;
+
+	libfdatetime_internal_sort_run_workers(
+	 (void *) merge_workers,
+	 sizeof( libfdatetime_internal_merge_worker_t ),
+	 number_of_workers,
+	 &libfdatetime_internal_merge_worker_start_function );
+
+	memory_free(
+	 merge_workers );
+
+	return( 1 );
+}
+
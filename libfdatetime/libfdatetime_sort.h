@@ -0,0 +1,232 @@
+/*
+ * Sort functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_SORT_H )
+#define _LIBFDATETIME_SORT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of bits in a radix sort digit
+ */
+#define LIBFDATETIME_SORT_DIGIT_SIZE			8
+
+/* The number of values of a radix sort digit
+ */
+#define LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES	256
+
+/* The number of radix sort digits in a sort key
+ */
+#define LIBFDATETIME_SORT_NUMBER_OF_DIGITS		8
+
+/* Retrieves the value of a radix sort digit of a sort key
+ * The sign bit is inverted so that negative sort keys sort before positive sort keys
+ */
+#define libfdatetime_sort_key_get_digit_value( sort_key, digit_index ) \
+	(uint8_t) ( ( (uint64_t) ( sort_key ) ^ 0x8000000000000000ULL ) >> ( ( digit_index ) * LIBFDATETIME_SORT_DIGIT_SIZE ) )
+
+/* The minimum number of values handled by a worker thread
+ */
+#define LIBFDATETIME_SORT_MINIMUM_NUMBER_OF_VALUES_PER_THREAD	16384
+
+/* The maximum number of worker threads
+ */
+#define LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS	256
+
+typedef struct libfdatetime_internal_sort_worker libfdatetime_internal_sort_worker_t;
+
+struct libfdatetime_internal_sort_worker
+{
+	/* The source sort keys
+	 */
+	const int64_t *source_sort_keys;
+
+	/* The destination sort keys
+	 */
+	int64_t *destination_sort_keys;
+
+	/* The source permutation
+	 */
+	const size_t *source_permutation;
+
+	/* The destination permutation
+	 */
+	size_t *destination_permutation;
+
+	/* The index of the first sort key handled by the worker
+	 */
+	size_t first_sort_key_index;
+
+	/* The number of sort keys handled by the worker
+	 */
+	size_t number_of_sort_keys;
+
+	/* The index of the digit
+	 */
+	int digit_index;
+
+	/* The number of sort keys per digit value, which is converted into
+	 * the index of the destination of the next sort key per digit value
+	 */
+	size_t digit_values[ LIBFDATETIME_SORT_NUMBER_OF_DIGIT_VALUES ];
+};
+
+typedef struct libfdatetime_internal_merge_worker libfdatetime_internal_merge_worker_t;
+
+struct libfdatetime_internal_merge_worker
+{
+	/* The streams
+	 */
+	const int64_t **streams;
+
+	/* The stream sizes
+	 */
+	const size_t *stream_sizes;
+
+	/* The number of streams
+	 */
+	int number_of_streams;
+
+	/* The merged sort keys
+	 */
+	int64_t *merged_sort_keys;
+
+	/* The merged stream indexes
+	 */
+	int *merged_stream_indexes;
+
+	/* The index of the first merged sort key handled by the worker
+	 */
+	size_t first_merged_index;
+
+	/* The index of the merged sort key after the last one handled by the worker
+	 */
+	size_t last_merged_index;
+
+	/* The loser tree, contains number of streams entries
+	 */
+	size_t *loser_tree;
+
+	/* The index of the next sort key per stream, contains number of streams entries
+	 */
+	size_t *stream_indexes;
+
+	/* The index of the sort key after the last one per stream, contains number of streams entries
+	 */
+	size_t *stream_end_indexes;
+};
+
+int64_t libfdatetime_get_sort_key_from_number_of_seconds(
+         int64_t number_of_seconds,
+         uint32_t number_of_nano_seconds );
+
+int libfdatetime_internal_get_sort_key(
+     int timestamp_type,
+     intptr_t *timestamp,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_compare_any(
+     int first_timestamp_type,
+     intptr_t *first_timestamp,
+     int second_timestamp_type,
+     intptr_t *second_timestamp,
+     libcerror_error_t **error );
+
+void libfdatetime_internal_sort_worker_count_digit_values(
+      libfdatetime_internal_sort_worker_t *sort_worker );
+
+void libfdatetime_internal_sort_worker_scatter(
+      libfdatetime_internal_sort_worker_t *sort_worker );
+
+void libfdatetime_internal_sort_run_workers(
+      void *workers,
+      size_t worker_size,
+      int number_of_workers,
+      void *(*start_function)(
+               void *arguments ) );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_sort_keys(
+     int64_t *sort_keys,
+     size_t *permutation,
+     size_t number_of_sort_keys,
+     int64_t *scratch_sort_keys,
+     size_t *scratch_permutation,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+size_t libfdatetime_internal_merge_get_stream_index(
+        const int64_t *stream,
+        size_t stream_size,
+        int64_t sort_key,
+        uint8_t include_equal );
+
+void libfdatetime_internal_merge_get_split(
+      const int64_t **streams,
+      const size_t *stream_sizes,
+      int number_of_streams,
+      size_t merged_index,
+      size_t *stream_indexes );
+
+int libfdatetime_internal_merge_worker_is_before(
+     libfdatetime_internal_merge_worker_t *merge_worker,
+     size_t first_stream_index,
+     size_t second_stream_index );
+
+void libfdatetime_internal_merge_worker_adjust(
+      libfdatetime_internal_merge_worker_t *merge_worker,
+      size_t stream_index );
+
+void libfdatetime_internal_merge_worker_merge(
+      libfdatetime_internal_merge_worker_t *merge_worker );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_merge_sorted_streams(
+     const int64_t **streams,
+     const size_t *stream_sizes,
+     int number_of_streams,
+     int64_t *merged_sort_keys,
+     int *merged_stream_indexes,
+     size_t number_of_merged_sort_keys,
+     size_t *scratch_buffer,
+     size_t scratch_buffer_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_SORT_H ) */
+
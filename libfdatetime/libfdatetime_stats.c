@@ -0,0 +1,455 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_LIBFDATETIME_STATS ) && defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_stats.h"
+#include "libfdatetime_unused.h"
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+
+/* The counters are only updated by the thread that owns them, relaxed atomic
+ * loads and stores allow other threads to read them without locking the owner
+ * A plain read and write would be a data race, hence compilers without atomic
+ * builtins or interlocked functions are not supported
+ */
+#if defined( __GNUC__ )
+#define libfdatetime_stats_load_value( value ) \
+	__atomic_load_n( &( value ), __ATOMIC_RELAXED )
+
+#define libfdatetime_stats_store_value( value, new_value ) \
+	__atomic_store_n( &( value ), new_value, __ATOMIC_RELAXED )
+
+#elif defined( _MSC_VER )
+#define libfdatetime_stats_load_value( value ) \
+	(uint64_t) InterlockedCompareExchange64( (volatile LONG64 *) &( value ), 0, 0 )
+
+#define libfdatetime_stats_store_value( value, new_value ) \
+	InterlockedExchange64( (volatile LONG64 *) &( value ), (LONG64) ( new_value ) )
+
+#else
+#error Instrumentation counters (--enable-stats) require atomic builtins or interlocked functions
+
+#endif /* defined( __GNUC__ ) */
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+
+/* The counters of threads that have exited
+ */
+static uint64_t libfdatetime_stats_exited_threads_values[ LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES ][ LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES ];
+
+/* The list of the counters of the running threads
+ */
+static libfdatetime_stats_counters_t *libfdatetime_stats_first_counters = NULL;
+
+/* The mutex that protects the list of counters and the counters of threads that have exited
+ */
+static pthread_mutex_t libfdatetime_stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* The key of the thread specific counters, the destructor of the key folds
+ * the counters of an exiting thread into the counters of threads that have exited
+ */
+static pthread_key_t libfdatetime_stats_key;
+
+static pthread_once_t libfdatetime_stats_key_once = PTHREAD_ONCE_INIT;
+
+#if defined( __GNUC__ )
+
+/* Thread local cache of the thread specific counters
+ */
+static __thread libfdatetime_stats_counters_t *libfdatetime_stats_thread_counters = NULL;
+
+#endif /* defined( __GNUC__ ) */
+
+/* Folds the counters of an exiting thread into the counters of threads that have exited
+ */
+static void libfdatetime_stats_free_thread_counters(
+             void *data )
+{
+	libfdatetime_stats_counters_t *counters = (libfdatetime_stats_counters_t *) data;
+	int counter_type                        = 0;
+	int timestamp_type                      = 0;
+
+	if( counters == NULL )
+	{
+		return;
+	}
+	pthread_mutex_lock(
+	 &libfdatetime_stats_mutex );
+
+	for( timestamp_type = 0;
+	     timestamp_type < LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES;
+	     timestamp_type++ )
+	{
+		for( counter_type = 0;
+		     counter_type < LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES;
+		     counter_type++ )
+		{
+			libfdatetime_stats_exited_threads_values[ timestamp_type ][ counter_type ] += counters->values[ timestamp_type ][ counter_type ];
+		}
+	}
+	if( counters->previous_counters != NULL )
+	{
+		counters->previous_counters->next_counters = counters->next_counters;
+	}
+	else
+	{
+		libfdatetime_stats_first_counters = counters->next_counters;
+	}
+	if( counters->next_counters != NULL )
+	{
+		counters->next_counters->previous_counters = counters->previous_counters;
+	}
+	pthread_mutex_unlock(
+	 &libfdatetime_stats_mutex );
+
+	memory_free(
+	 counters );
+}
+
+/* Creates the key of the thread specific counters
+ */
+static void libfdatetime_stats_create_key(
+             void )
+{
+	pthread_key_create(
+	 &libfdatetime_stats_key,
+	 &libfdatetime_stats_free_thread_counters );
+}
+
+/* Retrieves the counters of the calling thread, the counters are created on first use
+ * Returns a pointer to the counters or NULL if not available
+ */
+static libfdatetime_stats_counters_t *libfdatetime_stats_get_thread_counters(
+                                       void )
+{
+	libfdatetime_stats_counters_t *counters = NULL;
+
+#if defined( __GNUC__ )
+	counters = libfdatetime_stats_thread_counters;
+
+	if( counters != NULL )
+	{
+		return( counters );
+	}
+#endif
+	if( pthread_once(
+	     &libfdatetime_stats_key_once,
+	     &libfdatetime_stats_create_key ) != 0 )
+	{
+		return( NULL );
+	}
+	counters = (libfdatetime_stats_counters_t *) pthread_getspecific(
+	                                              libfdatetime_stats_key );
+
+	if( counters == NULL )
+	{
+		counters = memory_allocate_structure(
+		            libfdatetime_stats_counters_t );
+
+		if( counters == NULL )
+		{
+			return( NULL );
+		}
+		if( memory_set(
+		     counters,
+		     0,
+		     sizeof( libfdatetime_stats_counters_t ) ) == NULL )
+		{
+			memory_free(
+			 counters );
+
+			return( NULL );
+		}
+		if( pthread_setspecific(
+		     libfdatetime_stats_key,
+		     counters ) != 0 )
+		{
+			memory_free(
+			 counters );
+
+			return( NULL );
+		}
+		pthread_mutex_lock(
+		 &libfdatetime_stats_mutex );
+
+		counters->next_counters = libfdatetime_stats_first_counters;
+
+		if( libfdatetime_stats_first_counters != NULL )
+		{
+			libfdatetime_stats_first_counters->previous_counters = counters;
+		}
+		libfdatetime_stats_first_counters = counters;
+
+		pthread_mutex_unlock(
+		 &libfdatetime_stats_mutex );
+	}
+#if defined( __GNUC__ )
+	libfdatetime_stats_thread_counters = counters;
+#endif
+	return( counters );
+}
+
+#else
+
+/* Without multi-threading support all counters are process wide
+ */
+static libfdatetime_stats_counters_t libfdatetime_stats_process_counters;
+
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
+/* Adds a value to a counter of the calling thread
+ */
+void libfdatetime_stats_add(
+      int timestamp_type,
+      int counter_type,
+      uint64_t value )
+{
+	libfdatetime_stats_counters_t *counters = NULL;
+
+	if( ( timestamp_type < 0 )
+	 || ( timestamp_type >= LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES )
+	 || ( counter_type < 0 )
+	 || ( counter_type >= LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES ) )
+	{
+		return;
+	}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	counters = libfdatetime_stats_get_thread_counters();
+
+	if( counters == NULL )
+	{
+		return;
+	}
+#else
+	counters = &libfdatetime_stats_process_counters;
+#endif
+	libfdatetime_stats_store_value(
+	 counters->values[ timestamp_type ][ counter_type ],
+	 libfdatetime_stats_load_value( counters->values[ timestamp_type ][ counter_type ] ) + value );
+}
+
+#endif /* defined( HAVE_LIBFDATETIME_STATS ) */
+
+/* Retrieves the value of a statistics counter of a specific timestamp type
+ * The value is the sum of the counters of all threads, including threads that have exited
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
+ */
+int libfdatetime_stats_get(
+     int timestamp_type,
+     int counter_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libfdatetime_stats_get";
+
+#if defined( HAVE_LIBFDATETIME_STATS ) && defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	libfdatetime_stats_counters_t *counters = NULL;
+#endif
+
+	if( ( timestamp_type < 0 )
+	 || ( timestamp_type >= LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported timestamp type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter_type < 0 )
+	 || ( counter_type >= LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported counter type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFDATETIME_STATS )
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	if( pthread_mutex_lock(
+	     &libfdatetime_stats_mutex ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to lock mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*value = libfdatetime_stats_exited_threads_values[ timestamp_type ][ counter_type ];
+
+	for( counters = libfdatetime_stats_first_counters;
+	     counters != NULL;
+	     counters = counters->next_counters )
+	{
+		*value += libfdatetime_stats_load_value(
+		           counters->values[ timestamp_type ][ counter_type ] );
+	}
+	if( pthread_mutex_unlock(
+	     &libfdatetime_stats_mutex ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	*value = libfdatetime_stats_process_counters.values[ timestamp_type ][ counter_type ];
+#endif
+	return( 1 );
+#else
+	*value = 0;
+
+	return( 0 );
+#endif /* defined( HAVE_LIBFDATETIME_STATS ) */
+}
+
+/* Resets the statistics counters of all threads
+ * A counter that is updated while it is reset can retain its value
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
+ */
+int libfdatetime_stats_reset(
+     libcerror_error_t **error LIBFDATETIME_ATTRIBUTE_UNUSED )
+{
+#if defined( HAVE_LIBFDATETIME_STATS )
+	static char *function                   = "libfdatetime_stats_reset";
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	libfdatetime_stats_counters_t *counters = NULL;
+	int counter_type                        = 0;
+	int timestamp_type                      = 0;
+
+	if( pthread_mutex_lock(
+	     &libfdatetime_stats_mutex ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to lock mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     libfdatetime_stats_exited_threads_values,
+	     0,
+	     sizeof( libfdatetime_stats_exited_threads_values ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear counters of exited threads.",
+		 function );
+
+		pthread_mutex_unlock(
+		 &libfdatetime_stats_mutex );
+
+		return( -1 );
+	}
+	for( counters = libfdatetime_stats_first_counters;
+	     counters != NULL;
+	     counters = counters->next_counters )
+	{
+		for( timestamp_type = 0;
+		     timestamp_type < LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES;
+		     timestamp_type++ )
+		{
+			for( counter_type = 0;
+			     counter_type < LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES;
+			     counter_type++ )
+			{
+				libfdatetime_stats_store_value(
+				 counters->values[ timestamp_type ][ counter_type ],
+				 0 );
+			}
+		}
+	}
+	if( pthread_mutex_unlock(
+	     &libfdatetime_stats_mutex ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( memory_set(
+	     libfdatetime_stats_process_counters.values,
+	     0,
+	     sizeof( libfdatetime_stats_process_counters.values ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear counters.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
+	return( 1 );
+#else
+	LIBFDATETIME_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+#endif /* defined( HAVE_LIBFDATETIME_STATS ) */
+}
+
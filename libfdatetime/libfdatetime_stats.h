@@ -0,0 +1,92 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFDATETIME_STATS_H )
+#define _LIBFDATETIME_STATS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of timestamp types, including the undefined timestamp type
+ */
+#define LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES	8
+
+/* The number of counter types
+ */
+#define LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES	5
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+
+typedef struct libfdatetime_stats_counters libfdatetime_stats_counters_t;
+
+struct libfdatetime_stats_counters
+{
+	/* The counter values per timestamp type and counter type
+	 */
+	uint64_t values[ LIBFDATETIME_STATS_NUMBER_OF_TIMESTAMP_TYPES ][ LIBFDATETIME_STATS_NUMBER_OF_COUNTER_TYPES ];
+
+	/* The previous counters in the list of counters of all threads
+	 */
+	libfdatetime_stats_counters_t *previous_counters;
+
+	/* The next counters in the list of counters of all threads
+	 */
+	libfdatetime_stats_counters_t *next_counters;
+};
+
+void libfdatetime_stats_add(
+      int timestamp_type,
+      int counter_type,
+      uint64_t value );
+
+#define LIBFDATETIME_STATS_ADD( timestamp_type, counter_type, value ) \
+	libfdatetime_stats_add( timestamp_type, counter_type, (uint64_t) ( value ) );
+
+#else
+#define LIBFDATETIME_STATS_ADD( timestamp_type, counter_type, value ) \
+	/* Statistics are disabled */
+
+#endif /* defined( HAVE_LIBFDATETIME_STATS ) */
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_stats_get(
+     int timestamp_type,
+     int counter_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_stats_reset(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_STATS_H ) */
+
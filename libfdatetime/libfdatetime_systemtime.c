@@ -26,7 +26,12 @@
 
 #include "libfdatetime_definitions.h"
 #include "libfdatetime_date_time_values.h"
+#include "libfdatetime_filetime.h"
 #include "libfdatetime_libcerror.h"
+#include "libfdatetime_posix_time.h"
+#include "libfdatetime_probes.h"
+#include "libfdatetime_sort.h"
+#include "libfdatetime_stats.h"
 #include "libfdatetime_systemtime.h"
 #include "libfdatetime_types.h"
 
@@ -303,6 +308,151 @@ int libfdatetime_systemtime_copy_from_byte_stream(
 		 byte_stream,
 		 internal_systemtime->milli_seconds );
 	}
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	 1 )
+
+	return( 1 );
+}
+
+/* Converts date time values into a SYSTEMTIME
+ * The SYSTEMTIME can represent the years 1601 and later, the micro and nano seconds are truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_systemtime_copy_from_date_time_values(
+     libfdatetime_internal_systemtime_t *internal_systemtime,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfdatetime_internal_systemtime_copy_from_date_time_values";
+	int64_t number_of_days    = 0;
+	int64_t number_of_seconds = 0;
+
+	if( internal_systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of seconds is also used to validate the date time values
+	 */
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     date_time_values,
+	     &number_of_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of seconds since 1970.",
+		 function );
+
+		return( -1 );
+	}
+	if( date_time_values->year < 1601 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid date time values - year value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_days = number_of_seconds / 86400;
+
+	if( ( number_of_seconds % 86400 ) < 0 )
+	{
+		number_of_days -= 1;
+	}
+	/* January 1, 1970 was a Thursday and a day of week of 0 represents Sunday
+	 */
+	internal_systemtime->day_of_week = (uint16_t) ( ( ( number_of_days % 7 ) + 11 ) % 7 );
+
+	internal_systemtime->year          = date_time_values->year;
+	internal_systemtime->month         = date_time_values->month;
+	internal_systemtime->day_of_month  = date_time_values->day;
+	internal_systemtime->hours         = date_time_values->hours;
+	internal_systemtime->minutes       = date_time_values->minutes;
+	internal_systemtime->seconds       = date_time_values->seconds;
+	internal_systemtime->milli_seconds = date_time_values->milli_seconds;
+
+	return( 1 );
+}
+
+/* Converts date time values into a SYSTEMTIME
+ * The fraction of seconds is specified as a number of nano seconds
+ * The SYSTEMTIME can represent the years 1601 and later, the micro and nano seconds are truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_systemtime_copy_from_date_time_values(
+     libfdatetime_systemtime_t *systemtime,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_systemtime_copy_from_date_time_values";
+
+	if( systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_date_time_values_set_values(
+	     &date_time_values,
+	     year,
+	     month,
+	     day,
+	     hours,
+	     minutes,
+	     seconds,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_systemtime_copy_from_date_time_values(
+	     (libfdatetime_internal_systemtime_t *) systemtime,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date time values to SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -497,6 +647,449 @@ int libfdatetime_internal_systemtime_copy_to_date_time_values(
 	return( 1 );
 }
 
+/* Converts a SYSTEMTIME into a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_systemtime_copy_to_filetime(
+     libfdatetime_systemtime_t *systemtime,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_systemtime_copy_to_filetime";
+
+	if( libfdatetime_internal_systemtime_copy_to_date_time_values(
+	     (libfdatetime_internal_systemtime_t *) systemtime,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_filetime_copy_from_date_time_values(
+	     (libfdatetime_internal_filetime_t *) filetime,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FILETIME from date time values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a SYSTEMTIME into a POSIX time
+ * The milli seconds are truncated to the precision of the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_systemtime_copy_to_posix_time(
+     libfdatetime_systemtime_t *systemtime,
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libfdatetime_systemtime_copy_to_posix_time";
+
+	if( libfdatetime_internal_systemtime_copy_to_date_time_values(
+	     (libfdatetime_internal_systemtime_t *) systemtime,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_posix_time_copy_from_date_time_values(
+	     (libfdatetime_internal_posix_time_t *) posix_time,
+	     &date_time_values,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time from date time values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort key of a SYSTEMTIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_systemtime_get_sort_key(
+     libfdatetime_internal_systemtime_t *internal_systemtime,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+
+	static char *function     = "libfdatetime_internal_systemtime_get_sort_key";
+	int64_t number_of_seconds = 0;
+
+	if( internal_systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort key.",
+		 function );
+
+		return( -1 );
+	}
+	/* The error is not set since a SYSTEMTIME that does not represent a date and time
+	 * maps to the invalid sort key
+	 */
+	if( libfdatetime_internal_systemtime_copy_to_date_time_values(
+	     internal_systemtime,
+	     &date_time_values,
+	     NULL ) != 1 )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+	}
+	else if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	          &date_time_values,
+	          &number_of_seconds,
+	          NULL ) != 1 )
+	{
+		*sort_key = LIBFDATETIME_SORT_KEY_INVALID;
+	}
+	else
+	{
+		*sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+		             number_of_seconds,
+		             (uint32_t) date_time_values.milli_seconds * 1000000 );
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the sort key
+ * The sort key is the number of 100 nano seconds intervals since January 1, 1601 00:00:00
+ * A SYSTEMTIME that does not represent a date and time maps to LIBFDATETIME_SORT_KEY_INVALID
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_systemtime_get_sort_key(
+     libfdatetime_systemtime_t *systemtime,
+     int64_t *sort_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_systemtime_get_sort_key";
+
+	if( systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_systemtime_get_sort_key(
+	     (libfdatetime_internal_systemtime_t *) systemtime,
+	     sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sort key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the day of week stored in the SYSTEMTIME matches its date
+ * The decoding functions do not check the day of week, since it is redundant
+ * Returns 1 if the day of week is valid, 0 if not or -1 on error
+ */
+int libfdatetime_systemtime_has_valid_day_of_week(
+     libfdatetime_systemtime_t *systemtime,
+     libcerror_error_t **error )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_systemtime_t *internal_systemtime = NULL;
+
+	static char *function                                   = "libfdatetime_systemtime_has_valid_day_of_week";
+	int64_t number_of_days                                  = 0;
+
+	if( systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	internal_systemtime = (libfdatetime_internal_systemtime_t *) systemtime;
+
+	/* The error is not set since a SYSTEMTIME that does not represent a date
+	 * cannot have a valid day of week
+	 */
+	if( libfdatetime_internal_systemtime_copy_to_date_time_values(
+	     internal_systemtime,
+	     &date_time_values,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_days_since_1970(
+	     &date_time_values,
+	     &number_of_days,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libfdatetime_date_time_values_set_calendar_values(
+	     &date_time_values,
+	     number_of_days,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set calendar values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_systemtime->day_of_week != (uint16_t) date_time_values.day_of_week )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sort keys of an array of SYSTEMTIME values
+ * The SYSTEMTIME values are stored consecutively in the byte stream, 16 bytes per value
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_systemtime_array_get_sort_keys(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     int64_t *sort_keys,
+     size_t number_of_values,
+     libcerror_error_t **error )
+{
+	libfdatetime_internal_systemtime_t internal_systemtime;
+
+	static char *function = "libfdatetime_systemtime_array_get_sort_keys";
+	size_t value_index    = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBFDATETIME_ENDIAN_BIG )
+	 && ( byte_order != LIBFDATETIME_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > ( byte_stream_size / 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libfdatetime_systemtime_copy_from_byte_stream(
+		     (libfdatetime_systemtime_t *) &internal_systemtime,
+		     &( byte_stream[ value_index * 16 ] ),
+		     16,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %" PRIzd " from byte stream.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( libfdatetime_internal_systemtime_get_sort_key(
+		     &internal_systemtime,
+		     &( sort_keys[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sort key of value: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two SYSTEMTIME
+ * Both values are compared by their sort key
+ * Returns LIBFDATETIME_COMPARE_LESS, LIBFDATETIME_COMPARE_EQUAL, LIBFDATETIME_COMPARE_GREATER if successful or -1 on error
+ */
+int libfdatetime_systemtime_compare(
+     libfdatetime_systemtime_t *first_systemtime,
+     libfdatetime_systemtime_t *second_systemtime,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfdatetime_systemtime_compare";
+	int64_t first_sort_key  = 0;
+	int64_t second_sort_key = 0;
+
+	if( first_systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_systemtime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second SYSTEMTIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_systemtime_get_sort_key(
+	     (libfdatetime_internal_systemtime_t *) first_systemtime,
+	     &first_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_internal_systemtime_get_sort_key(
+	     (libfdatetime_internal_systemtime_t *) second_systemtime,
+	     &second_sort_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second sort key.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sort_key < second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_LESS );
+	}
+	else if( first_sort_key > second_sort_key )
+	{
+		return( LIBFDATETIME_COMPARE_GREATER );
+	}
+	return( LIBFDATETIME_COMPARE_EQUAL );
+}
+
 /* Deterimes the size of the string for the SYSTEMTIME
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -534,34 +1127,15 @@ int libfdatetime_systemtime_get_string_size(
 
 		return( -1 );
 	}
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_systemtime_copy_to_date_time_values(
 	          (libfdatetime_internal_systemtime_t *) systemtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
-	if( result != 1 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	else
+	if( result == 1 )
 	{
 		result = libfdatetime_date_time_values_get_string_size(
 		          &date_time_values,
@@ -901,6 +1475,10 @@ int libfdatetime_systemtime_copy_to_utf8_string_with_index(
 	static char *function                                   = "libfdatetime_systemtime_copy_to_utf8_string_with_index";
 	int result                                              = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( systemtime == NULL )
 	{
 		libcerror_error_set(
@@ -914,32 +1492,33 @@ int libfdatetime_systemtime_copy_to_utf8_string_with_index(
 	}
 	internal_systemtime = (libfdatetime_internal_systemtime_t *) systemtime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf8_string_index != NULL )
+	{
+		string_start_index = *utf8_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 systemtime,
+	 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+	  internal_systemtime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_systemtime_copy_to_date_time_values(
 	          internal_systemtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -965,6 +1544,16 @@ int libfdatetime_systemtime_copy_to_utf8_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+		  internal_systemtime ) )
+
 		result = libfdatetime_internal_systemtime_copy_to_utf8_string_in_hexadecimal(
 		          internal_systemtime,
 		          utf8_string,
@@ -984,6 +1573,23 @@ int libfdatetime_systemtime_copy_to_utf8_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 systemtime,
+	 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+	  internal_systemtime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf8_string_index - string_start_index ) * sizeof( uint8_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1298,6 +1904,10 @@ int libfdatetime_systemtime_copy_to_utf16_string_with_index(
 	static char *function                                   = "libfdatetime_systemtime_copy_to_utf16_string_with_index";
 	int result                                              = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( systemtime == NULL )
 	{
 		libcerror_error_set(
@@ -1311,32 +1921,33 @@ int libfdatetime_systemtime_copy_to_utf16_string_with_index(
 	}
 	internal_systemtime = (libfdatetime_internal_systemtime_t *) systemtime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf16_string_index != NULL )
+	{
+		string_start_index = *utf16_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 systemtime,
+	 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+	  internal_systemtime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_systemtime_copy_to_date_time_values(
 	          internal_systemtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1362,6 +1973,16 @@ int libfdatetime_systemtime_copy_to_utf16_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+		  internal_systemtime ) )
+
 		result = libfdatetime_internal_systemtime_copy_to_utf16_string_in_hexadecimal(
 		          internal_systemtime,
 		          utf16_string,
@@ -1381,6 +2002,23 @@ int libfdatetime_systemtime_copy_to_utf16_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 systemtime,
+	 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+	  internal_systemtime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf16_string_index - string_start_index ) * sizeof( uint16_t ) )
+#endif
 	return( 1 );
 }
 
@@ -1695,6 +2333,10 @@ int libfdatetime_systemtime_copy_to_utf32_string_with_index(
 	static char *function                                   = "libfdatetime_systemtime_copy_to_utf32_string_with_index";
 	int result                                              = 0;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	size_t string_start_index = 0;
+#endif
+
 	if( systemtime == NULL )
 	{
 		libcerror_error_set(
@@ -1708,32 +2350,33 @@ int libfdatetime_systemtime_copy_to_utf32_string_with_index(
 	}
 	internal_systemtime = (libfdatetime_internal_systemtime_t *) systemtime;
 
+#if defined( HAVE_LIBFDATETIME_STATS )
+	if( utf32_string_index != NULL )
+	{
+		string_start_index = *utf32_string_index;
+	}
+#endif
+
+	LIBFDATETIME_PROBE_FORMAT_BEGIN(
+	 systemtime,
+	 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+	  internal_systemtime ),
+	 string_format_flags )
+
+	/* The value is formatted in hexadecimal if it is out of bounds, hence no error
+	 * is created, so that the fallback does not need to allocate
+	 */
 	result = libfdatetime_internal_systemtime_copy_to_date_time_values(
 	          internal_systemtime,
 	          &date_time_values,
-	          error );
+	          NULL );
 
 	if( result != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set date time values.",
-		 function );
-#endif
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( DISABLED )
-			libcerror_error_backtrace_fprint(
-			 *error,
-			 stderr );
-#endif
-			libcerror_error_free(
-			 error );
-		}
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+		 1 )
 	}
 	else
 	{
@@ -1759,6 +2402,16 @@ int libfdatetime_systemtime_copy_to_utf32_string_with_index(
 	}
 	if( result != 1 )
 	{
+		LIBFDATETIME_STATS_ADD(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+		 1 )
+
+		LIBFDATETIME_PROBE_FALLBACK_HEX(
+		 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+		 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+		  internal_systemtime ) )
+
 		result = libfdatetime_internal_systemtime_copy_to_utf32_string_in_hexadecimal(
 		          internal_systemtime,
 		          utf32_string,
@@ -1778,6 +2431,23 @@ int libfdatetime_systemtime_copy_to_utf32_string_with_index(
 			return( -1 );
 		}
 	}
+	LIBFDATETIME_PROBE_FORMAT_END(
+	 systemtime,
+	 LIBFDATETIME_PROBE_VALUE_SYSTEMTIME(
+	  internal_systemtime ),
+	 string_format_flags )
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	 1 )
+
+	LIBFDATETIME_STATS_ADD(
+	 LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME,
+	 LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	 ( *utf32_string_index - string_start_index ) * sizeof( uint32_t ) )
+#endif
 	return( 1 );
 }
 
@@ -88,11 +88,72 @@ int libfdatetime_systemtime_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+int libfdatetime_internal_systemtime_copy_from_date_time_values(
+     libfdatetime_internal_systemtime_t *internal_systemtime,
+     libfdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
 int libfdatetime_internal_systemtime_copy_to_date_time_values(
      libfdatetime_internal_systemtime_t *internal_systemtime,
      libfdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error );
 
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_copy_to_filetime(
+     libfdatetime_systemtime_t *systemtime,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_copy_to_posix_time(
+     libfdatetime_systemtime_t *systemtime,
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+int libfdatetime_internal_systemtime_get_sort_key(
+     libfdatetime_internal_systemtime_t *internal_systemtime,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_get_sort_key(
+     libfdatetime_systemtime_t *systemtime,
+     int64_t *sort_key,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_has_valid_day_of_week(
+     libfdatetime_systemtime_t *systemtime,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_array_get_sort_keys(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     int64_t *sort_keys,
+     size_t number_of_values,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_copy_from_date_time_values(
+     libfdatetime_systemtime_t *systemtime,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day,
+     uint8_t hours,
+     uint8_t minutes,
+     uint8_t seconds,
+     uint32_t nano_seconds,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_systemtime_compare(
+     libfdatetime_systemtime_t *first_systemtime,
+     libfdatetime_systemtime_t *second_systemtime,
+     libcerror_error_t **error );
+
 LIBFDATETIME_EXTERN \
 int libfdatetime_systemtime_get_string_size(
      libfdatetime_systemtime_t *systemtime,
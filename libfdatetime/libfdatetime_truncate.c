@@ -0,0 +1,379 @@
+/*
+ * Truncate functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_definitions.h"
+#include "libfdatetime_libcerror.h"
+#include "libfdatetime_truncate.h"
+
+/* Retrieves the number of seconds of a sub-day truncate unit
+ * Returns 1 if successful, 0 if the unit is not a sub-day unit or -1 on error
+ */
+int libfdatetime_internal_truncate_get_unit_number_of_seconds(
+     int unit,
+     int64_t *number_of_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfdatetime_internal_truncate_get_unit_number_of_seconds";
+
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( unit )
+	{
+		case LIBFDATETIME_TRUNCATE_UNIT_SECOND:
+			*number_of_seconds = 1;
+			break;
+
+		case LIBFDATETIME_TRUNCATE_UNIT_MINUTE:
+			*number_of_seconds = 60;
+			break;
+
+		case LIBFDATETIME_TRUNCATE_UNIT_HOUR:
+			*number_of_seconds = 3600;
+			break;
+
+		case LIBFDATETIME_TRUNCATE_UNIT_DAY:
+			*number_of_seconds = 86400;
+			break;
+
+		case LIBFDATETIME_TRUNCATE_UNIT_MONTH:
+		case LIBFDATETIME_TRUNCATE_UNIT_YEAR:
+			return( 0 );
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported unit: %d.",
+			 function,
+			 unit );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Truncates a number of days since January 1, 1970 to the first day of the month or year
+ * The civil date is determined directly from the number of days instead of iterating the years
+ * Returns the truncated number of days
+ */
+int64_t libfdatetime_internal_truncate_number_of_days(
+         int64_t number_of_days,
+         int unit )
+{
+	int64_t day_of_era    = 0;
+	int64_t day_of_month  = 0;
+	int64_t day_of_year   = 0;
+	int64_t era           = 0;
+	int64_t month_of_year = 0;
+	int64_t year_of_era   = 0;
+
+	/* The year is considered to start at March 1 so that the leap day is the last day of the year
+	 * An era consists of 400 years or 146097 days
+	 * 719468 is the number of days from March 1, 0000 to January 1, 1970
+	 */
+	number_of_days += 719468;
+
+	if( number_of_days >= 0 )
+	{
+		era = number_of_days / 146097;
+	}
+	else
+	{
+		era = ( number_of_days - 146096 ) / 146097;
+	}
+	day_of_era  = number_of_days - ( era * 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	/* The month of year is relative to March
+	 */
+	month_of_year = ( ( 5 * day_of_year ) + 2 ) / 153;
+	day_of_month  = day_of_year - ( ( ( 153 * month_of_year ) + 2 ) / 5 );
+
+	number_of_days -= 719468;
+
+	if( unit == LIBFDATETIME_TRUNCATE_UNIT_MONTH )
+	{
+		return( number_of_days - day_of_month );
+	}
+	/* January and February are the last months of the March based year
+	 */
+	if( month_of_year >= 10 )
+	{
+		return( number_of_days - ( day_of_year - 306 ) );
+	}
+	/* January and February of the year that contains March have 59 days
+	 * or 60 days if the year is a leap year
+	 */
+	day_of_year += 59;
+
+	if( ( ( year_of_era % 4 ) == 0 )
+	 && ( ( ( year_of_era % 100 ) != 0 )
+	  ||  ( year_of_era == 0 ) ) )
+	{
+		day_of_year += 1;
+	}
+	return( number_of_days - day_of_year );
+}
+
+/* Truncates a number of seconds since January 1, 1970 00:00:00 to a unit
+ * The number of seconds is rounded down and the number of nano seconds is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_internal_truncate_number_of_seconds(
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     int unit,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfdatetime_internal_truncate_number_of_seconds";
+	int64_t number_of_days         = 0;
+	int64_t remainder              = 0;
+	int64_t unit_number_of_seconds = 0;
+	int result                     = 0;
+
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          unit,
+	          &unit_number_of_seconds,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unit number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		unit_number_of_seconds = 86400;
+	}
+	remainder = *number_of_seconds % unit_number_of_seconds;
+
+	/* Round the number of seconds down for dates before January 1, 1970
+	 */
+	if( remainder < 0 )
+	{
+		remainder += unit_number_of_seconds;
+	}
+	if( result != 0 )
+	{
+		*number_of_seconds     -= remainder;
+		*number_of_nano_seconds = 0;
+
+		return( 1 );
+	}
+	/* Determine the number of days without subtracting the remainder first
+	 * to prevent an underflow for values near the minimum
+	 */
+	number_of_days = *number_of_seconds / 86400;
+
+	if( ( *number_of_seconds % 86400 ) < 0 )
+	{
+		number_of_days -= 1;
+	}
+
+	number_of_days = libfdatetime_internal_truncate_number_of_days(
+	                  number_of_days,
+	                  unit );
+
+	if( number_of_days < ( INT64_MIN / 86400 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_seconds      = number_of_days * 86400;
+	*number_of_nano_seconds = 0;
+
+	return( 1 );
+}
+
+/* Truncates sort keys to a unit
+ * The sort keys are rounded down to the start of the second, minute, hour, day, month or year
+ * The sub-day units are truncated with integer arithmetic only
+ * The minimum, maximum and invalid sort keys are not changed
+ * The sort keys and truncated sort keys can refer to the same array
+ * Returns 1 if successful or -1 on error
+ */
+int libfdatetime_sort_keys_truncate(
+     const int64_t *sort_keys,
+     size_t number_of_sort_keys,
+     int unit,
+     int64_t *truncated_sort_keys,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfdatetime_sort_keys_truncate";
+	size_t sort_key_index          = 0;
+	int64_t number_of_days         = 0;
+	int64_t remainder              = 0;
+	int64_t sort_key               = 0;
+	int64_t unit_number_of_seconds = 0;
+	int64_t unit_size              = 0;
+	int result                     = 0;
+
+	if( sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sort_keys > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sort keys value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( truncated_sort_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid truncated sort keys.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          unit,
+	          &unit_number_of_seconds,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unit number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		unit_number_of_seconds = 86400;
+	}
+	/* A sort key is in 100 nano seconds intervals since January 1, 1601 00:00:00
+	 */
+	unit_size = unit_number_of_seconds * 10000000;
+
+	for( sort_key_index = 0;
+	     sort_key_index < number_of_sort_keys;
+	     sort_key_index++ )
+	{
+		sort_key = sort_keys[ sort_key_index ];
+
+		if( ( sort_key != LIBFDATETIME_SORT_KEY_MINIMUM )
+		 && ( sort_key != LIBFDATETIME_SORT_KEY_MAXIMUM )
+		 && ( sort_key != LIBFDATETIME_SORT_KEY_INVALID ) )
+		{
+			remainder = sort_key % unit_size;
+
+			/* Round the sort key down for dates before January 1, 1601
+			 */
+			if( remainder < 0 )
+			{
+				remainder += unit_size;
+			}
+			sort_key -= remainder;
+
+			if( result == 0 )
+			{
+				/* 134774 is the number of days from January 1, 1601 to January 1, 1970
+				 */
+				number_of_days = libfdatetime_internal_truncate_number_of_days(
+				                  ( sort_key / unit_size ) - 134774,
+				                  unit );
+
+				number_of_days += 134774;
+
+				if( number_of_days < ( LIBFDATETIME_SORT_KEY_MINIMUM / unit_size ) )
+				{
+					sort_key = LIBFDATETIME_SORT_KEY_MINIMUM;
+				}
+				else
+				{
+					sort_key = number_of_days * unit_size;
+				}
+			}
+		}
+		truncated_sort_keys[ sort_key_index ] = sort_key;
+	}
+	return( 1 );
+}
+
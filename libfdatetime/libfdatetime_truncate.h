@@ -0,0 +1,64 @@
+/*
+ * Truncate functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFDATETIME_TRUNCATE_H )
+#define _LIBFDATETIME_TRUNCATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfdatetime_extern.h"
+#include "libfdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfdatetime_internal_truncate_get_unit_number_of_seconds(
+     int unit,
+     int64_t *number_of_seconds,
+     libcerror_error_t **error );
+
+int64_t libfdatetime_internal_truncate_number_of_days(
+         int64_t number_of_days,
+         int unit );
+
+int libfdatetime_internal_truncate_number_of_seconds(
+     int64_t *number_of_seconds,
+     uint32_t *number_of_nano_seconds,
+     int unit,
+     libcerror_error_t **error );
+
+LIBFDATETIME_EXTERN \
+int libfdatetime_sort_keys_truncate(
+     const int64_t *sort_keys,
+     size_t number_of_sort_keys,
+     int unit,
+     int64_t *truncated_sort_keys,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFDATETIME_TRUNCATE_H ) */
+
@@ -34,6 +34,7 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfdatetime_batch_job {}	libfdatetime_batch_job_t;
 typedef struct libfdatetime_fat_date {}		libfdatetime_fat_date_t;
 typedef struct libfdatetime_fat_date_time {}	libfdatetime_fat_date_time_t;
 typedef struct libfdatetime_fat_time {}		libfdatetime_fat_time_t;
@@ -45,6 +46,7 @@ typedef struct libfdatetime_posix_time {}	libfdatetime_posix_time_t;
 typedef struct libfdatetime_systemtime {}	libfdatetime_systemtime_t;
 
 #else
+typedef intptr_t libfdatetime_batch_job_t;
 typedef intptr_t libfdatetime_fat_date_t;
 typedef intptr_t libfdatetime_fat_date_time_t;
 typedef intptr_t libfdatetime_fat_time_t;
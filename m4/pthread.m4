@@ -0,0 +1,127 @@
+dnl Functions for pthread
+dnl
+dnl Version: 20240513
+
+dnl Function to detect if pthread is available
+AC_DEFUN([AX_PTHREAD_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_winapi" = xyes],
+    [ac_cv_pthread=no],
+    [test "x$ac_cv_enable_multi_threading_support" = xno],
+    [ac_cv_pthread=no],
+    [test "x$ac_cv_with_pthread" = xno],
+    [ac_cv_pthread=no],
+    [dnl Check if the directory provided as parameter exists
+    AS_IF(
+      [test "x$ac_cv_with_pthread" != x && test "x$ac_cv_with_pthread" != xauto-detect && test "x$ac_cv_with_pthread" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([pthread])])
+
+    dnl Check for headers
+    AC_CHECK_HEADERS([pthread.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_pthread_h" = xno],
+      [ac_cv_pthread=no],
+      [ac_cv_pthread=yes
+
+      dnl Check for the individual functions
+      AC_CHECK_LIB(
+        pthread,
+        pthread_create,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_join,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_init,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_destroy,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_lock,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_unlock,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+
+      ac_cv_pthread_LIBADD="-lpthread"
+      ])
+
+    AX_CHECK_LIB_DIRECTORY_MSG_ON_FAILURE([pthread])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_pthread" = xyes],
+    [AC_DEFINE(
+      [HAVE_PTHREAD],
+      [1],
+      [Define if pthread library is available.])
+    AC_SUBST(
+      [HAVE_PTHREAD],
+      [1])
+    ],
+    [AC_SUBST(
+      [HAVE_PTHREAD],
+      [0])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_pthread" != xno],
+    [AC_SUBST(
+      [PTHREAD_CPPFLAGS],
+      [$ac_cv_pthread_CPPFLAGS])
+    AC_SUBST(
+      [PTHREAD_LIBADD],
+      [$ac_cv_pthread_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_pthread" = xyes],
+    [AC_SUBST(
+      [ax_pthread_pc_libs_private],
+      [-lpthread])
+    ])
+  ])
+
+dnl Function to determine if pthread should be used
+AC_DEFUN([AX_PTHREAD_CHECK_ENABLE],
+  [AX_COMMON_ARG_ENABLE(
+    [multi-threading-support],
+    [multi_threading_support],
+    [enable multi-threading support],
+    [yes])
+  AX_COMMON_ARG_WITH(
+    [pthread],
+    [pthread],
+    [search for pthread in includedir and libdir or in the specified DIR, or no if not to use pthread],
+    [auto-detect],
+    [DIR])
+
+  AX_PTHREAD_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_pthread" != xno],
+    [AC_DEFINE(
+      [HAVE_MULTI_THREAD_SUPPORT],
+      [1],
+      [Define to 1 if multi thread support should be used.])
+    AC_SUBST(
+      [HAVE_MULTI_THREAD_SUPPORT],
+      [1])
+
+    ac_cv_multi_threading_support=yes],
+    [ac_cv_multi_threading_support=no])
+  ])
+
@@ -171,6 +171,38 @@ int result = (negative << shift);]] )],
     [$ac_cv_have_asan])
   ])
 
+dnl Function to check whether libtsan is functional
+AC_DEFUN([AX_TESTS_CHECK_LIBTSAN],
+  [AC_MSG_CHECKING([whether libtsan is functional])
+
+  BACKUP_CFLAGS="$CFLAGS"
+  BACKUP_LDFLAGS="$LDFLAGS"
+
+  TSAN_CFLAGS="-fno-omit-frame-pointer -fsanitize=thread -g -O1"
+  TSAN_LDFLAGS="-fsanitize=thread"
+
+  CFLAGS="$CFLAGS $TSAN_CFLAGS"
+  LDFLAGS="$LDFLAGS $TSAN_LDFLAGS"
+
+  AC_LANG_PUSH(C)
+
+  AC_LINK_IFELSE(
+    [AC_LANG_PROGRAM(
+      [[#include <stdio.h>]],
+      [[int value = 0;
+printf("%d", value);]] )],
+    [ac_cv_have_tsan=yes],
+    [ac_cv_have_tsan=no])
+
+  AC_LANG_POP(C)
+
+  CFLAGS="$BACKUP_CFLAGS"
+  LDFLAGS="$BACKUP_LDFLAGS"
+
+  AC_MSG_RESULT(
+    [$ac_cv_have_tsan])
+  ])
+
 dnl Function to detect whether asan support should be enabled
 AC_DEFUN([AX_TESTS_CHECK_ENABLE_ASAN],
   [AX_COMMON_ARG_ENABLE(
@@ -219,6 +251,30 @@ AC_DEFUN([AX_TESTS_CHECK_ENABLE_UBSAN],
     ])
   ])
 
+dnl Function to detect whether tsan support should be enabled
+AC_DEFUN([AX_TESTS_CHECK_ENABLE_TSAN],
+  [AX_COMMON_ARG_ENABLE(
+    [tsan],
+    [tsan],
+    [build with tsan],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_tsan" != xno],
+    [AX_TESTS_CHECK_LIBTSAN
+
+    AS_IF(
+      [test "x$ac_cv_have_tsan" = xno],
+      [AC_MSG_FAILURE(
+        [Unable to build with functional libtsan],
+        [1])
+      ])
+
+    CFLAGS="$CFLAGS $TSAN_CFLAGS"
+    LDFLAGS="$LDFLAGS $TSAN_LDFLAGS"
+    ])
+  ])
+
 dnl Function to detect whether code coverage support should be enabled
 AC_DEFUN([AX_TESTS_CHECK_ENABLE_CODE_COVERAGE],
   [AX_COMMON_ARG_ENABLE(
@@ -19,6 +19,12 @@ initialize_configure_options()
 	echo "${CONFIGURE_HELP}" | grep -- '--enable-debug-output' > /dev/null
 	HAVE_ENABLE_DEBUG_OUTPUT=$?
 
+	echo "${CONFIGURE_HELP}" | grep -- '--enable-stats' > /dev/null
+	HAVE_ENABLE_STATS=$?
+
+	echo "${CONFIGURE_HELP}" | grep -- '--enable-sdt-probes' > /dev/null
+	HAVE_ENABLE_SDT_PROBES=$?
+
 	echo "${CONFIGURE_HELP}" | grep -- '--with-bzip2' > /dev/null
 	HAVE_WITH_BZIP2=$?
 
@@ -107,6 +113,31 @@ run_configure_make_check_with_asan()
 	./tests/runtests.sh ${MAKE_CHECK_OPTIONS} | sed -E '/Making check in / d'
 }
 
+run_configure_make_check_with_tsan()
+{
+	local LDCONFIG=`which ldconfig 2> /dev/null`
+
+	if test -z ${LDCONFIG} || test ! -x ${LDCONFIG}
+	then
+		return
+	fi
+	local LIBTSAN=`ldconfig -p | grep libtsan | sed 's/^.* => //' | sort | tail -n 1`
+
+	if test -z ${LIBTSAN} || test ! -f ${LIBTSAN}
+	then
+		return
+	fi
+	CONFIGURE_OPTIONS="--enable-tsan"
+
+	if test ${HAVE_ENABLE_WIDE_CHARACTER_TYPE} -eq 0
+	then
+		CONFIGURE_OPTIONS="${CONFIGURE_OPTIONS} --enable-wide-character-type"
+	fi
+	run_configure_make ${CONFIGURE_OPTIONS}
+
+	./tests/runtests.sh ${MAKE_CHECK_OPTIONS} | sed -E '/Making check in / d'
+}
+
 run_configure_make_check_with_code_coverage()
 {
 	CONFIGURE_OPTIONS="--disable-shared --enable-code-coverage"
@@ -237,11 +268,43 @@ MAKE_CHECK_OPTIONS="-j${NUMBER_OF_JOBS} --no-print-directory --quiet TESTSUITEFL
 echo -e "\033[1mTesting without options.\033[0m"
 run_configure_make_check
 
+if test -n "${BENCH_BASELINE}" || test -f "bench/fdatetime_bench_baseline.json"
+then
+	BENCH_BASELINE=${BENCH_BASELINE:-bench/fdatetime_bench_baseline.json};
+
+	case ${BENCH_BASELINE} in
+	/*)
+		;;
+	*)
+		BENCH_BASELINE="${PWD}/${BENCH_BASELINE}";
+		;;
+	esac
+
+	echo -e "\033[1mTesting for performance regressions.\033[0m"
+	make --no-print-directory bench-compare BENCH_BASELINE="${BENCH_BASELINE}"
+fi
+
 if test ${HAVE_ENABLE_VERBOSE_OUTPUT} -eq 0 && test ${HAVE_ENABLE_DEBUG_OUTPUT} -eq 0
 then
 	echo -e "\033[1mTesting with verbose and debug output.\033[0m"
 	run_configure_make_check "--enable-verbose-output --enable-debug-output"
 fi
+if test ${HAVE_ENABLE_STATS} -eq 0
+then
+	echo -e "\033[1mTesting with instrumentation counters.\033[0m"
+	run_configure_make_check "--enable-stats"
+
+	if test ${HAVE_WITH_PTHREAD} -eq 0
+	then
+		echo -e "\033[1mTesting with instrumentation counters without multi-threading support.\033[0m"
+		run_configure_make_check "--enable-stats --with-pthread=no"
+	fi
+fi
+if test ${HAVE_ENABLE_SDT_PROBES} -eq 0 && test -f "/usr/include/sys/sdt.h"
+then
+	echo -e "\033[1mTesting with static probes.\033[0m"
+	run_configure_make_check "--enable-sdt-probes"
+fi
 if test ${HAVE_WITH_PTHREAD} -eq 0 && test ${PROJECT_NAME} != "libcthreads"
 then
 	echo -e "\033[1mTesting with without multi-threading support.\033[0m"
@@ -280,5 +343,8 @@ run_configure_make_check_with_asan
 echo -e "\033[1mTesting with ubsan.\033[0m"
 run_configure_make_check_with_ubsan
 
+echo -e "\033[1mTesting with tsan.\033[0m"
+run_configure_make_check_with_tsan
+
 echo -e "\033[1mTesting with code coverage.\033[0m"
 run_configure_make_check_with_code_coverage
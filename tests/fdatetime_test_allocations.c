@@ -0,0 +1,2081 @@
+/*
+ * Library allocation accounting testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_memory.h"
+#include "fdatetime_test_unused.h"
+
+#if defined( HAVE_FDATETIME_TEST_ALLOCATIONS )
+
+/* The number of operations over which the allocations are counted
+ */
+#define FDATETIME_TEST_ALLOCATIONS_NUMBER_OF_OPERATIONS	1000
+
+/* The string format flags used to test the string functions
+ */
+#define FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS \
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS
+
+/* The size of the strings used to test the string functions
+ */
+#define FDATETIME_TEST_ALLOCATIONS_STRING_SIZE		64
+
+/* Counts the allocations of an expression over a number of operations
+ * The expression is evaluated once before counting, so that one time
+ * allocations, such as those of per-thread state, are not counted
+ */
+#define FDATETIME_TEST_ALLOCATIONS_RUN( function_name, is_allocation_free, expression ) \
+	expression; \
+	fdatetime_test_allocations_start(); \
+	for( operation_index = 0; \
+	     operation_index < FDATETIME_TEST_ALLOCATIONS_NUMBER_OF_OPERATIONS; \
+	     operation_index++ ) \
+	{ \
+		expression; \
+	} \
+	if( fdatetime_test_allocations_stop( \
+	     function_name, \
+	     is_allocation_free ) != 1 ) \
+	{ \
+		goto on_error; \
+	}
+
+/* Counts the allocations of the string functions of a timestamp type, which are all allocation-free
+ */
+#define FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS( type_name, timestamp, value_description ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_get_string_size" value_description, \
+	 1, \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _get_string_size( \
+	   timestamp, \
+	   &string_size, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_copy_to_utf8_string" value_description, \
+	 1, \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _copy_to_utf8_string( \
+	   timestamp, \
+	   utf8_string, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_SIZE, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_copy_to_utf8_string_with_index" value_description, \
+	 1, \
+	 string_index = 0; \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _copy_to_utf8_string_with_index( \
+	   timestamp, \
+	   utf8_string, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_SIZE, \
+	   &string_index, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_copy_to_utf16_string" value_description, \
+	 1, \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _copy_to_utf16_string( \
+	   timestamp, \
+	   utf16_string, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_SIZE, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_copy_to_utf16_string_with_index" value_description, \
+	 1, \
+	 string_index = 0; \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _copy_to_utf16_string_with_index( \
+	   timestamp, \
+	   utf16_string, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_SIZE, \
+	   &string_index, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_copy_to_utf32_string" value_description, \
+	 1, \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _copy_to_utf32_string( \
+	   timestamp, \
+	   utf32_string, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_SIZE, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) ) \
+	FDATETIME_TEST_ALLOCATIONS_RUN( \
+	 "libfdatetime_" #type_name "_copy_to_utf32_string_with_index" value_description, \
+	 1, \
+	 string_index = 0; \
+	 fdatetime_test_allocations_check_result( \
+	  libfdatetime_ ## type_name ## _copy_to_utf32_string_with_index( \
+	   timestamp, \
+	   utf32_string, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_SIZE, \
+	   &string_index, \
+	   FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS, \
+	   &error ), \
+	  &error ) )
+
+/* Value to indicate the allocations per operation should be reported
+ */
+static int fdatetime_test_allocations_report                     = 0;
+
+/* The number of allocations at the start of the counting
+ */
+static uint64_t fdatetime_test_allocations_start_number          = 0;
+
+/* The number of operations that failed since the start of the counting
+ */
+static size_t fdatetime_test_allocations_number_of_failed_operations = 0;
+
+/* Starts counting allocations
+ */
+void fdatetime_test_allocations_start(
+      void )
+{
+	fdatetime_test_allocations_number_of_failed_operations = 0;
+
+	fdatetime_test_allocations_start_number = __atomic_load_n(
+	                                           &fdatetime_test_number_of_allocations,
+	                                           __ATOMIC_RELAXED );
+}
+
+/* Stops counting allocations, reports the allocations per operation if requested
+ * and checks that a function declared allocation-free did not allocate
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_stop(
+     const char *function_name,
+     int is_allocation_free )
+{
+	uint64_t number_of_allocations = 0;
+
+	number_of_allocations = __atomic_load_n(
+	                         &fdatetime_test_number_of_allocations,
+	                         __ATOMIC_RELAXED );
+
+	number_of_allocations -= fdatetime_test_allocations_start_number;
+
+	if( fdatetime_test_allocations_report != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: %.3f allocations per operation%s\n",
+		 function_name,
+		 (double) number_of_allocations / FDATETIME_TEST_ALLOCATIONS_NUMBER_OF_OPERATIONS,
+		 ( is_allocation_free != 0 ) ? " (allocation-free)" : "" );
+	}
+	if( fdatetime_test_allocations_number_of_failed_operations != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: %" PRIzu " out of %d operations failed\n",
+		 function_name,
+		 fdatetime_test_allocations_number_of_failed_operations,
+		 FDATETIME_TEST_ALLOCATIONS_NUMBER_OF_OPERATIONS );
+
+		return( 0 );
+	}
+	if( ( is_allocation_free != 0 )
+	 && ( number_of_allocations != 0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "%s: is allocation-free but allocated %" PRIu64 " times in %d operations\n",
+		 function_name,
+		 number_of_allocations,
+		 FDATETIME_TEST_ALLOCATIONS_NUMBER_OF_OPERATIONS );
+
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Checks the result of an operation
+ * An operation that fails is counted and its error is freed
+ */
+void fdatetime_test_allocations_check_result(
+      int result,
+      libcerror_error_t **error )
+{
+	if( result == -1 )
+	{
+		fdatetime_test_allocations_number_of_failed_operations++;
+	}
+	if( *error != NULL )
+	{
+		libcerror_error_free(
+		 error );
+	}
+}
+
+/* Tests the allocations of the FAT date time functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_fat_date_time(
+     void )
+{
+	uint8_t byte_stream[ 4 ] = {
+		0x0c, 0x3d, 0xd0, 0xa8 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error                     = NULL;
+	libfdatetime_fat_date_time_t *fat_date_time  = NULL;
+	libfdatetime_fat_date_time_t *fat_date_time2 = NULL;
+	size_t string_index                          = 0;
+	size_t string_size                           = 0;
+	int64_t sort_key                             = 0;
+	uint32_t value_32bit                         = 0;
+	int operation_index                          = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_fat_date_time_initialize(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_initialize(
+	          &fat_date_time2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_fat_date_time_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_fat_date_time_copy_from_byte_stream(
+	   fat_date_time,
+	   byte_stream,
+	   4,
+	   LIBFDATETIME_ENDIAN_LITTLE,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_fat_date_time_copy_to_32bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_fat_date_time_copy_to_32bit(
+	   fat_date_time,
+	   &value_32bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_fat_date_time_copy_from_32bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_fat_date_time_copy_from_32bit(
+	   fat_date_time2,
+	   value_32bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_fat_date_time_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_fat_date_time_get_sort_key(
+	   fat_date_time,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_fat_date_time_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_fat_date_time_compare(
+	   fat_date_time,
+	   fat_date_time2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 fat_date_time,
+	 fat_date_time,
+	 "" )
+
+	/* Test string functions with a value that is formatted in hexadecimal
+	 */
+	result = libfdatetime_fat_date_time_copy_from_32bit(
+	          fat_date_time,
+	          0xffffffffUL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 fat_date_time,
+	 fat_date_time,
+	 " (out of range)" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_fat_date_time_free(
+	          &fat_date_time2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_free(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fat_date_time2 != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &fat_date_time2,
+		 NULL );
+	}
+	if( fat_date_time != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &fat_date_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the FILETIME functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_filetime(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	uint8_t date_time_utf8_string[ 21 ] = {
+		'2', '0', '1', '0', '-', '0', '8', '-', '1', '2', 'T', '2', '1', ':', '0', '6', ':', '3', '1', 'Z', 0 };
+
+	uint16_t date_time_utf16_string[ 21 ] = {
+		'2', '0', '1', '0', '-', '0', '8', '-', '1', '2', 'T', '2', '1', ':', '0', '6', ':', '3', '1', 'Z', 0 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error             = NULL;
+	libfdatetime_filetime_t *filetime    = NULL;
+	libfdatetime_filetime_t *filetime2   = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	size_t string_index                  = 0;
+	size_t string_size                   = 0;
+	int64_t sort_key                     = 0;
+	uint64_t value_64bit                 = 0;
+	uint16_t day_of_year                 = 0;
+	uint16_t iso_week_year               = 0;
+	uint8_t day_of_week                  = 0;
+	uint8_t iso_week                     = 0;
+	int operation_index                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_copy_from_byte_stream(
+	   filetime,
+	   byte_stream,
+	   8,
+	   LIBFDATETIME_ENDIAN_LITTLE,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_copy_to_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_copy_to_64bit(
+	   filetime,
+	   &value_64bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_copy_from_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_copy_from_64bit(
+	   filetime2,
+	   value_64bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_copy_from_utf8_string",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_copy_from_utf8_string(
+	   filetime2,
+	   date_time_utf8_string,
+	   21,
+	   LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_copy_from_utf16_string",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_copy_from_utf16_string(
+	   filetime2,
+	   date_time_utf16_string,
+	   21,
+	   LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_copy_to_posix_time",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_copy_to_posix_time(
+	   filetime,
+	   posix_time,
+	   LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_get_sort_key(
+	   filetime,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_filetime_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_filetime_compare(
+	   filetime,
+	   filetime2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_compare_any",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_compare_any(
+	   LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	   (intptr_t *) filetime,
+	   LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	   (intptr_t *) posix_time,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_get_calendar_values",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_get_calendar_values(
+	   LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	   (intptr_t *) filetime,
+	   &day_of_week,
+	   &day_of_year,
+	   &iso_week_year,
+	   &iso_week,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 filetime,
+	 filetime,
+	 "" )
+
+	/* Test string functions with a value that is formatted in hexadecimal
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 filetime,
+	 filetime,
+	 " (out of range)" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( filetime2 != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime2,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the floatingtime functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_floatingtime(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0x61, 0x0b, 0xb6, 0x60, 0x8f, 0x04, 0xe5, 0x40 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error                   = NULL;
+	libfdatetime_floatingtime_t *floatingtime  = NULL;
+	libfdatetime_floatingtime_t *floatingtime2 = NULL;
+	size_t string_index                        = 0;
+	size_t string_size                         = 0;
+	int64_t sort_key                           = 0;
+	uint64_t value_64bit                       = 0;
+	int operation_index                        = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_floatingtime_initialize(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_initialize(
+	          &floatingtime2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_floatingtime_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_floatingtime_copy_from_byte_stream(
+	   floatingtime,
+	   byte_stream,
+	   8,
+	   LIBFDATETIME_ENDIAN_LITTLE,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_floatingtime_copy_to_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_floatingtime_copy_to_64bit(
+	   floatingtime,
+	   &value_64bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_floatingtime_copy_from_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_floatingtime_copy_from_64bit(
+	   floatingtime2,
+	   value_64bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_floatingtime_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_floatingtime_get_sort_key(
+	   floatingtime,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_floatingtime_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_floatingtime_compare(
+	   floatingtime,
+	   floatingtime2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 floatingtime,
+	 floatingtime,
+	 "" )
+
+	/* Test string functions with a value that is formatted in hexadecimal
+	 */
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0x7ff8000000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 floatingtime,
+	 floatingtime,
+	 " (out of range)" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_floatingtime_free(
+	          &floatingtime2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_free(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floatingtime2 != NULL )
+	{
+		libfdatetime_floatingtime_free(
+		 &floatingtime2,
+		 NULL );
+	}
+	if( floatingtime != NULL )
+	{
+		libfdatetime_floatingtime_free(
+		 &floatingtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the HFS time functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_hfs_time(
+     void )
+{
+	uint8_t byte_stream[ 4 ] = {
+		0xcc, 0x28, 0xb9, 0x75 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_filetime_t *filetime     = NULL;
+	libfdatetime_hfs_time_t *hfs_time     = NULL;
+	libfdatetime_hfs_time_t *hfs_time2    = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	size_t string_index                   = 0;
+	size_t string_size                    = 0;
+	int64_t sort_key                      = 0;
+	uint32_t value_32bit                  = 0;
+	int operation_index                   = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_copy_from_byte_stream(
+	   hfs_time,
+	   byte_stream,
+	   4,
+	   LIBFDATETIME_ENDIAN_BIG,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_copy_to_32bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_copy_to_32bit(
+	   hfs_time,
+	   &value_32bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_copy_from_32bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_copy_from_32bit(
+	   hfs_time2,
+	   value_32bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_copy_to_filetime",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_copy_to_filetime(
+	   hfs_time,
+	   filetime,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_copy_to_posix_time",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_copy_to_posix_time(
+	   hfs_time,
+	   posix_time,
+	   LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_get_sort_key(
+	   hfs_time,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_hfs_time_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_hfs_time_compare(
+	   hfs_time,
+	   hfs_time2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 hfs_time,
+	 hfs_time,
+	 "" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( hfs_time2 != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time2,
+		 NULL );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the NSF timedate functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_nsf_timedate(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xf6, 0x32, 0x3b, 0x00, 0xb4, 0x72, 0x25, 0xc1 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error                   = NULL;
+	libfdatetime_nsf_timedate_t *nsf_timedate  = NULL;
+	libfdatetime_nsf_timedate_t *nsf_timedate2 = NULL;
+	size_t string_index                        = 0;
+	size_t string_size                         = 0;
+	int64_t sort_key                           = 0;
+	uint64_t value_64bit                       = 0;
+	int operation_index                        = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_nsf_timedate_initialize(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_initialize(
+	          &nsf_timedate2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_nsf_timedate_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_nsf_timedate_copy_from_byte_stream(
+	   nsf_timedate,
+	   byte_stream,
+	   8,
+	   LIBFDATETIME_ENDIAN_LITTLE,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_nsf_timedate_copy_to_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_nsf_timedate_copy_to_64bit(
+	   nsf_timedate,
+	   &value_64bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_nsf_timedate_copy_from_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_nsf_timedate_copy_from_64bit(
+	   nsf_timedate2,
+	   value_64bit,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_nsf_timedate_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_nsf_timedate_get_sort_key(
+	   nsf_timedate,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_nsf_timedate_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_nsf_timedate_compare(
+	   nsf_timedate,
+	   nsf_timedate2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 nsf_timedate,
+	 nsf_timedate,
+	 "" )
+
+	/* Test string functions with a value that is formatted in hexadecimal
+	 */
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          nsf_timedate,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 nsf_timedate,
+	 nsf_timedate,
+	 " (out of range)" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_nsf_timedate_free(
+	          &nsf_timedate2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_free(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsf_timedate2 != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &nsf_timedate2,
+		 NULL );
+	}
+	if( nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &nsf_timedate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the POSIX time functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_posix_time(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0x00, 0x5a, 0x3a, 0xa8, 0x06, 0x69, 0x3e, 0x16 };
+
+	uint8_t date_time_utf8_string[ 21 ] = {
+		'2', '0', '1', '0', '-', '0', '8', '-', '1', '2', 'T', '2', '1', ':', '0', '6', ':', '3', '1', 'Z', 0 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error               = NULL;
+	libfdatetime_filetime_t *filetime      = NULL;
+	libfdatetime_posix_time_t *posix_time  = NULL;
+	libfdatetime_posix_time_t *posix_time2 = NULL;
+	size_t string_index                    = 0;
+	size_t string_size                     = 0;
+	int64_t sort_key                       = 0;
+	uint64_t value_64bit                   = 0;
+	uint32_t value_32bit                   = 0;
+	uint8_t value_type                     = 0;
+	int operation_index                    = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_from_32bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_from_32bit(
+	   posix_time,
+	   0x4c6461e7UL,
+	   LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_to_32bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_to_32bit(
+	   posix_time,
+	   &value_32bit,
+	   &value_type,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_from_utf8_string",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_from_utf8_string(
+	   posix_time2,
+	   date_time_utf8_string,
+	   21,
+	   LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	   LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_from_byte_stream(
+	   posix_time,
+	   byte_stream,
+	   8,
+	   LIBFDATETIME_ENDIAN_LITTLE,
+	   LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_to_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_to_64bit(
+	   posix_time,
+	   &value_64bit,
+	   &value_type,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_from_64bit",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_from_64bit(
+	   posix_time2,
+	   value_64bit,
+	   value_type,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_copy_to_filetime",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_copy_to_filetime(
+	   posix_time,
+	   filetime,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_get_sort_key(
+	   posix_time,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_posix_time_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_posix_time_compare(
+	   posix_time,
+	   posix_time2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 posix_time,
+	 posix_time,
+	 "" )
+
+	/* Test string functions with a value that is formatted in hexadecimal
+	 */
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x0000003b00000000ULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 posix_time,
+	 posix_time,
+	 " (out of range)" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_free(
+	          &posix_time2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( posix_time2 != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time2,
+		 NULL );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the SYSTEMTIME functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_systemtime(
+     void )
+{
+	uint8_t byte_stream[ 16 ] = {
+		0xcf, 0x07, 0x0c, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00 };
+
+	uint8_t invalid_byte_stream[ 16 ] = {
+		0xcf, 0x07, 0x0d, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00 };
+
+	uint16_t utf16_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+	uint8_t utf8_string[ FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error                = NULL;
+	libfdatetime_filetime_t *filetime       = NULL;
+	libfdatetime_posix_time_t *posix_time   = NULL;
+	libfdatetime_systemtime_t *systemtime   = NULL;
+	libfdatetime_systemtime_t *systemtime2  = NULL;
+	size_t string_index                     = 0;
+	size_t string_size                      = 0;
+	int64_t sort_key                        = 0;
+	int operation_index                     = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_systemtime_copy_from_byte_stream",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_systemtime_copy_from_byte_stream(
+	   systemtime,
+	   byte_stream,
+	   16,
+	   LIBFDATETIME_ENDIAN_LITTLE,
+	   &error ),
+	  &error ) )
+
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          systemtime2,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_systemtime_copy_to_filetime",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_systemtime_copy_to_filetime(
+	   systemtime,
+	   filetime,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_systemtime_copy_to_posix_time",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_systemtime_copy_to_posix_time(
+	   systemtime,
+	   posix_time,
+	   LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_systemtime_get_sort_key",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_systemtime_get_sort_key(
+	   systemtime,
+	   &sort_key,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_systemtime_compare",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_systemtime_compare(
+	   systemtime,
+	   systemtime2,
+	   &error ),
+	  &error ) )
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 systemtime,
+	 systemtime,
+	 "" )
+
+	/* Test string functions with a value that is formatted in hexadecimal
+	 */
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          systemtime,
+	          invalid_byte_stream,
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ALLOCATIONS_RUN_STRING_FUNCTIONS(
+	 systemtime,
+	 systemtime,
+	 " (out of range)" )
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_free(
+	          &systemtime2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_free(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( systemtime2 != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime2,
+		 NULL );
+	}
+	if( systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of the batch conversion functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_allocations_batch_convert(
+     void )
+{
+	uint8_t byte_stream[ 16 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+	uint8_t utf8_string_arena[ 2 * FDATETIME_TEST_ALLOCATIONS_STRING_SIZE ];
+
+	libcerror_error_t *error             = NULL;
+	libfdatetime_batch_job_t *batch_job  = NULL;
+	int operation_index                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          2 * FDATETIME_TEST_ALLOCATIONS_STRING_SIZE,
+	          FDATETIME_TEST_ALLOCATIONS_STRING_SIZE,
+	          FDATETIME_TEST_ALLOCATIONS_STRING_FORMAT_FLAGS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Worker threads are not allocation-free, hence the batch is converted by the calling thread
+	 */
+	result = libfdatetime_batch_job_set_number_of_threads(
+	          batch_job,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test conversion functions
+	 */
+	FDATETIME_TEST_ALLOCATIONS_RUN(
+	 "libfdatetime_batch_convert",
+	 1,
+	 fdatetime_test_allocations_check_result(
+	  libfdatetime_batch_convert(
+	   batch_job,
+	   &error ),
+	  &error ) )
+
+	/* Clean up
+	 */
+	result = libfdatetime_batch_job_free(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_FDATETIME_TEST_ALLOCATIONS ) */
+
+/* The main program
+ * Use the option -r to report the allocations per operation of every function
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( HAVE_FDATETIME_TEST_ALLOCATIONS )
+	if( argc == 2 )
+	{
+		if( ( system_string_length(
+		       argv[ 1 ] ) != 2 )
+		 || ( system_string_compare(
+		       argv[ 1 ],
+		       _SYSTEM_STRING( "-r" ),
+		       2 ) != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Usage: fdatetime_test_allocations [ -r ]\n" );
+
+			return( EXIT_FAILURE );
+		}
+		fdatetime_test_allocations_report = 1;
+	}
+	else if( argc > 2 )
+	{
+		fprintf(
+		 stderr,
+		 "Usage: fdatetime_test_allocations [ -r ]\n" );
+
+		return( EXIT_FAILURE );
+	}
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_fat_date_time",
+	 fdatetime_test_allocations_fat_date_time );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime",
+	 fdatetime_test_allocations_filetime );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_floatingtime",
+	 fdatetime_test_allocations_floatingtime );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time",
+	 fdatetime_test_allocations_hfs_time );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate",
+	 fdatetime_test_allocations_nsf_timedate );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time",
+	 fdatetime_test_allocations_posix_time );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime",
+	 fdatetime_test_allocations_systemtime );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_batch_convert",
+	 fdatetime_test_allocations_batch_convert );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+#else
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	/* Allocation accounting requires malloc and realloc to be interposed
+	 */
+	return( 77 );
+#endif /* defined( HAVE_FDATETIME_TEST_ALLOCATIONS ) */
+}
+
@@ -0,0 +1,1611 @@
+/*
+ * Library batch conversion functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_memory.h"
+#include "fdatetime_test_unused.h"
+
+/* The number of values used to test the conversion, which spans multiple chunks
+ */
+#define FDATETIME_TEST_BATCH_NUMBER_OF_VALUES		40000
+
+/* The size of the UTF-8 string of an individual value
+ */
+#define FDATETIME_TEST_BATCH_UTF8_STRING_SIZE		48
+
+/* Tests the libfdatetime_batch_job_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_job_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfdatetime_batch_job_t *batch_job    = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_free(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_initialize(
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch_job = (libfdatetime_batch_job_t *) 0x12345678UL;
+
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	batch_job = NULL;
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfdatetime_batch_job_initialize with malloc failing
+		 */
+		fdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libfdatetime_batch_job_initialize(
+		          &batch_job,
+		          &error );
+
+		if( fdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			fdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( batch_job != NULL )
+			{
+				libfdatetime_batch_job_free(
+				 &batch_job,
+				 NULL );
+			}
+		}
+		else
+		{
+			FDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FDATETIME_TEST_ASSERT_IS_NULL(
+			 "batch_job",
+			 batch_job );
+
+			FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfdatetime_batch_job_initialize with memset failing
+		 */
+		fdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libfdatetime_batch_job_initialize(
+		          &batch_job,
+		          &error );
+
+		if( fdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			fdatetime_test_memset_attempts_before_fail = -1;
+
+			if( batch_job != NULL )
+			{
+				libfdatetime_batch_job_free(
+				 &batch_job,
+				 NULL );
+			}
+		}
+		else
+		{
+			FDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FDATETIME_TEST_ASSERT_IS_NULL(
+			 "batch_job",
+			 batch_job );
+
+			FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_job_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_job_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_free(
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_job_set_input function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_job_set_input(
+     libfdatetime_batch_job_t *batch_job )
+{
+	uint8_t byte_stream[ 16 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01,
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	libcerror_error_t *error  = NULL;
+	size_t number_of_values   = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_get_number_of_values(
+	          batch_job,
+	          &number_of_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_values",
+	 number_of_values,
+	 (size_t) 2 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_get_number_of_values(
+	          batch_job,
+	          &number_of_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_values",
+	 number_of_values,
+	 (size_t) 4 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_set_input(
+	          NULL,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          NULL,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_UNDEFINED,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          0xff,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          -1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          12,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_job_set_output function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_job_set_output(
+     libfdatetime_batch_job_t *batch_job )
+{
+	uint8_t utf8_string_arena[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          64,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_set_output(
+	          NULL,
+	          utf8_string_arena,
+	          64,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          NULL,
+	          64,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          (size_t) SSIZE_MAX + 1,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          64,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          64,
+	          65,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_job_get_number_of_threads and libfdatetime_batch_job_set_number_of_threads functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_job_number_of_threads(
+     libfdatetime_batch_job_t *batch_job )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_get_number_of_threads(
+	          batch_job,
+	          &number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_number_of_threads(
+	          batch_job,
+	          4,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_get_number_of_threads(
+	          batch_job,
+	          &number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 4 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_get_number_of_threads(
+	          batch_job,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_number_of_threads(
+	          batch_job,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_number_of_threads(
+	          batch_job,
+	          257,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_job_get_number_of_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_job_get_number_of_values(
+     libfdatetime_batch_job_t *batch_job )
+{
+	libcerror_error_t *error = NULL;
+	size_t number_of_values  = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_get_number_of_values(
+	          NULL,
+	          &number_of_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_get_number_of_values(
+	          batch_job,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_convert function with FILETIME values and a specific number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_convert_filetime(
+     int number_of_threads )
+{
+	uint8_t expected_utf8_string[ FDATETIME_TEST_BATCH_UTF8_STRING_SIZE ];
+
+	libcerror_error_t *error            = NULL;
+	libfdatetime_batch_job_t *batch_job = NULL;
+	libfdatetime_filetime_t *filetime   = NULL;
+	uint8_t *byte_stream                = NULL;
+	uint8_t *utf8_string_arena          = NULL;
+	uint64_t value_64bit                = 0;
+	size_t value_index                  = 0;
+	uint32_t string_format_flags        = LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	byte_stream = (uint8_t *) malloc(
+	                           FDATETIME_TEST_BATCH_NUMBER_OF_VALUES * 8 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	utf8_string_arena = (uint8_t *) malloc(
+	                                 FDATETIME_TEST_BATCH_NUMBER_OF_VALUES * FDATETIME_TEST_BATCH_UTF8_STRING_SIZE );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string_arena",
+	 utf8_string_arena );
+
+	/* 0x01cb3a623d0a17ce with increments that span multiple days per value
+	 */
+	value_64bit = 0x01cb3a623d0a17ceULL;
+
+	for( value_index = 0;
+	     value_index < FDATETIME_TEST_BATCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( byte_stream[ value_index * 8 ] ),
+		 value_64bit );
+
+		value_64bit += 0x000000c92a69c3b7ULL;
+	}
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_number_of_threads(
+	          batch_job,
+	          number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          FDATETIME_TEST_BATCH_NUMBER_OF_VALUES * 8,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          FDATETIME_TEST_BATCH_NUMBER_OF_VALUES * FDATETIME_TEST_BATCH_UTF8_STRING_SIZE,
+	          FDATETIME_TEST_BATCH_UTF8_STRING_SIZE,
+	          string_format_flags,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < FDATETIME_TEST_BATCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		result = libfdatetime_filetime_copy_from_byte_stream(
+		          filetime,
+		          &( byte_stream[ value_index * 8 ] ),
+		          8,
+		          LIBFDATETIME_ENDIAN_LITTLE,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_utf8_string(
+		          filetime,
+		          expected_utf8_string,
+		          FDATETIME_TEST_BATCH_UTF8_STRING_SIZE,
+		          string_format_flags,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          &( utf8_string_arena[ value_index * FDATETIME_TEST_BATCH_UTF8_STRING_SIZE ] ),
+		          expected_utf8_string,
+		          30 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          FDATETIME_TEST_BATCH_NUMBER_OF_VALUES * FDATETIME_TEST_BATCH_UTF8_STRING_SIZE,
+	          16,
+	          string_format_flags,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          ( FDATETIME_TEST_BATCH_NUMBER_OF_VALUES - 1 ) * FDATETIME_TEST_BATCH_UTF8_STRING_SIZE,
+	          FDATETIME_TEST_BATCH_UTF8_STRING_SIZE,
+	          string_format_flags,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_free(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	free(
+	 utf8_string_arena );
+
+	free(
+	 byte_stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	if( utf8_string_arena != NULL )
+	{
+		free(
+		 utf8_string_arena );
+	}
+	if( byte_stream != NULL )
+	{
+		free(
+		 byte_stream );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_batch_convert function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_batch_convert(
+     void )
+{
+	uint8_t utf8_string_arena[ 4 * 32 ];
+
+	uint8_t byte_stream[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x4c, 0x8f, 0x46, 0x4f,
+		0x7f, 0xff, 0xff, 0xff, 0x00, 0x01, 0x51, 0x80 };
+
+	libcerror_error_t *error            = NULL;
+	libfdatetime_batch_job_t *batch_job = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = fdatetime_test_batch_convert_filetime(
+	          1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_batch_convert_filetime(
+	          4 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Initialize test
+	 */
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_batch_convert(
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfdatetime_batch_convert with missing input
+	 */
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfdatetime_batch_convert with missing output
+	 */
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          4 * 32,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 0 ] ),
+	          "1970-01-01T00:00:00",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 32 ] ),
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 64 ] ),
+	          "2038-01-19T03:14:07",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 96 ] ),
+	          "1970-01-02T00:00:00",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libfdatetime_batch_convert with a value that is not supported
+	 */
+	byte_stream[ 8 ]  = 0x80;
+	byte_stream[ 9 ]  = 0x00;
+	byte_stream[ 10 ] = 0x00;
+	byte_stream[ 11 ] = 0x00;
+
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 32 ] ),
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 64 ] ),
+	          "(0x80000000)",
+	          13 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          (char *) &( utf8_string_arena[ 96 ] ),
+	          "1970-01-02T00:00:00",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfdatetime_batch_job_free(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error            = NULL;
+	libfdatetime_batch_job_t *batch_job = NULL;
+	int result                          = 0;
+
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_batch_job_initialize",
+	 fdatetime_test_batch_job_initialize );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_batch_job_free",
+	 fdatetime_test_batch_job_free );
+
+	/* Initialize test
+	 */
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_job_set_input",
+	 fdatetime_test_batch_job_set_input,
+	 batch_job );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_job_set_output",
+	 fdatetime_test_batch_job_set_output,
+	 batch_job );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_job_get_number_of_threads",
+	 fdatetime_test_batch_job_number_of_threads,
+	 batch_job );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_job_get_number_of_values",
+	 fdatetime_test_batch_job_get_number_of_values,
+	 batch_job );
+
+	/* Clean up
+	 */
+	result = libfdatetime_batch_job_free(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "batch_job",
+	 batch_job );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_batch_convert",
+	 fdatetime_test_batch_convert );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,550 @@
+/*
+ * Library calendar functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_calendar.h"
+#include "../libfdatetime/libfdatetime_date_time_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_internal_copy_to_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_copy_to_date_time_values(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_filetime_t *filetime                = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0x01cb3a623d0a17ceULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_internal_copy_to_date_time_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values.year",
+	 date_time_values.year,
+	 2010 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values.month",
+	 date_time_values.month,
+	 8 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values.day",
+	 date_time_values.day,
+	 12 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_copy_to_date_time_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_copy_to_date_time_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_UNDEFINED,
+	          (intptr_t *) filetime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_get_calendar_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_get_calendar_values(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfdatetime_filetime_t *filetime     = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint16_t day_of_year                  = 0;
+	uint16_t iso_week_year                = 0;
+	uint8_t day_of_week                   = 0;
+	uint8_t iso_week                      = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0x01cb3a623d0a17ceULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* 2021-01-01 00:00:00 is in the last ISO week of 2020
+	 */
+	result = libfdatetime_posix_time_copy_from_32bit(
+	          posix_time,
+	          1609459200,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          &day_of_week,
+	          &day_of_year,
+	          &iso_week_year,
+	          &iso_week,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_week",
+	 day_of_week,
+	 4 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "day_of_year",
+	 day_of_year,
+	 224 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "iso_week_year",
+	 iso_week_year,
+	 2010 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "iso_week",
+	 iso_week,
+	 32 );
+
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          (intptr_t *) posix_time,
+	          &day_of_week,
+	          &day_of_year,
+	          &iso_week_year,
+	          &iso_week,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_week",
+	 day_of_week,
+	 5 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "day_of_year",
+	 day_of_year,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "iso_week_year",
+	 iso_week_year,
+	 2020 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "iso_week",
+	 iso_week,
+	 53 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_UNDEFINED,
+	          (intptr_t *) filetime,
+	          &day_of_week,
+	          &day_of_year,
+	          &iso_week_year,
+	          &iso_week,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          NULL,
+	          &day_of_year,
+	          &iso_week_year,
+	          &iso_week,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          &day_of_week,
+	          NULL,
+	          &iso_week_year,
+	          &iso_week,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          &day_of_week,
+	          &day_of_year,
+	          NULL,
+	          &iso_week,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_get_calendar_values(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          &day_of_week,
+	          &day_of_year,
+	          &iso_week_year,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_copy_to_date_time_values",
+	 fdatetime_test_internal_copy_to_date_time_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_get_calendar_values",
+	 fdatetime_test_get_calendar_values );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
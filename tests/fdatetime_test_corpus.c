@@ -0,0 +1,767 @@
+/*
+ * Synthetic timestamp corpus testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_corpus_generator.h"
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+/* The number of values of a generated corpus, which is not a multiple of the record sizes
+ */
+#define FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES		20003
+
+/* The size of the UTF-8 string of an individual value
+ */
+#define FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE		48
+
+/* Tests the fdatetime_test_corpus_generator_get_profile_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_corpus_get_profile_by_name(
+     void )
+{
+	const char *profile_name = NULL;
+	int profile              = 0;
+	int profile_index        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( profile_index = 1;
+	     profile_index <= FDATETIME_TEST_CORPUS_NUMBER_OF_PROFILES;
+	     profile_index++ )
+	{
+		profile_name = fdatetime_test_corpus_generator_get_profile_name(
+		                profile_index );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "profile_name",
+		 profile_name );
+
+		result = fdatetime_test_corpus_generator_get_profile_by_name(
+		          profile_name,
+		          &profile );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "profile",
+		 profile,
+		 profile_index );
+	}
+	result = fdatetime_test_corpus_generator_get_profile_by_name(
+	          "ntfs",
+	          &profile );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = fdatetime_test_corpus_generator_get_profile_by_name(
+	          NULL,
+	          &profile );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = fdatetime_test_corpus_generator_get_profile_by_name(
+	          "ntfs_mft",
+	          NULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	profile_name = fdatetime_test_corpus_generator_get_profile_name(
+	                FDATETIME_TEST_CORPUS_PROFILE_UNDEFINED );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "profile_name",
+	 profile_name );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the fdatetime_test_corpus_generator_generate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_corpus_generate(
+     void )
+{
+	uint8_t first_buffer[ 256 ];
+	uint8_t second_buffer[ 256 ];
+
+	int profile_index = 0;
+	int result        = 0;
+
+	/* Test regular cases
+	 */
+	for( profile_index = 1;
+	     profile_index <= FDATETIME_TEST_CORPUS_NUMBER_OF_PROFILES;
+	     profile_index++ )
+	{
+		result = fdatetime_test_corpus_generator_generate(
+		          profile_index,
+		          1,
+		          first_buffer,
+		          256,
+		          32 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The same seed generates the same values
+		 */
+		result = fdatetime_test_corpus_generator_generate(
+		          profile_index,
+		          1,
+		          second_buffer,
+		          256,
+		          32 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          first_buffer,
+		          second_buffer,
+		          128 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Another seed generates other values
+		 */
+		result = fdatetime_test_corpus_generator_generate(
+		          profile_index,
+		          2,
+		          second_buffer,
+		          256,
+		          32 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          first_buffer,
+		          second_buffer,
+		          128 );
+
+		FDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = fdatetime_test_corpus_generator_generate(
+	          FDATETIME_TEST_CORPUS_PROFILE_UNDEFINED,
+	          1,
+	          first_buffer,
+	          256,
+	          32 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = fdatetime_test_corpus_generator_generate(
+	          FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT,
+	          1,
+	          NULL,
+	          256,
+	          32 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = fdatetime_test_corpus_generator_generate(
+	          FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT,
+	          1,
+	          first_buffer,
+	          256,
+	          33 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests converting a generated corpus using libfdatetime_batch_convert
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_corpus_batch_convert(
+     int profile )
+{
+	libcerror_error_t *error            = NULL;
+	libfdatetime_batch_job_t *batch_job = NULL;
+	uint8_t *buffer                     = NULL;
+	uint8_t *utf8_string_arena          = NULL;
+	size_t value_size                   = 0;
+	int byte_order                      = 0;
+	int result                          = 0;
+	int timestamp_type                  = 0;
+
+	result = fdatetime_test_corpus_generator_get_value_format(
+	          profile,
+	          &timestamp_type,
+	          &byte_order,
+	          &value_size );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	buffer = (uint8_t *) malloc(
+	                      value_size * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	utf8_string_arena = (uint8_t *) malloc(
+	                                 FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string_arena",
+	 utf8_string_arena );
+
+	result = fdatetime_test_corpus_generator_generate(
+	          profile,
+	          1,
+	          buffer,
+	          value_size * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES,
+	          FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_batch_job_initialize(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_input(
+	          batch_job,
+	          buffer,
+	          value_size * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES,
+	          timestamp_type,
+	          0,
+	          byte_order,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_set_output(
+	          batch_job,
+	          utf8_string_arena,
+	          FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES,
+	          FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_convert(
+	          batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_batch_job_free(
+	          &batch_job,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	free(
+	 utf8_string_arena );
+
+	free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_job != NULL )
+	{
+		libfdatetime_batch_job_free(
+		 &batch_job,
+		 NULL );
+	}
+	if( utf8_string_arena != NULL )
+	{
+		free(
+		 utf8_string_arena );
+	}
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* Tests converting a generated FAT corpus
+ * The unset creation date and times cannot be converted and are skipped
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_corpus_fat_date_time_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE ];
+
+	libcerror_error_t *error                    = NULL;
+	libfdatetime_fat_date_time_t *fat_date_time = NULL;
+	uint8_t *buffer                             = NULL;
+	uint32_t value_32bit                        = 0;
+	int number_of_unset_values                  = 0;
+	int result                                  = 0;
+	int value_index                             = 0;
+
+	buffer = (uint8_t *) malloc(
+	                      4 * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = fdatetime_test_corpus_generator_generate(
+	          FDATETIME_TEST_CORPUS_PROFILE_FAT,
+	          1,
+	          buffer,
+	          4 * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES,
+	          FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfdatetime_fat_date_time_initialize(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ value_index * 4 ] ),
+		 value_32bit );
+
+		if( value_32bit == 0 )
+		{
+			number_of_unset_values++;
+
+			continue;
+		}
+		result = libfdatetime_fat_date_time_copy_from_byte_stream(
+		          fat_date_time,
+		          &( buffer[ value_index * 4 ] ),
+		          4,
+		          LIBFDATETIME_ENDIAN_LITTLE,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_fat_date_time_copy_to_utf8_string(
+		          fat_date_time,
+		          utf8_string,
+		          FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE,
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The values are generated between 1995 and 2026
+		 */
+		result = ( ( utf8_string[ 0 ] == '1' ) && ( utf8_string[ 1 ] == '9' ) )
+		      || ( ( utf8_string[ 0 ] == '2' ) && ( utf8_string[ 1 ] == '0' ) );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	FDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_unset_values",
+	 number_of_unset_values,
+	 0 );
+
+	result = libfdatetime_fat_date_time_free(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fat_date_time != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &fat_date_time,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* Tests the values of a generated carved garbage corpus
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_corpus_carved_garbage(
+     void )
+{
+	uint8_t utf8_string[ FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE ];
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	uint8_t *buffer                   = NULL;
+	uint64_t value_64bit              = 0;
+	int number_of_converted_values    = 0;
+	int number_of_sentinel_values     = 0;
+	int number_of_zero_values         = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	buffer = (uint8_t *) malloc(
+	                      8 * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = fdatetime_test_corpus_generator_generate(
+	          FDATETIME_TEST_CORPUS_PROFILE_CARVED_GARBAGE,
+	          1,
+	          buffer,
+	          8 * FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES,
+	          FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < FDATETIME_TEST_CORPUS_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( buffer[ value_index * 8 ] ),
+		 value_64bit );
+
+		if( value_64bit == 0 )
+		{
+			number_of_zero_values++;
+		}
+		else if( ( value_64bit == 0x7fffffffffffffffULL )
+		      || ( value_64bit == 0xffffffffffffffffULL ) )
+		{
+			number_of_sentinel_values++;
+		}
+		result = libfdatetime_filetime_copy_from_byte_stream(
+		          filetime,
+		          &( buffer[ value_index * 8 ] ),
+		          8,
+		          LIBFDATETIME_ENDIAN_LITTLE,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Not every carved value can be converted
+		 */
+		result = libfdatetime_filetime_copy_to_utf8_string(
+		          filetime,
+		          utf8_string,
+		          FDATETIME_TEST_CORPUS_UTF8_STRING_SIZE,
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+		          &error );
+
+		if( result == 1 )
+		{
+			number_of_converted_values++;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	FDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_converted_values",
+	 number_of_converted_values,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_sentinel_values",
+	 number_of_sentinel_values,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_zero_values",
+	 number_of_zero_values,
+	 0 );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FDATETIME_TEST_RUN(
+	 "fdatetime_test_corpus_generator_get_profile_by_name",
+	 fdatetime_test_corpus_get_profile_by_name );
+
+	FDATETIME_TEST_RUN(
+	 "fdatetime_test_corpus_generator_generate",
+	 fdatetime_test_corpus_generate );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_convert",
+	 fdatetime_test_corpus_batch_convert,
+	 FDATETIME_TEST_CORPUS_PROFILE_EVTX );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_convert",
+	 fdatetime_test_corpus_batch_convert,
+	 FDATETIME_TEST_CORPUS_PROFILE_HFS_CATALOG );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_batch_convert",
+	 fdatetime_test_corpus_batch_convert,
+	 FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_fat_date_time_copy_to_utf8_string",
+	 fdatetime_test_corpus_fat_date_time_copy_to_utf8_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_copy_to_utf8_string",
+	 fdatetime_test_corpus_carved_garbage );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
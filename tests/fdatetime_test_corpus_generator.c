@@ -0,0 +1,765 @@
+/*
+ * Synthetic timestamp corpus generator functions for testing
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "fdatetime_test_corpus_generator.h"
+#include "fdatetime_test_libfdatetime.h"
+
+/* The number of seconds since January 1, 1970 of January 1, 1995, January 1, 2015
+ * and January 1, 2026, most timestamps are generated between 2015 and 2026
+ */
+#define FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_1995	788918400LL
+#define FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_2015	1420070400LL
+#define FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_2026	1767225600LL
+
+/* The number of seconds between January 1, 1601 and January 1, 1970
+ */
+#define FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_OFFSET	11644473600LL
+
+/* The number of seconds between January 1, 1904 and January 1, 1970
+ */
+#define FDATETIME_TEST_CORPUS_GENERATOR_HFS_TIME_OFFSET	2082844800LL
+
+#define FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY	86400LL
+
+/* The number of 100 nano seconds intervals per second
+ */
+#define FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS	10000000LL
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+static uint64_t fdatetime_test_corpus_generator_get_random_value(
+                 uint64_t *random_state )
+{
+	*random_state ^= *random_state << 13;
+	*random_state ^= *random_state >> 7;
+	*random_state ^= *random_state << 17;
+
+	return( *random_state );
+}
+
+/* Retrieves a pseudo random value in the range 0 to range - 1
+ * Returns the pseudo random value
+ */
+static uint64_t fdatetime_test_corpus_generator_get_random_in_range(
+                 uint64_t *random_state,
+                 uint64_t range )
+{
+	return( fdatetime_test_corpus_generator_get_random_value(
+	         random_state ) % range );
+}
+
+/* Retrieves a pseudo random number of seconds since January 1, 1970 between 2015 and 2026
+ * The maximum of two uniform values is used so that recent timestamps are more likely
+ * Returns the number of seconds
+ */
+static int64_t fdatetime_test_corpus_generator_get_recent_seconds(
+                uint64_t *random_state )
+{
+	uint64_t first_value  = 0;
+	uint64_t range        = 0;
+	uint64_t second_value = 0;
+
+	range = (uint64_t) ( FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_2026 - FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_2015 );
+
+	first_value = fdatetime_test_corpus_generator_get_random_in_range(
+	               random_state,
+	               range );
+
+	second_value = fdatetime_test_corpus_generator_get_random_in_range(
+	                random_state,
+	                range );
+
+	if( second_value > first_value )
+	{
+		first_value = second_value;
+	}
+	return( FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_2015 + (int64_t) first_value );
+}
+
+/* Copies a number of seconds since January 1, 1970 and 100 nano seconds intervals
+ * to a little-endian FILETIME
+ */
+static void fdatetime_test_corpus_generator_copy_filetime(
+             uint8_t *value,
+             int64_t number_of_seconds,
+             uint64_t number_of_ticks )
+{
+	uint64_t filetime = 0;
+
+	filetime = (uint64_t) ( number_of_seconds + FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_OFFSET )
+	         * FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS
+	         + number_of_ticks;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 value,
+	 filetime );
+}
+
+/* Copies a number of seconds since January 1, 1970 to a big-endian HFS time
+ * A number of seconds of 0 is copied as an unset HFS time of 0
+ */
+static void fdatetime_test_corpus_generator_copy_hfs_time(
+             uint8_t *value,
+             int64_t number_of_seconds )
+{
+	uint32_t hfs_time = 0;
+
+	if( number_of_seconds != 0 )
+	{
+		hfs_time = (uint32_t) ( number_of_seconds + FDATETIME_TEST_CORPUS_GENERATOR_HFS_TIME_OFFSET );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 value,
+	 hfs_time );
+}
+
+/* Copies a number of seconds since January 1, 1970 to a FAT date and time
+ * The date is stored before the time, both little-endian, which is the byte order
+ * read by libfdatetime_fat_date_time_copy_from_byte_stream
+ * A number of seconds of 0 is copied as an unset FAT date and time of 0
+ */
+static void fdatetime_test_corpus_generator_copy_fat_date_time(
+             uint8_t *value,
+             int64_t number_of_seconds,
+             int date_only )
+{
+	int64_t day_of_era      = 0;
+	int64_t number_of_days  = 0;
+	int64_t year_of_era     = 0;
+	int64_t day_of_year     = 0;
+	int64_t month_of_year   = 0;
+	uint16_t fat_date       = 0;
+	uint16_t fat_time       = 0;
+	uint16_t day_of_month   = 0;
+	uint16_t month          = 0;
+	uint16_t year           = 0;
+	uint32_t seconds_of_day = 0;
+
+	if( number_of_seconds != 0 )
+	{
+		/* Determine the date from the number of days since January 1, 1970
+		 * using 400 year eras that start on March 1, 0000
+		 */
+		number_of_days = ( number_of_seconds / FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY ) + 719468;
+		seconds_of_day = (uint32_t) ( number_of_seconds % FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+
+		day_of_era    = number_of_days % 146097;
+		year_of_era   = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+		day_of_year   = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+		month_of_year = ( ( 5 * day_of_year ) + 2 ) / 153;
+
+		day_of_month = (uint16_t) ( day_of_year - ( ( ( 153 * month_of_year ) + 2 ) / 5 ) + 1 );
+		month        = (uint16_t) ( ( month_of_year < 10 ) ? ( month_of_year + 3 ) : ( month_of_year - 9 ) );
+		year         = (uint16_t) ( year_of_era + ( ( number_of_days / 146097 ) * 400 ) + ( ( month <= 2 ) ? 1 : 0 ) );
+
+		fat_date = (uint16_t) ( ( ( year - 1980 ) << 9 ) | ( month << 5 ) | day_of_month );
+
+		if( date_only == 0 )
+		{
+			fat_time = (uint16_t) ( ( ( seconds_of_day / 3600 ) << 11 )
+			                      | ( ( ( seconds_of_day / 60 ) % 60 ) << 5 )
+			                      | ( ( seconds_of_day % 60 ) / 2 ) );
+		}
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 value,
+	 fat_date );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( value[ 2 ] ),
+	 fat_time );
+}
+
+/* Generates NTFS $STANDARD_INFORMATION attribute timestamps
+ * Every record consists of the creation, modification, entry modification and access
+ * FILETIME. Most records have identical timestamps, files tend to be created in batches
+ * that share the same second and unused records contain 0 values.
+ */
+static void fdatetime_test_corpus_generator_generate_ntfs_mft(
+             uint64_t *random_state,
+             uint8_t *buffer,
+             size_t number_of_values )
+{
+	int64_t record_seconds[ 4 ];
+	uint64_t record_ticks[ 4 ];
+
+	int64_t batch_seconds = 0;
+	size_t value_index    = 0;
+	uint64_t probability  = 0;
+	int record_index      = 0;
+
+	batch_seconds = fdatetime_test_corpus_generator_get_recent_seconds(
+	                 random_state );
+
+	while( value_index < number_of_values )
+	{
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 30 )
+		{
+			record_seconds[ 0 ] = batch_seconds + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                                 random_state,
+			                                                 3 );
+		}
+		else
+		{
+			record_seconds[ 0 ] = fdatetime_test_corpus_generator_get_recent_seconds(
+			                       random_state );
+		}
+		batch_seconds = record_seconds[ 0 ];
+
+		record_ticks[ 0 ] = fdatetime_test_corpus_generator_get_random_in_range(
+		                     random_state,
+		                     FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS );
+
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		for( record_index = 1;
+		     record_index < 4;
+		     record_index++ )
+		{
+			if( probability < 60 )
+			{
+				record_seconds[ record_index ] = record_seconds[ 0 ];
+				record_ticks[ record_index ]   = record_ticks[ 0 ];
+			}
+			else
+			{
+				record_seconds[ record_index ] = record_seconds[ record_index - 1 ]
+				                               + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+				                                            random_state,
+				                                            30 * FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+
+				record_ticks[ record_index ] = fdatetime_test_corpus_generator_get_random_in_range(
+				                                random_state,
+				                                FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS );
+			}
+		}
+		for( record_index = 0;
+		     ( record_index < 4 ) && ( value_index < number_of_values );
+		     record_index++ )
+		{
+			if( probability < 2 )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 &( buffer[ value_index * 8 ] ),
+				 (uint64_t) 0 );
+			}
+			else
+			{
+				fdatetime_test_corpus_generator_copy_filetime(
+				 &( buffer[ value_index * 8 ] ),
+				 record_seconds[ record_index ],
+				 record_ticks[ record_index ] );
+			}
+			value_index++;
+		}
+	}
+}
+
+/* Generates HFS+ catalog file record timestamps
+ * Every record consists of the creation, content modification, attribute modification,
+ * access and backup HFS time. Timestamps only have a precision of seconds,
+ * the modification times follow the creation time and the backup time is mostly not set.
+ */
+static void fdatetime_test_corpus_generator_generate_hfs_catalog(
+             uint64_t *random_state,
+             uint8_t *buffer,
+             size_t number_of_values )
+{
+	int64_t record_seconds[ 5 ];
+
+	size_t value_index   = 0;
+	uint64_t probability = 0;
+	int record_index     = 0;
+
+	while( value_index < number_of_values )
+	{
+		record_seconds[ 0 ] = fdatetime_test_corpus_generator_get_recent_seconds(
+		                       random_state );
+
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 50 )
+		{
+			record_seconds[ 1 ] = record_seconds[ 0 ];
+			record_seconds[ 2 ] = record_seconds[ 0 ];
+		}
+		else
+		{
+			record_seconds[ 1 ] = record_seconds[ 0 ]
+			                    + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                 random_state,
+			                                 90 * FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+
+			record_seconds[ 2 ] = record_seconds[ 1 ]
+			                    + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                 random_state,
+			                                 60 );
+		}
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 50 )
+		{
+			record_seconds[ 3 ] = record_seconds[ 1 ];
+		}
+		else
+		{
+			record_seconds[ 3 ] = record_seconds[ 2 ]
+			                    + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                 random_state,
+			                                 7 * FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+		}
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 95 )
+		{
+			record_seconds[ 4 ] = 0;
+		}
+		else
+		{
+			record_seconds[ 4 ] = record_seconds[ 2 ]
+			                    + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                 random_state,
+			                                 FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+		}
+		for( record_index = 0;
+		     ( record_index < 5 ) && ( value_index < number_of_values );
+		     record_index++ )
+		{
+			fdatetime_test_corpus_generator_copy_hfs_time(
+			 &( buffer[ value_index * 4 ] ),
+			 record_seconds[ record_index ] );
+
+			value_index++;
+		}
+	}
+}
+
+/* Generates Windows XML event log (EVTX) event record written times
+ * The FILETIMEs increase monotonically, most events are written in bursts
+ * less than a second apart and some after long idle periods.
+ */
+static void fdatetime_test_corpus_generator_generate_evtx(
+             uint64_t *random_state,
+             uint8_t *buffer,
+             size_t number_of_values )
+{
+	uint64_t filetime    = 0;
+	uint64_t interval    = 0;
+	uint64_t probability = 0;
+	size_t value_index   = 0;
+
+	filetime = (uint64_t) ( fdatetime_test_corpus_generator_get_recent_seconds(
+	                         random_state ) + FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_OFFSET )
+	         * FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 60 )
+		{
+			interval = FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS;
+		}
+		else if( probability < 90 )
+		{
+			interval = 60 * FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS;
+		}
+		else if( probability < 99 )
+		{
+			interval = 3600 * FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS;
+		}
+		else
+		{
+			interval = FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY * FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS;
+		}
+		filetime += fdatetime_test_corpus_generator_get_random_in_range(
+		             random_state,
+		             interval );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( buffer[ value_index * 8 ] ),
+		 filetime );
+	}
+}
+
+/* Generates FAT directory entry timestamps
+ * Every record consists of the creation, modification and access FAT date and time.
+ * Timestamps have a precision of 2 seconds, the access time only contains a date
+ * and some drivers do not set the creation time.
+ */
+static void fdatetime_test_corpus_generator_generate_fat(
+             uint64_t *random_state,
+             uint8_t *buffer,
+             size_t number_of_values )
+{
+	int64_t record_seconds[ 3 ];
+
+	uint64_t probability = 0;
+	uint64_t range       = 0;
+	size_t value_index   = 0;
+	int record_index     = 0;
+
+	range = (uint64_t) ( FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_2026 - FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_1995 );
+
+	while( value_index < number_of_values )
+	{
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 70 )
+		{
+			record_seconds[ 1 ] = fdatetime_test_corpus_generator_get_recent_seconds(
+			                       random_state );
+		}
+		else
+		{
+			record_seconds[ 1 ] = FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_1995
+			                    + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                 random_state,
+			                                 range );
+		}
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 3 )
+		{
+			record_seconds[ 0 ] = 0;
+		}
+		else if( probability < 60 )
+		{
+			record_seconds[ 0 ] = record_seconds[ 1 ];
+		}
+		else
+		{
+			record_seconds[ 0 ] = record_seconds[ 1 ]
+			                    - (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+			                                 random_state,
+			                                 365 * FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+		}
+		record_seconds[ 2 ] = record_seconds[ 1 ]
+		                    + (int64_t) fdatetime_test_corpus_generator_get_random_in_range(
+		                                 random_state,
+		                                 30 * FDATETIME_TEST_CORPUS_GENERATOR_SECONDS_PER_DAY );
+
+		for( record_index = 0;
+		     ( record_index < 3 ) && ( value_index < number_of_values );
+		     record_index++ )
+		{
+			fdatetime_test_corpus_generator_copy_fat_date_time(
+			 &( buffer[ value_index * 4 ] ),
+			 record_seconds[ record_index ],
+			 ( record_index == 2 ) );
+
+			value_index++;
+		}
+	}
+}
+
+/* Generates carved data interpreted as FILETIMEs
+ * The values are a mix of plausible timestamps, 0 values, the 0x7fffffffffffffff
+ * and 0xffffffffffffffff sentinels, text and random data.
+ */
+static void fdatetime_test_corpus_generator_generate_carved_garbage(
+             uint64_t *random_state,
+             uint8_t *buffer,
+             size_t number_of_values )
+{
+	uint64_t probability = 0;
+	uint64_t value_64bit = 0;
+	size_t value_index   = 0;
+	int byte_index       = 0;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		probability = fdatetime_test_corpus_generator_get_random_in_range(
+		               random_state,
+		               100 );
+
+		if( probability < 20 )
+		{
+			fdatetime_test_corpus_generator_copy_filetime(
+			 &( buffer[ value_index * 8 ] ),
+			 fdatetime_test_corpus_generator_get_recent_seconds(
+			  random_state ),
+			 fdatetime_test_corpus_generator_get_random_in_range(
+			  random_state,
+			  FDATETIME_TEST_CORPUS_GENERATOR_FILETIME_TICKS ) );
+
+			continue;
+		}
+		if( probability < 35 )
+		{
+			value_64bit = 0;
+		}
+		else if( probability < 45 )
+		{
+			value_64bit = 0x7fffffffffffffffULL;
+		}
+		else if( probability < 55 )
+		{
+			value_64bit = 0xffffffffffffffffULL;
+		}
+		else if( probability < 70 )
+		{
+			/* Printable ASCII text
+			 */
+			value_64bit = 0;
+
+			for( byte_index = 0;
+			     byte_index < 8;
+			     byte_index++ )
+			{
+				value_64bit <<= 8;
+				value_64bit  |= 0x20 + fdatetime_test_corpus_generator_get_random_in_range(
+				                        random_state,
+				                        0x5f );
+			}
+		}
+		else
+		{
+			value_64bit = fdatetime_test_corpus_generator_get_random_value(
+			               random_state );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( buffer[ value_index * 8 ] ),
+		 value_64bit );
+	}
+}
+
+/* Retrieves a profile by its name
+ * Returns 1 if successful, 0 if no such profile or -1 on error
+ */
+int fdatetime_test_corpus_generator_get_profile_by_name(
+     const char *name,
+     int *profile )
+{
+	const char *profile_name = NULL;
+	size_t name_length       = 0;
+	int profile_index        = 0;
+
+	if( ( name == NULL )
+	 || ( profile == NULL ) )
+	{
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	for( profile_index = 1;
+	     profile_index <= FDATETIME_TEST_CORPUS_NUMBER_OF_PROFILES;
+	     profile_index++ )
+	{
+		profile_name = fdatetime_test_corpus_generator_get_profile_name(
+		                profile_index );
+
+		if( ( narrow_string_length( profile_name ) == name_length )
+		 && ( narrow_string_compare(
+		       profile_name,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*profile = profile_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the name of a profile
+ * Returns a string containing the name or NULL if not available
+ */
+const char *fdatetime_test_corpus_generator_get_profile_name(
+             int profile )
+{
+	switch( profile )
+	{
+		case FDATETIME_TEST_CORPUS_PROFILE_CARVED_GARBAGE:
+			return( "carved_garbage" );
+
+		case FDATETIME_TEST_CORPUS_PROFILE_EVTX:
+			return( "evtx" );
+
+		case FDATETIME_TEST_CORPUS_PROFILE_FAT:
+			return( "fat" );
+
+		case FDATETIME_TEST_CORPUS_PROFILE_HFS_CATALOG:
+			return( "hfs_catalog" );
+
+		case FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT:
+			return( "ntfs_mft" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Retrieves the timestamp type, byte order and size of the values of a profile
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_corpus_generator_get_value_format(
+     int profile,
+     int *timestamp_type,
+     int *byte_order,
+     size_t *value_size )
+{
+	if( ( timestamp_type == NULL )
+	 || ( byte_order == NULL )
+	 || ( value_size == NULL ) )
+	{
+		return( -1 );
+	}
+	switch( profile )
+	{
+		case FDATETIME_TEST_CORPUS_PROFILE_CARVED_GARBAGE:
+		case FDATETIME_TEST_CORPUS_PROFILE_EVTX:
+		case FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT:
+			*timestamp_type = LIBFDATETIME_TIMESTAMP_TYPE_FILETIME;
+			*byte_order     = LIBFDATETIME_ENDIAN_LITTLE;
+			*value_size     = 8;
+			break;
+
+		case FDATETIME_TEST_CORPUS_PROFILE_FAT:
+			*timestamp_type = LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME;
+			*byte_order     = LIBFDATETIME_ENDIAN_LITTLE;
+			*value_size     = 4;
+			break;
+
+		case FDATETIME_TEST_CORPUS_PROFILE_HFS_CATALOG:
+			*timestamp_type = LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME;
+			*byte_order     = LIBFDATETIME_ENDIAN_BIG;
+			*value_size     = 4;
+			break;
+
+		default:
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates the values of a profile
+ * The same profile, seed and number of values always generate the same values
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_corpus_generator_generate(
+     int profile,
+     uint64_t seed,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t number_of_values )
+{
+	uint64_t random_state = 0;
+	size_t value_size     = 0;
+	int byte_order        = 0;
+	int timestamp_type    = 0;
+
+	if( buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( fdatetime_test_corpus_generator_get_value_format(
+	     profile,
+	     &timestamp_type,
+	     &byte_order,
+	     &value_size ) != 1 )
+	{
+		return( -1 );
+	}
+	if( number_of_values > ( buffer_size / value_size ) )
+	{
+		return( -1 );
+	}
+	/* The random state cannot be 0 otherwise only 0 values are generated
+	 */
+	random_state = seed ^ 0x5eed12345678abcdULL;
+
+	if( random_state == 0 )
+	{
+		random_state = 0x5eed12345678abcdULL;
+	}
+	switch( profile )
+	{
+		case FDATETIME_TEST_CORPUS_PROFILE_CARVED_GARBAGE:
+			fdatetime_test_corpus_generator_generate_carved_garbage(
+			 &random_state,
+			 buffer,
+			 number_of_values );
+			break;
+
+		case FDATETIME_TEST_CORPUS_PROFILE_EVTX:
+			fdatetime_test_corpus_generator_generate_evtx(
+			 &random_state,
+			 buffer,
+			 number_of_values );
+			break;
+
+		case FDATETIME_TEST_CORPUS_PROFILE_FAT:
+			fdatetime_test_corpus_generator_generate_fat(
+			 &random_state,
+			 buffer,
+			 number_of_values );
+			break;
+
+		case FDATETIME_TEST_CORPUS_PROFILE_HFS_CATALOG:
+			fdatetime_test_corpus_generator_generate_hfs_catalog(
+			 &random_state,
+			 buffer,
+			 number_of_values );
+			break;
+
+		case FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT:
+			fdatetime_test_corpus_generator_generate_ntfs_mft(
+			 &random_state,
+			 buffer,
+			 number_of_values );
+			break;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,69 @@
+/*
+ * Synthetic timestamp corpus generator functions for testing
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FDATETIME_TEST_CORPUS_GENERATOR_H )
+#define _FDATETIME_TEST_CORPUS_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum FDATETIME_TEST_CORPUS_PROFILES
+{
+	FDATETIME_TEST_CORPUS_PROFILE_UNDEFINED,
+	FDATETIME_TEST_CORPUS_PROFILE_CARVED_GARBAGE,
+	FDATETIME_TEST_CORPUS_PROFILE_EVTX,
+	FDATETIME_TEST_CORPUS_PROFILE_FAT,
+	FDATETIME_TEST_CORPUS_PROFILE_HFS_CATALOG,
+	FDATETIME_TEST_CORPUS_PROFILE_NTFS_MFT
+};
+
+#define FDATETIME_TEST_CORPUS_NUMBER_OF_PROFILES	5
+
+int fdatetime_test_corpus_generator_get_profile_by_name(
+     const char *name,
+     int *profile );
+
+const char *fdatetime_test_corpus_generator_get_profile_name(
+             int profile );
+
+int fdatetime_test_corpus_generator_get_value_format(
+     int profile,
+     int *timestamp_type,
+     int *byte_order,
+     size_t *value_size );
+
+int fdatetime_test_corpus_generator_generate(
+     int profile,
+     uint64_t seed,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t number_of_values );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FDATETIME_TEST_CORPUS_GENERATOR_H ) */
+
@@ -0,0 +1,845 @@
+/*
+ * Library C++ interface testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include <libfdatetime.hpp>
+
+typedef int (*fdatetime_test_cpp_copy_to_utf8_string_t)(
+               intptr_t *timestamp,
+               uint8_t *utf8_string,
+               size_t utf8_string_size,
+               uint32_t string_format_flags,
+               libcerror_error_t **error );
+
+typedef int (*fdatetime_test_cpp_copy_to_utf16_string_t)(
+               intptr_t *timestamp,
+               uint16_t *utf16_string,
+               size_t utf16_string_size,
+               uint32_t string_format_flags,
+               libcerror_error_t **error );
+
+/* Compares a constant string buffer with an expected string
+ */
+template<typename StringBufferType>
+constexpr bool fdatetime_test_cpp_string_buffer_equals(
+                const StringBufferType &string_buffer,
+                const char *expected_string )
+{
+	size_t string_index = 0;
+
+	while( expected_string[ string_index ] != 0 )
+	{
+		if( ( string_index >= string_buffer.length )
+		 || ( string_buffer.data[ string_index ] != expected_string[ string_index ] ) )
+		{
+			return( false );
+		}
+		string_index++;
+	}
+	return( ( string_index == string_buffer.length )
+	     && ( string_buffer.data[ string_index ] == 0 ) );
+}
+
+/* The conversions can be evaluated in a constant expression
+ */
+static_assert(
+ fdatetime_test_cpp_string_buffer_equals(
+  fdatetime::filetime( 0x01cb3a623d0a17ceULL ).to_string_buffer<LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR>(),
+  "2010-08-12T21:06:31.546875000Z" ),
+ "invalid constant FILETIME string" );
+
+static_assert(
+ fdatetime_test_cpp_string_buffer_equals(
+  fdatetime::filetime( 0x24c85a5ed1c04000ULL ).to_string_buffer<LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME>(),
+  "(0x24c85a5e 0xd1c04000)" ),
+ "invalid constant FILETIME hexadecimal string" );
+
+static_assert(
+ fdatetime_test_cpp_string_buffer_equals(
+  fdatetime::posix_time<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED>( 0 ).to_string_buffer<LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS>(),
+  "Jan 01, 1970 00:00:00.000" ),
+ "invalid constant POSIX time string" );
+
+static_assert(
+ fdatetime::posix_time<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED>( 0x80000000UL ).to_string_buffer<LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME>().size() == 0,
+ "invalid constant unsupported POSIX time string" );
+
+static_assert(
+ fdatetime_test_cpp_string_buffer_equals(
+  fdatetime::posix_time<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED>( 0x80000000UL ).to_string_buffer<LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME>(),
+  "Jan 19, 2038 03:14:08" ),
+ "invalid constant unsigned POSIX time string" );
+
+static_assert(
+ fdatetime::hfs_time::get_maximum_string_size<LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE>() == 13,
+ "invalid HFS time maximum string size" );
+
+/* Compares the C++ and C string representations of a timestamp
+ * Returns 1 if successful or 0 if not
+ */
+template<uint32_t StringFormatFlags, typename TimestampType>
+int fdatetime_test_cpp_compare_strings(
+     const TimestampType &timestamp,
+     intptr_t *c_timestamp,
+     fdatetime_test_cpp_copy_to_utf8_string_t copy_to_utf8_string,
+     fdatetime_test_cpp_copy_to_utf16_string_t copy_to_utf16_string )
+{
+	fdatetime::basic_string_buffer<char, TimestampType::template get_maximum_string_size<StringFormatFlags>()> utf8_string_buffer;
+	fdatetime::basic_string_buffer<uint16_t, TimestampType::template get_maximum_string_size<StringFormatFlags>()> utf16_string_buffer;
+
+	uint16_t utf16_string[ 64 ] = { 0 };
+	uint8_t utf8_string[ 64 ]   = { 0 };
+
+	libcerror_error_t *error = NULL;
+	size_t string_length     = 0;
+	int result               = 0;
+
+	utf8_string_buffer = timestamp.template to_string_buffer<StringFormatFlags>();
+
+	result = copy_to_utf8_string(
+	          c_timestamp,
+	          utf8_string,
+	          64,
+	          StringFormatFlags,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = utf8_string_buffer.size();
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 narrow_string_length( (char *) utf8_string ) );
+
+	result = memory_compare(
+	          utf8_string_buffer.c_str(),
+	          utf8_string,
+	          string_length + 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 timestamp.template copy_to_string<StringFormatFlags>( (char *) utf8_string, string_length + 1 ),
+	 string_length + 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 timestamp.template copy_to_string<StringFormatFlags>( (char *) utf8_string, string_length ),
+	 (size_t) 0 );
+
+	utf16_string_buffer = timestamp.template to_string_buffer<StringFormatFlags, uint16_t>();
+
+	result = copy_to_utf16_string(
+	          c_timestamp,
+	          utf16_string,
+	          64,
+	          StringFormatFlags,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 utf16_string_buffer.size(),
+	 string_length );
+
+	result = memory_compare(
+	          utf16_string_buffer.c_str(),
+	          utf16_string,
+	          sizeof( uint16_t ) * ( string_length + 1 ) );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "string format flags: 0x%08" PRIx32 " C: %s C++: %s\n",
+	 StringFormatFlags,
+	 (char *) utf8_string,
+	 utf8_string_buffer.c_str() );
+
+	return( 0 );
+}
+
+/* A list of string format flags to compare
+ */
+template<uint32_t... StringFormatFlags>
+struct fdatetime_test_cpp_string_format_flags_list
+{
+	/* Compares the C++ and C string representations for all string format flags in the list
+	 * Returns 1 if successful or 0 if not
+	 */
+	template<typename TimestampType>
+	static int compare_strings(
+	            const TimestampType &timestamp,
+	            intptr_t *c_timestamp,
+	            fdatetime_test_cpp_copy_to_utf8_string_t copy_to_utf8_string,
+	            fdatetime_test_cpp_copy_to_utf16_string_t copy_to_utf16_string )
+	{
+		const int results[] = {
+			fdatetime_test_cpp_compare_strings<StringFormatFlags>(
+			 timestamp,
+			 c_timestamp,
+			 copy_to_utf8_string,
+			 copy_to_utf16_string )... };
+
+		for( int result : results )
+		{
+			if( result != 1 )
+			{
+				return( 0 );
+			}
+		}
+		return( 1 );
+	}
+};
+
+typedef fdatetime_test_cpp_string_format_flags_list<
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR > fdatetime_test_cpp_string_format_flags;
+
+/* Retrieves a pseudo random 64-bit value
+ */
+uint64_t fdatetime_test_cpp_get_random_value(
+          uint64_t *seed )
+{
+	/* xorshift64
+	 */
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 7;
+	*seed ^= *seed << 17;
+
+	return( *seed );
+}
+
+/* Tests the fdatetime::filetime type
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_cpp_filetime(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	uint64_t values[ 8 ] = {
+		0, 1, 0x01cb3a623d0a17ceULL, 0x0123456789abcdefULL, 0x24c85a5ed1c03fffULL,
+		0x24c85a5ed1c04000ULL, 0x7fffffffffffffffULL, 0xffffffffffffffffULL };
+
+	libcerror_error_t *error           = NULL;
+	libfdatetime_filetime_t *filetime  = NULL;
+	uint64_t seed                      = 0x0123456789abcdefULL;
+	uint64_t value_64bit               = 0;
+	int result                         = 0;
+	int value_index                    = 0;
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 fdatetime::filetime::from_byte_stream( byte_stream, LIBFDATETIME_ENDIAN_LITTLE ).get_value(),
+	 (uint64_t) 0x01cb3a623d0a17ceULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 fdatetime::filetime::from_byte_stream( byte_stream, LIBFDATETIME_ENDIAN_BIG ).get_value(),
+	 (uint64_t) 0xce170a3d623acb01ULL );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 1008;
+	     value_index++ )
+	{
+		if( value_index < 8 )
+		{
+			value_64bit = values[ value_index ];
+		}
+		else
+		{
+			/* Values between 1601 and 10000
+			 */
+			value_64bit = fdatetime_test_cpp_get_random_value( &seed ) % 0x24c85a5ed1c05000ULL;
+		}
+		result = libfdatetime_filetime_copy_from_64bit(
+		          filetime,
+		          value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fdatetime_test_cpp_string_format_flags::compare_strings(
+		          fdatetime::filetime( value_64bit ),
+		          filetime,
+		          &libfdatetime_filetime_copy_to_utf8_string,
+		          &libfdatetime_filetime_copy_to_utf16_string );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests a fdatetime::posix_time type
+ * Returns 1 if successful or 0 if not
+ */
+template<uint8_t ValueType>
+int fdatetime_test_cpp_posix_time_with_value_type(
+     uint64_t maximum_random_value )
+{
+	uint64_t boundary_values_32bit[ 3 ] = {
+		0x80000000UL, 0x7fffffffUL, 0x80000001UL };
+
+	uint64_t boundary_values_64bit[ 3 ] = {
+		0x8000000000000000ULL, 0x7fffffffffffffffULL, 0x8000000000000001ULL };
+
+	uint64_t values[ 9 ] = {
+		0, 1, 1700000000UL, 0x7fffffffUL, 0x80000001UL, 0xffffffffUL,
+		0x0000000100000000ULL, 0xfffffffffff00000ULL, 0xffffffffffffffffULL };
+
+	uint8_t byte_stream[ 8 ]              = { 0 };
+	char string[ 64 ]                     = { 0 };
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t boundary_value_64bit         = 0;
+	uint64_t seed                         = 0x0123456789abcdefULL;
+	uint64_t value_64bit                  = 0;
+	int result                            = 0;
+	int value_index                       = 0;
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the boundary values around the smallest signed value, of which
+	 * the C++ result must match the C result
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		if( fdatetime::posix_time<ValueType>::is_32bit )
+		{
+			boundary_value_64bit = boundary_values_32bit[ value_index ];
+
+			byte_stream[ 0 ] = (uint8_t) ( boundary_value_64bit >> 24 );
+			byte_stream[ 1 ] = (uint8_t) ( boundary_value_64bit >> 16 );
+			byte_stream[ 2 ] = (uint8_t) ( boundary_value_64bit >> 8 );
+			byte_stream[ 3 ] = (uint8_t) boundary_value_64bit;
+
+			result = libfdatetime_posix_time_copy_from_32bit(
+			          posix_time,
+			          (uint32_t) boundary_value_64bit,
+			          ValueType,
+			          &error );
+		}
+		else
+		{
+			boundary_value_64bit = boundary_values_64bit[ value_index ];
+
+			byte_stream[ 0 ] = (uint8_t) ( boundary_value_64bit >> 56 );
+			byte_stream[ 1 ] = (uint8_t) ( boundary_value_64bit >> 48 );
+			byte_stream[ 2 ] = (uint8_t) ( boundary_value_64bit >> 40 );
+			byte_stream[ 3 ] = (uint8_t) ( boundary_value_64bit >> 32 );
+			byte_stream[ 4 ] = (uint8_t) ( boundary_value_64bit >> 24 );
+			byte_stream[ 5 ] = (uint8_t) ( boundary_value_64bit >> 16 );
+			byte_stream[ 6 ] = (uint8_t) ( boundary_value_64bit >> 8 );
+			byte_stream[ 7 ] = (uint8_t) boundary_value_64bit;
+
+			result = libfdatetime_posix_time_copy_from_64bit(
+			          posix_time,
+			          boundary_value_64bit,
+			          ValueType,
+			          &error );
+		}
+		FDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "is_valid",
+		 (int) fdatetime::posix_time<ValueType>( boundary_value_64bit ).is_valid(),
+		 (int) ( result == 1 ) );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "is_valid",
+		 (int) fdatetime::posix_time<ValueType>::from_byte_stream( byte_stream, LIBFDATETIME_ENDIAN_BIG ).is_valid(),
+		 (int) ( result == 1 ) );
+
+		if( result == 1 )
+		{
+			FDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = fdatetime_test_cpp_string_format_flags::compare_strings(
+			          fdatetime::posix_time<ValueType>( boundary_value_64bit ),
+			          posix_time,
+			          &libfdatetime_posix_time_copy_to_utf8_string,
+			          &libfdatetime_posix_time_copy_to_utf16_string );
+
+			FDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		else
+		{
+			FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+			 "string_length",
+			 fdatetime::posix_time<ValueType>( boundary_value_64bit ).template to_string_buffer<LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME>().size(),
+			 (size_t) 0 );
+
+			FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+			 "string_length",
+			 fdatetime::posix_time<ValueType>( boundary_value_64bit ).template copy_to_string<LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME>( string, 64 ),
+			 (size_t) 0 );
+		}
+	}
+
+	for( value_index = 0;
+	     value_index < 1009;
+	     value_index++ )
+	{
+		if( value_index < 9 )
+		{
+			value_64bit = values[ value_index ];
+		}
+		else
+		{
+			value_64bit = fdatetime_test_cpp_get_random_value( &seed ) % maximum_random_value;
+
+			/* Include negative values
+			 */
+			if( ( value_index % 2 ) != 0 )
+			{
+				value_64bit = ~value_64bit;
+			}
+		}
+		if( fdatetime::posix_time<ValueType>::is_32bit )
+		{
+			value_64bit &= 0xffffffffUL;
+
+			/* The C functions do not support a signed 32-bit value of 0x80000000
+			 */
+			if( ( fdatetime::posix_time<ValueType>::is_signed )
+			 && ( value_64bit == 0x80000000UL ) )
+			{
+				continue;
+			}
+
+			result = libfdatetime_posix_time_copy_from_32bit(
+			          posix_time,
+			          (uint32_t) value_64bit,
+			          ValueType,
+			          &error );
+		}
+		else
+		{
+			result = libfdatetime_posix_time_copy_from_64bit(
+			          posix_time,
+			          value_64bit,
+			          ValueType,
+			          &error );
+		}
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fdatetime_test_cpp_string_format_flags::compare_strings(
+		          fdatetime::posix_time<ValueType>( value_64bit ),
+		          posix_time,
+		          &libfdatetime_posix_time_copy_to_utf8_string,
+		          &libfdatetime_posix_time_copy_to_utf16_string );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fdatetime::posix_time types
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_cpp_posix_time(
+     void )
+{
+	int result = 0;
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED>(
+	          0x80000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED>(
+	          0x80000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Limit the 64-bit seconds values to keep the run time of the reference implementation short
+	 */
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED>(
+	          0x0000010000000000ULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED>(
+	          0x0000010000000000ULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED>(
+	          0x0100000000000000ULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED>(
+	          0x0100000000000000ULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED>(
+	          0x7fffffffffffffffULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fdatetime_test_cpp_posix_time_with_value_type<LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED>(
+	          0x7fffffffffffffffULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the fdatetime::hfs_time type
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_cpp_hfs_time(
+     void )
+{
+	uint32_t values[ 4 ] = {
+		0, 1, 0x7fffffffUL, 0xffffffffUL };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_hfs_time_t *hfs_time = NULL;
+	uint64_t seed                     = 0x0123456789abcdefULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 1004;
+	     value_index++ )
+	{
+		if( value_index < 4 )
+		{
+			value_32bit = values[ value_index ];
+		}
+		else
+		{
+			value_32bit = (uint32_t) fdatetime_test_cpp_get_random_value( &seed );
+		}
+		result = libfdatetime_hfs_time_copy_from_32bit(
+		          hfs_time,
+		          value_32bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fdatetime_test_cpp_string_format_flags::compare_strings(
+		          fdatetime::hfs_time( value_32bit ),
+		          hfs_time,
+		          &libfdatetime_hfs_time_copy_to_utf8_string,
+		          &libfdatetime_hfs_time_copy_to_utf16_string );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FDATETIME_TEST_RUN(
+	 "fdatetime::filetime",
+	 fdatetime_test_cpp_filetime );
+
+	FDATETIME_TEST_RUN(
+	 "fdatetime::posix_time",
+	 fdatetime_test_cpp_posix_time );
+
+	FDATETIME_TEST_RUN(
+	 "fdatetime::hfs_time",
+	 fdatetime_test_cpp_hfs_time );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -568,6 +569,275 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfdatetime_date_time_values_copy_to_utf8_string_with_index function with the specialized string format flags
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_date_time_values_copy_to_utf8_string_with_index_specialized(
+     void )
+{
+	const char *expected_strings[ 4 ] = {
+		"2018-07-25T08:49:51.123456789Z",
+		"Jul 25, 2018 08:49:51.123",
+		"2018-07-25",
+		"Jul 25, 2018" };
+
+	uint32_t string_format_flags[ 4 ] = {
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE };
+
+	uint8_t utf8_string[ 48 ];
+
+	libcerror_error_t *error                          = NULL;
+	libfdatetime_date_time_values_t *date_time_values = NULL;
+	size_t expected_string_size                       = 0;
+	size_t string_index                               = 0;
+	int format_index                                  = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_date_time_values_initialize(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( format_index = 0;
+	     format_index < 4;
+	     format_index++ )
+	{
+		date_time_values->year          = 2018;
+		date_time_values->month         = 7;
+		date_time_values->day           = 25;
+		date_time_values->hours         = 8;
+		date_time_values->minutes       = 49;
+		date_time_values->seconds       = 51;
+		date_time_values->milli_seconds = 123;
+		date_time_values->micro_seconds = 456;
+		date_time_values->nano_seconds  = 789;
+
+		expected_string_size = narrow_string_length(
+		                        expected_strings[ format_index ] ) + 1;
+
+		/* Test regular cases
+		 */
+		result = libfdatetime_date_time_values_get_string_size(
+		          date_time_values,
+		          &string_index,
+		          string_format_flags[ format_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 expected_string_size );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_index = 4;
+
+		result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+		          date_time_values,
+		          utf8_string,
+		          4 + expected_string_size,
+		          &string_index,
+		          string_format_flags[ format_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 4 + expected_string_size );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          (char *) &( utf8_string[ 4 ] ),
+		          expected_strings[ format_index ],
+		          expected_string_size );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test error cases
+		 */
+		string_index = 4;
+
+		result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+		          date_time_values,
+		          utf8_string,
+		          4 + expected_string_size - 1,
+		          &string_index,
+		          string_format_flags[ format_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 (size_t) 4 );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Test with invalid date and time values
+		 */
+		date_time_values->year  = 2019;
+		date_time_values->month = 2;
+		date_time_values->day   = 29;
+
+		result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+		          date_time_values,
+		          utf8_string,
+		          48,
+		          &string_index,
+		          string_format_flags[ format_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		date_time_values->month = 13;
+		date_time_values->day   = 1;
+
+		result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+		          date_time_values,
+		          utf8_string,
+		          48,
+		          &string_index,
+		          string_format_flags[ format_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test with invalid time values
+	 */
+	date_time_values->month         = 7;
+	date_time_values->milli_seconds = 1000;
+
+	result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+	          date_time_values,
+	          utf8_string,
+	          48,
+	          &string_index,
+	          string_format_flags[ 1 ],
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	date_time_values->milli_seconds = 999;
+	date_time_values->nano_seconds  = 1000;
+
+	result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+	          date_time_values,
+	          utf8_string,
+	          48,
+	          &string_index,
+	          string_format_flags[ 0 ],
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_date_time_values_free(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( date_time_values != NULL )
+	{
+		libfdatetime_date_time_values_free(
+		 &date_time_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfdatetime_date_time_values_copy_to_utf16_string_with_index function
  * Returns 1 if successful or 0 if not
  */
@@ -882,48 +1152,821 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libfdatetime_date_time_values_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fdatetime_test_date_time_values_copy_from_utf8_string(
+     void )
 {
-	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
-	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t utf8_string[ 48 ];
+
+	const char *invalid_ctime_strings[ 12 ] = {
+		"Jam 14, 2010",
+		"Xyz 14, 2010",
+		"Sep 14 2010",
+		"Sep 14, 201",
+		"Sep 32, 2010",
+		"Feb 29, 2010",
+		"Sep 14, 2010 09:54",
+		"Sep 14, 2010 09:54:23.",
+		"Sep 14, 2010 09:54:23 GMT",
+		"Sep 14, 2010 09:54:23 UTC ",
+		"Sep 14, 2010 UTC 09:54:23",
+		"Sep 14, 2010T09:54:23" };
+
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_date_time_values_t parsed_date_time_values;
+	size_t string_index                              = 0;
+	int16_t timezone_offset                          = 0;
+	int result                                       = 0;
+	int string_number                                = 0;
+	uint8_t month                                    = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+	/* Test regular cases
+	 */
+	for( month = 1;
+	     month <= 12;
+	     month++ )
+	{
+		date_time_values.year          = 2010;
+		date_time_values.month         = month;
+		date_time_values.day           = 14;
+		date_time_values.hours         = 9;
+		date_time_values.minutes       = 54;
+		date_time_values.seconds       = 23;
+		date_time_values.milli_seconds = 123;
+		date_time_values.micro_seconds = 0;
+		date_time_values.nano_seconds  = 0;
+
+		string_index = 0;
+
+		result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+		          &date_time_values,
+		          utf8_string,
+		          48,
+		          &string_index,
+		          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		          &error );
 
-	FDATETIME_TEST_RUN(
-	 "libfdatetime_date_time_values_initialize",
-	 fdatetime_test_date_time_values_initialize );
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	FDATETIME_TEST_RUN(
-	 "libfdatetime_date_time_values_free",
-	 fdatetime_test_date_time_values_free );
+		/* The month string is matched case insensitive
+		 */
+		if( ( month % 2 ) == 0 )
+		{
+			utf8_string[ 0 ] |= 0x20;
+		}
+		else
+		{
+			utf8_string[ 1 ] &= 0xdf;
+			utf8_string[ 2 ] &= 0xdf;
+		}
+		result = libfdatetime_date_time_values_copy_from_utf8_string(
+		          &parsed_date_time_values,
+		          utf8_string,
+		          48,
+		          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+		          &timezone_offset,
+		          &error );
 
-	FDATETIME_TEST_RUN(
-	 "libfdatetime_date_time_values_get_string_size",
-	 fdatetime_test_date_time_values_get_string_size );
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "parsed_date_time_values.year",
+		 (int) parsed_date_time_values.year,
+		 2010 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "parsed_date_time_values.month",
+		 (int) parsed_date_time_values.month,
+		 (int) month );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "parsed_date_time_values.day",
+		 (int) parsed_date_time_values.day,
+		 14 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "parsed_date_time_values.seconds",
+		 (int) parsed_date_time_values.seconds,
+		 23 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "parsed_date_time_values.milli_seconds",
+		 (int) parsed_date_time_values.milli_seconds,
+		 123 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "timezone_offset",
+		 (int) timezone_offset,
+		 0 );
+	}
+	result = libfdatetime_date_time_values_copy_from_utf8_string(
+	          &parsed_date_time_values,
+	          (uint8_t *) "Feb 29, 2012 UTC",
+	          16,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &timezone_offset,
+	          &error );
 
-	FDATETIME_TEST_RUN(
-	 "libfdatetime_date_time_values_copy_to_utf8_string_with_index",
-	 fdatetime_test_date_time_values_copy_to_utf8_string_with_index );
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FDATETIME_TEST_RUN(
-	 "libfdatetime_date_time_values_copy_to_utf16_string_with_index",
-	 fdatetime_test_date_time_values_copy_to_utf16_string_with_index );
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FDATETIME_TEST_RUN(
-	 "libfdatetime_date_time_values_copy_to_utf32_string_with_index",
-	 fdatetime_test_date_time_values_copy_to_utf32_string_with_index );
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parsed_date_time_values.hours",
+	 (int) parsed_date_time_values.hours,
+	 0 );
+
+	result = libfdatetime_date_time_values_copy_from_utf8_string(
+	          &parsed_date_time_values,
+	          (uint8_t *) "2010-09-14T09:54:23-01:30",
+	          25,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          &timezone_offset,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "timezone_offset",
+	 (int) timezone_offset,
+	 -90 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_date_time_values_copy_from_utf8_string(
+	          NULL,
+	          utf8_string,
+	          48,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &timezone_offset,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_date_time_values_copy_from_utf8_string(
+	          &parsed_date_time_values,
+	          utf8_string,
+	          48,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( string_number = 0;
+	     string_number < 12;
+	     string_number++ )
+	{
+		result = libfdatetime_date_time_values_copy_from_utf8_string(
+		          &parsed_date_time_values,
+		          (uint8_t *) invalid_ctime_strings[ string_number ],
+		          narrow_string_length( invalid_ctime_strings[ string_number ] ),
+		          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+		          &timezone_offset,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_date_time_values_copy_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_date_time_values_copy_from_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 80 ];
+
+	const char *ctime_string                         = "Sep 14, 2010 09:54:23.123 UTC";
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_date_time_values_t date_time_values;
+	size_t string_index                              = 0;
+	int16_t timezone_offset                          = 0;
+	int result                                       = 0;
+
+	for( string_index = 0;
+	     string_index < 29;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = (uint16_t) ctime_string[ string_index ];
+	}
+	utf16_string[ 29 ] = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_date_time_values_copy_from_utf16_string(
+	          &date_time_values,
+	          utf16_string,
+	          80,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &timezone_offset,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "date_time_values.month",
+	 (int) date_time_values.month,
+	 9 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "date_time_values.milli_seconds",
+	 (int) date_time_values.milli_seconds,
+	 123 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_date_time_values_copy_from_utf16_string(
+	          &date_time_values,
+	          NULL,
+	          80,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &timezone_offset,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a string with a character that is not ASCII
+	 */
+	utf16_string[ 1 ] = 0x00e9;
+
+	result = libfdatetime_date_time_values_copy_from_utf16_string(
+	          &date_time_values,
+	          utf16_string,
+	          80,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &timezone_offset,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a string that exceeds the maximum parse string length
+	 */
+	utf16_string[ 1 ] = (uint16_t) 'e';
+
+	for( string_index = 25;
+	     string_index < 80;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = (uint16_t) '0';
+	}
+	result = libfdatetime_date_time_values_copy_from_utf16_string(
+	          &date_time_values,
+	          utf16_string,
+	          80,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &timezone_offset,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_date_time_values_get_number_of_seconds_since_1970 function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_date_time_values_get_number_of_seconds_since_1970(
+     void )
+{
+	uint16_t years[ 5 ] = {
+		1970, 2010, 1601, 1, 9999 };
+
+	uint8_t months[ 5 ] = {
+		1, 9, 1, 1, 12 };
+
+	uint8_t days[ 5 ] = {
+		1, 14, 1, 1, 31 };
+
+	int64_t expected_number_of_seconds[ 5 ] = {
+		0,
+		1284422400,
+		-11644473600,
+		-62135596800,
+		253402214400 };
+
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_date_time_values_t date_time_values;
+	int64_t number_of_seconds                        = 0;
+	int result                                       = 0;
+	int value_index                                  = 0;
+
+	date_time_values.hours         = 0;
+	date_time_values.minutes       = 0;
+	date_time_values.seconds       = 0;
+	date_time_values.milli_seconds = 0;
+	date_time_values.micro_seconds = 0;
+	date_time_values.nano_seconds  = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		date_time_values.year  = years[ value_index ];
+		date_time_values.month = months[ value_index ];
+		date_time_values.day   = days[ value_index ];
+
+		result = libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+		          &date_time_values,
+		          &number_of_seconds,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "number_of_seconds",
+		 number_of_seconds,
+		 expected_number_of_seconds[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	          NULL,
+	          &number_of_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.month = 13;
+
+	result = libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	          &date_time_values,
+	          &number_of_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_date_time_values_get_number_of_days_since_1970 function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_date_time_values_get_number_of_days_since_1970(
+     void )
+{
+	uint16_t years[ 6 ] = {
+		1970, 2021, 2016, 1601, 1, 9999 };
+
+	uint8_t months[ 6 ] = {
+		1, 1, 2, 1, 1, 12 };
+
+	uint8_t days[ 6 ] = {
+		1, 1, 29, 1, 1, 31 };
+
+	int64_t expected_number_of_days[ 6 ] = {
+		0,
+		18628,
+		16860,
+		-134774,
+		-719162,
+		2932896 };
+
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_date_time_values_t date_time_values;
+	int64_t number_of_days                           = 0;
+	int result                                       = 0;
+	int value_index                                  = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		date_time_values.year  = years[ value_index ];
+		date_time_values.month = months[ value_index ];
+		date_time_values.day   = days[ value_index ];
+
+		result = libfdatetime_date_time_values_get_number_of_days_since_1970(
+		          &date_time_values,
+		          &number_of_days,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "number_of_days",
+		 number_of_days,
+		 expected_number_of_days[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_date_time_values_get_number_of_days_since_1970(
+	          NULL,
+	          &number_of_days,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_date_time_values_get_number_of_days_since_1970(
+	          &date_time_values,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year  = 2019;
+	date_time_values.month = 2;
+	date_time_values.day   = 29;
+
+	result = libfdatetime_date_time_values_get_number_of_days_since_1970(
+	          &date_time_values,
+	          &number_of_days,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_date_time_values_set_calendar_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_date_time_values_set_calendar_values(
+     void )
+{
+	uint16_t years[ 10 ] = {
+		1970, 2021, 2024, 2020, 2016, 1601, 2008, 9999, 2010, 1 };
+
+	uint8_t months[ 10 ] = {
+		1, 1, 12, 12, 2, 1, 12, 12, 1, 1 };
+
+	uint8_t days[ 10 ] = {
+		1, 1, 30, 31, 29, 1, 29, 31, 3, 1 };
+
+	int64_t number_of_days[ 10 ] = {
+		0, 18628, 20087, 18627, 16860, -134774, 14242, 2932896, 14612, -719162 };
+
+	uint8_t expected_day_of_week[ 10 ] = {
+		4, 5, 1, 4, 1, 1, 1, 5, 0, 1 };
+
+	uint16_t expected_day_of_year[ 10 ] = {
+		1, 1, 365, 366, 60, 1, 364, 365, 3, 1 };
+
+	uint16_t expected_iso_week_year[ 10 ] = {
+		1970, 2020, 2025, 2020, 2016, 1601, 2009, 9999, 2009, 1 };
+
+	uint8_t expected_iso_week[ 10 ] = {
+		1, 53, 1, 53, 9, 1, 1, 52, 53, 1 };
+
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_date_time_values_t date_time_values;
+	int result                                       = 0;
+	int value_index                                  = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 10;
+	     value_index++ )
+	{
+		date_time_values.year  = years[ value_index ];
+		date_time_values.month = months[ value_index ];
+		date_time_values.day   = days[ value_index ];
+
+		result = libfdatetime_date_time_values_set_calendar_values(
+		          &date_time_values,
+		          number_of_days[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+		 "date_time_values.day_of_week",
+		 date_time_values.day_of_week,
+		 expected_day_of_week[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+		 "date_time_values.day_of_year",
+		 date_time_values.day_of_year,
+		 expected_day_of_year[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+		 "date_time_values.iso_week_year",
+		 date_time_values.iso_week_year,
+		 expected_iso_week_year[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+		 "date_time_values.iso_week",
+		 date_time_values.iso_week,
+		 expected_iso_week[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_date_time_values_set_calendar_values(
+	          NULL,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year  = 2019;
+	date_time_values.month = 13;
+	date_time_values.day   = 1;
+
+	result = libfdatetime_date_time_values_set_calendar_values(
+	          &date_time_values,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_initialize",
+	 fdatetime_test_date_time_values_initialize );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_free",
+	 fdatetime_test_date_time_values_free );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_get_string_size",
+	 fdatetime_test_date_time_values_get_string_size );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_copy_to_utf8_string_with_index",
+	 fdatetime_test_date_time_values_copy_to_utf8_string_with_index );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_copy_to_utf8_string_with_index (specialized)",
+	 fdatetime_test_date_time_values_copy_to_utf8_string_with_index_specialized );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_copy_to_utf16_string_with_index",
+	 fdatetime_test_date_time_values_copy_to_utf16_string_with_index );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_copy_to_utf32_string_with_index",
+	 fdatetime_test_date_time_values_copy_to_utf32_string_with_index );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_copy_from_utf8_string",
+	 fdatetime_test_date_time_values_copy_from_utf8_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_copy_from_utf16_string",
+	 fdatetime_test_date_time_values_copy_from_utf16_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_get_number_of_seconds_since_1970",
+	 fdatetime_test_date_time_values_get_number_of_seconds_since_1970 );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_get_number_of_days_since_1970",
+	 fdatetime_test_date_time_values_get_number_of_days_since_1970 );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_date_time_values_set_calendar_values",
+	 fdatetime_test_date_time_values_set_calendar_values );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
@@ -0,0 +1,1885 @@
+/*
+ * Library differential verification testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_calendar.h"
+#include "../libfdatetime/libfdatetime_date_time_values.h"
+#include "../libfdatetime/libfdatetime_fat_date_time.h"
+#include "../libfdatetime/libfdatetime_filetime.h"
+#include "../libfdatetime/libfdatetime_floatingtime.h"
+#include "../libfdatetime/libfdatetime_hfs_time.h"
+#include "../libfdatetime/libfdatetime_nsf_timedate.h"
+#include "../libfdatetime/libfdatetime_posix_time.h"
+#include "../libfdatetime/libfdatetime_sort.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* The number of values of every case that is verified by default
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_SAMPLE_VALUES	65536
+
+/* The default number of values of every random case that is verified in exhaustive mode
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_RANDOM_VALUES	( (uint64_t) 1 << 30 )
+
+/* The number of values of every exhaustive case, which covers all 32-bit values
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_32BIT_VALUES	( (uint64_t) 1 << 32 )
+
+/* The maximum number of threads
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The maximum number of mismatches reported per thread
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_REPORTS	4
+
+/* The size of the strings
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE			64
+
+/* The multiplier used to spread the sample values over all 32-bit values
+ * it is odd, hence the multiplication is a bijection of the 32-bit values
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_SAMPLE_MULTIPLIER		0x9e3779b1UL
+
+/* The FILETIME of January 1, 10000 00:00:00, which is the first value that
+ * cannot be represented as date time values
+ */
+#define FDATETIME_TEST_DIFFERENTIAL_FILETIME_YEAR_10000		0x24c85a5ed1c04000ULL
+
+enum FDATETIME_TEST_DIFFERENTIAL_CASES
+{
+	FDATETIME_TEST_DIFFERENTIAL_CASE_FAT_DATE_TIME,
+	FDATETIME_TEST_DIFFERENTIAL_CASE_HFS_TIME,
+	FDATETIME_TEST_DIFFERENTIAL_CASE_POSIX_TIME_32BIT_SIGNED,
+	FDATETIME_TEST_DIFFERENTIAL_CASE_POSIX_TIME_32BIT_UNSIGNED,
+	FDATETIME_TEST_DIFFERENTIAL_CASE_FILETIME,
+	FDATETIME_TEST_DIFFERENTIAL_CASE_NSF_TIMEDATE,
+	FDATETIME_TEST_DIFFERENTIAL_CASE_FLOATINGTIME,
+
+	FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_CASES
+};
+
+typedef struct fdatetime_test_differential_case fdatetime_test_differential_case_t;
+
+struct fdatetime_test_differential_case
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The timestamp type
+	 */
+	int timestamp_type;
+
+	/* Value to indicate all 32-bit values are verified in exhaustive mode
+	 * otherwise pseudo random values are verified
+	 */
+	uint8_t is_exhaustive;
+
+	/* The maximum difference between the sort key and the reference sort key
+	 */
+	int64_t sort_key_tolerance;
+
+	/* The boundary values, which are verified in every mode
+	 */
+	const uint64_t *boundary_values;
+
+	/* The number of boundary values
+	 */
+	uint64_t number_of_boundary_values;
+};
+
+typedef struct fdatetime_test_differential_worker fdatetime_test_differential_worker_t;
+
+struct fdatetime_test_differential_worker
+{
+	/* The case
+	 */
+	const fdatetime_test_differential_case_t *test_case;
+
+	/* The index of the first value
+	 */
+	uint64_t first_value_index;
+
+	/* The number of values
+	 */
+	uint64_t number_of_values;
+
+	/* The multiplier of the value index of an exhaustive case
+	 */
+	uint32_t value_multiplier;
+
+	/* The state of the pseudo random values of a random case
+	 */
+	uint64_t random_state;
+
+	/* The values to verify instead of the values of the case
+	 */
+	const uint64_t *values;
+
+	/* The number of mismatches
+	 */
+	uint64_t number_of_mismatches;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* The POSIX time boundary values: around the smallest signed value and
+ * Dec 31, 1999 00:00:00, Dec 31, 1999 23:59:59 and Jan 1, 2000 00:00:00
+ */
+static const uint64_t fdatetime_test_differential_posix_time_boundary_values[ 7 ] = {
+	0x7fffffffUL, 0x80000000UL, 0x80000001UL, 0xffffffffUL,
+	0x386bf200UL, 0x386d437fUL, 0x386d4380UL };
+
+/* The FILETIME boundary values: Dec 31, 1699 00:00:00, Dec 31, 1699 23:59:59.9999999,
+ * Jan 1, 1700 00:00:00 and the last value before Jan 1, 10000
+ */
+static const uint64_t fdatetime_test_differential_filetime_boundary_values[ 4 ] = {
+	0x006efd14845c8000ULL, 0x006efdddaec63fffULL, 0x006efdddaec64000ULL,
+	FDATETIME_TEST_DIFFERENTIAL_FILETIME_YEAR_10000 - 1 };
+
+/* The floatingtime boundary values, as the IEEE 754 representation of:
+ * -0.25, -1.0, -1.5, 36525.0 (Dec 31, 1999), 36526.0 (Jan 1, 2000) and -693959.0 (Jan 1, 0000)
+ */
+static const uint64_t fdatetime_test_differential_floatingtime_boundary_values[ 6 ] = {
+	0xbfd0000000000000ULL, 0xbff0000000000000ULL, 0xbff8000000000000ULL,
+	0x40e1d5a000000000ULL, 0x40e1d5c000000000ULL, 0xc1252d8e00000000ULL };
+
+/* The floatingtime sort key is determined from the fraction of the day directly,
+ * while the calendar decoder truncates hours, minutes, seconds and fractions of
+ * seconds in turn, each of which can lose a digit to floating-point rounding
+ */
+static const fdatetime_test_differential_case_t fdatetime_test_differential_cases[ FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_CASES ] = {
+	{ "fat_date_time", LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME, 1, 0, NULL, 0 },
+	{ "hfs_time", LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME, 1, 0, NULL, 0 },
+	{ "posix_time_32bit_signed", LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME, 1, 0, fdatetime_test_differential_posix_time_boundary_values, 7 },
+	{ "posix_time_32bit_unsigned", LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME, 1, 0, fdatetime_test_differential_posix_time_boundary_values, 7 },
+	{ "filetime", LIBFDATETIME_TIMESTAMP_TYPE_FILETIME, 0, 0, fdatetime_test_differential_filetime_boundary_values, 4 },
+	{ "nsf_timedate", LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE, 0, 0, NULL, 0 },
+	{ "floatingtime", LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME, 0, 10000, fdatetime_test_differential_floatingtime_boundary_values, 6 } };
+
+static const char fdatetime_test_differential_month_strings[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+static uint64_t fdatetime_test_differential_get_random_value(
+                 uint64_t *random_state )
+{
+	*random_state ^= *random_state << 13;
+	*random_state ^= *random_state >> 7;
+	*random_state ^= *random_state << 17;
+
+	return( *random_state );
+}
+
+/* Reports a mismatch
+ */
+void fdatetime_test_differential_report_mismatch(
+      fdatetime_test_differential_worker_t *worker,
+      uint64_t value,
+      const char *description )
+{
+	if( worker->number_of_mismatches < FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_REPORTS )
+	{
+		fprintf(
+		 stdout,
+		 "%s: mismatch for value: 0x%016" PRIx64 " (%s).\n",
+		 worker->test_case->name,
+		 value,
+		 description );
+	}
+	worker->number_of_mismatches += 1;
+}
+
+/* Determines if two date time values are equal
+ * Returns 1 if equal or 0 if not
+ */
+int fdatetime_test_differential_date_time_values_are_equal(
+     libfdatetime_date_time_values_t *first_date_time_values,
+     libfdatetime_date_time_values_t *second_date_time_values )
+{
+	if( ( first_date_time_values->year != second_date_time_values->year )
+	 || ( first_date_time_values->month != second_date_time_values->month )
+	 || ( first_date_time_values->day != second_date_time_values->day )
+	 || ( first_date_time_values->hours != second_date_time_values->hours )
+	 || ( first_date_time_values->minutes != second_date_time_values->minutes )
+	 || ( first_date_time_values->seconds != second_date_time_values->seconds )
+	 || ( first_date_time_values->milli_seconds != second_date_time_values->milli_seconds )
+	 || ( first_date_time_values->micro_seconds != second_date_time_values->micro_seconds )
+	 || ( first_date_time_values->nano_seconds != second_date_time_values->nano_seconds ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Converts a POSIX time into date time values
+ * This is a frozen copy of the original loop based decoder of the library, which serves
+ * as the reference of the POSIX time decoder, and must not be changed
+ * It treats the top bit as the sign regardless of the value type and returns day 0 for
+ * Dec 31, 1999, such values are outside the domain of the reference
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_differential_reference_posix_time_copy_to_date_time_values(
+     libfdatetime_internal_posix_time_t *internal_posix_time,
+     libfdatetime_date_time_values_t *date_time_values )
+{
+	uint64_t posix_timestamp = 0;
+	uint64_t remaining_years = 0;
+	uint32_t days_in_century = 0;
+	uint16_t days_in_year    = 0;
+	uint8_t days_in_month    = 0;
+	uint8_t is_signed        = 0;
+
+	if( internal_posix_time == NULL )
+	{
+		return( -1 );
+	}
+	if( ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	 && ( internal_posix_time->value_type != LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		return( -1 );
+	}
+	if( date_time_values == NULL )
+	{
+		return( -1 );
+	}
+	posix_timestamp = internal_posix_time->timestamp;
+
+	if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED ) )
+	{
+		is_signed = (uint8_t) ( posix_timestamp >> 31 );
+
+		if( is_signed != 0 )
+		{
+			if( ( posix_timestamp & 0x7fffffffUL ) == 0 )
+			{
+				return( -1 );
+			}
+			posix_timestamp = -( (int32_t) posix_timestamp );
+		}
+	}
+	else if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED )
+	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED )
+	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	      || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		is_signed = (uint8_t) ( posix_timestamp >> 63 );
+
+		if( is_signed != 0 )
+		{
+#if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
+			if( ( posix_timestamp & 0x7fffffffffffffffUL ) == 0 )
+#else
+			if( ( posix_timestamp & 0x7fffffffffffffffULL ) == 0 )
+#endif
+			{
+				return( -1 );
+			}
+			posix_timestamp = -( (int64_t) posix_timestamp );
+		}
+	}
+        date_time_values->nano_seconds = 0;
+
+	if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		/* The timestamp is in units of nano seconds correct the value to seconds
+		 */
+		date_time_values->nano_seconds = posix_timestamp % 1000;
+		posix_timestamp /= 1000;
+
+		if( ( is_signed != 0 )
+		 && ( date_time_values->nano_seconds > 0 ) )
+		{
+			date_time_values->nano_seconds = 999 - date_time_values->nano_seconds;
+		}
+	}
+	if( ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+	 || ( internal_posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+	{
+		/* The timestamp is in units of micro seconds correct the value to seconds
+		 */
+		date_time_values->micro_seconds = posix_timestamp % 1000;
+		posix_timestamp /= 1000;
+
+		if( ( is_signed != 0 )
+		 && ( date_time_values->micro_seconds > 0 ) )
+		{
+			date_time_values->micro_seconds = 999 - date_time_values->micro_seconds;
+		}
+		date_time_values->milli_seconds = posix_timestamp % 1000;
+		posix_timestamp /= 1000;
+
+		if( ( is_signed != 0 )
+		 && ( date_time_values->milli_seconds > 0 ) )
+		{
+			date_time_values->milli_seconds = 999 - date_time_values->milli_seconds;
+		}
+	}
+	else
+	{
+	        date_time_values->micro_seconds = 0;
+	        date_time_values->milli_seconds = 0;
+	}
+	if( is_signed != 0 )
+	{
+		posix_timestamp -= 1;
+	}
+	/* There are 60 seconds in a minute correct the value to minutes
+	 */
+	date_time_values->seconds = posix_timestamp % 60;
+	posix_timestamp          /= 60;
+
+	if( ( is_signed != 0 )
+	 && ( date_time_values->seconds > 0 ) )
+	{
+		date_time_values->seconds = 59 - date_time_values->seconds;
+	}
+	/* There are 60 minutes in an hour correct the value to hours
+	 */
+	date_time_values->minutes = posix_timestamp % 60;
+	posix_timestamp          /= 60;
+
+	if( ( is_signed != 0 )
+	 && ( date_time_values->minutes > 0 ) )
+	{
+		date_time_values->minutes = 59 - date_time_values->minutes;
+	}
+	/* There are 24 hours in a day correct the value to days
+	 */
+	date_time_values->hours = posix_timestamp % 24;
+	posix_timestamp        /= 24;
+
+	if( ( is_signed != 0 )
+	 && ( date_time_values->hours > 0 ) )
+	{
+		date_time_values->hours = 23 - date_time_values->hours;
+	}
+	/* Determine the number of years starting at 'Jan 1, 1970 00:00:00'
+	 * correct the value to days within the year
+	 */
+	if( is_signed == 0 )
+	{
+		/* Add 1 day to compensate that Jan 1, 1970 is represented as 0
+		 */
+		posix_timestamp += 1;
+
+		if( posix_timestamp >= 10957 )
+		{
+			date_time_values->year = 2000;
+
+			posix_timestamp -= 10957;
+		}
+		else
+		{
+			date_time_values->year = 1970;
+		}
+	}
+	else
+	{
+		date_time_values->year = 1969;
+	}
+	remaining_years = posix_timestamp % 100;
+
+	while( remaining_years > 0 )
+	{
+		/* Check for a leap year
+		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+		 */
+		if( ( ( ( date_time_values->year % 4 ) == 0 )
+		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+		 || ( ( date_time_values->year % 400 ) == 0 ) )
+		{
+			days_in_year = 366;
+		}
+		else
+		{
+			days_in_year = 365;
+		}
+		if( posix_timestamp <= days_in_year )
+		{
+			break;
+		}
+		posix_timestamp -= days_in_year;
+
+		if( is_signed == 0 )
+		{
+			date_time_values->year += 1;
+		}
+		else
+		{
+			date_time_values->year -= 1;
+		}
+		remaining_years -= 1;
+	}
+	while( posix_timestamp > 0 )
+	{
+		/* Check for a leap year
+		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+		 */
+		if( ( ( ( date_time_values->year % 4 ) == 0 )
+		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+		 || ( ( date_time_values->year % 400 ) == 0 ) )
+		{
+			days_in_century = 36525;
+		}
+		else
+		{
+			days_in_century = 36524;
+		}
+		if( posix_timestamp <= days_in_century )
+		{
+			break;
+		}
+		posix_timestamp -= days_in_century;
+
+		if( is_signed == 0 )
+		{
+			date_time_values->year += 100;
+		}
+		else
+		{
+			date_time_values->year -= 100;
+		}
+	}
+	while( posix_timestamp > 0 )
+	{
+		/* Check for a leap year
+		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+		 */
+		if( ( ( ( date_time_values->year % 4 ) == 0 )
+		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+		 || ( ( date_time_values->year % 400 ) == 0 ) )
+		{
+			days_in_year = 366;
+		}
+		else
+		{
+			days_in_year = 365;
+		}
+		if( posix_timestamp <= days_in_year )
+		{
+			break;
+		}
+		posix_timestamp -= days_in_year;
+
+		if( is_signed == 0 )
+		{
+			date_time_values->year += 1;
+		}
+		else
+		{
+			date_time_values->year -= 1;
+		}
+	}
+	/* Determine the month correct the value to days within the month
+	 */
+	if( is_signed == 0 )
+	{
+		date_time_values->month = 1;
+	}
+	else
+	{
+		date_time_values->month = 12;
+	}
+	do
+	{
+		/* February (2)
+		 */
+		if( date_time_values->month == 2 )
+		{
+			if( ( ( ( date_time_values->year % 4 ) == 0 )
+			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+			 || ( ( date_time_values->year % 400 ) == 0 ) )
+			{
+				days_in_month = 29;
+			}
+			else
+			{
+				days_in_month = 28;
+			}
+		}
+		/* April (4), June (6), September (9), November (11)
+		 */
+		else if( ( date_time_values->month == 4 )
+		      || ( date_time_values->month == 6 )
+		      || ( date_time_values->month == 9 )
+		      || ( date_time_values->month == 11 ) )
+		{
+			days_in_month = 30;
+		}
+		/* January (1), March (3), May (5), July (7), August (8), October (10), December (12)
+		 */
+		else if( ( date_time_values->month == 1 )
+		      || ( date_time_values->month == 3 )
+		      || ( date_time_values->month == 5 )
+		      || ( date_time_values->month == 7 )
+		      || ( date_time_values->month == 8 )
+		      || ( date_time_values->month == 10 )
+		      || ( date_time_values->month == 12 ) )
+		{
+			days_in_month = 31;
+		}
+		/* This should never happen, but just in case
+		 */
+		else
+		{
+			return( -1 );
+		}
+		if( posix_timestamp <= days_in_month )
+		{
+			break;
+		}
+		posix_timestamp -= days_in_month;
+
+		if( is_signed == 0 )
+		{
+			date_time_values->month += 1;
+		}
+		else
+		{
+			date_time_values->month -= 1;
+		}
+	}
+	while( posix_timestamp > 0 );
+
+	/* Determine the day
+	 */
+	date_time_values->day = (uint8_t) posix_timestamp;
+
+	if( is_signed != 0 )
+	{
+		date_time_values->day = days_in_month - date_time_values->day;
+	}
+	return( 1 );
+}
+
+
+/* Converts a floatingtime into date time values
+ * This is a frozen copy of the original loop based decoder of the library, which serves
+ * as the reference of the floatingtime decoder, and must not be changed
+ * It does not support negative values and returns month 13 for a whole number of days at
+ * the end of a year, such values are outside the domain of the reference
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_differential_reference_floatingtime_copy_to_date_time_values(
+     libfdatetime_internal_floatingtime_t *internal_floatingtime,
+     libfdatetime_date_time_values_t *date_time_values )
+{
+	double floatingtimestamp = 0;
+	uint32_t days_in_century = 0;
+	uint16_t days_in_year    = 0;
+	uint8_t days_in_month    = 0;
+
+	if( internal_floatingtime == NULL )
+	{
+		return( -1 );
+	}
+	if( date_time_values == NULL )
+	{
+		return( -1 );
+	}
+	floatingtimestamp = internal_floatingtime->timestamp.floating_point;
+
+	if( ( floatingtimestamp <= -3650000.0 )
+	 || ( floatingtimestamp >= 3650000.0 ) )
+	{
+		return( -1 );
+	}
+	/* Determine the number of years starting at '30 Dec 1899 00:00:00'
+	 * correct the value to days within the year
+	 */
+	date_time_values->year  = 1899;
+	date_time_values->month = 12;
+	date_time_values->day   = 30;
+
+	if( floatingtimestamp >= 2.0 )
+	{
+		date_time_values->year  = 1900;
+		date_time_values->month = 1;
+		date_time_values->day   = 1;
+
+		floatingtimestamp -= 2.0;
+	}
+	while( floatingtimestamp > 0.0 )
+	{
+		if( ( date_time_values->year % 400 ) == 0 )
+		{
+			days_in_century = 36525;
+		}
+		else
+		{
+			days_in_century = 36524;
+		}
+		if( floatingtimestamp <= days_in_century )
+		{
+			break;
+		}
+		floatingtimestamp -= days_in_century;
+
+		date_time_values->year += 100;
+	}
+	while( floatingtimestamp > 0.0 )
+	{
+		/* Check for a leap year
+		 * The year is ( ( dividable by 4 ) and ( not dividable by 100 ) ) or ( dividable by 400 )
+		 */
+		if( ( ( ( date_time_values->year % 4 ) == 0 )
+		  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+		 || ( ( date_time_values->year % 400 ) == 0 ) )
+		{
+			days_in_year = 366;
+		}
+		else
+		{
+			days_in_year = 365;
+		}
+		if( floatingtimestamp <= days_in_year )
+		{
+			break;
+		}
+		floatingtimestamp -= days_in_year;
+
+		date_time_values->year += 1;
+	}
+	if( date_time_values->year > 9999 )
+	{
+		return( -1 );
+	}
+	/* Determine the month correct the value to days within the month
+	 */
+	while( floatingtimestamp > 0.0 )
+	{
+		/* February (2)
+		 */
+		if( date_time_values->month == 2 )
+		{
+			if( ( ( ( date_time_values->year % 4 ) == 0 )
+			  &&  ( ( date_time_values->year % 100 ) != 0 ) )
+			 || ( ( date_time_values->year % 400 ) == 0 ) )
+			{
+				days_in_month = 29;
+			}
+			else
+			{
+				days_in_month = 28;
+			}
+		}
+		/* April (4), June (6), September (9), November (11)
+		 */
+		else if( ( date_time_values->month == 4 )
+		      || ( date_time_values->month == 6 )
+		      || ( date_time_values->month == 9 )
+		      || ( date_time_values->month == 11 ) )
+		{
+			days_in_month = 30;
+		}
+		/* January (1), March (3), May (5), July (7), August (8), October (10), December (12)
+		 */
+		else if( ( date_time_values->month == 1 )
+		      || ( date_time_values->month == 3 )
+		      || ( date_time_values->month == 5 )
+		      || ( date_time_values->month == 7 )
+		      || ( date_time_values->month == 8 )
+		      || ( date_time_values->month == 10 )
+		      || ( date_time_values->month == 12 ) )
+		{
+			days_in_month = 31;
+		}
+		/* This should never happen, but just in case
+		 */
+		else
+		{
+			return( -1 );
+		}
+		if( floatingtimestamp < days_in_month )
+		{
+			break;
+		}
+		floatingtimestamp -= days_in_month;
+
+		date_time_values->month += 1;
+	}
+	/* Determine the day
+	 */
+	date_time_values->day += (uint8_t) floatingtimestamp;
+	floatingtimestamp     -= (int) floatingtimestamp;
+
+	/* There are 24 hours in a day correct the value to hours
+	 */
+	floatingtimestamp      *= 24.0;
+	date_time_values->hours = (uint8_t) floatingtimestamp;
+	floatingtimestamp      -= date_time_values->hours;
+
+	/* There are 60 minutes in an hour correct the value to minutes
+	 */
+	floatingtimestamp        *= 60.0;
+	date_time_values->minutes = (uint8_t) floatingtimestamp;
+	floatingtimestamp        -= date_time_values->minutes;
+
+	/* There are 60 seconds in a minute correct the value to seconds
+	 */
+	floatingtimestamp        *= 60.0;
+	date_time_values->seconds = (uint8_t) floatingtimestamp;
+	floatingtimestamp        -= date_time_values->seconds;
+
+	/* There are 1000 milli seconds in a seconds correct the value to milli seconds
+	 */
+	floatingtimestamp              *= 1000.0;
+	date_time_values->milli_seconds = (uint16_t) floatingtimestamp;
+	floatingtimestamp              -= date_time_values->milli_seconds;
+
+	/* There are 1000 micro seconds in a seconds correct the value to micro seconds
+	 */
+	floatingtimestamp              *= 1000.0;
+	date_time_values->micro_seconds = (uint16_t) floatingtimestamp;
+	floatingtimestamp              -= date_time_values->micro_seconds;
+
+	/* There are 1000 nano seconds in a seconds correct the value to nano seconds
+	 */
+	floatingtimestamp             *= 1000.0;
+	date_time_values->nano_seconds = (uint16_t) floatingtimestamp;
+
+	return( 1 );
+}
+
+
+/* Verifies the specialized string functions against the generic string function
+ * and a reference string of the date time values
+ * Returns 1 if successful, 0 on mismatch or -1 on error
+ */
+int fdatetime_test_differential_verify_strings(
+     libfdatetime_date_time_values_t *date_time_values )
+{
+	char reference_string[ FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE ];
+	uint8_t generic_string[ FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE ];
+	uint8_t specialized_string[ FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE ];
+
+	size_t generic_string_index     = 0;
+	size_t specialized_string_index = 0;
+	int generic_result              = 0;
+	int specialized_result          = 0;
+
+	/* The ISO 8601 date time nano seconds with timezone indicator format is handled
+	 * by a specialized string function, with micro seconds it is handled by the generic function
+	 */
+	specialized_result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+	                      date_time_values,
+	                      specialized_string,
+	                      FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE,
+	                      &specialized_string_index,
+	                      LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	                      NULL );
+
+	generic_result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+	                  date_time_values,
+	                  generic_string,
+	                  FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE,
+	                  &generic_string_index,
+	                  LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	                  NULL );
+
+	if( ( specialized_result == -1 )
+	 || ( generic_result == -1 ) )
+	{
+		return( -1 );
+	}
+	if( specialized_result != generic_result )
+	{
+		return( 0 );
+	}
+	if( specialized_result == 0 )
+	{
+		return( 1 );
+	}
+	narrow_string_snprintf(
+	 reference_string,
+	 FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE,
+	 "%04" PRIu16 "-%02" PRIu8 "-%02" PRIu8 "T%02" PRIu8 ":%02" PRIu8 ":%02" PRIu8 ".%03" PRIu16 "%03" PRIu16 "%03" PRIu16 "Z",
+	 date_time_values->year,
+	 date_time_values->month,
+	 date_time_values->day,
+	 date_time_values->hours,
+	 date_time_values->minutes,
+	 date_time_values->seconds,
+	 date_time_values->milli_seconds,
+	 date_time_values->micro_seconds,
+	 date_time_values->nano_seconds );
+
+	if( ( specialized_string_index != 31 )
+	 || ( memory_compare( specialized_string, reference_string, 31 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( generic_string_index != 28 )
+	 || ( memory_compare( generic_string, reference_string, 26 ) != 0 )
+	 || ( generic_string[ 26 ] != (uint8_t) 'Z' )
+	 || ( generic_string[ 27 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	/* The ctime date time milli seconds format is handled by a specialized string function,
+	 * with micro seconds it is handled by the generic function
+	 */
+	specialized_string_index = 0;
+	generic_string_index     = 0;
+
+	specialized_result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+	                      date_time_values,
+	                      specialized_string,
+	                      FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE,
+	                      &specialized_string_index,
+	                      LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	                      NULL );
+
+	generic_result = libfdatetime_date_time_values_copy_to_utf8_string_with_index(
+	                  date_time_values,
+	                  generic_string,
+	                  FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE,
+	                  &generic_string_index,
+	                  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS,
+	                  NULL );
+
+	if( ( specialized_result != 1 )
+	 || ( generic_result != 1 ) )
+	{
+		return( 0 );
+	}
+	narrow_string_snprintf(
+	 reference_string,
+	 FDATETIME_TEST_DIFFERENTIAL_STRING_SIZE,
+	 "%.3s %02" PRIu8 ", %04" PRIu16 " %02" PRIu8 ":%02" PRIu8 ":%02" PRIu8 ".%03" PRIu16 "%03" PRIu16,
+	 &( fdatetime_test_differential_month_strings[ ( date_time_values->month - 1 ) * 3 ] ),
+	 date_time_values->day,
+	 date_time_values->year,
+	 date_time_values->hours,
+	 date_time_values->minutes,
+	 date_time_values->seconds,
+	 date_time_values->milli_seconds,
+	 date_time_values->micro_seconds );
+
+	if( ( specialized_string_index != 26 )
+	 || ( memory_compare( specialized_string, reference_string, 25 ) != 0 )
+	 || ( specialized_string[ 25 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( generic_string_index != 29 )
+	 || ( memory_compare( generic_string, reference_string, 29 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Converts a POSIX time into a FILETIME
+ * The conversion is done independently of the POSIX time functions of the library
+ * and serves as the reference for the POSIX times outside the domain of the frozen decoder
+ * Returns 1 if successful or 0 if the POSIX time cannot be represented before Jan 1, 10000
+ */
+int fdatetime_test_differential_reference_posix_time_copy_to_filetime(
+     libfdatetime_internal_posix_time_t *posix_time,
+     libfdatetime_internal_filetime_t *filetime )
+{
+	int64_t number_of_seconds = 0;
+	int64_t number_of_units   = 0;
+	int64_t remainder         = 0;
+	int64_t units_per_second  = 1;
+	uint64_t filetime_value   = 0;
+
+	switch( posix_time->value_type )
+	{
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED:
+			number_of_units = (int64_t) ( (int32_t) ( posix_time->timestamp & 0xffffffffUL ) );
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED:
+			number_of_units = (int64_t) ( posix_time->timestamp & 0xffffffffUL );
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED:
+			number_of_units = (int64_t) posix_time->timestamp;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED:
+			number_of_units  = (int64_t) posix_time->timestamp;
+			units_per_second = 1000000;
+			break;
+
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED:
+			number_of_units  = (int64_t) posix_time->timestamp;
+			units_per_second = 1000000000;
+			break;
+
+		/* An unsigned 64-bit value beyond the maximum signed value is beyond Jan 1, 10000
+		 */
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED:
+		case LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED:
+			if( posix_time->timestamp > (uint64_t) INT64_MAX )
+			{
+				return( 0 );
+			}
+			number_of_units = (int64_t) posix_time->timestamp;
+
+			if( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED )
+			{
+				units_per_second = 1000000;
+			}
+			else if( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED )
+			{
+				units_per_second = 1000000000;
+			}
+			break;
+
+		default:
+			return( 0 );
+	}
+	number_of_seconds = number_of_units / units_per_second;
+	remainder         = number_of_units % units_per_second;
+
+	if( remainder < 0 )
+	{
+		number_of_seconds -= 1;
+		remainder         += units_per_second;
+	}
+	/* Jan 1, 1601 is 11644473600 seconds before Jan 1, 1970 and
+	 * Jan 1, 10000 is 253402300800 seconds after Jan 1, 1970
+	 */
+	if( ( number_of_seconds < -11644473600LL )
+	 || ( number_of_seconds >= 253402300800LL ) )
+	{
+		return( 0 );
+	}
+	filetime_value = ( (uint64_t) ( number_of_seconds + 11644473600LL ) * 10000000 )
+	               + (uint64_t) ( ( remainder * 10000000 ) / units_per_second );
+
+	filetime->lower = (uint32_t) ( filetime_value & 0xffffffffUL );
+	filetime->upper = (uint32_t) ( filetime_value >> 32 );
+
+	return( 1 );
+}
+
+/* Retrieves the reference date time values of a timestamp
+ * The POSIX time and floatingtime references are the frozen copies of the original
+ * decoders, the other timestamp types are decoded by the calendar decoders of the library
+ * A POSIX time outside the domain of its reference is converted into a FILETIME by
+ * epoch arithmetic, which is decoded by the FILETIME decoder instead
+ * Returns 1 if successful or 0 if the timestamp is outside the domain of the reference
+ */
+int fdatetime_test_differential_get_reference_date_time_values(
+     int timestamp_type,
+     intptr_t *timestamp,
+     libfdatetime_date_time_values_t *reference_date_time_values )
+{
+	libfdatetime_internal_filetime_t filetime;
+
+	libfdatetime_internal_posix_time_t *posix_time = NULL;
+	int64_t number_of_seconds                      = 0;
+	double floatingtimestamp                       = 0.0;
+	int result                                     = 0;
+
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			floatingtimestamp = ( (libfdatetime_internal_floatingtime_t *) timestamp )->timestamp.floating_point;
+
+			if( !( ( floatingtimestamp >= 0.0 )
+			    && ( floatingtimestamp < 3650000.0 ) ) )
+			{
+				return( 0 );
+			}
+			result = fdatetime_test_differential_reference_floatingtime_copy_to_date_time_values(
+			          (libfdatetime_internal_floatingtime_t *) timestamp,
+			          reference_date_time_values );
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			posix_time = (libfdatetime_internal_posix_time_t *) timestamp;
+
+			if( ( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+			 || ( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED ) )
+			{
+				number_of_seconds = (int64_t) ( posix_time->timestamp & 0xffffffffUL );
+			}
+			else if( ( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+			      || ( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED ) )
+			{
+				number_of_seconds = (int64_t) ( posix_time->timestamp / 1000000 );
+			}
+			else if( ( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+			      || ( posix_time->value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED ) )
+			{
+				number_of_seconds = (int64_t) ( posix_time->timestamp / 1000000000 );
+			}
+			else
+			{
+				number_of_seconds = (int64_t) posix_time->timestamp;
+			}
+			/* The original decoder treats the top bit as the sign regardless of the value type
+			 * and does not determine the year correctly for every value beyond 0x7fffffff seconds
+			 */
+			if( ( ( posix_time->timestamp & 0x8000000000000000ULL ) == 0 )
+			 && ( number_of_seconds >= 0 )
+			 && ( number_of_seconds <= (int64_t) 0x7fffffffL ) )
+			{
+				result = fdatetime_test_differential_reference_posix_time_copy_to_date_time_values(
+				          posix_time,
+				          reference_date_time_values );
+
+				if( ( result == 1 )
+				 && ( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+				       reference_date_time_values,
+				       &number_of_seconds,
+				       NULL ) == 1 ) )
+				{
+					return( 1 );
+				}
+			}
+			if( fdatetime_test_differential_reference_posix_time_copy_to_filetime(
+			     posix_time,
+			     &filetime ) != 1 )
+			{
+				return( 0 );
+			}
+			result = libfdatetime_internal_copy_to_date_time_values(
+			          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+			          (intptr_t *) &filetime,
+			          reference_date_time_values,
+			          NULL );
+			break;
+
+		default:
+			return( libfdatetime_internal_copy_to_date_time_values(
+			         timestamp_type,
+			         timestamp,
+			         reference_date_time_values,
+			         NULL ) == 1 );
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	/* The reference decoders do not validate every value, date time values
+	 * that do not represent a valid date and time are outside their domain
+	 */
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     reference_date_time_values,
+	     &number_of_seconds,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Verifies that a timestamp converted into another timestamp type decodes
+ * into the same date time values as the reference
+ * Returns 1 if successful, 0 on mismatch
+ */
+int fdatetime_test_differential_verify_converted_timestamp(
+     int timestamp_type,
+     intptr_t *timestamp,
+     libfdatetime_date_time_values_t *reference_date_time_values )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_date_time_values_t decoded_date_time_values;
+
+	/* A converted timestamp outside the domain of the reference of its type is not verified
+	 */
+	if( fdatetime_test_differential_get_reference_date_time_values(
+	     timestamp_type,
+	     timestamp,
+	     &date_time_values ) != 1 )
+	{
+		return( 1 );
+	}
+	if( libfdatetime_internal_copy_to_date_time_values(
+	     timestamp_type,
+	     timestamp,
+	     &decoded_date_time_values,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( fdatetime_test_differential_date_time_values_are_equal(
+	     &decoded_date_time_values,
+	     &date_time_values ) != 1 )
+	{
+		return( 0 );
+	}
+	return( fdatetime_test_differential_date_time_values_are_equal(
+	         &date_time_values,
+	         reference_date_time_values ) );
+}
+
+/* Verifies the epoch based conversions of a timestamp against the reference date time values
+ * Returns 1 if successful, 0 on mismatch
+ */
+int fdatetime_test_differential_verify_conversions(
+     int timestamp_type,
+     intptr_t *timestamp,
+     libfdatetime_date_time_values_t *reference_date_time_values )
+{
+	libfdatetime_internal_filetime_t filetime;
+	libfdatetime_internal_posix_time_t posix_time;
+
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			/* A FILETIME outside the range of a signed 64-bit number of nano seconds cannot be converted
+			 */
+			if( libfdatetime_filetime_copy_to_posix_time(
+			     (libfdatetime_filetime_t *) timestamp,
+			     (libfdatetime_posix_time_t *) &posix_time,
+			     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+			     NULL ) == 1 )
+			{
+				if( fdatetime_test_differential_verify_converted_timestamp(
+				     LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+				     (intptr_t *) &posix_time,
+				     reference_date_time_values ) != 1 )
+				{
+					return( 0 );
+				}
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			if( libfdatetime_hfs_time_copy_to_posix_time(
+			     (libfdatetime_hfs_time_t *) timestamp,
+			     (libfdatetime_posix_time_t *) &posix_time,
+			     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+			     NULL ) != 1 )
+			{
+				return( 0 );
+			}
+			if( fdatetime_test_differential_verify_converted_timestamp(
+			     LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+			     (intptr_t *) &posix_time,
+			     reference_date_time_values ) != 1 )
+			{
+				return( 0 );
+			}
+			if( libfdatetime_hfs_time_copy_to_filetime(
+			     (libfdatetime_hfs_time_t *) timestamp,
+			     (libfdatetime_filetime_t *) &filetime,
+			     NULL ) != 1 )
+			{
+				return( 0 );
+			}
+			if( fdatetime_test_differential_verify_converted_timestamp(
+			     LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+			     (intptr_t *) &filetime,
+			     reference_date_time_values ) != 1 )
+			{
+				return( 0 );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			if( libfdatetime_posix_time_copy_to_filetime(
+			     (libfdatetime_posix_time_t *) timestamp,
+			     (libfdatetime_filetime_t *) &filetime,
+			     NULL ) != 1 )
+			{
+				return( 0 );
+			}
+			if( fdatetime_test_differential_verify_converted_timestamp(
+			     LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+			     (intptr_t *) &filetime,
+			     reference_date_time_values ) != 1 )
+			{
+				return( 0 );
+			}
+			break;
+
+		default:
+			break;
+	}
+	return( 1 );
+}
+
+/* Verifies a timestamp
+ * The reference date time values are the reference for the calendar decoder of the library,
+ * the sort key, the epoch based conversions and the string functions
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_differential_verify_timestamp(
+     fdatetime_test_differential_worker_t *worker,
+     intptr_t *timestamp,
+     uint64_t value )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_date_time_values_t decoded_date_time_values;
+
+	int64_t number_of_seconds  = 0;
+	int64_t reference_sort_key = 0;
+	int64_t sort_key           = 0;
+	int64_t sort_key_delta     = 0;
+	int decoder_result         = 0;
+	int reference_result       = 0;
+	int result                 = 0;
+
+	if( libfdatetime_internal_get_sort_key(
+	     worker->test_case->timestamp_type,
+	     timestamp,
+	     &sort_key,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	reference_result = fdatetime_test_differential_get_reference_date_time_values(
+	                    worker->test_case->timestamp_type,
+	                    timestamp,
+	                    &date_time_values );
+
+	decoder_result = libfdatetime_internal_copy_to_date_time_values(
+	                  worker->test_case->timestamp_type,
+	                  timestamp,
+	                  &decoded_date_time_values,
+	                  NULL );
+
+	if( reference_result == 1 )
+	{
+		if( ( decoder_result != 1 )
+		 || ( fdatetime_test_differential_date_time_values_are_equal(
+		       &decoded_date_time_values,
+		       &date_time_values ) != 1 ) )
+		{
+			fdatetime_test_differential_report_mismatch(
+			 worker,
+			 value,
+			 "calendar decoder" );
+		}
+	}
+	/* A timestamp outside the domain of the reference is verified against the calendar
+	 * decoder of the library, a timestamp that cannot be represented as date time values
+	 * is only verified by the sort key and conversion tests of the corresponding type
+	 */
+	else if( decoder_result == 1 )
+	{
+		date_time_values = decoded_date_time_values;
+	}
+	else
+	{
+		return( 1 );
+	}
+	if( libfdatetime_date_time_values_get_number_of_seconds_since_1970(
+	     &date_time_values,
+	     &number_of_seconds,
+	     NULL ) != 1 )
+	{
+		/* The calendar decoder does not validate every value, date time values
+		 * that do not represent a valid date and time must have an invalid sort key
+		 */
+		if( sort_key != LIBFDATETIME_SORT_KEY_INVALID )
+		{
+			fdatetime_test_differential_report_mismatch(
+			 worker,
+			 value,
+			 "sort key of invalid date time values" );
+		}
+		return( 1 );
+	}
+	reference_sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+	                      number_of_seconds,
+	                      ( (uint32_t) date_time_values.milli_seconds * 1000000 )
+	                      + ( (uint32_t) date_time_values.micro_seconds * 1000 )
+	                      + date_time_values.nano_seconds );
+
+	sort_key_delta = sort_key - reference_sort_key;
+
+	if( ( sort_key == LIBFDATETIME_SORT_KEY_INVALID )
+	 || ( sort_key_delta > worker->test_case->sort_key_tolerance )
+	 || ( sort_key_delta < -( worker->test_case->sort_key_tolerance ) ) )
+	{
+		fdatetime_test_differential_report_mismatch(
+		 worker,
+		 value,
+		 "sort key" );
+	}
+	if( fdatetime_test_differential_verify_conversions(
+	     worker->test_case->timestamp_type,
+	     timestamp,
+	     &date_time_values ) != 1 )
+	{
+		fdatetime_test_differential_report_mismatch(
+		 worker,
+		 value,
+		 "conversion" );
+	}
+	result = fdatetime_test_differential_verify_strings(
+	          &date_time_values );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		fdatetime_test_differential_report_mismatch(
+		 worker,
+		 value,
+		 "string" );
+	}
+	return( 1 );
+}
+
+/* Verifies the values of a worker
+ * Make sure the value is a pointer to a differential worker
+ */
+void *fdatetime_test_differential_worker_start_function(
+       void *arguments )
+{
+	libfdatetime_internal_fat_date_time_t fat_date_time;
+	libfdatetime_internal_filetime_t filetime;
+	libfdatetime_internal_floatingtime_t floatingtime;
+	libfdatetime_internal_hfs_time_t hfs_time;
+	libfdatetime_internal_nsf_timedate_t nsf_timedate;
+	libfdatetime_internal_posix_time_t posix_time;
+
+	fdatetime_test_differential_worker_t *worker = NULL;
+	intptr_t *timestamp                          = NULL;
+	int32_t number_of_days                       = 0;
+	uint64_t random_value                        = 0;
+	uint64_t value                               = 0;
+	uint64_t value_index                         = 0;
+
+	worker         = (fdatetime_test_differential_worker_t *) arguments;
+	worker->result = 1;
+
+	for( value_index = worker->first_value_index;
+	     value_index < ( worker->first_value_index + worker->number_of_values );
+	     value_index++ )
+	{
+		/* The values are used as is, since the random value is 0
+		 */
+		if( worker->values != NULL )
+		{
+			value        = worker->values[ value_index ];
+			random_value = 0;
+		}
+		else if( worker->test_case->is_exhaustive != 0 )
+		{
+			value = (uint32_t) ( value_index * worker->value_multiplier );
+		}
+		else
+		{
+			value        = fdatetime_test_differential_get_random_value(
+			                &( worker->random_state ) );
+			random_value = fdatetime_test_differential_get_random_value(
+			                &( worker->random_state ) );
+		}
+		switch( worker->test_case - fdatetime_test_differential_cases )
+		{
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_FAT_DATE_TIME:
+				fat_date_time.date = (uint16_t) ( value >> 16 );
+				fat_date_time.time = (uint16_t) ( value & 0x0000ffffUL );
+
+				timestamp = (intptr_t *) &fat_date_time;
+				break;
+
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_HFS_TIME:
+				hfs_time.timestamp = (uint32_t) value;
+
+				timestamp = (intptr_t *) &hfs_time;
+				break;
+
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_POSIX_TIME_32BIT_SIGNED:
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_POSIX_TIME_32BIT_UNSIGNED:
+				/* The POSIX time is set directly, since copy from 32-bit rejects
+				 * a signed value of 0x80000000, which the decoder supports
+				 */
+				posix_time.timestamp = (uint32_t) value;
+
+				if( worker->test_case == &( fdatetime_test_differential_cases[ FDATETIME_TEST_DIFFERENTIAL_CASE_POSIX_TIME_32BIT_SIGNED ] ) )
+				{
+					posix_time.value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED;
+				}
+				else
+				{
+					posix_time.value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED;
+				}
+				timestamp = (intptr_t *) &posix_time;
+				break;
+
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_FILETIME:
+				/* Most of the values are restricted to the years that can be represented
+				 * as date time values, since only those can be verified against the calendar decoder
+				 */
+				if( ( random_value & 0x03 ) != 0 )
+				{
+					value %= FDATETIME_TEST_DIFFERENTIAL_FILETIME_YEAR_10000;
+				}
+				filetime.lower = (uint32_t) ( value & 0xffffffffUL );
+				filetime.upper = (uint32_t) ( value >> 32 );
+
+				timestamp = (intptr_t *) &filetime;
+				break;
+
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_NSF_TIMEDATE:
+				/* Most of the values are restricted to the Julian days of the years 0 to 9999
+				 * and a valid number of 10 milli seconds in the day
+				 */
+				if( ( random_value & 0x03 ) != 0 )
+				{
+					value = ( value & 0xff00000000000000ULL )
+					      | ( (uint64_t) ( 1721060 + ( ( value >> 32 ) % 3652425 ) ) << 32 )
+					      | ( ( value & 0xffffffffUL ) % 8640000 );
+				}
+				nsf_timedate.lower = (uint32_t) ( value & 0xffffffffUL );
+				nsf_timedate.upper = (uint32_t) ( value >> 32 );
+
+				timestamp = (intptr_t *) &nsf_timedate;
+				break;
+
+			case FDATETIME_TEST_DIFFERENTIAL_CASE_FLOATINGTIME:
+				/* Most of the values are restricted to a number of days in the years 0 to 9999,
+				 * where 1 Jan 0000 is day -693959 and 1 Jan 10000 is day 2958466. A part of
+				 * these values is a whole number of days and quarters of a day, which are
+				 * represented exactly and hence test the boundaries of the days and years
+				 */
+				switch( random_value & 0x03 )
+				{
+					case 0:
+						floatingtime.timestamp.integer = value;
+						break;
+
+					case 1:
+						number_of_days = (int32_t) ( ( value >> 32 ) % 3652425 ) - 693959;
+
+						if( number_of_days < 0 )
+						{
+							floatingtime.timestamp.floating_point = (double) number_of_days - ( (double) ( value & 0x03 ) / 4.0 );
+						}
+						else
+						{
+							floatingtime.timestamp.floating_point = (double) number_of_days + ( (double) ( value & 0x03 ) / 4.0 );
+						}
+						break;
+
+					default:
+						floatingtime.timestamp.floating_point = ( (double) ( value >> 11 ) * ( 3652425.0 / 9007199254740992.0 ) ) - 693959.0;
+						break;
+				}
+				value = floatingtime.timestamp.integer;
+
+				timestamp = (intptr_t *) &floatingtime;
+				break;
+
+			default:
+				worker->result = -1;
+
+				return( NULL );
+		}
+		if( fdatetime_test_differential_verify_timestamp(
+		     worker,
+		     timestamp,
+		     value ) != 1 )
+		{
+			worker->result = -1;
+
+			break;
+		}
+	}
+	return( NULL );
+}
+
+/* Retrieves the number of online processors
+ * Returns the number of processors or 1 if not available
+ */
+int fdatetime_test_differential_get_number_of_processors(
+     void )
+{
+	int number_of_processors = 1;
+
+#if defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	long value = sysconf(
+	              _SC_NPROCESSORS_ONLN );
+
+	if( value > 0 )
+	{
+		number_of_processors = (int) value;
+	}
+#endif
+	return( number_of_processors );
+}
+
+/* Verifies the values of a case sharded over a number of threads
+ * If values is not NULL these values are verified instead of the values of the case
+ * Returns 1 if successful, 0 on mismatch or -1 on error
+ */
+int fdatetime_test_differential_verify_case(
+     const fdatetime_test_differential_case_t *test_case,
+     const uint64_t *values,
+     uint64_t number_of_values,
+     uint32_t value_multiplier,
+     uint64_t seed,
+     int number_of_threads,
+     uint8_t print_summary )
+{
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	pthread_t threads[ FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	fdatetime_test_differential_worker_t workers[ FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_THREADS ];
+
+	uint64_t number_of_mismatches        = 0;
+	uint64_t number_of_values_per_thread = 0;
+	int number_of_started_threads        = 0;
+	int result                           = 1;
+	int thread_index                     = 0;
+
+	number_of_values_per_thread = number_of_values / number_of_threads;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		workers[ thread_index ].test_case            = test_case;
+		workers[ thread_index ].first_value_index    = number_of_values_per_thread * thread_index;
+		workers[ thread_index ].number_of_values     = number_of_values_per_thread;
+		workers[ thread_index ].value_multiplier     = value_multiplier;
+		workers[ thread_index ].values               = values;
+		workers[ thread_index ].number_of_mismatches = 0;
+		workers[ thread_index ].result               = 0;
+
+		/* The pseudo random state must not be 0
+		 */
+		workers[ thread_index ].random_state = ( seed * 0x9e3779b97f4a7c15ULL ) ^ ( (uint64_t) thread_index + 1 );
+
+		if( workers[ thread_index ].random_state == 0 )
+		{
+			workers[ thread_index ].random_state = 1;
+		}
+		/* The last thread verifies the remaining values
+		 */
+		if( thread_index == ( number_of_threads - 1 ) )
+		{
+			workers[ thread_index ].number_of_values += number_of_values % number_of_threads;
+		}
+	}
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( pthread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     &fdatetime_test_differential_worker_start_function,
+		     (void *) &( workers[ thread_index ] ) ) != 0 )
+		{
+			break;
+		}
+		number_of_started_threads++;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_started_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	/* The workers of threads that could not be started run in the calling thread
+	 */
+	for( thread_index = number_of_started_threads;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		fdatetime_test_differential_worker_start_function(
+		 (void *) &( workers[ thread_index ] ) );
+	}
+#else
+	/* Without multi-threading support the workers run one after the other
+	 */
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		fdatetime_test_differential_worker_start_function(
+		 (void *) &( workers[ thread_index ] ) );
+	}
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( workers[ thread_index ].result != 1 )
+		{
+			result = -1;
+		}
+		number_of_mismatches += workers[ thread_index ].number_of_mismatches;
+	}
+	if( ( result == 1 )
+	 && ( number_of_mismatches != 0 ) )
+	{
+		result = 0;
+	}
+	if( ( print_summary != 0 )
+	 || ( result != 1 ) )
+	{
+		fprintf(
+		 stdout,
+		 "%s: %" PRIu64 " values verified, %" PRIu64 " mismatches%s.\n",
+		 test_case->name,
+		 number_of_values,
+		 number_of_mismatches,
+		 ( result == -1 ) ? ", error" : "" );
+	}
+	return( result );
+}
+
+/* Prints usage information
+ */
+void fdatetime_test_differential_usage_fprint(
+      FILE *stream )
+{
+	fprintf( stream, "Usage: fdatetime_test_differential [ -e ] [ -n number_of_values ] [ -s seed ]\n"
+	                 "                                   [ -t number_of_threads ]\n\n" );
+	fprintf( stream, "\t-e: exhaustive mode, verifies all 32-bit HFS time, POSIX time and FAT date\n"
+	                 "\t    time values and %" PRIu64 " pseudo random FILETIME, NSF timedate and\n"
+	                 "\t    floatingtime values\n",
+	                 FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_RANDOM_VALUES );
+	fprintf( stream, "\t-n: number of pseudo random values per timestamp type\n" );
+	fprintf( stream, "\t-s: seed of the pseudo random values (default is 1)\n" );
+	fprintf( stream, "\t-t: number of threads (default is the number of online processors)\n" );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ * By default a sample of every case is verified, use the option -e to verify exhaustively
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+	char *value_end                   = NULL;
+	uint64_t number_of_random_values  = 0;
+	uint64_t number_of_values         = 0;
+	uint64_t seed                     = 1;
+	uint32_t value_multiplier         = 0;
+	uint8_t exhaustive_mode           = 0;
+	int argument_index                = 0;
+	int case_index                    = 0;
+	int number_of_threads             = 0;
+	int result                        = 1;
+
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( ( argv[ argument_index ][ 0 ] != '-' )
+		 || ( narrow_string_length( argv[ argument_index ] ) != 2 ) )
+		{
+			fdatetime_test_differential_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( argv[ argument_index ][ 1 ] == 'e' )
+		{
+			exhaustive_mode = 1;
+
+			continue;
+		}
+		if( ( argument_index + 1 ) >= argc )
+		{
+			fdatetime_test_differential_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( argv[ argument_index ][ 1 ] == 'n' )
+		{
+			number_of_random_values = (uint64_t) strtoull( argv[ ++argument_index ], &value_end, 10 );
+
+			if( ( *value_end != 0 )
+			 || ( number_of_random_values == 0 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of values.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else if( argv[ argument_index ][ 1 ] == 's' )
+		{
+			seed = (uint64_t) strtoull( argv[ ++argument_index ], &value_end, 0 );
+
+			if( *value_end != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid seed.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else if( argv[ argument_index ][ 1 ] == 't' )
+		{
+			number_of_threads = (int) strtol( argv[ ++argument_index ], &value_end, 10 );
+
+			if( ( *value_end != 0 )
+			 || ( number_of_threads <= 0 )
+			 || ( number_of_threads > FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_THREADS ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of threads.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else
+		{
+			fdatetime_test_differential_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( number_of_threads == 0 )
+	{
+		number_of_threads = fdatetime_test_differential_get_number_of_processors();
+
+		if( number_of_threads > FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			number_of_threads = FDATETIME_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_THREADS;
+		}
+	}
+	if( number_of_random_values == 0 )
+	{
+		if( exhaustive_mode != 0 )
+		{
+			number_of_random_values = FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_RANDOM_VALUES;
+		}
+		else
+		{
+			number_of_random_values = FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_SAMPLE_VALUES;
+		}
+	}
+	for( case_index = 0;
+	     case_index < FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_CASES;
+	     case_index++ )
+	{
+		if( fdatetime_test_differential_cases[ case_index ].is_exhaustive == 0 )
+		{
+			number_of_values = number_of_random_values;
+			value_multiplier = 0;
+		}
+		else if( exhaustive_mode != 0 )
+		{
+			number_of_values = FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_32BIT_VALUES;
+			value_multiplier = 1;
+		}
+		else
+		{
+			number_of_values = FDATETIME_TEST_DIFFERENTIAL_NUMBER_OF_SAMPLE_VALUES;
+			value_multiplier = FDATETIME_TEST_DIFFERENTIAL_SAMPLE_MULTIPLIER;
+		}
+		if( fdatetime_test_differential_cases[ case_index ].number_of_boundary_values > 0 )
+		{
+			if( fdatetime_test_differential_verify_case(
+			     &( fdatetime_test_differential_cases[ case_index ] ),
+			     fdatetime_test_differential_cases[ case_index ].boundary_values,
+			     fdatetime_test_differential_cases[ case_index ].number_of_boundary_values,
+			     0,
+			     seed,
+			     1,
+			     exhaustive_mode ) != 1 )
+			{
+				result = 0;
+			}
+		}
+		if( fdatetime_test_differential_verify_case(
+		     &( fdatetime_test_differential_cases[ case_index ] ),
+		     NULL,
+		     number_of_values,
+		     value_multiplier,
+		     seed,
+		     number_of_threads,
+		     exhaustive_mode ) != 1 )
+		{
+			result = 0;
+		}
+	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+#else
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	/* The differential verification requires the internal functions of the library
+	 */
+	return( 77 );
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+}
+
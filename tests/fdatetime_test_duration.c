@@ -0,0 +1,1453 @@
+/*
+ * Library duration functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_duration.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_get_duration_from_number_of_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_get_duration_from_number_of_seconds(
+     void )
+{
+	int64_t first_number_of_seconds[ 11 ] = {
+		1284460463,
+		1284460462,
+		0,
+		(int64_t) 0x7fffffffffffffffULL,
+		-( (int64_t) 0x7fffffffffffffffULL ),
+		9223372036,
+		9223372037,
+		9223372037,
+		-9223372037,
+		-9223372037,
+		-9223372037 };
+
+	uint32_t first_number_of_nano_seconds[ 11 ] = {
+		500000000,
+		0,
+		0,
+		0,
+		0,
+		854775807,
+		0,
+		0,
+		999999999,
+		145224192,
+		145224191 };
+
+	int64_t second_number_of_seconds[ 11 ] = {
+		1284460462,
+		1284460463,
+		0,
+		-1,
+		1,
+		0,
+		0,
+		0,
+		0,
+		0,
+		0 };
+
+	uint32_t second_number_of_nano_seconds[ 11 ] = {
+		0,
+		500000000,
+		0,
+		0,
+		0,
+		0,
+		999999999,
+		145224192,
+		0,
+		0,
+		0 };
+
+	int64_t expected_durations[ 11 ] = {
+		1500000000,
+		-1500000000,
+		0,
+		(int64_t) 0x7fffffffffffffffULL,
+		-( (int64_t) 0x7fffffffffffffffULL ) - 1,
+		(int64_t) 0x7fffffffffffffffULL,
+		(int64_t) 9223372036000000001LL,
+		(int64_t) 0x7fffffffffffffffULL,
+		(int64_t) -9223372036000000001LL,
+		-( (int64_t) 0x7fffffffffffffffULL ) - 1,
+		-( (int64_t) 0x7fffffffffffffffULL ) - 1 };
+
+	int64_t duration = 0;
+	int value_index  = 0;
+
+	for( value_index = 0;
+	     value_index < 11;
+	     value_index++ )
+	{
+		duration = libfdatetime_get_duration_from_number_of_seconds(
+		            first_number_of_seconds[ value_index ],
+		            first_number_of_nano_seconds[ value_index ],
+		            second_number_of_seconds[ value_index ],
+		            second_number_of_nano_seconds[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "duration",
+		 duration,
+		 expected_durations[ value_index ] );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_duration_add_to_number_of_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_duration_add_to_number_of_seconds(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	number_of_seconds      = 10;
+	number_of_nano_seconds = 600000000;
+
+	result = libfdatetime_internal_duration_add_to_number_of_seconds(
+	          &number_of_seconds,
+	          &number_of_nano_seconds,
+	          (int64_t) 1500000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 12 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (uint32_t) 100000000 );
+
+	result = libfdatetime_internal_duration_add_to_number_of_seconds(
+	          &number_of_seconds,
+	          &number_of_nano_seconds,
+	          (int64_t) -200000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 11 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (uint32_t) 900000000 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_duration_add_to_number_of_seconds(
+	          NULL,
+	          &number_of_nano_seconds,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_duration_add_to_number_of_seconds(
+	          &number_of_seconds,
+	          NULL,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_nano_seconds = 1000000000;
+
+	result = libfdatetime_internal_duration_add_to_number_of_seconds(
+	          &number_of_seconds,
+	          &number_of_nano_seconds,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_seconds      = (int64_t) 0x7fffffffffffffffULL;
+	number_of_nano_seconds = 0;
+
+	result = libfdatetime_internal_duration_add_to_number_of_seconds(
+	          &number_of_seconds,
+	          &number_of_nano_seconds,
+	          (int64_t) 1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 0x7fffffffffffffffULL );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_duration_copy_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_duration_copy_to_string(
+     void )
+{
+	int64_t durations[ 6 ] = {
+		0,
+		10626306789000000,
+		10626306789000000,
+		-1500000000,
+		-( (int64_t) 0x7fffffffffffffffULL ) - 1,
+		86399999999999 };
+
+	uint32_t string_format_flags[ 6 ] = {
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS };
+
+	const char *expected_strings[ 6 ] = {
+		"0 days 00:00:00",
+		"122 days 23:45:06.789",
+		"P122DT23H45M6.789S",
+		"-P0DT0H0M1S",
+		"-106751 days 23:47:16.854775808",
+		"0 days 23:59:59.999999" };
+
+	char string[ LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_length     = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		result = libfdatetime_internal_duration_copy_to_string(
+		          durations[ value_index ],
+		          string,
+		          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+		          &string_length,
+		          string_format_flags[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "string_length",
+		 string_length,
+		 narrow_string_length( expected_strings[ value_index ] ) );
+
+		result = memory_compare(
+		          string,
+		          expected_strings[ value_index ],
+		          string_length );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_duration_copy_to_string(
+	          0,
+	          NULL,
+	          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	          &string_length,
+	          string_format_flags[ 0 ],
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_duration_copy_to_string(
+	          0,
+	          string,
+	          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE - 1,
+	          &string_length,
+	          string_format_flags[ 0 ],
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_duration_copy_to_string(
+	          0,
+	          string,
+	          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	          NULL,
+	          string_format_flags[ 0 ],
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test without the duration flag
+	 */
+	result = libfdatetime_internal_duration_copy_to_string(
+	          0,
+	          string,
+	          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	          &string_length,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported string format type
+	 */
+	result = libfdatetime_internal_duration_copy_to_string(
+	          0,
+	          string,
+	          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	          &string_length,
+	          0x000000ffUL | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported string format flag
+	 */
+	result = libfdatetime_internal_duration_copy_to_string(
+	          0,
+	          string,
+	          LIBFDATETIME_DURATION_MAXIMUM_STRING_SIZE,
+	          &string_length,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_duration_get_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_get_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_duration_get_string_size(
+	          (int64_t) 10626306789000000,
+	          &string_size,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 22 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_duration_get_string_size(
+	          0,
+	          NULL,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_get_string_size(
+	          0,
+	          &string_size,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_duration_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_copy_to_utf8_string(
+     void )
+{
+	uint8_t expected_utf8_string[ 19 ] = {
+		'P', '1', '2', '2', 'D', 'T', '2', '3', 'H', '4', '5', 'M', '6', '.', '7', '8', '9', 'S', 0 };
+
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_duration_copy_to_utf8_string(
+	          (int64_t) 10626306789000000,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          sizeof( uint8_t ) * 19 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_duration_copy_to_utf8_string(
+	          0,
+	          NULL,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf8_string(
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf8_string(
+	          (int64_t) 10626306789000000,
+	          utf8_string,
+	          18,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_duration_copy_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_copy_to_utf8_string_with_index(
+     void )
+{
+	uint8_t expected_utf8_string[ 19 ] = {
+		'P', '1', '2', '2', 'D', 'T', '2', '3', 'H', '4', '5', 'M', '6', '.', '7', '8', '9', 'S', 0 };
+
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfdatetime_duration_copy_to_utf8_string_with_index(
+	          (int64_t) 10626306789000000,
+	          utf8_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 19 );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          sizeof( uint8_t ) * 19 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfdatetime_duration_copy_to_utf8_string_with_index(
+	          0,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf8_string_with_index(
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf8_string_with_index(
+	          0,
+	          utf8_string,
+	          32,
+	          NULL,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 20;
+
+	result = libfdatetime_duration_copy_to_utf8_string_with_index(
+	          (int64_t) 10626306789000000,
+	          utf8_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_duration_copy_to_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_copy_to_utf16_string(
+     void )
+{
+	uint16_t expected_utf16_string[ 19 ] = {
+		'P', '1', '2', '2', 'D', 'T', '2', '3', 'H', '4', '5', 'M', '6', '.', '7', '8', '9', 'S', 0 };
+
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_duration_copy_to_utf16_string(
+	          (int64_t) 10626306789000000,
+	          utf16_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 19 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_duration_copy_to_utf16_string(
+	          0,
+	          NULL,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf16_string(
+	          0,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf16_string(
+	          (int64_t) 10626306789000000,
+	          utf16_string,
+	          18,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_duration_copy_to_utf16_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_copy_to_utf16_string_with_index(
+     void )
+{
+	uint16_t expected_utf16_string[ 19 ] = {
+		'P', '1', '2', '2', 'D', 'T', '2', '3', 'H', '4', '5', 'M', '6', '.', '7', '8', '9', 'S', 0 };
+
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfdatetime_duration_copy_to_utf16_string_with_index(
+	          (int64_t) 10626306789000000,
+	          utf16_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 19 );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 19 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfdatetime_duration_copy_to_utf16_string_with_index(
+	          0,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf16_string_with_index(
+	          0,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf16_string_with_index(
+	          0,
+	          utf16_string,
+	          32,
+	          NULL,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 20;
+
+	result = libfdatetime_duration_copy_to_utf16_string_with_index(
+	          (int64_t) 10626306789000000,
+	          utf16_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_duration_copy_to_utf32_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_copy_to_utf32_string(
+     void )
+{
+	uint32_t expected_utf32_string[ 19 ] = {
+		'P', '1', '2', '2', 'D', 'T', '2', '3', 'H', '4', '5', 'M', '6', '.', '7', '8', '9', 'S', 0 };
+
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_duration_copy_to_utf32_string(
+	          (int64_t) 10626306789000000,
+	          utf32_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf32_string,
+	          expected_utf32_string,
+	          sizeof( uint32_t ) * 19 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_duration_copy_to_utf32_string(
+	          0,
+	          NULL,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf32_string(
+	          0,
+	          utf32_string,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf32_string(
+	          (int64_t) 10626306789000000,
+	          utf32_string,
+	          18,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_duration_copy_to_utf32_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_duration_copy_to_utf32_string_with_index(
+     void )
+{
+	uint32_t expected_utf32_string[ 19 ] = {
+		'P', '1', '2', '2', 'D', 'T', '2', '3', 'H', '4', '5', 'M', '6', '.', '7', '8', '9', 'S', 0 };
+
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfdatetime_duration_copy_to_utf32_string_with_index(
+	          (int64_t) 10626306789000000,
+	          utf32_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 19 );
+
+	result = memory_compare(
+	          utf32_string,
+	          expected_utf32_string,
+	          sizeof( uint32_t ) * 19 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfdatetime_duration_copy_to_utf32_string_with_index(
+	          0,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf32_string_with_index(
+	          0,
+	          utf32_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_duration_copy_to_utf32_string_with_index(
+	          0,
+	          utf32_string,
+	          32,
+	          NULL,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 20;
+
+	result = libfdatetime_duration_copy_to_utf32_string_with_index(
+	          (int64_t) 10626306789000000,
+	          utf32_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DURATION | LIBFDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_get_duration_from_number_of_seconds",
+	 fdatetime_test_get_duration_from_number_of_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_duration_add_to_number_of_seconds",
+	 fdatetime_test_internal_duration_add_to_number_of_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_duration_copy_to_string",
+	 fdatetime_test_internal_duration_copy_to_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_get_string_size",
+	 fdatetime_test_duration_get_string_size );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_copy_to_utf8_string",
+	 fdatetime_test_duration_copy_to_utf8_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_copy_to_utf8_string_with_index",
+	 fdatetime_test_duration_copy_to_utf8_string_with_index );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_copy_to_utf16_string",
+	 fdatetime_test_duration_copy_to_utf16_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_copy_to_utf16_string_with_index",
+	 fdatetime_test_duration_copy_to_utf16_string_with_index );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_copy_to_utf32_string",
+	 fdatetime_test_duration_copy_to_utf32_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_duration_copy_to_utf32_string_with_index",
+	 fdatetime_test_duration_copy_to_utf32_string_with_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -881,8 +882,962 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfdatetime_internal_fat_date_time_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_fat_date_time_copy_from_date_time_values(
+     void )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_fat_date_time_t internal_fat_date_time;
+	libfdatetime_internal_fat_date_time_t round_trip_fat_date_time;
+
+	libcerror_error_t *error        = NULL;
+	uint32_t number_of_valid_values = 0;
+	uint32_t value_16bit            = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	date_time_values.year          = 2010;
+	date_time_values.month         = 9;
+	date_time_values.day           = 14;
+	date_time_values.hours         = 9;
+	date_time_values.minutes       = 54;
+	date_time_values.seconds       = 23;
+	date_time_values.milli_seconds = 123;
+	date_time_values.micro_seconds = 456;
+	date_time_values.nano_seconds  = 789;
+
+	result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+	          &internal_fat_date_time,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "internal_fat_date_time.date",
+	 internal_fat_date_time.date,
+	 0x3d2e );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "internal_fat_date_time.time",
+	 internal_fat_date_time.time,
+	 0x4ecb );
+
+	/* Test the round trip of every date value, the time value is kept constant
+	 */
+	internal_fat_date_time.time = 0x4ecb;
+
+	for( value_16bit = 0;
+	     value_16bit <= 0xffff;
+	     value_16bit++ )
+	{
+		internal_fat_date_time.date = (uint16_t) value_16bit;
+
+		result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
+		          &internal_fat_date_time,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Values that do not represent a valid date are rejected
+		 */
+		result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+		          &round_trip_fat_date_time,
+		          &date_time_values,
+		          NULL );
+
+		if( result == 1 )
+		{
+			FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+			 "round_trip_fat_date_time.date",
+			 round_trip_fat_date_time.date,
+			 internal_fat_date_time.date );
+
+			FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+			 "round_trip_fat_date_time.time",
+			 round_trip_fat_date_time.time,
+			 internal_fat_date_time.time );
+
+			number_of_valid_values++;
+		}
+	}
+	/* 1980 through 2107 consists of 46751 days
+	 */
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_valid_values",
+	 number_of_valid_values,
+	 46751 );
+
+	/* Test the round trip of every time value, the date value is kept constant
+	 */
+	internal_fat_date_time.date = 0x3d2e;
+
+	number_of_valid_values = 0;
+
+	for( value_16bit = 0;
+	     value_16bit <= 0xffff;
+	     value_16bit++ )
+	{
+		internal_fat_date_time.time = (uint16_t) value_16bit;
+
+		result = libfdatetime_internal_fat_date_time_copy_to_date_time_values(
+		          &internal_fat_date_time,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+		          &round_trip_fat_date_time,
+		          &date_time_values,
+		          NULL );
+
+		if( result == 1 )
+		{
+			FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+			 "round_trip_fat_date_time.date",
+			 round_trip_fat_date_time.date,
+			 internal_fat_date_time.date );
+
+			FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+			 "round_trip_fat_date_time.time",
+			 round_trip_fat_date_time.time,
+			 internal_fat_date_time.time );
+
+			number_of_valid_values++;
+		}
+	}
+	/* A day consists of 43200 intervals of 2 seconds
+	 */
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_valid_values",
+	 number_of_valid_values,
+	 43200 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+	          &internal_fat_date_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year    = 1979;
+	date_time_values.month   = 12;
+	date_time_values.day     = 31;
+	date_time_values.hours   = 0;
+	date_time_values.minutes = 0;
+	date_time_values.seconds = 0;
+
+	result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+	          &internal_fat_date_time,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year  = 2108;
+	date_time_values.month = 1;
+	date_time_values.day   = 1;
+
+	result = libfdatetime_internal_fat_date_time_copy_from_date_time_values(
+	          &internal_fat_date_time,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+/* Tests the libfdatetime_fat_date_time_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_fat_date_time_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                    = NULL;
+	libfdatetime_fat_date_time_t *fat_date_time = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_fat_date_time_initialize(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "fat_date_time",
+	 fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_fat_date_time_copy_from_date_time_values(
+	          fat_date_time,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_copy_to_utf8_string(
+	          fat_date_time,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:22",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_fat_date_time_copy_from_date_time_values(
+	          NULL,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_copy_from_date_time_values(
+	          fat_date_time,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_copy_from_date_time_values(
+	          fat_date_time,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_copy_from_date_time_values(
+	          fat_date_time,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_copy_from_date_time_values(
+	          fat_date_time,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_fat_date_time_free(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "fat_date_time",
+	 fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fat_date_time != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &fat_date_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_fat_date_time_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_fat_date_time_get_sort_key(
+     void )
+{
+	uint32_t values[ 3 ] = {
+		0x00000021UL,
+		0x544b3d2eUL,
+		0x00000000UL };
+
+	int64_t expected_sort_keys[ 3 ] = {
+		119600064000000000,
+		129289340620000000,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	libcerror_error_t *error                    = NULL;
+	libfdatetime_fat_date_time_t *fat_date_time = NULL;
+	int64_t sort_key                            = 0;
+	int result                                  = 0;
+	int value_index                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_fat_date_time_initialize(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "fat_date_time",
+	 fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfdatetime_fat_date_time_copy_from_32bit(
+		          fat_date_time,
+		          values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_fat_date_time_get_sort_key(
+		          fat_date_time,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_fat_date_time_get_sort_key(
+	          NULL,
+	          &sort_key,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_get_sort_key(
+	          fat_date_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_fat_date_time_free(
+	          &fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "fat_date_time",
+	 fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fat_date_time != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &fat_date_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_fat_date_time_array_get_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_fat_date_time_array_get_sort_keys(
+     void )
+{
+	uint32_t fat_date_time_values[ 3 ] = {
+		0x00000021UL,
+		0x544b3d2eUL,
+		0x00000000UL };
+
+	int64_t expected_sort_keys[ 3 ] = {
+		119600064000000000,
+		129289340620000000,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	int64_t sort_keys[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_fat_date_time_array_get_sort_keys(
+	          fat_date_time_values,
+	          3,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_fat_date_time_array_get_sort_keys(
+	          NULL,
+	          3,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_array_get_sort_keys(
+	          fat_date_time_values,
+	          (size_t) SSIZE_MAX,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_array_get_sort_keys(
+	          fat_date_time_values,
+	          3,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_fat_date_time_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_fat_date_time_compare(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfdatetime_fat_date_time_t *first_fat_date_time  = NULL;
+	libfdatetime_fat_date_time_t *second_fat_date_time = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_fat_date_time_initialize(
+	          &first_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_fat_date_time",
+	 first_fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_initialize(
+	          &second_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_fat_date_time",
+	 second_fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_copy_from_32bit(
+	          first_fat_date_time,
+	          0x00000021UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_copy_from_32bit(
+	          second_fat_date_time,
+	          0x544b3d2eUL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_fat_date_time_compare(
+	          first_fat_date_time,
+	          second_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_compare(
+	          second_fat_date_time,
+	          first_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_compare(
+	          first_fat_date_time,
+	          first_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_fat_date_time_compare(
+	          NULL,
+	          second_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_fat_date_time_compare(
+	          first_fat_date_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_fat_date_time_free(
+	          &first_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_fat_date_time",
+	 first_fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_fat_date_time_free(
+	          &second_fat_date_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_fat_date_time",
+	 second_fat_date_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_fat_date_time != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &second_fat_date_time,
+		 NULL );
+	}
+	if( first_fat_date_time != NULL )
+	{
+		libfdatetime_fat_date_time_free(
+		 &first_fat_date_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfdatetime_fat_date_time_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -2791,8 +3746,28 @@ int main(
 	 "libfdatetime_internal_fat_date_time_copy_to_date_time_values",
 	 fdatetime_test_internal_fat_date_time_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_fat_date_time_copy_from_date_time_values",
+	 fdatetime_test_internal_fat_date_time_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_fat_date_time_get_sort_key",
+	 fdatetime_test_fat_date_time_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_fat_date_time_array_get_sort_keys",
+	 fdatetime_test_fat_date_time_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_fat_date_time_compare",
+	 fdatetime_test_fat_date_time_compare );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_fat_date_time_copy_from_date_time_values",
+	 fdatetime_test_fat_date_time_copy_from_date_time_values );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_fat_date_time_get_string_size",
 	 fdatetime_test_fat_date_time_get_string_size );
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -270,17 +271,3427 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfdatetime_filetime_add function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_add(
+     void )
+{
+	libfdatetime_filetime_t *first_filetime  = NULL;
+	libfdatetime_filetime_t *second_filetime = NULL;
+	libcerror_error_t *error                 = NULL;
+	uint64_t value_64bit                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &first_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0x00000000ffffffffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0x0000000000000001ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_add(
+	          first_filetime,
+	          second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          first_filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0000000100000000ULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_add(
+	          NULL,
+	          second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_add(
+	          first_filetime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test additional value out of bounds
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0x0000000000000001ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_add(
+	          first_filetime,
+	          second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          first_filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &first_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &second_filetime,
+		 NULL );
+	}
+	if( first_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &first_filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_subtract function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_subtract(
+     void )
+{
+	libfdatetime_filetime_t *first_filetime  = NULL;
+	libfdatetime_filetime_t *second_filetime = NULL;
+	libcerror_error_t *error                 = NULL;
+	uint64_t value_64bit                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &first_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0x0000000100000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0x0000000000000001ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_subtract(
+	          first_filetime,
+	          second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          first_filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x00000000ffffffffULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_subtract(
+	          NULL,
+	          second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_subtract(
+	          first_filetime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test subtracted value out of bounds
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0x0000000000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0x0000000000000001ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_subtract(
+	          first_filetime,
+	          second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          first_filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &first_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &second_filetime,
+		 NULL );
+	}
+	if( first_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &first_filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_add_number_of_ticks function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_add_number_of_ticks(
+     void )
+{
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t value_64bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0x00000000ffffffffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_add_number_of_ticks(
+	          filetime,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0000000100000000ULL );
+
+	result = libfdatetime_filetime_add_number_of_ticks(
+	          filetime,
+	          -2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x00000000fffffffeULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_add_number_of_ticks(
+	          NULL,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_add_number_of_ticks(
+	          filetime,
+	          -( (int64_t) 0x7fffffffffffffffLL ) - 1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_add_number_of_ticks(
+	          filetime,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_get_difference function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_get_difference(
+     void )
+{
+	libfdatetime_filetime_t *first_filetime  = NULL;
+	libfdatetime_filetime_t *second_filetime = NULL;
+	libcerror_error_t *error                 = NULL;
+	int64_t number_of_ticks                  = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &first_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0x01cb53f2cf0ec807ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0x01cb53f2ce763187ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_get_difference(
+	          first_filetime,
+	          second_filetime,
+	          &number_of_ticks,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_ticks",
+	 number_of_ticks,
+	 (int64_t) 10000000 );
+
+	result = libfdatetime_filetime_get_difference(
+	          second_filetime,
+	          first_filetime,
+	          &number_of_ticks,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_ticks",
+	 number_of_ticks,
+	 (int64_t) -10000000 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_get_difference(
+	          NULL,
+	          second_filetime,
+	          &number_of_ticks,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_get_difference(
+	          first_filetime,
+	          NULL,
+	          &number_of_ticks,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_get_difference(
+	          first_filetime,
+	          second_filetime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &second_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &first_filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &second_filetime,
+		 NULL );
+	}
+	if( first_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &first_filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_array_get_differences function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_array_get_differences(
+     void )
+{
+	uint64_t first_filetime_values[ 5 ] = {
+		0x01cb53f2cf0ec807UL,
+		0x01cb53f2ce763187UL,
+		0xffffffffffffffffUL,
+		0x0000000000000000UL,
+		0x0000000000000000UL };
+
+	uint64_t second_filetime_values[ 5 ] = {
+		0x01cb53f2ce763187UL,
+		0x01cb53f2cf0ec807UL,
+		0x0000000000000000UL,
+		0x8000000000000000UL,
+		0xffffffffffffffffUL };
+
+	int64_t expected_differences[ 5 ] = {
+		10000000,
+		-10000000,
+		(int64_t) 0x7fffffffffffffffLL,
+		-( (int64_t) 0x7fffffffffffffffLL ) - 1,
+		-( (int64_t) 0x7fffffffffffffffLL ) - 1 };
+
+	int64_t differences[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_array_get_differences(
+	          first_filetime_values,
+	          second_filetime_values,
+	          5,
+	          differences,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "differences[ value_index ]",
+		 differences[ value_index ],
+		 expected_differences[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_array_get_differences(
+	          NULL,
+	          second_filetime_values,
+	          5,
+	          differences,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_get_differences(
+	          first_filetime_values,
+	          NULL,
+	          5,
+	          differences,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_get_differences(
+	          first_filetime_values,
+	          second_filetime_values,
+	          (size_t) SSIZE_MAX,
+	          differences,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_get_differences(
+	          first_filetime_values,
+	          second_filetime_values,
+	          5,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_truncate(
+     void )
+{
+	int units[ 6 ] = {
+		LIBFDATETIME_TRUNCATE_UNIT_SECOND,
+		LIBFDATETIME_TRUNCATE_UNIT_MINUTE,
+		LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+		LIBFDATETIME_TRUNCATE_UNIT_DAY,
+		LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+		LIBFDATETIME_TRUNCATE_UNIT_YEAR };
+
+	/* February 29, 2024 13:45:12.3456789 truncated to every unit
+	 */
+	uint64_t expected_values[ 6 ] = {
+		0x01da6b15845ca400UL,
+		0x01da6b157d359600UL,
+		0x01da6b0f33e24800UL,
+		0x01da6aa23ce90000UL,
+		0x01da54a199580000UL,
+		0x01da3c457689c000UL };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	uint64_t value_64bit              = 0;
+	int result                        = 0;
+	int unit_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( unit_index = 0;
+	     unit_index < 6;
+	     unit_index++ )
+	{
+		result = libfdatetime_filetime_copy_from_64bit(
+		          filetime,
+		          0x01da6b1584916315UL,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_truncate(
+		          filetime,
+		          units[ unit_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_64bit(
+		          filetime,
+		          &value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ unit_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_truncate(
+	          NULL,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_truncate(
+	          filetime,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_array_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_array_truncate(
+     void )
+{
+	uint64_t filetime_values[ 2 ] = {
+		0x01da6b1584916315UL,
+		0x01da6b1584916315UL };
+
+	uint64_t truncated_filetime_values[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_array_truncate(
+	          filetime_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+	          truncated_filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "truncated_filetime_values[ 1 ]",
+	 truncated_filetime_values[ 1 ],
+	 0x01da54a199580000UL );
+
+	/* Test truncating in place
+	 */
+	result = libfdatetime_filetime_array_truncate(
+	          filetime_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime_values[ 0 ]",
+	 filetime_values[ 0 ],
+	 0x01da6b0f33e24800UL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_array_truncate(
+	          NULL,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_truncate(
+	          filetime_values,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_truncate(
+	          filetime_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_truncate(
+	          filetime_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          truncated_filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfdatetime_filetime_copy_from_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fdatetime_test_filetime_copy_from_byte_stream(
+int fdatetime_test_filetime_copy_from_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          NULL,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          NULL,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          4,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          -1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_copy_from_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_from_64bit(
+     void )
+{
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t value_64bit              = 0x1cb3a623d0a17ce;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          NULL,
+	          value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_copy_to_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_to_64bit(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t value_64bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 0x1cb3a623d0a17ce );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_copy_to_64bit(
+	          NULL,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint32_t fdatetime_test_filetime_get_random_value(
+          uint32_t *random_state )
+{
+	uint32_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Tests the libfdatetime_filetime_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_from_utf8_string(
+     void )
+{
+	const char *invalid_strings[ 16 ] = {
+		"",
+		"2010-09-1",
+		"2010/09/14",
+		"2010-09-1a",
+		"2010-13-14",
+		"2010-02-29",
+		"2010-09-14X09:54:23",
+		"2010-09-14T09:54",
+		"2010-09-14T24:00:00",
+		"2010-09-14T09:54:60",
+		"2010-09-14T09:5a:23",
+		"2010-09-14T09:54:23.",
+		"2010-09-14T09:54:23Zx",
+		"2010-09-14T09:54:23+24:00",
+		"2010-09-14T09:54:23+02",
+		"1600-12-31T23:59:59Z" };
+
+	const char *valid_strings[ 9 ] = {
+		"2010-09-14T09:54:23Z",
+		"2010-09-14T09:54:23.1234567Z",
+		"2010-09-14 09:54:23.123456789",
+		"2010-09-14t09:54:23,5z",
+		"2010-09-14T11:54:23+02:00",
+		"2010-09-14T04:24:23-05:30",
+		"2010-09-14",
+		"1601-01-01T00:00:00Z",
+		"9999-12-31T23:59:59.99999999999Z" };
+
+	uint64_t expected_values[ 9 ] = {
+		0x1cb53f2cefbf180UL,
+		0x1cb53f2cf0ec807UL,
+		0x1cb53f2cf0ec807UL,
+		0x1cb53f2cf483cc0UL,
+		0x1cb53f2cefbf180UL,
+		0x1cb53f2cefbf180UL,
+		0x1cb539fc62e0000UL,
+		0,
+		0x24c85a5ed1c03fffUL };
+
+	uint8_t utf8_string[ 32 ];
+
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t value_64bit              = 0;
+	int result                        = 0;
+	int string_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 9;
+	     string_index++ )
+	{
+		result = libfdatetime_filetime_copy_from_utf8_string(
+		          filetime,
+		          (uint8_t *) valid_strings[ string_index ],
+		          narrow_string_length( valid_strings[ string_index ] ),
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_64bit(
+		          filetime,
+		          &value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ string_index ] );
+	}
+	/* Test string terminated by an end of string character
+	 */
+	result = memory_set(
+	          utf8_string,
+	          0,
+	          32 ) != NULL;
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_copy(
+	          utf8_string,
+	          "2010-09-14T09:54:23Z",
+	          20 ) != NULL;
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfdatetime_filetime_copy_from_utf8_string(
+	          filetime,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x1cb53f2cefbf180UL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_copy_from_utf8_string(
+	          NULL,
+	          (uint8_t *) valid_strings[ 0 ],
+	          20,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_utf8_string(
+	          filetime,
+	          NULL,
+	          20,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_utf8_string(
+	          filetime,
+	          (uint8_t *) valid_strings[ 0 ],
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_utf8_string(
+	          filetime,
+	          (uint8_t *) valid_strings[ 0 ],
+	          20,
+	          0xff,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( string_index = 0;
+	     string_index < 16;
+	     string_index++ )
+	{
+		result = libfdatetime_filetime_copy_from_utf8_string(
+		          filetime,
+		          (uint8_t *) invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests round trips of libfdatetime_filetime_copy_to_utf8_string and libfdatetime_filetime_copy_from_utf8_string
+ * and that libfdatetime_filetime_copy_from_utf8_string handles mutated strings
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_from_utf8_string_round_trip(
+     void )
+{
+	uint32_t string_format_flags[ 5 ] = {
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+		LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME };
+
+	uint64_t precisions[ 5 ] = {
+		1,
+		1,
+		10,
+		10000,
+		10000000 };
+
+	uint8_t utf8_string[ 48 ];
+
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t string_length              = 0;
+	uint64_t expected_value_64bit     = 0;
+	uint64_t value_64bit              = 0;
+	uint32_t random_state             = 0x1cb3a623UL;
+	int flags_index                   = 0;
+	int iteration                     = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test round trips of values up to 9999-12-31 23:59:59.9999999
+	 */
+	for( iteration = 0;
+	     iteration < 30000;
+	     iteration++ )
+	{
+		flags_index = iteration % 5;
+
+		value_64bit   = fdatetime_test_filetime_get_random_value( &random_state );
+		value_64bit <<= 32;
+		value_64bit  |= fdatetime_test_filetime_get_random_value( &random_state );
+		value_64bit  %= (uint64_t) 0x24c85a5ed1c04000UL;
+
+		expected_value_64bit = value_64bit - ( value_64bit % precisions[ flags_index ] );
+
+		result = libfdatetime_filetime_copy_from_64bit(
+		          filetime,
+		          value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfdatetime_filetime_copy_to_utf8_string(
+		          filetime,
+		          utf8_string,
+		          48,
+		          string_format_flags[ flags_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_from_utf8_string(
+		          filetime,
+		          utf8_string,
+		          48,
+		          string_format_flags[ flags_index ] & 0x000000ffUL,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_64bit(
+		          filetime,
+		          &value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_value_64bit );
+
+		/* Test that a mutated or truncated string is either rejected or converted
+		 */
+		string_length = narrow_string_length(
+		                 (char *) utf8_string );
+
+		utf8_string[ fdatetime_test_filetime_get_random_value( &random_state ) % string_length ] = (uint8_t) fdatetime_test_filetime_get_random_value( &random_state );
+
+		result = libfdatetime_filetime_copy_from_utf8_string(
+		          filetime,
+		          utf8_string,
+		          1 + ( fdatetime_test_filetime_get_random_value( &random_state ) % string_length ),
+		          string_format_flags[ flags_index ] & 0x000000ffUL,
+		          &error );
+
+		if( result == -1 )
+		{
+			FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			FDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_copy_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_from_utf16_string(
+     void )
+{
+	const char *utf8_strings[ 2 ] = {
+		"2010-09-14T09:54:23.1234567Z",
+		"Sep 14, 2010 09:54:23.123 UTC" };
+
+	uint64_t expected_values[ 2 ] = {
+		0x01cb53f2cf0ec807UL,
+		0x01cb53f2cf0eb630UL };
+
+	uint16_t utf16_string[ 32 ];
+
+	libfdatetime_filetime_t *filetime = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t string_index               = 0;
+	uint64_t value_64bit              = 0;
+	int result                        = 0;
+	int string_number                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( string_number = 0;
+	     string_number < 2;
+	     string_number++ )
+	{
+		for( string_index = 0;
+		     utf8_strings[ string_number ][ string_index ] != 0;
+		     string_index++ )
+		{
+			utf16_string[ string_index ] = (uint16_t) utf8_strings[ string_number ][ string_index ];
+		}
+		utf16_string[ string_index ] = 0;
+
+		result = libfdatetime_filetime_copy_from_utf16_string(
+		          filetime,
+		          utf16_string,
+		          32,
+		          ( string_number == 0 ) ? LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 : LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_64bit(
+		          filetime,
+		          &value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ string_number ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_copy_from_utf16_string(
+	          NULL,
+	          utf16_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_utf16_string(
+	          filetime,
+	          utf16_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf16_string[ 0 ] = 0x0160;
+
+	result = libfdatetime_filetime_copy_from_utf16_string(
+	          filetime,
+	          utf16_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_copy_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_to_posix_time(
+     void )
+{
+	uint64_t valid_values[ 5 ] = {
+		0x01cb53f2cf0ec807UL,
+		0x01cb53f2cf0ec807UL,
+		0x01cb53f2cf0ec807UL,
+		0x0000000000000000UL,
+		0xffffffffffffffffUL };
+
+	uint8_t valid_value_types[ 5 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED };
+
+	uint64_t expected_values[ 5 ] = {
+		0x000000004c8f464fUL,
+		0x000490353294d400UL,
+		0x11d34fcd955c22bcUL,
+		0xfffffffd49ef6f00UL,
+		0x000001aac9191acaUL };
+
+	uint8_t invalid_value_types[ 3 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_filetime_t *filetime     = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t value_64bit                  = 0;
+	uint32_t value_32bit                  = 0;
+	uint8_t value_type                    = 0;
+	int result                            = 0;
+	int value_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		result = libfdatetime_filetime_copy_from_64bit(
+		          filetime,
+		          valid_values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_posix_time(
+		          filetime,
+		          posix_time,
+		          valid_value_types[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( valid_value_types[ value_index ] == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+		{
+			result = libfdatetime_posix_time_copy_to_32bit(
+			          posix_time,
+			          &value_32bit,
+			          &value_type,
+			          &error );
+
+			value_64bit = value_32bit;
+		}
+		else
+		{
+			result = libfdatetime_posix_time_copy_to_64bit(
+			          posix_time,
+			          &value_64bit,
+			          &value_type,
+			          &error );
+		}
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+		 "value_type",
+		 value_type,
+		 valid_value_types[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_copy_to_posix_time(
+	          NULL,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_to_posix_time(
+	          filetime,
+	          NULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_to_posix_time(
+	          filetime,
+	          posix_time,
+	          0xff,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a FILETIME of January 1, 1601 that cannot be represented by the value types
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfdatetime_filetime_copy_to_posix_time(
+		          filetime,
+		          posix_time,
+		          invalid_value_types[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_array_copy_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_array_copy_to_posix_time(
+     void )
+{
+	uint64_t filetime_values[ 3 ] = {
+		0x019db1ded53e8000UL,
+		0x01cb53f2cf0ec807UL,
+		0x019db1ded53e7fffUL };
+
+	uint64_t expected_values[ 3 ] = {
+		0x0000000000000000UL,
+		0x11d34fcd955c22bcUL,
+		0xffffffffffffff9cUL };
+
+	uint64_t posix_time_values[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_array_copy_to_posix_time(
+	          filetime_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	          posix_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "posix_time_values[ value_index ]",
+		 posix_time_values[ value_index ],
+		 expected_values[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_array_copy_to_posix_time(
+	          NULL,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	          posix_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_copy_to_posix_time(
+	          filetime_values,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	          posix_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_copy_to_posix_time(
+	          filetime_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value that cannot be represented as a POSIX time of the value type
+	 */
+	result = libfdatetime_filetime_array_copy_to_posix_time(
+	          filetime_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          posix_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_internal_filetime_copy_to_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_filetime_copy_to_date_time_values(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	libcerror_error_t *error                          = NULL;
+	libfdatetime_date_time_values_t *date_time_values = NULL;
+	libfdatetime_filetime_t *filetime                 = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_date_time_values_initialize(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_internal_filetime_copy_to_date_time_values(
+	          (libfdatetime_internal_filetime_t *) filetime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the last day of 1699 and the first day of 1700
+	 */
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0x006efd14845c8000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_filetime_copy_to_date_time_values(
+	          (libfdatetime_internal_filetime_t *) filetime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 1699 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 12 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 31 );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0x006efdddaec64000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_filetime_copy_to_date_time_values(
+	          (libfdatetime_internal_filetime_t *) filetime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 1700 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_filetime_copy_to_date_time_values(
+	          NULL,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_filetime_copy_to_date_time_values(
+	          (libfdatetime_internal_filetime_t *) filetime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_date_time_values_free(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_date_time_values_free(
+		 &date_time_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_filetime_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_filetime_copy_from_date_time_values(
      void )
 {
-	uint8_t byte_stream[ 8 ] = {
-		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_filetime_t internal_filetime;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	date_time_values.year          = 2010;
+	date_time_values.month         = 9;
+	date_time_values.day           = 14;
+	date_time_values.hours         = 9;
+	date_time_values.minutes       = 54;
+	date_time_values.seconds       = 23;
+	date_time_values.milli_seconds = 123;
+	date_time_values.micro_seconds = 456;
+	date_time_values.nano_seconds  = 789;
+
+	result = libfdatetime_internal_filetime_copy_from_date_time_values(
+	          &internal_filetime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_filetime.upper",
+	 internal_filetime.upper,
+	 0x01cb53f2 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_filetime.lower",
+	 internal_filetime.lower,
+	 0xcf0ec807 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_filetime_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_filetime_copy_from_date_time_values(
+	          &internal_filetime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.milli_seconds = 1000;
+
+	result = libfdatetime_internal_filetime_copy_from_date_time_values(
+	          &internal_filetime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year          = 1600;
+	date_time_values.milli_seconds = 0;
+
+	result = libfdatetime_internal_filetime_copy_from_date_time_values(
+	          &internal_filetime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_filetime_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
 
-	libfdatetime_filetime_t *filetime = NULL;
 	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
 	int result                        = 0;
 
 	/* Initialize test
@@ -304,11 +3715,15 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 
 	/* Test regular cases
 	 */
-	result = libfdatetime_filetime_copy_from_byte_stream(
+	result = libfdatetime_filetime_copy_from_date_time_values(
 	          filetime,
-	          byte_stream,
-	          8,
-	          LIBFDATETIME_ENDIAN_BIG,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -320,11 +3735,11 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 	 "error",
 	 error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
+	result = libfdatetime_filetime_copy_to_utf8_string(
 	          filetime,
-	          byte_stream,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -336,13 +3751,27 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 	 "error",
 	 error );
 
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfdatetime_filetime_copy_from_byte_stream(
+	result = libfdatetime_filetime_copy_from_date_time_values(
 	          NULL,
-	          byte_stream,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -357,11 +3786,15 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
+	result = libfdatetime_filetime_copy_from_date_time_values(
 	          filetime,
-	          NULL,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -376,11 +3809,61 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
+	result = libfdatetime_filetime_copy_from_date_time_values(
 	          filetime,
-	          byte_stream,
-	          4,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_date_time_values(
+	          filetime,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_copy_from_date_time_values(
+	          filetime,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -395,11 +3878,127 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
-	          filetime,
-	          byte_stream,
-	          (size_t) SSIZE_MAX + 1,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_filetime_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_filetime_get_sort_key(
+     void )
+{
+	uint64_t values[ 3 ] = {
+		0x01cb53f2cf0ec807UL,
+		0x0000000000000000UL,
+		0xffffffffffffffffUL };
+
+	int64_t expected_sort_keys[ 3 ] = {
+		129289316631234567,
+		0,
+		LIBFDATETIME_SORT_KEY_MAXIMUM };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	int64_t sort_key                  = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfdatetime_filetime_copy_from_64bit(
+		          filetime,
+		          values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_get_sort_key(
+		          filetime,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_filetime_get_sort_key(
+	          NULL,
+	          &sort_key,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -414,11 +4013,9 @@ int fdatetime_test_filetime_copy_from_byte_stream(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
+	result = libfdatetime_filetime_get_sort_key(
 	          filetime,
-	          byte_stream,
-	          8,
-	          -1,
+	          NULL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -469,21 +4066,34 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfdatetime_filetime_copy_from_64bit function
+/* Tests the libfdatetime_filetime_array_get_sort_keys function
  * Returns 1 if successful or 0 if not
  */
-int fdatetime_test_filetime_copy_from_64bit(
+int fdatetime_test_filetime_array_get_sort_keys(
      void )
 {
-	libfdatetime_filetime_t *filetime = NULL;
-	libcerror_error_t *error          = NULL;
-	uint64_t value_64bit              = 0x1cb3a623d0a17ce;
-	int result                        = 0;
+	uint64_t filetime_values[ 3 ] = {
+		0x01cb53f2cf0ec807UL,
+		0x0000000000000000UL,
+		0xffffffffffffffffUL };
 
-	/* Initialize test
+	int64_t expected_sort_keys[ 3 ] = {
+		129289316631234567,
+		0,
+		LIBFDATETIME_SORT_KEY_MAXIMUM };
+
+	int64_t sort_keys[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
 	 */
-	result = libfdatetime_filetime_initialize(
-	          &filetime,
+	result = libfdatetime_filetime_array_get_sort_keys(
+	          filetime_values,
+	          3,
+	          sort_keys,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -491,35 +4101,43 @@ int fdatetime_test_filetime_copy_from_64bit(
 	 result,
 	 1 );
 
-	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "filetime",
-	 filetime );
-
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
 	 */
-	result = libfdatetime_filetime_copy_from_64bit(
-	          filetime,
-	          value_64bit,
+	result = libfdatetime_filetime_array_get_sort_keys(
+	          NULL,
+	          3,
+	          sort_keys,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FDATETIME_TEST_ASSERT_IS_NULL(
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfdatetime_filetime_copy_from_64bit(
-	          NULL,
-	          value_64bit,
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_filetime_array_get_sort_keys(
+	          filetime_values,
+	          (size_t) SSIZE_MAX,
+	          sort_keys,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -534,25 +4152,24 @@ int fdatetime_test_filetime_copy_from_64bit(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfdatetime_filetime_free(
-	          &filetime,
+	result = libfdatetime_filetime_array_get_sort_keys(
+	          filetime_values,
+	          3,
+	          NULL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "filetime",
-	 filetime );
+	 -1 );
 
-	FDATETIME_TEST_ASSERT_IS_NULL(
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -561,33 +4178,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfdatetime_filetime_copy_to_64bit function
+/* Tests the libfdatetime_filetime_compare function
  * Returns 1 if successful or 0 if not
  */
-int fdatetime_test_filetime_copy_to_64bit(
+int fdatetime_test_filetime_compare(
      void )
 {
-	uint8_t byte_stream[ 8 ] = {
-		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
-
-	libfdatetime_filetime_t *filetime = NULL;
-	libcerror_error_t *error          = NULL;
-	uint64_t value_64bit              = 0;
-	int result                        = 0;
+	libcerror_error_t *error                 = NULL;
+	libfdatetime_filetime_t *first_filetime  = NULL;
+	libfdatetime_filetime_t *second_filetime = NULL;
+	int result                               = 0;
 
 	/* Initialize test
 	 */
 	result = libfdatetime_filetime_initialize(
-	          &filetime,
+	          &first_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -596,18 +4204,15 @@ int fdatetime_test_filetime_copy_to_64bit(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "filetime",
-	 filetime );
+	 "first_filetime",
+	 first_filetime );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
-	          filetime,
-	          byte_stream,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	result = libfdatetime_filetime_initialize(
+	          &second_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -615,15 +4220,17 @@ int fdatetime_test_filetime_copy_to_64bit(
 	 result,
 	 1 );
 
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_filetime",
+	 second_filetime );
+
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfdatetime_filetime_copy_to_64bit(
-	          filetime,
-	          &value_64bit,
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0x0000000000000000UL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -631,107 +4238,73 @@ int fdatetime_test_filetime_copy_to_64bit(
 	 result,
 	 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
-	 "value_64bit",
-	 value_64bit,
-	 0x1cb3a623d0a17ce );
-
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfdatetime_filetime_copy_to_64bit(
-	          NULL,
-	          &value_64bit,
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0x01cb53f2cf0ec807UL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfdatetime_filetime_copy_to_64bit(
-	          filetime,
-	          NULL,
+	/* Test regular cases
+	 */
+	result = libfdatetime_filetime_compare(
+	          first_filetime,
+	          second_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 LIBFDATETIME_COMPARE_LESS );
 
-	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfdatetime_filetime_free(
-	          &filetime,
+	result = libfdatetime_filetime_compare(
+	          second_filetime,
+	          first_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "filetime",
-	 filetime );
+	 LIBFDATETIME_COMPARE_GREATER );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
-	return( 0 );
-}
-
-#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+	result = libfdatetime_filetime_compare(
+	          first_filetime,
+	          first_filetime,
+	          &error );
 
-/* Tests the libfdatetime_internal_filetime_copy_to_date_time_values function
- * Returns 1 if successful or 0 if not
- */
-int fdatetime_test_internal_filetime_copy_to_date_time_values(
-     void )
-{
-	uint8_t byte_stream[ 8 ] = {
-		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
 
-	libcerror_error_t *error                          = NULL;
-	libfdatetime_date_time_values_t *date_time_values = NULL;
-	libfdatetime_filetime_t *filetime                 = NULL;
-	int result                                        = 0;
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
+	/* Test distinct values that exceed the range of a sort key
 	 */
-	result = libfdatetime_date_time_values_initialize(
-	          &date_time_values,
+	result = libfdatetime_filetime_copy_from_64bit(
+	          first_filetime,
+	          0x8000000000000000ULL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -739,16 +4312,13 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 	 result,
 	 1 );
 
-	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "date_time_values",
-	 date_time_values );
-
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_filetime_initialize(
-	          &filetime,
+	result = libfdatetime_filetime_copy_from_64bit(
+	          second_filetime,
+	          0xffffffffffffffffULL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -756,41 +4326,33 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 	 result,
 	 1 );
 
-	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "filetime",
-	 filetime );
-
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_filetime_copy_from_byte_stream(
-	          filetime,
-	          byte_stream,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
+	result = libfdatetime_filetime_compare(
+	          first_filetime,
+	          second_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 LIBFDATETIME_COMPARE_LESS );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfdatetime_internal_filetime_copy_to_date_time_values(
-	          (libfdatetime_internal_filetime_t *) filetime,
-	          date_time_values,
+	result = libfdatetime_filetime_compare(
+	          second_filetime,
+	          first_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 LIBFDATETIME_COMPARE_GREATER );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -798,9 +4360,9 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 
 	/* Test error cases
 	 */
-	result = libfdatetime_internal_filetime_copy_to_date_time_values(
+	result = libfdatetime_filetime_compare(
 	          NULL,
-	          date_time_values,
+	          second_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -815,8 +4377,8 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_internal_filetime_copy_to_date_time_values(
-	          (libfdatetime_internal_filetime_t *) filetime,
+	result = libfdatetime_filetime_compare(
+	          first_filetime,
 	          NULL,
 	          &error );
 
@@ -835,7 +4397,7 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 	/* Clean up
 	 */
 	result = libfdatetime_filetime_free(
-	          &filetime,
+	          &first_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -844,15 +4406,15 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "filetime",
-	 filetime );
+	 "first_filetime",
+	 first_filetime );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_date_time_values_free(
-	          &date_time_values,
+	result = libfdatetime_filetime_free(
+	          &second_filetime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -861,8 +4423,8 @@ int fdatetime_test_internal_filetime_copy_to_date_time_values(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "date_time_values",
-	 date_time_values );
+	 "second_filetime",
+	 second_filetime );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -876,23 +4438,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( filetime != NULL )
+	if( second_filetime != NULL )
 	{
 		libfdatetime_filetime_free(
-		 &filetime,
+		 &second_filetime,
 		 NULL );
 	}
-	if( filetime != NULL )
+	if( first_filetime != NULL )
 	{
-		libfdatetime_date_time_values_free(
-		 &date_time_values,
+		libfdatetime_filetime_free(
+		 &first_filetime,
 		 NULL );
 	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
-
 /* Tests the libfdatetime_filetime_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -2789,7 +6349,33 @@ int main(
 	 "libfdatetime_filetime_free",
 	 fdatetime_test_filetime_free );
 
-	/* TODO: add test for libfdatetime_filetime_add */
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_add",
+	 fdatetime_test_filetime_add );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_subtract",
+	 fdatetime_test_filetime_subtract );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_add_number_of_ticks",
+	 fdatetime_test_filetime_add_number_of_ticks );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_get_difference",
+	 fdatetime_test_filetime_get_difference );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_array_get_differences",
+	 fdatetime_test_filetime_array_get_differences );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_truncate",
+	 fdatetime_test_filetime_truncate );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_array_truncate",
+	 fdatetime_test_filetime_array_truncate );
 
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_filetime_copy_from_byte_stream",
@@ -2803,14 +6389,54 @@ int main(
 	 "libfdatetime_filetime_copy_to_64bit",
 	 fdatetime_test_filetime_copy_to_64bit );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_copy_from_utf8_string",
+	 fdatetime_test_filetime_copy_from_utf8_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_copy_from_utf8_string_round_trip",
+	 fdatetime_test_filetime_copy_from_utf8_string_round_trip );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_copy_from_utf16_string",
+	 fdatetime_test_filetime_copy_from_utf16_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_copy_to_posix_time",
+	 fdatetime_test_filetime_copy_to_posix_time );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_array_copy_to_posix_time",
+	 fdatetime_test_filetime_array_copy_to_posix_time );
+
 #if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
 
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_internal_filetime_copy_to_date_time_values",
 	 fdatetime_test_internal_filetime_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_filetime_copy_from_date_time_values",
+	 fdatetime_test_internal_filetime_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_get_sort_key",
+	 fdatetime_test_filetime_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_array_get_sort_keys",
+	 fdatetime_test_filetime_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_compare",
+	 fdatetime_test_filetime_compare );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_filetime_copy_from_date_time_values",
+	 fdatetime_test_filetime_copy_from_date_time_values );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_filetime_get_string_size",
 	 fdatetime_test_filetime_get_string_size );
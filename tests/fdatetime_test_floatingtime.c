@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -796,11 +797,911 @@ int fdatetime_test_internal_floatingtime_copy_to_date_time_values(
 	 "error",
 	 error );
 
+	/* Test a whole number of days at the end of a year, which is Jan 1, 2000
+	 */
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0x40e1d5c000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 2000 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->hours",
+	 date_time_values->hours,
+	 (uint8_t) 0 );
+
+	/* Test a negative value, which is Dec 29, 1899 06:00:00
+	 */
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0xbff4000000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 1899 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 12 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 29 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->hours",
+	 date_time_values->hours,
+	 (uint8_t) 6 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          NULL,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the value is NaN
+	 */
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0x7ff8000000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the value is positive infinity
+	 */
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0x7ff0000000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the value is negative infinity
+	 */
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0xfff0000000000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_floatingtime_free(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "floatingtime",
+	 floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_date_time_values_free(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floatingtime != NULL )
+	{
+		libfdatetime_floatingtime_free(
+		 &floatingtime,
+		 NULL );
+	}
+	if( floatingtime != NULL )
+	{
+		libfdatetime_date_time_values_free(
+		 &date_time_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_floatingtime_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_floatingtime_copy_from_date_time_values(
+     void )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_date_time_values_t round_trip_date_time_values;
+	libfdatetime_internal_floatingtime_t internal_floatingtime;
+
+	uint16_t years[ 4 ] = {
+		1899, 1900, 2010, 9999 };
+
+	uint8_t months[ 4 ] = {
+		12, 1, 9, 12 };
+
+	uint8_t days[ 4 ] = {
+		30, 1, 14, 31 };
+
+	uint8_t hours[ 4 ] = {
+		0, 6, 12, 18 };
+
+	double expected_values[ 4 ] = {
+		0.0, 2.25, 40435.5, 2958465.75 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	date_time_values.minutes       = 0;
+	date_time_values.seconds       = 0;
+	date_time_values.milli_seconds = 0;
+	date_time_values.micro_seconds = 0;
+	date_time_values.nano_seconds  = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		date_time_values.year  = years[ value_index ];
+		date_time_values.month = months[ value_index ];
+		date_time_values.day   = days[ value_index ];
+		date_time_values.hours = hours[ value_index ];
+
+		result = libfdatetime_internal_floatingtime_copy_from_date_time_values(
+		          &internal_floatingtime,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_FLOAT(
+		 "internal_floatingtime.timestamp.floating_point",
+		 internal_floatingtime.timestamp.floating_point,
+		 expected_values[ value_index ] );
+
+		result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+		          &internal_floatingtime,
+		          &round_trip_date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.year",
+		 (int) round_trip_date_time_values.year,
+		 (int) years[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.month",
+		 (int) round_trip_date_time_values.month,
+		 (int) months[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.day",
+		 (int) round_trip_date_time_values.day,
+		 (int) days[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.hours",
+		 (int) round_trip_date_time_values.hours,
+		 (int) hours[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_floatingtime_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_floatingtime_copy_from_date_time_values(
+	          &internal_floatingtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year  = 1899;
+	date_time_values.month = 12;
+	date_time_values.day   = 29;
+
+	result = libfdatetime_internal_floatingtime_copy_from_date_time_values(
+	          &internal_floatingtime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_floatingtime_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_floatingtime_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                  = NULL;
+	libfdatetime_floatingtime_t *floatingtime = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_floatingtime_initialize(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "floatingtime",
+	 floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_floatingtime_copy_from_date_time_values(
+	          floatingtime,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_copy_to_utf8_string(
+	          floatingtime,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_floatingtime_copy_from_date_time_values(
+	          NULL,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_copy_from_date_time_values(
+	          floatingtime,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_copy_from_date_time_values(
+	          floatingtime,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_copy_from_date_time_values(
+	          floatingtime,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_copy_from_date_time_values(
+	          floatingtime,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_floatingtime_free(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "floatingtime",
+	 floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floatingtime != NULL )
+	{
+		libfdatetime_floatingtime_free(
+		 &floatingtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_floatingtime_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_floatingtime_get_sort_key(
+     void )
+{
+	uint64_t values[ 5 ] = {
+		0x0000000000000000UL,
+		0x40d8f84000000000UL,
+		0xbff8000000000000UL,
+		0x7ff8000000000000UL,
+		0x414bd8e800000000UL };
+
+	int64_t expected_sort_keys[ 5 ] = {
+		94353120000000000,
+		116444736000000000,
+		94352688000000000,
+		LIBFDATETIME_SORT_KEY_INVALID,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	libcerror_error_t *error                  = NULL;
+	libfdatetime_floatingtime_t *floatingtime = NULL;
+	int64_t sort_key                          = 0;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_floatingtime_initialize(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "floatingtime",
+	 floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		result = libfdatetime_floatingtime_copy_from_64bit(
+		          floatingtime,
+		          values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_floatingtime_get_sort_key(
+		          floatingtime,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_floatingtime_get_sort_key(
+	          NULL,
+	          &sort_key,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_get_sort_key(
+	          floatingtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_floatingtime_free(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "floatingtime",
+	 floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floatingtime != NULL )
+	{
+		libfdatetime_floatingtime_free(
+		 &floatingtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_floatingtime_array_get_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_floatingtime_array_get_sort_keys(
+     void )
+{
+	uint64_t floatingtime_values[ 5 ] = {
+		0x0000000000000000UL,
+		0x40d8f84000000000UL,
+		0xbff8000000000000UL,
+		0x7ff8000000000000UL,
+		0x414bd8e800000000UL };
+
+	int64_t expected_sort_keys[ 5 ] = {
+		94353120000000000,
+		116444736000000000,
+		94352688000000000,
+		LIBFDATETIME_SORT_KEY_INVALID,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	int64_t sort_keys[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_floatingtime_array_get_sort_keys(
+	          floatingtime_values,
+	          5,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
 	/* Test error cases
 	 */
-	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
+	result = libfdatetime_floatingtime_array_get_sort_keys(
 	          NULL,
-	          date_time_values,
+	          5,
+	          sort_keys,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -815,8 +1716,193 @@ int fdatetime_test_internal_floatingtime_copy_to_date_time_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_internal_floatingtime_copy_to_date_time_values(
-	          (libfdatetime_internal_floatingtime_t *) floatingtime,
+	result = libfdatetime_floatingtime_array_get_sort_keys(
+	          floatingtime_values,
+	          (size_t) SSIZE_MAX,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_array_get_sort_keys(
+	          floatingtime_values,
+	          5,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_floatingtime_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_floatingtime_compare(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_floatingtime_t *first_floatingtime  = NULL;
+	libfdatetime_floatingtime_t *second_floatingtime = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_floatingtime_initialize(
+	          &first_floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_floatingtime",
+	 first_floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_initialize(
+	          &second_floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_floatingtime",
+	 second_floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          first_floatingtime,
+	          0xbff8000000000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          second_floatingtime,
+	          0x0000000000000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_floatingtime_compare(
+	          first_floatingtime,
+	          second_floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_compare(
+	          second_floatingtime,
+	          first_floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_compare(
+	          first_floatingtime,
+	          first_floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_floatingtime_compare(
+	          NULL,
+	          second_floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_floatingtime_compare(
+	          first_floatingtime,
 	          NULL,
 	          &error );
 
@@ -835,7 +1921,7 @@ int fdatetime_test_internal_floatingtime_copy_to_date_time_values(
 	/* Clean up
 	 */
 	result = libfdatetime_floatingtime_free(
-	          &floatingtime,
+	          &first_floatingtime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -844,15 +1930,15 @@ int fdatetime_test_internal_floatingtime_copy_to_date_time_values(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "floatingtime",
-	 floatingtime );
+	 "first_floatingtime",
+	 first_floatingtime );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_date_time_values_free(
-	          &date_time_values,
+	result = libfdatetime_floatingtime_free(
+	          &second_floatingtime,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -861,8 +1947,8 @@ int fdatetime_test_internal_floatingtime_copy_to_date_time_values(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "date_time_values",
-	 date_time_values );
+	 "second_floatingtime",
+	 second_floatingtime );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -876,23 +1962,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( floatingtime != NULL )
+	if( second_floatingtime != NULL )
 	{
 		libfdatetime_floatingtime_free(
-		 &floatingtime,
+		 &second_floatingtime,
 		 NULL );
 	}
-	if( floatingtime != NULL )
+	if( first_floatingtime != NULL )
 	{
-		libfdatetime_date_time_values_free(
-		 &date_time_values,
+		libfdatetime_floatingtime_free(
+		 &first_floatingtime,
 		 NULL );
 	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
-
 /* Tests the libfdatetime_floatingtime_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -2948,8 +4032,28 @@ int main(
 	 "libfdatetime_internal_floatingtime_copy_to_date_time_values",
 	 fdatetime_test_internal_floatingtime_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_floatingtime_copy_from_date_time_values",
+	 fdatetime_test_internal_floatingtime_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_floatingtime_get_sort_key",
+	 fdatetime_test_floatingtime_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_floatingtime_array_get_sort_keys",
+	 fdatetime_test_floatingtime_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_floatingtime_compare",
+	 fdatetime_test_floatingtime_compare );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_floatingtime_copy_from_date_time_values",
+	 fdatetime_test_floatingtime_copy_from_date_time_values );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_floatingtime_get_string_size",
 	 fdatetime_test_floatingtime_get_string_size );
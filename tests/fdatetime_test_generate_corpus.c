@@ -0,0 +1,264 @@
+/*
+ * Generates a synthetic timestamp corpus
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_corpus_generator.h"
+
+/* The default number of values
+ */
+#define FDATETIME_TEST_GENERATE_CORPUS_NUMBER_OF_VALUES	65536
+
+/* Prints usage information
+ */
+void fdatetime_test_generate_corpus_usage_fprint(
+      FILE *stream )
+{
+	int profile = 0;
+
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fdatetime_test_generate_corpus to generate a synthetic timestamp corpus.\n\n" );
+
+	fprintf( stream, "Usage: fdatetime_test_generate_corpus [ -n number_of_values ] [ -s seed ]\n"
+	                 "                                      profile output_file\n\n" );
+
+	fprintf( stream, "\tprofile:     the profile, options:" );
+
+	for( profile = 1;
+	     profile <= FDATETIME_TEST_CORPUS_NUMBER_OF_PROFILES;
+	     profile++ )
+	{
+		fprintf( stream, " %s", fdatetime_test_corpus_generator_get_profile_name( profile ) );
+	}
+	fprintf( stream, "\n" );
+	fprintf( stream, "\toutput_file: the file the values are written to\n\n" );
+	fprintf( stream, "\t-n:          number of values (default is %d)\n",
+	                 FDATETIME_TEST_GENERATE_CORPUS_NUMBER_OF_VALUES );
+	fprintf( stream, "\t-s:          seed of the pseudo random values (default is 1)\n" );
+}
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	const char *output_filename = NULL;
+	const char *profile_name    = NULL;
+	uint8_t *buffer             = NULL;
+	char *value_end             = NULL;
+	FILE *output_stream         = NULL;
+	uint64_t seed               = 1;
+	size_t number_of_values     = FDATETIME_TEST_GENERATE_CORPUS_NUMBER_OF_VALUES;
+	size_t value_size           = 0;
+	int argument_index          = 0;
+	int byte_order              = 0;
+	int profile                 = 0;
+	int timestamp_type          = 0;
+
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( argv[ argument_index ][ 0 ] != '-' )
+		{
+			break;
+		}
+		if( ( narrow_string_length( argv[ argument_index ] ) != 2 )
+		 || ( ( argument_index + 1 ) >= argc ) )
+		{
+			fdatetime_test_generate_corpus_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( argv[ argument_index ][ 1 ] == 'n' )
+		{
+			number_of_values = (size_t) strtoul( argv[ ++argument_index ], &value_end, 10 );
+
+			if( ( *value_end != 0 )
+			 || ( number_of_values == 0 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of values.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else if( argv[ argument_index ][ 1 ] == 's' )
+		{
+			seed = (uint64_t) strtoull( argv[ ++argument_index ], &value_end, 0 );
+
+			if( *value_end != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid seed.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else
+		{
+			fdatetime_test_generate_corpus_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( ( argument_index + 2 ) != argc )
+	{
+		fdatetime_test_generate_corpus_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	profile_name    = argv[ argument_index ];
+	output_filename = argv[ argument_index + 1 ];
+
+	if( fdatetime_test_corpus_generator_get_profile_by_name(
+	     profile_name,
+	     &profile ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported profile: %s.\n",
+		 profile_name );
+
+		return( EXIT_FAILURE );
+	}
+	if( fdatetime_test_corpus_generator_get_value_format(
+	     profile,
+	     &timestamp_type,
+	     &byte_order,
+	     &value_size ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve value format.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_values > ( (size_t) SSIZE_MAX / value_size ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of values.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	buffer = (uint8_t *) malloc(
+	                      number_of_values * value_size );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	if( fdatetime_test_corpus_generator_generate(
+	     profile,
+	     seed,
+	     buffer,
+	     number_of_values * value_size,
+	     number_of_values ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate values.\n" );
+
+		goto on_error;
+	}
+	output_stream = file_stream_open(
+	                 output_filename,
+	                 FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( output_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open output file: %s.\n",
+		 output_filename );
+
+		goto on_error;
+	}
+	if( file_stream_write(
+	     output_stream,
+	     buffer,
+	     number_of_values * value_size ) != ( number_of_values * value_size ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write values.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     output_stream ) != 0 )
+	{
+		output_stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close output file.\n" );
+
+		goto on_error;
+	}
+	free(
+	 buffer );
+
+	fprintf(
+	 stdout,
+	 "Generated %" PRIzu " %s values of %" PRIzu " bytes in: %s\n",
+	 number_of_values,
+	 profile_name,
+	 value_size,
+	 output_filename );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	if( buffer != NULL )
+	{
+		free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -712,63 +713,2151 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfdatetime_hfs_time_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_copy_to_filetime(
+     void )
+{
+	uint32_t hfs_time_values[ 3 ] = {
+		0x00000000UL,
+		0xc8b4f6cfUL,
+		0xffffffffUL };
+
+	uint64_t expected_values[ 3 ] = {
+		0x0153b281e0fb4000UL,
+		0x01cb53f2cefbf180UL,
+		0x01ec4901e062a980UL };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	libfdatetime_hfs_time_t *hfs_time = NULL;
+	uint64_t value_64bit              = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfdatetime_hfs_time_copy_from_32bit(
+		          hfs_time,
+		          hfs_time_values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_hfs_time_copy_to_filetime(
+		          hfs_time,
+		          filetime,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_64bit(
+		          filetime,
+		          &value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_copy_to_filetime(
+	          NULL,
+	          filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_to_filetime(
+	          hfs_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_copy_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_copy_to_posix_time(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfdatetime_hfs_time_t *hfs_time     = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t value_64bit                  = 0;
+	uint32_t value_32bit                  = 0;
+	uint8_t value_type                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          hfs_time,
+	          0xc8b4f6cfUL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_copy_to_posix_time(
+	          hfs_time,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_to_32bit(
+	          posix_time,
+	          &value_32bit,
+	          &value_type,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 0x4c8f464f );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_to_posix_time(
+	          hfs_time,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_to_64bit(
+	          posix_time,
+	          &value_64bit,
+	          &value_type,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 0x000490353292f1c0UL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_copy_to_posix_time(
+	          NULL,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_to_posix_time(
+	          hfs_time,
+	          NULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a HFS time before January 1, 1970 that cannot be represented as an unsigned POSIX time
+	 */
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          hfs_time,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_to_posix_time(
+	          hfs_time,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_array_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_array_copy_to_filetime(
+     void )
+{
+	uint32_t hfs_time_values[ 3 ] = {
+		0x00000000UL,
+		0xc8b4f6cfUL,
+		0xffffffffUL };
+
+	uint64_t expected_values[ 3 ] = {
+		0x0153b281e0fb4000UL,
+		0x01cb53f2cefbf180UL,
+		0x01ec4901e062a980UL };
+
+	uint64_t filetime_values[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_array_copy_to_filetime(
+	          hfs_time_values,
+	          3,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "filetime_values[ value_index ]",
+		 filetime_values[ value_index ],
+		 expected_values[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_array_copy_to_filetime(
+	          NULL,
+	          3,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_copy_to_filetime(
+	          hfs_time_values,
+	          (size_t) SSIZE_MAX,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_copy_to_filetime(
+	          hfs_time_values,
+	          3,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
 
-/* Tests the libfdatetime_internal_hfs_time_copy_to_date_time_values function
+/* Tests the libfdatetime_internal_hfs_time_copy_to_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
+     void )
+{
+	uint8_t byte_stream[ 4 ] = {
+		0xcc, 0x28, 0xb9, 0x75 };
+
+	libcerror_error_t *error                          = NULL;
+	libfdatetime_date_time_values_t *date_time_values = NULL;
+	libfdatetime_hfs_time_t *hfs_time                 = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_date_time_values_initialize(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_from_byte_stream(
+	          hfs_time,
+	          byte_stream,
+	          4,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+	          (libfdatetime_internal_hfs_time_t *) hfs_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+	          NULL,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+	          (libfdatetime_internal_hfs_time_t *) hfs_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_date_time_values_free(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_date_time_values_free(
+		 &date_time_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_hfs_time_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_hfs_time_copy_from_date_time_values(
+     void )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_hfs_time_t internal_hfs_time;
+	libfdatetime_internal_hfs_time_t round_trip_hfs_time;
+
+	libcerror_error_t *error   = NULL;
+	uint32_t number_of_days    = 0;
+	uint32_t number_of_seconds = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	date_time_values.year          = 2010;
+	date_time_values.month         = 9;
+	date_time_values.day           = 14;
+	date_time_values.hours         = 9;
+	date_time_values.minutes       = 54;
+	date_time_values.seconds       = 23;
+	date_time_values.milli_seconds = 999;
+	date_time_values.micro_seconds = 0;
+	date_time_values.nano_seconds  = 0;
+
+	result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+	          &internal_hfs_time,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_hfs_time.timestamp",
+	 internal_hfs_time.timestamp,
+	 0xc8b4f6cf );
+
+	/* Test the round trip of every day, the time of the day varies per day
+	 */
+	for( number_of_days = 0;
+	     number_of_days <= 49710;
+	     number_of_days++ )
+	{
+		internal_hfs_time.timestamp = ( number_of_days * 86400 ) + ( ( number_of_days * 7919 ) % 86400 );
+
+		if( number_of_days == 49710 )
+		{
+			internal_hfs_time.timestamp = 0xffffffffUL;
+		}
+		result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+		          &internal_hfs_time,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+		          &round_trip_hfs_time,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "round_trip_hfs_time.timestamp",
+		 round_trip_hfs_time.timestamp,
+		 internal_hfs_time.timestamp );
+	}
+	/* Test the round trip of every second of a day
+	 */
+	for( number_of_seconds = 0;
+	     number_of_seconds < 86400;
+	     number_of_seconds++ )
+	{
+		internal_hfs_time.timestamp = 0xc8b20000UL + number_of_seconds;
+
+		result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+		          &internal_hfs_time,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+		          &round_trip_hfs_time,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "round_trip_hfs_time.timestamp",
+		 round_trip_hfs_time.timestamp,
+		 internal_hfs_time.timestamp );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+	          &internal_hfs_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year          = 1903;
+	date_time_values.month         = 12;
+	date_time_values.day           = 31;
+	date_time_values.hours         = 23;
+	date_time_values.minutes       = 59;
+	date_time_values.seconds       = 59;
+	date_time_values.milli_seconds = 0;
+
+	result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+	          &internal_hfs_time,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year    = 2040;
+	date_time_values.month   = 2;
+	date_time_values.day     = 6;
+	date_time_values.hours   = 6;
+	date_time_values.minutes = 28;
+	date_time_values.seconds = 16;
+
+	result = libfdatetime_internal_hfs_time_copy_from_date_time_values(
+	          &internal_hfs_time,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_hfs_time_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_hfs_time_t *hfs_time = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_copy_from_date_time_values(
+	          hfs_time,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_to_utf8_string(
+	          hfs_time,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_copy_from_date_time_values(
+	          NULL,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_from_date_time_values(
+	          hfs_time,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_from_date_time_values(
+	          hfs_time,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_from_date_time_values(
+	          hfs_time,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_from_date_time_values(
+	          hfs_time,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_get_sort_key(
+     void )
+{
+	uint32_t values[ 2 ] = {
+		0x00000000UL,
+		0xffffffffUL };
+
+	int64_t expected_sort_keys[ 2 ] = {
+		95616288000000000,
+		138565960950000000 };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_hfs_time_t *hfs_time = NULL;
+	int64_t sort_key                  = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		result = libfdatetime_hfs_time_copy_from_32bit(
+		          hfs_time,
+		          values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_hfs_time_get_sort_key(
+		          hfs_time,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_get_sort_key(
+	          NULL,
+	          &sort_key,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_get_sort_key(
+	          hfs_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_array_get_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_array_get_sort_keys(
+     void )
+{
+	uint32_t hfs_time_values[ 2 ] = {
+		0x00000000UL,
+		0xffffffffUL };
+
+	int64_t expected_sort_keys[ 2 ] = {
+		95616288000000000,
+		138565960950000000 };
+
+	int64_t sort_keys[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_array_get_sort_keys(
+	          hfs_time_values,
+	          2,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_array_get_sort_keys(
+	          NULL,
+	          2,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_get_sort_keys(
+	          hfs_time_values,
+	          (size_t) SSIZE_MAX,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_get_sort_keys(
+	          hfs_time_values,
+	          2,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_compare(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfdatetime_hfs_time_t *first_hfs_time  = NULL;
+	libfdatetime_hfs_time_t *second_hfs_time = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &first_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_hfs_time",
+	 first_hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_initialize(
+	          &second_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_hfs_time",
+	 second_hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          first_hfs_time,
+	          0x00000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          second_hfs_time,
+	          0xffffffffUL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_compare(
+	          first_hfs_time,
+	          second_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_compare(
+	          second_hfs_time,
+	          first_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_compare(
+	          first_hfs_time,
+	          first_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_compare(
+	          NULL,
+	          second_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_compare(
+	          first_hfs_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_hfs_time_free(
+	          &first_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_hfs_time",
+	 first_hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_free(
+	          &second_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_hfs_time",
+	 second_hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &second_hfs_time,
+		 NULL );
+	}
+	if( first_hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &first_hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_add_number_of_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_add_number_of_nano_seconds(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfdatetime_hfs_time_t *hfs_time = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          hfs_time,
+	          0x00000010UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_add_number_of_nano_seconds(
+	          hfs_time,
+	          (int64_t) 1500000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_to_32bit(
+	          hfs_time,
+	          &value_32bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000011UL );
+
+	result = libfdatetime_hfs_time_add_number_of_nano_seconds(
+	          hfs_time,
+	          (int64_t) -2000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_to_32bit(
+	          hfs_time,
+	          &value_32bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x0000000fUL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_add_number_of_nano_seconds(
+	          NULL,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          hfs_time,
+	          0x00000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_add_number_of_nano_seconds(
+	          hfs_time,
+	          (int64_t) -1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_to_32bit(
+	          hfs_time,
+	          &value_32bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000000UL );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          hfs_time,
+	          0xffffffffUL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_add_number_of_nano_seconds(
+	          hfs_time,
+	          (int64_t) 1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_copy_to_32bit(
+	          hfs_time,
+	          &value_32bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xffffffffUL );
+
+	/* Clean up
+	 */
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_get_difference function
  * Returns 1 if successful or 0 if not
  */
-int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
+int fdatetime_test_hfs_time_get_difference(
      void )
 {
-	uint8_t byte_stream[ 4 ] = {
-		0xcc, 0x28, 0xb9, 0x75 };
+	libcerror_error_t *error                 = NULL;
+	libfdatetime_hfs_time_t *first_hfs_time  = NULL;
+	libfdatetime_hfs_time_t *second_hfs_time = NULL;
+	int64_t number_of_nano_seconds           = 0;
+	int result                               = 0;
 
-	libcerror_error_t *error                          = NULL;
-	libfdatetime_date_time_values_t *date_time_values = NULL;
-	libfdatetime_hfs_time_t *hfs_time                 = NULL;
-	int result                                        = 0;
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &first_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_hfs_time",
+	 first_hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_initialize(
+	          &second_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_hfs_time",
+	 second_hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          first_hfs_time,
+	          0xffffffffUL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          second_hfs_time,
+	          0x00000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_get_difference(
+	          first_hfs_time,
+	          second_hfs_time,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 4294967295000000000 );
+
+	result = libfdatetime_hfs_time_get_difference(
+	          second_hfs_time,
+	          first_hfs_time,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -4294967295000000000 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_get_difference(
+	          NULL,
+	          second_hfs_time,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-	/* Initialize test
-	 */
-	result = libfdatetime_date_time_values_initialize(
-	          &date_time_values,
+	result = libfdatetime_hfs_time_get_difference(
+	          first_hfs_time,
+	          NULL,
+	          &number_of_nano_seconds,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "date_time_values",
-	 date_time_values );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_hfs_time_initialize(
-	          &hfs_time,
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_get_difference(
+	          first_hfs_time,
+	          second_hfs_time,
+	          NULL,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "hfs_time",
-	 hfs_time );
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_hfs_time_free(
+	          &second_hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_hfs_time_copy_from_byte_stream(
-	          hfs_time,
-	          byte_stream,
-	          4,
-	          LIBFDATETIME_ENDIAN_BIG,
+	result = libfdatetime_hfs_time_free(
+	          &first_hfs_time,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -780,11 +2869,63 @@ int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &second_hfs_time,
+		 NULL );
+	}
+	if( first_hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &first_hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_truncate(
+     void )
+{
+	int units[ 6 ] = {
+		LIBFDATETIME_TRUNCATE_UNIT_SECOND,
+		LIBFDATETIME_TRUNCATE_UNIT_MINUTE,
+		LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+		LIBFDATETIME_TRUNCATE_UNIT_DAY,
+		LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+		LIBFDATETIME_TRUNCATE_UNIT_YEAR };
+
+	/* December 31, 1999 23:59:59 truncated to every unit
 	 */
-	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
-	          (libfdatetime_internal_hfs_time_t *) hfs_time,
-	          date_time_values,
+	uint32_t expected_values[ 6 ] = {
+		0xb492f3ffUL,
+		0xb492f3c4UL,
+		0xb492e5f0UL,
+		0xb491a280UL,
+		0xb46a1580UL,
+		0xb2b1c080UL };
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_hfs_time_t *hfs_time = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+	int unit_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -792,15 +2933,72 @@ int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
 	 result,
 	 1 );
 
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
+	for( unit_index = 0;
+	     unit_index < 6;
+	     unit_index++ )
+	{
+		result = libfdatetime_hfs_time_copy_from_32bit(
+		          hfs_time,
+		          0xb492f3ffUL,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_hfs_time_truncate(
+		          hfs_time,
+		          units[ unit_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_hfs_time_copy_to_32bit(
+		          hfs_time,
+		          &value_32bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 expected_values[ unit_index ] );
+	}
 	/* Test error cases
 	 */
-	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
+	result = libfdatetime_hfs_time_truncate(
 	          NULL,
-	          date_time_values,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -815,9 +3013,9 @@ int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_internal_hfs_time_copy_to_date_time_values(
-	          (libfdatetime_internal_hfs_time_t *) hfs_time,
-	          NULL,
+	result = libfdatetime_hfs_time_truncate(
+	          hfs_time,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -851,8 +3049,45 @@ int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
 	 "error",
 	 error );
 
-	result = libfdatetime_date_time_values_free(
-	          &date_time_values,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_hfs_time_array_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_hfs_time_array_truncate(
+     void )
+{
+	uint32_t hfs_time_values[ 2 ] = {
+		0xb492f3ffUL,
+		0xb492f3ffUL };
+
+	uint32_t truncated_hfs_time_values[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_hfs_time_array_truncate(
+	          hfs_time_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+	          truncated_hfs_time_values,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -861,13 +3096,115 @@ int fdatetime_test_internal_hfs_time_copy_to_date_time_values(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "date_time_values",
-	 date_time_values );
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "truncated_hfs_time_values[ 1 ]",
+	 truncated_hfs_time_values[ 1 ],
+	 (uint32_t) 0xb46a1580UL );
+
+	/* Test truncating in place
+	 */
+	result = libfdatetime_hfs_time_array_truncate(
+	          hfs_time_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+	          hfs_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "hfs_time_values[ 0 ]",
+	 hfs_time_values[ 0 ],
+	 (uint32_t) 0xb492e5f0UL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_hfs_time_array_truncate(
+	          NULL,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_hfs_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_truncate(
+	          hfs_time_values,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_hfs_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_truncate(
+	          hfs_time_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_hfs_time_array_truncate(
+	          hfs_time_values,
+	          2,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          truncated_hfs_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -876,23 +3213,9 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( hfs_time != NULL )
-	{
-		libfdatetime_hfs_time_free(
-		 &hfs_time,
-		 NULL );
-	}
-	if( hfs_time != NULL )
-	{
-		libfdatetime_date_time_values_free(
-		 &date_time_values,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
-
 /* Tests the libfdatetime_hfs_time_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -2555,14 +4878,62 @@ int main(
 	 "libfdatetime_hfs_time_copy_to_32bit",
 	 fdatetime_test_hfs_time_copy_to_32bit );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_copy_to_filetime",
+	 fdatetime_test_hfs_time_copy_to_filetime );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_copy_to_posix_time",
+	 fdatetime_test_hfs_time_copy_to_posix_time );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_array_copy_to_filetime",
+	 fdatetime_test_hfs_time_array_copy_to_filetime );
+
 #if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
 
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_internal_hfs_time_copy_to_date_time_values",
 	 fdatetime_test_internal_hfs_time_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_hfs_time_copy_from_date_time_values",
+	 fdatetime_test_internal_hfs_time_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_get_sort_key",
+	 fdatetime_test_hfs_time_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_array_get_sort_keys",
+	 fdatetime_test_hfs_time_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_compare",
+	 fdatetime_test_hfs_time_compare );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_add_number_of_nano_seconds",
+	 fdatetime_test_hfs_time_add_number_of_nano_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_get_difference",
+	 fdatetime_test_hfs_time_get_difference );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_truncate",
+	 fdatetime_test_hfs_time_truncate );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_array_truncate",
+	 fdatetime_test_hfs_time_array_truncate );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_hfs_time_copy_from_date_time_values",
+	 fdatetime_test_hfs_time_copy_from_date_time_values );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_hfs_time_get_string_size",
 	 fdatetime_test_hfs_time_get_string_size );
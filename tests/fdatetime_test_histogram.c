@@ -0,0 +1,1045 @@
+/*
+ * Library histogram functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_histogram.h"
+
+/* The number of values used to test building a histogram, which spans multiple worker threads
+ */
+#define FDATETIME_TEST_HISTOGRAM_NUMBER_OF_VALUES	100000
+
+/* The number of counts used to test building a histogram with linear buckets
+ */
+#define FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS	1000
+
+/* The sort key of Monday, August 9, 2010 00:00:00
+ */
+#define FDATETIME_TEST_HISTOGRAM_ORIGIN			129257856000000000LL
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint64_t fdatetime_test_histogram_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_internal_histogram_get_bucket_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_histogram_get_bucket_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t bucket_size      = 0;
+	int64_t cycle_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_internal_histogram_get_bucket_size(
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_MINUTE,
+	          &bucket_size,
+	          &cycle_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "bucket_size",
+	 bucket_size,
+	 (int64_t) 600000000 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "cycle_size",
+	 cycle_size,
+	 (int64_t) 0 );
+
+	result = libfdatetime_internal_histogram_get_bucket_size(
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR_OF_WEEK,
+	          &bucket_size,
+	          &cycle_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "bucket_size",
+	 bucket_size,
+	 (int64_t) 36000000000 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "cycle_size",
+	 cycle_size,
+	 (int64_t) 6048000000000 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_histogram_get_bucket_size(
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_UNDEFINED,
+	          &bucket_size,
+	          &cycle_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_histogram_get_bucket_size(
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          NULL,
+	          &cycle_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_histogram_get_bucket_size(
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          &bucket_size,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_histogram_build function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_histogram_build(
+     void )
+{
+	uint64_t filetime_values[ 4 ] = {
+		0x01cb3a623d0a17ceULL,
+		0x01da6b1584916315ULL,
+		0,
+		0xffffffffffffffffULL };
+
+	uint64_t posix_time_values[ 3 ] = {
+		1284460463,
+		0,
+		0xffffffffULL };
+
+	uint64_t counts[ 24 ];
+
+	libcerror_error_t *error = NULL;
+	int count_index          = 0;
+	int result               = 0;
+
+	/* Test FILETIME values per hour of day
+	 */
+	for( count_index = 0;
+	     count_index < 24;
+	     count_index++ )
+	{
+		counts[ count_index ] = 0;
+	}
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR_OF_DAY,
+	          0,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( count_index = 0;
+	     count_index < 24;
+	     count_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "counts[ count_index ]",
+		 counts[ count_index ],
+		 (uint64_t) ( ( ( count_index == 0 ) || ( count_index == 13 ) || ( count_index == 21 ) ) ? 1 : 0 ) );
+	}
+	/* Test FILETIME values per hour of day with an origin of 02:00:00
+	 */
+	for( count_index = 0;
+	     count_index < 24;
+	     count_index++ )
+	{
+		counts[ count_index ] = 0;
+	}
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR_OF_DAY,
+	          72000000000LL,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( count_index = 0;
+	     count_index < 24;
+	     count_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "counts[ count_index ]",
+		 counts[ count_index ],
+		 (uint64_t) ( ( ( count_index == 11 ) || ( count_index == 19 ) || ( count_index == 22 ) ) ? 1 : 0 ) );
+	}
+	/* Test FILETIME values per day of week where bucket 0 contains Sundays
+	 */
+	for( count_index = 0;
+	     count_index < 7;
+	     count_index++ )
+	{
+		counts[ count_index ] = 0;
+	}
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY_OF_WEEK,
+	          -864000000000LL,
+	          counts,
+	          7,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 0 ]",
+	 counts[ 0 ],
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 1 ]",
+	 counts[ 1 ],
+	 (uint64_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 4 ]",
+	 counts[ 4 ],
+	 (uint64_t) 2 );
+
+	/* Test FILETIME values per week, values after the last bucket are not counted
+	 */
+	counts[ 0 ] = 0;
+	counts[ 1 ] = 0;
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_WEEK,
+	          FDATETIME_TEST_HISTOGRAM_ORIGIN,
+	          counts,
+	          2,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 0 ]",
+	 counts[ 0 ],
+	 (uint64_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 1 ]",
+	 counts[ 1 ],
+	 (uint64_t) 0 );
+
+	/* Test POSIX time values per day of week, the counts are added to
+	 */
+	for( count_index = 0;
+	     count_index < 7;
+	     count_index++ )
+	{
+		counts[ count_index ] = 0;
+	}
+	for( count_index = 0;
+	     count_index < 2;
+	     count_index++ )
+	{
+		result = libfdatetime_histogram_build(
+		          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+		          posix_time_values,
+		          3,
+		          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY_OF_WEEK,
+		          0,
+		          counts,
+		          7,
+		          1,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( count_index = 0;
+	     count_index < 7;
+	     count_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "counts[ count_index ]",
+		 counts[ count_index ],
+		 (uint64_t) ( ( ( count_index >= 1 ) && ( count_index <= 3 ) ) ? 2 : 0 ) );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          NULL,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          posix_time_values,
+	          3,
+	          0xff,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          -1,
+	          0,
+	          counts,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          NULL,
+	          24,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          0,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR_OF_DAY,
+	          0,
+	          counts,
+	          23,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          filetime_values,
+	          4,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          24,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_sort_keys_build_histogram function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_sort_keys_build_histogram(
+     void )
+{
+	int64_t sort_keys[ 7 ] = {
+		0,
+		863999999999LL,
+		864000000000LL,
+		-1,
+		LIBFDATETIME_SORT_KEY_MINIMUM,
+		LIBFDATETIME_SORT_KEY_MAXIMUM,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	uint64_t counts[ 7 ];
+
+	libcerror_error_t *error = NULL;
+	int count_index          = 0;
+	int result               = 0;
+
+	/* Test sort keys per day, sort keys before the origin are not counted
+	 */
+	counts[ 0 ] = 0;
+	counts[ 1 ] = 0;
+
+	result = libfdatetime_sort_keys_build_histogram(
+	          sort_keys,
+	          7,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          2,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 0 ]",
+	 counts[ 0 ],
+	 (uint64_t) 2 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 1 ]",
+	 counts[ 1 ],
+	 (uint64_t) 1 );
+
+	/* Test sort keys per day of week, sort keys before the origin wrap around
+	 */
+	for( count_index = 0;
+	     count_index < 7;
+	     count_index++ )
+	{
+		counts[ count_index ] = 0;
+	}
+	result = libfdatetime_sort_keys_build_histogram(
+	          sort_keys,
+	          7,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY_OF_WEEK,
+	          0,
+	          counts,
+	          7,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 0 ]",
+	 counts[ 0 ],
+	 (uint64_t) 2 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 1 ]",
+	 counts[ 1 ],
+	 (uint64_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "counts[ 6 ]",
+	 counts[ 6 ],
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_sort_keys_build_histogram(
+	          NULL,
+	          7,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          7,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys_build_histogram(
+	          sort_keys,
+	          7,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_DAY,
+	          0,
+	          counts,
+	          7,
+	          -1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_histogram_build and libfdatetime_sort_keys_build_histogram functions
+ * with a specific number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_histogram_build_with_threads(
+     int number_of_threads )
+{
+	libcerror_error_t *error  = NULL;
+	int64_t *sort_keys        = NULL;
+	uint64_t *counts          = NULL;
+	uint64_t *expected_counts = NULL;
+	uint64_t *values          = NULL;
+	uint64_t random_state     = 0x5eed1234cafef00dULL;
+	uint64_t random_value     = 0;
+	size_t count_index        = 0;
+	size_t value_index        = 0;
+	int64_t bucket_index      = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	sort_keys = (int64_t *) malloc(
+	                         sizeof( int64_t ) * FDATETIME_TEST_HISTOGRAM_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "sort_keys",
+	 sort_keys );
+
+	values = (uint64_t *) malloc(
+	                       sizeof( uint64_t ) * FDATETIME_TEST_HISTOGRAM_NUMBER_OF_VALUES );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	counts = (uint64_t *) malloc(
+	                       sizeof( uint64_t ) * FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "counts",
+	 counts );
+
+	expected_counts = (uint64_t *) malloc(
+	                                sizeof( uint64_t ) * FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_counts",
+	 expected_counts );
+
+	for( count_index = 0;
+	     count_index < FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS;
+	     count_index++ )
+	{
+		counts[ count_index ]          = 0;
+		expected_counts[ count_index ] = 0;
+	}
+	/* Generate sort keys in and around the range of the hourly buckets
+	 */
+	for( value_index = 0;
+	     value_index < FDATETIME_TEST_HISTOGRAM_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		random_value = fdatetime_test_histogram_get_random_value(
+		                &random_state );
+
+		bucket_index = (int64_t) ( random_value % ( FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS + 20 ) ) - 10;
+
+		sort_keys[ value_index ] = FDATETIME_TEST_HISTOGRAM_ORIGIN
+		                         + ( bucket_index * 36000000000LL )
+		                         + (int64_t) ( ( random_value >> 32 ) % 36000000000ULL );
+
+		values[ value_index ] = (uint64_t) sort_keys[ value_index ];
+
+		if( ( bucket_index >= 0 )
+		 && ( bucket_index < FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS ) )
+		{
+			expected_counts[ bucket_index ] += 1;
+		}
+	}
+	/* Values without a valid sort key are not counted
+	 */
+	bucket_index = (int64_t) ( ( (uint64_t) sort_keys[ 0 ] - (uint64_t) FDATETIME_TEST_HISTOGRAM_ORIGIN ) / 36000000000ULL );
+
+	if( ( sort_keys[ 0 ] >= FDATETIME_TEST_HISTOGRAM_ORIGIN )
+	 && ( bucket_index < FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS ) )
+	{
+		expected_counts[ bucket_index ] -= 1;
+	}
+	sort_keys[ 0 ] = LIBFDATETIME_SORT_KEY_INVALID;
+	values[ 0 ]    = 0xffffffffffffffffULL;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_sort_keys_build_histogram(
+	          sort_keys,
+	          FDATETIME_TEST_HISTOGRAM_NUMBER_OF_VALUES,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR,
+	          FDATETIME_TEST_HISTOGRAM_ORIGIN,
+	          counts,
+	          FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS,
+	          number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_histogram_build(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          values,
+	          FDATETIME_TEST_HISTOGRAM_NUMBER_OF_VALUES,
+	          0,
+	          LIBFDATETIME_HISTOGRAM_BUCKET_UNIT_HOUR,
+	          FDATETIME_TEST_HISTOGRAM_ORIGIN,
+	          counts,
+	          FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS,
+	          number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( count_index = 0;
+	     count_index < FDATETIME_TEST_HISTOGRAM_NUMBER_OF_COUNTS;
+	     count_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "counts[ count_index ]",
+		 counts[ count_index ],
+		 2 * expected_counts[ count_index ] );
+	}
+	/* Clean up
+	 */
+	free(
+	 expected_counts );
+
+	expected_counts = NULL;
+
+	free(
+	 counts );
+
+	counts = NULL;
+
+	free(
+	 values );
+
+	values = NULL;
+
+	free(
+	 sort_keys );
+
+	sort_keys = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected_counts != NULL )
+	{
+		free(
+		 expected_counts );
+	}
+	if( counts != NULL )
+	{
+		free(
+		 counts );
+	}
+	if( values != NULL )
+	{
+		free(
+		 values );
+	}
+	if( sort_keys != NULL )
+	{
+		free(
+		 sort_keys );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_histogram_get_bucket_size",
+	 fdatetime_test_internal_histogram_get_bucket_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_histogram_build",
+	 fdatetime_test_histogram_build );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_sort_keys_build_histogram",
+	 fdatetime_test_sort_keys_build_histogram );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_histogram_build",
+	 fdatetime_test_histogram_build_with_threads,
+	 1 );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_histogram_build",
+	 fdatetime_test_histogram_build_with_threads,
+	 4 );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
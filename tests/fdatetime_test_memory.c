@@ -33,12 +33,16 @@
 
 #include "fdatetime_test_memory.h"
 
-#if defined( HAVE_FDATETIME_TEST_MEMORY )
+#if defined( HAVE_FDATETIME_TEST_ALLOCATIONS )
 
 static void *(*fdatetime_test_real_malloc)(size_t) = NULL;
 int fdatetime_test_malloc_attempts_before_fail     = -1;
 
-/* Custom malloc for testing memory error cases
+/* The number of calls to malloc and realloc
+ */
+uint64_t fdatetime_test_number_of_allocations      = 0;
+
+/* Custom malloc for testing memory error cases and counting allocations
  * Note this function might fail if compiled with optimization
  * Returns a pointer to newly allocated data or NULL
  */
@@ -68,12 +72,21 @@ void *malloc(
 	{
 		fdatetime_test_malloc_attempts_before_fail--;
 	}
+	__atomic_fetch_add(
+	 &fdatetime_test_number_of_allocations,
+	 1,
+	 __ATOMIC_RELAXED );
+
 	ptr = fdatetime_test_real_malloc(
 	       size );
 
 	return( ptr );
 }
 
+#endif /* defined( HAVE_FDATETIME_TEST_ALLOCATIONS ) */
+
+#if defined( HAVE_FDATETIME_TEST_MEMORY )
+
 static void *(*fdatetime_test_real_memcpy)(void *, const void *, size_t) = NULL;
 int fdatetime_test_memcpy_attempts_before_fail                           = -1;
 
@@ -156,10 +169,14 @@ void *memset(
 	return( ptr );
 }
 
+#endif /* defined( HAVE_FDATETIME_TEST_MEMORY ) */
+
+#if defined( HAVE_FDATETIME_TEST_ALLOCATIONS )
+
 static void *(*fdatetime_test_real_realloc)(void *, size_t) = NULL;
 int fdatetime_test_realloc_attempts_before_fail             = -1;
 
-/* Custom realloc for testing memory error cases
+/* Custom realloc for testing memory error cases and counting allocations
  * Note this function might fail if compiled with optimization
  * Returns a pointer to reallocated data or NULL
  */
@@ -188,6 +205,11 @@ void *realloc(
 	{
 		fdatetime_test_realloc_attempts_before_fail--;
 	}
+	__atomic_fetch_add(
+	 &fdatetime_test_number_of_allocations,
+	 1,
+	 __ATOMIC_RELAXED );
+
 	ptr = fdatetime_test_real_realloc(
 	       ptr,
 	       size );
@@ -195,5 +217,5 @@ void *realloc(
 	return( ptr );
 }
 
-#endif /* defined( HAVE_FDATETIME_TEST_MEMORY ) */
+#endif /* defined( HAVE_FDATETIME_TEST_ALLOCATIONS ) */
 
@@ -23,12 +23,13 @@
 #define _FDATETIME_TEST_MEMORY_H
 
 #include <common.h>
+#include <types.h>
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-#if defined( HAVE_MEMORY_TESTS )
+#if defined( HAVE_MEMORY_TESTS ) || defined( HAVE_ALLOCATION_TESTS )
 
 /* Memory tests only support x86 or x86-64 architectures */
 #if defined( __x86__ ) || defined( __x86_64__ )
@@ -39,12 +40,23 @@ extern "C" {
 /* Memory tests require dlsym */
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
 
+#if defined( HAVE_MEMORY_TESTS )
 #define HAVE_FDATETIME_TEST_MEMORY	1
+#endif
+
+/* Allocation accounting only interposes malloc and realloc */
+#define HAVE_FDATETIME_TEST_ALLOCATIONS	1
 
 #endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) */
 #endif /* !defined( LIBFDATETIME_DLL_IMPORT ) && !defined( __CYGWIN__ ) */
 #endif /* defined( __x86__ ) || defined( __x86_64__ ) */
-#endif /* defined( HAVE_MEMORY_TESTS ) */
+#endif /* defined( HAVE_MEMORY_TESTS ) || defined( HAVE_ALLOCATION_TESTS ) */
+
+#if defined( HAVE_FDATETIME_TEST_ALLOCATIONS )
+
+extern uint64_t fdatetime_test_number_of_allocations;
+
+#endif /* defined( HAVE_FDATETIME_TEST_ALLOCATIONS ) */
 
 #if defined( HAVE_FDATETIME_TEST_MEMORY )
 
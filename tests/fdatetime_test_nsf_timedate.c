@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -888,8 +889,1436 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfdatetime_internal_nsf_timedate_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_nsf_timedate_copy_from_date_time_values(
+     void )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_nsf_timedate_t internal_nsf_timedate;
+	libfdatetime_internal_nsf_timedate_t round_trip_nsf_timedate;
+
+	libcerror_error_t *error = NULL;
+	uint32_t julian_day      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	date_time_values.year          = 2010;
+	date_time_values.month         = 9;
+	date_time_values.day           = 14;
+	date_time_values.hours         = 9;
+	date_time_values.minutes       = 54;
+	date_time_values.seconds       = 23;
+	date_time_values.milli_seconds = 129;
+	date_time_values.micro_seconds = 0;
+	date_time_values.nano_seconds  = 0;
+
+	result = libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+	          &internal_nsf_timedate,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_nsf_timedate.upper",
+	 internal_nsf_timedate.upper,
+	 2455454 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_nsf_timedate.lower",
+	 internal_nsf_timedate.lower,
+	 3566312 );
+
+	/* Test the round trip of every day between January 1, 0001 and December 31, 9999
+	 * the time of the day varies per day
+	 */
+	for( julian_day = 1721426;
+	     julian_day <= 5373484;
+	     julian_day++ )
+	{
+		internal_nsf_timedate.upper = julian_day;
+		internal_nsf_timedate.lower = ( julian_day * 7919 ) % 8640000;
+
+		result = libfdatetime_internal_nsf_timedate_copy_to_date_time_values(
+		          &internal_nsf_timedate,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+		          &round_trip_nsf_timedate,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "round_trip_nsf_timedate.upper",
+		 round_trip_nsf_timedate.upper,
+		 internal_nsf_timedate.upper );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "round_trip_nsf_timedate.lower",
+		 round_trip_nsf_timedate.lower,
+		 internal_nsf_timedate.lower );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+	          &internal_nsf_timedate,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.month = 13;
+
+	result = libfdatetime_internal_nsf_timedate_copy_from_date_time_values(
+	          &internal_nsf_timedate,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+/* Tests the libfdatetime_nsf_timedate_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_nsf_timedate_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                  = NULL;
+	libfdatetime_nsf_timedate_t *nsf_timedate = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_nsf_timedate_initialize(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "nsf_timedate",
+	 nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_nsf_timedate_copy_from_date_time_values(
+	          nsf_timedate,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_to_utf8_string(
+	          nsf_timedate,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_nsf_timedate_copy_from_date_time_values(
+	          NULL,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_copy_from_date_time_values(
+	          nsf_timedate,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_copy_from_date_time_values(
+	          nsf_timedate,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_copy_from_date_time_values(
+	          nsf_timedate,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_copy_from_date_time_values(
+	          nsf_timedate,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_nsf_timedate_free(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "nsf_timedate",
+	 nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &nsf_timedate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_nsf_timedate_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_nsf_timedate_get_sort_key(
+     void )
+{
+	uint64_t values[ 5 ] = {
+		0x00253d8c00000000UL,
+		0x80253d8c0000007bUL,
+		0x001a42e400000000UL,
+		0x001a42e300000000UL,
+		0x00253d8c0083d600UL };
+
+	int64_t expected_sort_keys[ 5 ] = {
+		116444736000000000,
+		116444736012300000,
+		-505227456000000000,
+		LIBFDATETIME_SORT_KEY_INVALID,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	libcerror_error_t *error                  = NULL;
+	libfdatetime_nsf_timedate_t *nsf_timedate = NULL;
+	int64_t sort_key                          = 0;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_nsf_timedate_initialize(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "nsf_timedate",
+	 nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		result = libfdatetime_nsf_timedate_copy_from_64bit(
+		          nsf_timedate,
+		          values[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_nsf_timedate_get_sort_key(
+		          nsf_timedate,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_nsf_timedate_get_sort_key(
+	          NULL,
+	          &sort_key,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_get_sort_key(
+	          nsf_timedate,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_nsf_timedate_free(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "nsf_timedate",
+	 nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &nsf_timedate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_nsf_timedate_array_get_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_nsf_timedate_array_get_sort_keys(
+     void )
+{
+	uint64_t nsf_timedate_values[ 5 ] = {
+		0x00253d8c00000000UL,
+		0x80253d8c0000007bUL,
+		0x001a42e400000000UL,
+		0x001a42e300000000UL,
+		0x00253d8c0083d600UL };
+
+	int64_t expected_sort_keys[ 5 ] = {
+		116444736000000000,
+		116444736012300000,
+		-505227456000000000,
+		LIBFDATETIME_SORT_KEY_INVALID,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	int64_t sort_keys[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_nsf_timedate_array_get_sort_keys(
+	          nsf_timedate_values,
+	          5,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_nsf_timedate_array_get_sort_keys(
+	          NULL,
+	          5,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_array_get_sort_keys(
+	          nsf_timedate_values,
+	          (size_t) SSIZE_MAX,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_array_get_sort_keys(
+	          nsf_timedate_values,
+	          5,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_nsf_timedate_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_nsf_timedate_compare(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_nsf_timedate_t *first_nsf_timedate  = NULL;
+	libfdatetime_nsf_timedate_t *second_nsf_timedate = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_nsf_timedate_initialize(
+	          &first_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_nsf_timedate",
+	 first_nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_initialize(
+	          &second_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_nsf_timedate",
+	 second_nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          first_nsf_timedate,
+	          0x001a42e400000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          second_nsf_timedate,
+	          0x00253d8c00000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_nsf_timedate_compare(
+	          first_nsf_timedate,
+	          second_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_compare(
+	          second_nsf_timedate,
+	          first_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_compare(
+	          first_nsf_timedate,
+	          first_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_nsf_timedate_compare(
+	          NULL,
+	          second_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_compare(
+	          first_nsf_timedate,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_nsf_timedate_free(
+	          &first_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_nsf_timedate",
+	 first_nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_free(
+	          &second_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_nsf_timedate",
+	 second_nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &second_nsf_timedate,
+		 NULL );
+	}
+	if( first_nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &first_nsf_timedate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_nsf_timedate_add_number_of_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_nsf_timedate_add_number_of_nano_seconds(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfdatetime_nsf_timedate_t *nsf_timedate = NULL;
+	uint64_t value_64bit                      = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_nsf_timedate_initialize(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "nsf_timedate",
+	 nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          nsf_timedate,
+	          0x81253d8c00000064ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+	          nsf_timedate,
+	          (int64_t) 1505000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_to_64bit(
+	          nsf_timedate,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x81253d8c000000faULL );
+
+	result = libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+	          nsf_timedate,
+	          (int64_t) -3000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_to_64bit(
+	          nsf_timedate,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x81253d8b0083d5ceULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+	          NULL,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          nsf_timedate,
+	          0x0051fe2c0083d5ffULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+	          nsf_timedate,
+	          (int64_t) 10000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_copy_to_64bit(
+	          nsf_timedate,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0051fe2c0083d5ffULL );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          nsf_timedate,
+	          0x00253d8c0083d600ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_add_number_of_nano_seconds(
+	          nsf_timedate,
+	          (int64_t) 0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_nsf_timedate_free(
+	          &nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &nsf_timedate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_nsf_timedate_get_difference function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_nsf_timedate_get_difference(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfdatetime_nsf_timedate_t *first_nsf_timedate  = NULL;
+	libfdatetime_nsf_timedate_t *second_nsf_timedate = NULL;
+	int64_t number_of_nano_seconds                   = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_nsf_timedate_initialize(
+	          &first_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_nsf_timedate",
+	 first_nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_initialize(
+	          &second_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_nsf_timedate",
+	 second_nsf_timedate );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          first_nsf_timedate,
+	          0x00253d8d00000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          second_nsf_timedate,
+	          0x00253d8c00000032ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_get_difference(
+	          first_nsf_timedate,
+	          second_nsf_timedate,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 86399500000000 );
+
+	result = libfdatetime_nsf_timedate_get_difference(
+	          second_nsf_timedate,
+	          first_nsf_timedate,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -86399500000000 );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          first_nsf_timedate,
+	          0x0051fe2c00000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          second_nsf_timedate,
+	          0x001a42e400000000ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_get_difference(
+	          first_nsf_timedate,
+	          second_nsf_timedate,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0x7fffffffffffffffULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_nsf_timedate_get_difference(
+	          NULL,
+	          second_nsf_timedate,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_get_difference(
+	          first_nsf_timedate,
+	          NULL,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_nsf_timedate_get_difference(
+	          first_nsf_timedate,
+	          second_nsf_timedate,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid NSF timedate
+	 */
+	result = libfdatetime_nsf_timedate_copy_from_64bit(
+	          first_nsf_timedate,
+	          0x00253d8c0083d600ULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_get_difference(
+	          first_nsf_timedate,
+	          second_nsf_timedate,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_nsf_timedate_free(
+	          &second_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_nsf_timedate_free(
+	          &first_nsf_timedate,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &second_nsf_timedate,
+		 NULL );
+	}
+	if( first_nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &first_nsf_timedate,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfdatetime_nsf_timedate_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -2734,8 +4163,36 @@ int main(
 	 "libfdatetime_internal_nsf_timedate_copy_to_date_time_values",
 	 fdatetime_test_internal_nsf_timedate_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_nsf_timedate_copy_from_date_time_values",
+	 fdatetime_test_internal_nsf_timedate_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate_get_sort_key",
+	 fdatetime_test_nsf_timedate_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate_array_get_sort_keys",
+	 fdatetime_test_nsf_timedate_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate_compare",
+	 fdatetime_test_nsf_timedate_compare );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate_add_number_of_nano_seconds",
+	 fdatetime_test_nsf_timedate_add_number_of_nano_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate_get_difference",
+	 fdatetime_test_nsf_timedate_get_difference );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_nsf_timedate_copy_from_date_time_values",
+	 fdatetime_test_nsf_timedate_copy_from_date_time_values );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_nsf_timedate_get_string_size",
 	 fdatetime_test_nsf_timedate_get_string_size );
@@ -0,0 +1,466 @@
+/*
+ * Library line parsing functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+/* Tests the libfdatetime_parse_lines function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_parse_lines(
+     void )
+{
+	uint64_t values[ 8 ];
+	uint8_t error_bitmap[ 1 ];
+
+	const char *utf8_buffer = "1601-01-01T00:00:00Z\ngarbage\n2010-09-14T09:54:23.1234567Z\r\n\n1970-01-01T00:00:00Z";
+
+	libcerror_error_t *error       = NULL;
+	size_t number_of_invalid_lines = 0;
+	size_t number_of_lines         = 0;
+	size_t utf8_buffer_index       = 0;
+	size_t utf8_buffer_size        = 0;
+	int result                     = 0;
+
+	utf8_buffer_size = narrow_string_length(
+	                    utf8_buffer );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_buffer_index",
+	 utf8_buffer_index,
+	 utf8_buffer_size );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_lines",
+	 number_of_lines,
+	 (size_t) 5 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_invalid_lines",
+	 number_of_invalid_lines,
+	 (size_t) 2 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "error_bitmap[ 0 ]",
+	 error_bitmap[ 0 ],
+	 0x0a );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 1 ]",
+	 values[ 1 ],
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 2 ]",
+	 values[ 2 ],
+	 (uint64_t) 0x01cb53f2cf0ec807UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 4 ]",
+	 values[ 4 ],
+	 (uint64_t) 0x019db1ded53e8000UL );
+
+	/* Test parsing the buffer in multiple passes
+	 */
+	utf8_buffer_index = 0;
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          3,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_buffer_index",
+	 utf8_buffer_index,
+	 (size_t) 59 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_lines",
+	 number_of_lines,
+	 (size_t) 3 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_invalid_lines",
+	 number_of_invalid_lines,
+	 (size_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 (uint64_t) 0xfffffffd49ef6f00UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 2 ]",
+	 values[ 2 ],
+	 (uint64_t) 1284458063UL );
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          3,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_lines",
+	 number_of_lines,
+	 (size_t) 2 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "error_bitmap[ 0 ]",
+	 error_bitmap[ 0 ],
+	 0x01 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 1 ]",
+	 values[ 1 ],
+	 (uint64_t) 0 );
+
+	/* Test that a trailing line feed does not result in an additional line
+	 */
+	utf8_buffer_index = 0;
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          21,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_lines",
+	 number_of_lines,
+	 (size_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_invalid_lines",
+	 number_of_invalid_lines,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	utf8_buffer_index = 0;
+
+	result = libfdatetime_parse_lines(
+	          NULL,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          0xff,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_buffer_index = utf8_buffer_size + 1;
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_buffer_index = 0;
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          NULL,
+	          error_bitmap,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          NULL,
+	          8,
+	          &number_of_lines,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_parse_lines(
+	          (uint8_t *) utf8_buffer,
+	          utf8_buffer_size,
+	          &utf8_buffer_index,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          0,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          values,
+	          error_bitmap,
+	          8,
+	          NULL,
+	          &number_of_invalid_lines,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_parse_lines",
+	 fdatetime_test_parse_lines );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -454,6 +455,62 @@ int fdatetime_test_posix_time_copy_from_byte_stream(
 	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
 	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED );
 
+	/* The minimum value of a signed value type is supported by an unsigned value type
+	 */
+	result = libfdatetime_posix_time_copy_from_byte_stream(
+	          posix_time,
+	          fdatetime_test_posix_time_byte_stream_32bit_invalid,
+	          4,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time->timestamp",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->timestamp,
+	 (uint64_t) 0x80000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "posix_time->value_type",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
+	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED );
+
+	result = libfdatetime_posix_time_copy_from_byte_stream(
+	          posix_time,
+	          fdatetime_test_posix_time_byte_stream_64bit_invalid,
+	          8,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time->timestamp",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->timestamp,
+	 (uint64_t) 0x8000000000000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "posix_time->value_type",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
+	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED );
+
 	/* Test error cases
 	 */
 	result = libfdatetime_posix_time_copy_from_byte_stream(
@@ -728,6 +785,33 @@ int fdatetime_test_posix_time_copy_from_32bit(
 	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
 	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED );
 
+	/* The minimum value of a signed value type is supported by an unsigned value type
+	 */
+	result = libfdatetime_posix_time_copy_from_32bit(
+	          posix_time,
+	          0x80000000UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time->timestamp",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->timestamp,
+	 (uint64_t) 0x80000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "posix_time->value_type",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
+	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED );
+
 	/* Test error cases
 	 */
 	result = libfdatetime_posix_time_copy_from_32bit(
@@ -1065,6 +1149,83 @@ int fdatetime_test_posix_time_copy_from_64bit(
 	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
 	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED );
 
+	/* The minimum value of a signed value type is supported by an unsigned value type
+	 */
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x8000000000000000UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time->timestamp",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->timestamp,
+	 (uint64_t) 0x8000000000000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "posix_time->value_type",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
+	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED );
+
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x8000000000000000UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time->timestamp",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->timestamp,
+	 (uint64_t) 0x8000000000000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "posix_time->value_type",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
+	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED );
+
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x8000000000000000UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time->timestamp",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->timestamp,
+	 (uint64_t) 0x8000000000000000UL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "posix_time->value_type",
+	 ( (libfdatetime_internal_posix_time_t *) posix_time )->value_type,
+	 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED );
+
 	/* Test error cases
 	 */
 	result = libfdatetime_posix_time_copy_from_64bit(
@@ -1346,23 +1507,88 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint32_t fdatetime_test_posix_time_get_random_value(
+          uint32_t *random_state )
+{
+	uint32_t value = *random_state;
 
-/* Tests the libfdatetime_internal_posix_time_copy_to_date_time_values function
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Tests the libfdatetime_posix_time_copy_from_utf8_string function
  * Returns 1 if successful or 0 if not
  */
-int fdatetime_test_internal_posix_time_copy_to_date_time_values(
+int fdatetime_test_posix_time_copy_from_utf8_string(
      void )
 {
-	libcerror_error_t *error                          = NULL;
-	libfdatetime_date_time_values_t *date_time_values = NULL;
-	libfdatetime_posix_time_t *posix_time             = NULL;
-	int result                                        = 0;
+	const char *valid_strings[ 9 ] = {
+		"2010-09-14T09:54:23Z",
+		"2010-09-14T11:54:23+02:00",
+		"1969-12-31T23:59:59Z",
+		"2038-01-19T03:14:08Z",
+		"2010-09-14T09:54:23.123456789Z",
+		"2010-09-14T09:54:23.123456789Z",
+		"2010-09-14T09:54:23.123456789Z",
+		"9999-12-31T23:59:59Z",
+		"2010-09-14" };
+
+	uint8_t valid_value_types[ 9 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED };
+
+	uint64_t expected_values[ 9 ] = {
+		0x4c8f464fUL,
+		0x4c8f464fUL,
+		0xffffffffUL,
+		0x80000000UL,
+		0x4c8f464fUL,
+		0x490353294d400UL,
+		0x11d34fcd955c2315UL,
+		0x3afff4417fUL,
+		0x4c8ebb00UL };
+
+	const char *invalid_strings[ 5 ] = {
+		"2038-01-19T03:14:08Z",
+		"1969-12-31T23:59:59Z",
+		"1969-12-31T23:59:59Z",
+		"2262-04-12T00:00:00Z",
+		"2010-09-14T09:54:2" };
+
+	uint8_t invalid_value_types[ 5 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t value_64bit                  = 0;
+	uint32_t value_32bit                  = 0;
+	uint8_t value_type                    = 0;
+	int result                            = 0;
+	int string_index                      = 0;
 
 	/* Initialize test
 	 */
-	result = libfdatetime_date_time_values_initialize(
-	          &date_time_values,
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1371,52 +1597,141 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 1 );
 
 	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "date_time_values",
-	 date_time_values );
+	 "posix_time",
+	 posix_time );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_posix_time_initialize(
-	          &posix_time,
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 9;
+	     string_index++ )
+	{
+		result = libfdatetime_posix_time_copy_from_utf8_string(
+		          posix_time,
+		          (uint8_t *) valid_strings[ string_index ],
+		          narrow_string_length( valid_strings[ string_index ] ),
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+		          valid_value_types[ string_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( valid_value_types[ string_index ] == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+		 || ( valid_value_types[ string_index ] == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED ) )
+		{
+			result = libfdatetime_posix_time_copy_to_32bit(
+			          posix_time,
+			          &value_32bit,
+			          &value_type,
+			          &error );
+
+			value_64bit = value_32bit;
+		}
+		else
+		{
+			result = libfdatetime_posix_time_copy_to_64bit(
+			          posix_time,
+			          &value_64bit,
+			          &value_type,
+			          &error );
+		}
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ string_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "value_type",
+		 (int) value_type,
+		 (int) valid_value_types[ string_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_copy_from_utf8_string(
+	          NULL,
+	          (uint8_t *) valid_strings[ 0 ],
+	          20,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "posix_time",
-	 posix_time );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfdatetime_posix_time_copy_from_byte_stream(
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_utf8_string(
 	          posix_time,
-	          fdatetime_test_posix_time_byte_stream_32bit,
-	          4,
-	          LIBFDATETIME_ENDIAN_LITTLE,
-	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          (uint8_t *) valid_strings[ 0 ],
+	          20,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+	          0xff,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FDATETIME_TEST_ASSERT_IS_NULL(
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
-	          (libfdatetime_internal_posix_time_t *) posix_time,
-	          date_time_values,
+	libcerror_error_free(
+	 &error );
+
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		result = libfdatetime_posix_time_copy_from_utf8_string(
+		          posix_time,
+		          (uint8_t *) invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+		          invalid_value_types[ string_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1424,61 +1739,2531 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 result,
 	 1 );
 
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->year",
-	 date_time_values->year,
-	 (uint16_t) 2012 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->month",
-	 date_time_values->month,
-	 (uint8_t) 3 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->day",
-	 date_time_values->day,
-	 (uint8_t) 17 );
+	return( 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->hours",
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests libfdatetime_posix_time_copy_from_utf8_string with strings of random FILETIME values
+ * The FILETIME values are converted into the expected POSIX time arithmetically
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_copy_from_utf8_string_random(
+     void )
+{
+	uint8_t value_types[ 4 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED };
+
+	/* The maximum number of 100 nano seconds intervals since January 1, 1970 supported by the value types
+	 */
+	uint64_t maximum_values[ 4 ] = {
+		0x7fffffffUL * 10000000,
+		0x232aa87ffc81c000UL,
+		0x232aa87ffc81c000UL,
+		0x0147ae1479c64380UL };
+
+	uint8_t utf8_string[ 48 ];
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_filetime_t *filetime     = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t expected_value_64bit         = 0;
+	uint64_t number_of_intervals          = 0;
+	uint64_t value_64bit                  = 0;
+	uint32_t random_state                 = 0x4c8f464fUL;
+	uint32_t value_32bit                  = 0;
+	uint8_t value_type                    = 0;
+	int iteration                         = 0;
+	int result                            = 0;
+	int type_index                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iteration = 0;
+	     iteration < 30000;
+	     iteration++ )
+	{
+		type_index = iteration % 4;
+		value_type = value_types[ type_index ];
+
+		number_of_intervals   = fdatetime_test_posix_time_get_random_value( &random_state );
+		number_of_intervals <<= 32;
+		number_of_intervals  |= fdatetime_test_posix_time_get_random_value( &random_state );
+		number_of_intervals  %= maximum_values[ type_index ];
+
+		result = libfdatetime_filetime_copy_from_64bit(
+		          filetime,
+		          number_of_intervals + (uint64_t) 116444736000000000UL,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfdatetime_filetime_copy_to_utf8_string(
+		          filetime,
+		          utf8_string,
+		          48,
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_posix_time_copy_from_utf8_string(
+		          posix_time,
+		          utf8_string,
+		          48,
+		          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601,
+		          value_type,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+		{
+			result = libfdatetime_posix_time_copy_to_32bit(
+			          posix_time,
+			          &value_32bit,
+			          &value_type,
+			          &error );
+
+			value_64bit = value_32bit;
+		}
+		else
+		{
+			result = libfdatetime_posix_time_copy_to_64bit(
+			          posix_time,
+			          &value_64bit,
+			          &value_type,
+			          &error );
+		}
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED )
+		{
+			expected_value_64bit = number_of_intervals / 10;
+		}
+		else if( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED )
+		{
+			expected_value_64bit = number_of_intervals * 100;
+		}
+		else
+		{
+			expected_value_64bit = number_of_intervals / 10000000;
+		}
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_value_64bit );
+	}
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_copy_to_filetime(
+     void )
+{
+	uint64_t valid_values[ 6 ] = {
+		0x4c8f464fUL,
+		0xffffffffUL,
+		0xffffffffUL,
+		0xffffffffffffffffUL,
+		0xffffffffffffffffUL,
+		0x11d34fcd955c2315UL };
+
+	uint8_t valid_value_types[ 6 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED };
+
+	uint64_t expected_values[ 6 ] = {
+		0x01cb53f2cefbf180UL,
+		0x019db1ded4a5e980UL,
+		0x0236485ed4a5e980UL,
+		0x019db1ded53e7ff6UL,
+		0x019db1ded53e7fffUL,
+		0x01cb53f2cf0ec807UL };
+
+	uint64_t invalid_values[ 3 ] = {
+		0xffffffffffffffffUL,
+		0x7fffffffffffffffUL,
+		0xfffffffd49ef6effUL };
+
+	uint8_t invalid_value_types[ 3 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_filetime_t *filetime     = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t value_64bit                  = 0;
+	int result                            = 0;
+	int value_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		if( ( valid_value_types[ value_index ] == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+		 || ( valid_value_types[ value_index ] == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED ) )
+		{
+			result = libfdatetime_posix_time_copy_from_32bit(
+			          posix_time,
+			          (uint32_t) valid_values[ value_index ],
+			          valid_value_types[ value_index ],
+			          &error );
+		}
+		else
+		{
+			result = libfdatetime_posix_time_copy_from_64bit(
+			          posix_time,
+			          valid_values[ value_index ],
+			          valid_value_types[ value_index ],
+			          &error );
+		}
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_posix_time_copy_to_filetime(
+		          posix_time,
+		          filetime,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_filetime_copy_to_64bit(
+		          filetime,
+		          &value_64bit,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_copy_to_filetime(
+	          NULL,
+	          filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_to_filetime(
+	          posix_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test POSIX times that cannot be represented as a FILETIME
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfdatetime_posix_time_copy_from_64bit(
+		          posix_time,
+		          invalid_values[ value_index ],
+		          invalid_value_types[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_posix_time_copy_to_filetime(
+		          posix_time,
+		          filetime,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_array_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_array_copy_to_filetime(
+     void )
+{
+	uint64_t posix_time_values[ 3 ] = {
+		0x0000000000000000UL,
+		0x000490353294d400UL,
+		0xffffffffffffffffUL };
+
+	uint64_t expected_values[ 3 ] = {
+		0x019db1ded53e8000UL,
+		0x01cb53f2cf0ec800UL,
+		0x019db1ded53e7ff6UL };
+
+	uint64_t filetime_values[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          posix_time_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "filetime_values[ value_index ]",
+		 filetime_values[ value_index ],
+		 expected_values[ value_index ] );
+	}
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          posix_time_values,
+	          0,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          NULL,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          posix_time_values,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          posix_time_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value that cannot be represented as a FILETIME
+	 */
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          posix_time_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an unsupported value type
+	 */
+	result = libfdatetime_posix_time_array_copy_to_filetime(
+	          posix_time_values,
+	          3,
+	          0xff,
+	          filetime_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_internal_posix_time_copy_to_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_posix_time_copy_to_date_time_values(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfdatetime_date_time_values_t *date_time_values = NULL;
+	libfdatetime_posix_time_t *posix_time             = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_date_time_values_initialize(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_copy_from_byte_stream(
+	          posix_time,
+	          fdatetime_test_posix_time_byte_stream_32bit,
+	          4,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 2012 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 3 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 17 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->hours",
+	 date_time_values->hours,
+	 (uint8_t) 14 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->minutes",
+	 date_time_values->minutes,
+	 (uint8_t) 15 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->seconds",
+	 date_time_values->seconds,
+	 (uint8_t) 27 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->milli_seconds",
+	 date_time_values->milli_seconds,
+	 (uint16_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->micro_seconds",
+	 date_time_values->micro_seconds,
+	 (uint16_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->nano_seconds",
+	 date_time_values->nano_seconds,
+	 (uint16_t) 0 );
+
+	result = libfdatetime_posix_time_copy_from_byte_stream(
+	          posix_time,
+	          fdatetime_test_posix_time_byte_stream_64bit,
+	          8,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 2012 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 3 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 17 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->hours",
+	 date_time_values->hours,
+	 (uint8_t) 14 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->minutes",
+	 date_time_values->minutes,
+	 (uint8_t) 15 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->seconds",
+	 date_time_values->seconds,
+	 (uint8_t) 27 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->milli_seconds",
+	 date_time_values->milli_seconds,
+	 (uint16_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->micro_seconds",
+	 date_time_values->micro_seconds,
+	 (uint16_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->nano_seconds",
+	 date_time_values->nano_seconds,
+	 (uint16_t) 0 );
+
+	result = libfdatetime_posix_time_copy_from_byte_stream(
+	          posix_time,
+	          fdatetime_test_posix_time_byte_stream_64bit_with_microseconds,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 2012 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 3 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 17 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->hours",
+	 date_time_values->hours,
+	 (uint8_t) 14 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->minutes",
+	 date_time_values->minutes,
+	 (uint8_t) 15 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->seconds",
+	 date_time_values->seconds,
+	 (uint8_t) 27 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->milli_seconds",
+	 date_time_values->milli_seconds,
+	 (uint16_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->micro_seconds",
+	 date_time_values->micro_seconds,
+	 (uint16_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->nano_seconds",
+	 date_time_values->nano_seconds,
+	 (uint16_t) 0 );
+
+	result = libfdatetime_posix_time_copy_from_byte_stream(
+	          posix_time,
+	          fdatetime_test_posix_time_byte_stream_64bit_with_nanoseconds,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 2018 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 9 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 7 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->hours",
 	 date_time_values->hours,
 	 (uint8_t) 14 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->minutes",
-	 date_time_values->minutes,
-	 (uint8_t) 15 );
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->minutes",
+	 date_time_values->minutes,
+	 (uint8_t) 7 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->seconds",
+	 date_time_values->seconds,
+	 (uint8_t) 51 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->milli_seconds",
+	 date_time_values->milli_seconds,
+	 (uint16_t) 179 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->micro_seconds",
+	 date_time_values->micro_seconds,
+	 (uint16_t) 715 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->nano_seconds",
+	 date_time_values->nano_seconds,
+	 (uint16_t) 86 );
+
+	/* Test the last day of 1999 and the first day of 2000
+	 */
+	result = libfdatetime_posix_time_copy_from_32bit(
+	          posix_time,
+	          946684799,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 1999 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 12 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 31 );
+
+	result = libfdatetime_posix_time_copy_from_32bit(
+	          posix_time,
+	          946684800,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date_time_values->year",
+	 date_time_values->year,
+	 (uint16_t) 2000 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->month",
+	 date_time_values->month,
+	 (uint8_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date_time_values->day",
+	 date_time_values->day,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          NULL,
+	          date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libfdatetime_internal_posix_time_t *) posix_time )->value_type = 0xff;
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          date_time_values,
+	          &error );
+
+	( (libfdatetime_internal_posix_time_t *) posix_time )->value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED;
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	          (libfdatetime_internal_posix_time_t *) posix_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_date_time_values_free(
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "date_time_values",
+	 date_time_values );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_date_time_values_free(
+		 &date_time_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_posix_time_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_posix_time_copy_from_date_time_values(
+     void )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_internal_posix_time_t internal_posix_time;
+
+	uint8_t value_types[ 4 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED };
+
+	uint64_t expected_values[ 4 ] = {
+		1284458063UL,
+		1284458063UL,
+		1284458063123456UL,
+		1284458063123456789UL };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	date_time_values.year          = 2010;
+	date_time_values.month         = 9;
+	date_time_values.day           = 14;
+	date_time_values.hours         = 9;
+	date_time_values.minutes       = 54;
+	date_time_values.seconds       = 23;
+	date_time_values.milli_seconds = 123;
+	date_time_values.micro_seconds = 456;
+	date_time_values.nano_seconds  = 789;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		result = libfdatetime_internal_posix_time_copy_from_date_time_values(
+		          &internal_posix_time,
+		          &date_time_values,
+		          value_types[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "internal_posix_time.timestamp",
+		 internal_posix_time.timestamp,
+		 expected_values[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+		 "internal_posix_time.value_type",
+		 internal_posix_time.value_type,
+		 value_types[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_posix_time_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_posix_time_copy_from_date_time_values(
+	          &internal_posix_time,
+	          NULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_posix_time_copy_from_date_time_values(
+	          &internal_posix_time,
+	          &date_time_values,
+	          0xff,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a date that cannot be represented by a 32-bit signed POSIX time
+	 */
+	date_time_values.year = 2040;
+
+	result = libfdatetime_internal_posix_time_copy_from_date_time_values(
+	          &internal_posix_time,
+	          &date_time_values,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_posix_time_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_copy_from_date_time_values(
+	          posix_time,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_to_utf8_string(
+	          posix_time,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_copy_from_date_time_values(
+	          NULL,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_date_time_values(
+	          posix_time,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_date_time_values(
+	          posix_time,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_date_time_values(
+	          posix_time,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_date_time_values(
+	          posix_time,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_get_sort_key(
+     void )
+{
+	uint64_t values[ 4 ] = {
+		0x0000000000000000UL,
+		0xffffffffffffffffUL,
+		0x8000000000000001UL,
+		0xffffffffffffffffUL };
+
+	uint8_t value_types[ 4 ] = {
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+		LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED };
+
+	int64_t expected_sort_keys[ 4 ] = {
+		116444736000000000,
+		116444735999999990,
+		LIBFDATETIME_SORT_KEY_MINIMUM,
+		LIBFDATETIME_SORT_KEY_MAXIMUM };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	int64_t sort_key                      = 0;
+	int result                            = 0;
+	int value_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		result = libfdatetime_posix_time_copy_from_64bit(
+		          posix_time,
+		          values[ value_index ],
+		          value_types[ value_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_posix_time_get_sort_key(
+		          posix_time,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_get_sort_key(
+	          NULL,
+	          &sort_key,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_get_sort_key(
+	          posix_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_array_get_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_array_get_sort_keys(
+     void )
+{
+	uint64_t posix_time_values[ 3 ] = {
+		0x0000000000000000UL,
+		0xffffffffffffffffUL,
+		0x8000000000000000UL };
+
+	int64_t expected_sort_keys[ 3 ] = {
+		116444736000000000,
+		116444735999999990,
+		LIBFDATETIME_SORT_KEY_MINIMUM };
+
+	int64_t sort_keys[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_array_get_sort_keys(
+	          posix_time_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test a value type that is not supported
+	 */
+	result = libfdatetime_posix_time_array_get_sort_keys(
+	          posix_time_values,
+	          3,
+	          0xff,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 LIBFDATETIME_SORT_KEY_INVALID );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_array_get_sort_keys(
+	          NULL,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_array_get_sort_keys(
+	          posix_time_values,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_array_get_sort_keys(
+	          posix_time_values,
+	          3,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_compare(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfdatetime_posix_time_t *first_posix_time  = NULL;
+	libfdatetime_posix_time_t *second_posix_time = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &first_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_posix_time",
+	 first_posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &second_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_posix_time",
+	 second_posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          first_posix_time,
+	          0xffffffffffffffffUL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          second_posix_time,
+	          0x0000000000000000UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_compare(
+	          first_posix_time,
+	          second_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_compare(
+	          second_posix_time,
+	          first_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_compare(
+	          first_posix_time,
+	          first_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_compare(
+	          NULL,
+	          second_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_compare(
+	          first_posix_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &first_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_posix_time",
+	 first_posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_free(
+	          &second_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_posix_time",
+	 second_posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &second_posix_time,
+		 NULL );
+	}
+	if( first_posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &first_posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_add_number_of_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_add_number_of_nano_seconds(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t value_64bit                  = 0;
+	uint8_t value_type                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x00000000000f4240ULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_add_number_of_nano_seconds(
+	          posix_time,
+	          (int64_t) 1500,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_to_64bit(
+	          posix_time,
+	          &value_64bit,
+	          &value_type,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x00000000000f4241ULL );
+
+	result = libfdatetime_posix_time_add_number_of_nano_seconds(
+	          posix_time,
+	          (int64_t) -3000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_to_64bit(
+	          posix_time,
+	          &value_64bit,
+	          &value_type,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xffffffffffe17b81ULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_add_number_of_nano_seconds(
+	          NULL,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_32bit(
+	          posix_time,
+	          0x00000000UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_add_number_of_nano_seconds(
+	          posix_time,
+	          (int64_t) -1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x7fffffffffffffffULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_add_number_of_nano_seconds(
+	          posix_time,
+	          (int64_t) 1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_copy_to_64bit(
+	          posix_time,
+	          &value_64bit,
+	          &value_type,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7fffffffffffffffULL );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_get_difference function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_get_difference(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfdatetime_posix_time_t *first_posix_time  = NULL;
+	libfdatetime_posix_time_t *second_posix_time = NULL;
+	int64_t number_of_nano_seconds               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &first_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_posix_time",
+	 first_posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &second_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_posix_time",
+	 second_posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          first_posix_time,
+	          0x000000000000000aULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->seconds",
-	 date_time_values->seconds,
-	 (uint8_t) 27 );
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->milli_seconds",
-	 date_time_values->milli_seconds,
-	 (uint16_t) 0 );
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          second_posix_time,
+	          0x00000002363e7f00ULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	          &error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->micro_seconds",
-	 date_time_values->micro_seconds,
-	 (uint16_t) 0 );
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->nano_seconds",
-	 date_time_values->nano_seconds,
-	 (uint16_t) 0 );
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libfdatetime_posix_time_copy_from_byte_stream(
-	          posix_time,
-	          fdatetime_test_posix_time_byte_stream_64bit,
-	          8,
-	          LIBFDATETIME_ENDIAN_BIG,
-	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED,
+	result = libfdatetime_posix_time_get_difference(
+	          first_posix_time,
+	          second_posix_time,
+	          &number_of_nano_seconds,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1490,9 +4275,15 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 "error",
 	 error );
 
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
-	          (libfdatetime_internal_posix_time_t *) posix_time,
-	          date_time_values,
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 500000000 );
+
+	result = libfdatetime_posix_time_get_difference(
+	          second_posix_time,
+	          first_posix_time,
+	          &number_of_nano_seconds,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1504,71 +4295,318 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 "error",
 	 error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->year",
-	 date_time_values->year,
-	 (uint16_t) 2012 );
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -500000000 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->month",
-	 date_time_values->month,
-	 (uint8_t) 3 );
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          first_posix_time,
+	          0x7fffffffffffffffULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->day",
-	 date_time_values->day,
-	 (uint8_t) 17 );
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->hours",
-	 date_time_values->hours,
-	 (uint8_t) 14 );
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->minutes",
-	 date_time_values->minutes,
-	 (uint8_t) 15 );
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          second_posix_time,
+	          0x0000000000000000ULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->seconds",
-	 date_time_values->seconds,
-	 (uint8_t) 27 );
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->milli_seconds",
-	 date_time_values->milli_seconds,
-	 (uint16_t) 0 );
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_get_difference(
+	          first_posix_time,
+	          second_posix_time,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0x7fffffffffffffffULL );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_get_difference(
+	          NULL,
+	          second_posix_time,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_get_difference(
+	          first_posix_time,
+	          NULL,
+	          &number_of_nano_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_get_difference(
+	          first_posix_time,
+	          second_posix_time,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &second_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_free(
+	          &first_posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &second_posix_time,
+		 NULL );
+	}
+	if( first_posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &first_posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_posix_time_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_truncate(
+     void )
+{
+	int units[ 6 ] = {
+		LIBFDATETIME_TRUNCATE_UNIT_SECOND,
+		LIBFDATETIME_TRUNCATE_UNIT_MINUTE,
+		LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+		LIBFDATETIME_TRUNCATE_UNIT_DAY,
+		LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+		LIBFDATETIME_TRUNCATE_UNIT_YEAR };
+
+	/* March 15, 1969 06:07:08.123456 truncated to every unit
+	 */
+	uint64_t expected_values[ 6 ] = {
+		0xffffe913174f1b00UL,
+		0xffffe91316d50900UL,
+		0xffffe912fdcc5800UL,
+		0xffffe90df6568000UL,
+		0xffffe7f4548f4000UL,
+		0xffffe35173ec2000UL };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	uint64_t value_64bit                  = 0;
+	uint8_t value_type                    = 0;
+	int result                            = 0;
+	int unit_index                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( unit_index = 0;
+	     unit_index < 6;
+	     unit_index++ )
+	{
+		result = libfdatetime_posix_time_copy_from_64bit(
+		          posix_time,
+		          0xffffe9131750fd40UL,
+		          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_posix_time_truncate(
+		          posix_time,
+		          units[ unit_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_posix_time_copy_to_64bit(
+		          posix_time,
+		          &value_64bit,
+		          &value_type,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ unit_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT8(
+		 "value_type",
+		 value_type,
+		 (uint8_t) LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_posix_time_truncate(
+	          NULL,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          &error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->micro_seconds",
-	 date_time_values->micro_seconds,
-	 (uint16_t) 0 );
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->nano_seconds",
-	 date_time_values->nano_seconds,
-	 (uint16_t) 0 );
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libfdatetime_posix_time_copy_from_byte_stream(
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_posix_time_truncate(
 	          posix_time,
-	          fdatetime_test_posix_time_byte_stream_64bit_with_microseconds,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
-	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FDATETIME_TEST_ASSERT_IS_NULL(
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
-	          (libfdatetime_internal_posix_time_t *) posix_time,
-	          date_time_values,
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1576,61 +4614,54 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 result,
 	 1 );
 
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->year",
-	 date_time_values->year,
-	 (uint16_t) 2012 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->month",
-	 date_time_values->month,
-	 (uint8_t) 3 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->day",
-	 date_time_values->day,
-	 (uint8_t) 17 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->hours",
-	 date_time_values->hours,
-	 (uint8_t) 14 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->minutes",
-	 date_time_values->minutes,
-	 (uint8_t) 15 );
+	return( 1 );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->seconds",
-	 date_time_values->seconds,
-	 (uint8_t) 27 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->milli_seconds",
-	 date_time_values->milli_seconds,
-	 (uint16_t) 0 );
+/* Tests the libfdatetime_posix_time_array_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_posix_time_array_truncate(
+     void )
+{
+	uint64_t posix_time_values[ 2 ] = {
+		0xffffe9131750fd40UL,
+		0xffffe9131750fd40UL };
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->micro_seconds",
-	 date_time_values->micro_seconds,
-	 (uint16_t) 0 );
+	uint64_t truncated_posix_time_values[ 2 ];
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->nano_seconds",
-	 date_time_values->nano_seconds,
-	 (uint16_t) 0 );
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	result = libfdatetime_posix_time_copy_from_byte_stream(
-	          posix_time,
-	          fdatetime_test_posix_time_byte_stream_64bit_with_nanoseconds,
-	          8,
-	          LIBFDATETIME_ENDIAN_LITTLE,
-	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED,
+	/* Test regular cases
+	 */
+	result = libfdatetime_posix_time_array_truncate(
+	          posix_time_values,
+	          2,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+	          truncated_posix_time_values,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1642,9 +4673,19 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 "error",
 	 error );
 
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
-	          (libfdatetime_internal_posix_time_t *) posix_time,
-	          date_time_values,
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "truncated_posix_time_values[ 1 ]",
+	 truncated_posix_time_values[ 1 ],
+	 0xffffe7f4548f4000UL );
+
+	/* Test truncating in place
+	 */
+	result = libfdatetime_posix_time_array_truncate(
+	          posix_time_values,
+	          2,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+	          posix_time_values,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1656,56 +4697,19 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	 "error",
 	 error );
 
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->year",
-	 date_time_values->year,
-	 (uint16_t) 2018 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->month",
-	 date_time_values->month,
-	 (uint8_t) 9 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->day",
-	 date_time_values->day,
-	 (uint8_t) 7 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->hours",
-	 date_time_values->hours,
-	 (uint8_t) 14 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->minutes",
-	 date_time_values->minutes,
-	 (uint8_t) 7 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT8(
-	 "date_time_values->seconds",
-	 date_time_values->seconds,
-	 (uint8_t) 51 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->milli_seconds",
-	 date_time_values->milli_seconds,
-	 (uint16_t) 179 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->micro_seconds",
-	 date_time_values->micro_seconds,
-	 (uint16_t) 715 );
-
-	FDATETIME_TEST_ASSERT_EQUAL_UINT16(
-	 "date_time_values->nano_seconds",
-	 date_time_values->nano_seconds,
-	 (uint16_t) 86 );
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "posix_time_values[ 0 ]",
+	 posix_time_values[ 0 ],
+	 0xffffe912fdcc5800UL );
 
 	/* Test error cases
 	 */
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
+	result = libfdatetime_posix_time_array_truncate(
 	          NULL,
-	          date_time_values,
+	          2,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_posix_time_values,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -1720,15 +4724,14 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	libcerror_error_free(
 	 &error );
 
-	( (libfdatetime_internal_posix_time_t *) posix_time )->value_type = 0xff;
-
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
-	          (libfdatetime_internal_posix_time_t *) posix_time,
-	          date_time_values,
+	result = libfdatetime_posix_time_array_truncate(
+	          posix_time_values,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_posix_time_values,
 	          &error );
 
-	( (libfdatetime_internal_posix_time_t *) posix_time )->value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED;
-
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1741,8 +4744,11 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libfdatetime_internal_posix_time_copy_to_date_time_values(
-	          (libfdatetime_internal_posix_time_t *) posix_time,
+	result = libfdatetime_posix_time_array_truncate(
+	          posix_time_values,
+	          2,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
 	          NULL,
 	          &error );
 
@@ -1758,41 +4764,25 @@ int fdatetime_test_internal_posix_time_copy_to_date_time_values(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfdatetime_posix_time_free(
-	          &posix_time,
+	result = libfdatetime_posix_time_array_truncate(
+	          posix_time_values,
+	          2,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          truncated_posix_time_values,
 	          &error );
 
 	FDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "posix_time",
-	 posix_time );
+	 -1 );
 
-	FDATETIME_TEST_ASSERT_IS_NULL(
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfdatetime_date_time_values_free(
-	          &date_time_values,
-	          &error );
-
-	FDATETIME_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "date_time_values",
-	 date_time_values );
-
-	FDATETIME_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -1802,23 +4792,9 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( posix_time != NULL )
-	{
-		libfdatetime_posix_time_free(
-		 &posix_time,
-		 NULL );
-	}
-	if( posix_time != NULL )
-	{
-		libfdatetime_date_time_values_free(
-		 &date_time_values,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
-
 /* Tests the libfdatetime_posix_time_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -1891,7 +4867,7 @@ int fdatetime_test_posix_time_get_string_size(
 	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
 	 "string_size",
 	 string_size,
-	 (size_t) 13 );
+	 (size_t) 22 );
 
 	FDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -4046,14 +7022,66 @@ int main(
 	 "libfdatetime_posix_time_copy_to_64bit",
 	 fdatetime_test_posix_time_copy_to_64bit );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_copy_from_utf8_string",
+	 fdatetime_test_posix_time_copy_from_utf8_string );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_copy_from_utf8_string_random",
+	 fdatetime_test_posix_time_copy_from_utf8_string_random );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_copy_to_filetime",
+	 fdatetime_test_posix_time_copy_to_filetime );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_array_copy_to_filetime",
+	 fdatetime_test_posix_time_array_copy_to_filetime );
+
 #if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
 
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_internal_posix_time_copy_to_date_time_values",
 	 fdatetime_test_internal_posix_time_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_posix_time_copy_from_date_time_values",
+	 fdatetime_test_internal_posix_time_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_get_sort_key",
+	 fdatetime_test_posix_time_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_array_get_sort_keys",
+	 fdatetime_test_posix_time_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_compare",
+	 fdatetime_test_posix_time_compare );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_add_number_of_nano_seconds",
+	 fdatetime_test_posix_time_add_number_of_nano_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_get_difference",
+	 fdatetime_test_posix_time_get_difference );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_truncate",
+	 fdatetime_test_posix_time_truncate );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_array_truncate",
+	 fdatetime_test_posix_time_array_truncate );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_posix_time_copy_from_date_time_values",
+	 fdatetime_test_posix_time_copy_from_date_time_values );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_posix_time_get_string_size",
 	 fdatetime_test_posix_time_get_string_size );
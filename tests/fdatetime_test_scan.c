@@ -0,0 +1,749 @@
+/*
+ * Library scan functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_scan.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_internal_scan_get_filetime_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_scan_get_filetime_range(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t lower_bound     = 0;
+	uint64_t upper_bound     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * January 1, 2000 and January 1, 2001 00:00:00
+	 */
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          2000,
+	          2000,
+	          &lower_bound,
+	          &upper_bound,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_bound",
+	 lower_bound,
+	 (uint64_t) 125911584000000000ULL );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_bound",
+	 upper_bound,
+	 (uint64_t) 126227808000000000ULL );
+
+	/* The years before 1601 cannot be represented by a FILETIME
+	 * January 1, 1602 00:00:00
+	 */
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          1500,
+	          1601,
+	          &lower_bound,
+	          &upper_bound,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_bound",
+	 lower_bound,
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_bound",
+	 upper_bound,
+	 (uint64_t) 315360000000000ULL );
+
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          1500,
+	          1600,
+	          &lower_bound,
+	          &upper_bound,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_bound",
+	 lower_bound,
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_bound",
+	 upper_bound,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          2001,
+	          2000,
+	          &lower_bound,
+	          &upper_bound,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          2000,
+	          10000,
+	          &lower_bound,
+	          &upper_bound,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          2000,
+	          2000,
+	          NULL,
+	          &upper_bound,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_scan_get_filetime_range(
+	          2000,
+	          2000,
+	          &lower_bound,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_scan_filetimes function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_scan_filetimes(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+	size_t offsets[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	size_t number_of_offsets = 0;
+	size_t scanned_size      = 0;
+	int result               = 0;
+
+	/* The FILETIME of August 12, 2010 21:06:31.5468750 is stored at aligned
+	 * and unaligned offsets, in the first and last window of the buffer and
+	 * in different blocks
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 1024 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( buffer[ 8 ] ),
+	 0x01cb3a623d0a17ceULL );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( buffer[ 21 ] ),
+	 0x01cb3a623d0a17ceULL );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( buffer[ 600 ] ),
+	 0x01cb3a623d0a17ceULL );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( buffer[ 1016 ] ),
+	 0x01cb3a623d0a17ceULL );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 (size_t) 4 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "scanned_size",
+	 scanned_size,
+	 (size_t) 1024 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 0 ]",
+	 offsets[ 0 ],
+	 (size_t) 8 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 1 ]",
+	 offsets[ 1 ],
+	 (size_t) 21 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 2 ]",
+	 offsets[ 2 ],
+	 (size_t) 600 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 3 ]",
+	 offsets[ 3 ],
+	 (size_t) 1016 );
+
+	/* Test with an alignment of 8 bytes
+	 */
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          8,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 (size_t) 3 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 0 ]",
+	 offsets[ 0 ],
+	 (size_t) 8 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 1 ]",
+	 offsets[ 1 ],
+	 (size_t) 600 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 2 ]",
+	 offsets[ 2 ],
+	 (size_t) 1016 );
+
+	/* Test with a range of years that does not contain the values
+	 */
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2011,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 (size_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "scanned_size",
+	 scanned_size,
+	 (size_t) 1024 );
+
+	/* Test resuming a scan when the offsets array is full
+	 */
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          1,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 (size_t) 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 0 ]",
+	 offsets[ 0 ],
+	 (size_t) 8 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "scanned_size",
+	 scanned_size,
+	 (size_t) 21 );
+
+	result = libfdatetime_scan_filetimes(
+	          &( buffer[ 21 ] ),
+	          1024 - 21,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 (size_t) 3 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 0 ]",
+	 offsets[ 0 ],
+	 (size_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 1 ]",
+	 offsets[ 1 ],
+	 (size_t) 579 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "offsets[ 2 ]",
+	 offsets[ 2 ],
+	 (size_t) 995 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "scanned_size",
+	 scanned_size,
+	 (size_t) 1024 - 21 );
+
+	/* Test with a buffer that is smaller than a FILETIME
+	 */
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          7,
+	          1,
+	          1601,
+	          9999,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 (size_t) 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "scanned_size",
+	 scanned_size,
+	 (size_t) 7 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_scan_filetimes(
+	          NULL,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          0,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2031,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          NULL,
+	          8,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          0,
+	          &number_of_offsets,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          NULL,
+	          &scanned_size,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_scan_filetimes(
+	          buffer,
+	          1024,
+	          1,
+	          2000,
+	          2030,
+	          offsets,
+	          8,
+	          &number_of_offsets,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_scan_get_filetime_range",
+	 fdatetime_test_internal_scan_get_filetime_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_scan_filetimes",
+	 fdatetime_test_scan_filetimes );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
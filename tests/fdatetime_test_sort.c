@@ -0,0 +1,1767 @@
+/*
+ * Library sort functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_sort.h"
+
+/* The number of sort keys used to test sorting and merging, which spans multiple worker threads
+ */
+#define FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS		100000
+
+/* Retrieves a pseudo random sort key
+ * Every other sort key is limited to a small range so that there are many equal sort keys
+ * Returns the next pseudo random sort key
+ */
+int64_t fdatetime_test_sort_get_random_sort_key(
+         uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	if( ( value & 1 ) != 0 )
+	{
+		return( (int64_t) ( value % 64 ) - 32 );
+	}
+	return( (int64_t) value );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_get_sort_key_from_number_of_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_get_sort_key_from_number_of_seconds(
+     void )
+{
+	int64_t number_of_seconds[ 5 ] = {
+		0,
+		-11644473600,
+		1284460463,
+		(int64_t) 0x7fffffffffffffffULL,
+		-( (int64_t) 0x7fffffffffffffffULL ) };
+
+	uint32_t number_of_nano_seconds[ 5 ] = {
+		0,
+		0,
+		999999999,
+		0,
+		0 };
+
+	int64_t expected_sort_keys[ 5 ] = {
+		116444736000000000,
+		0,
+		129289340639999999,
+		LIBFDATETIME_SORT_KEY_MAXIMUM,
+		LIBFDATETIME_SORT_KEY_MINIMUM };
+
+	int64_t sort_key = 0;
+	int value_index  = 0;
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		sort_key = libfdatetime_get_sort_key_from_number_of_seconds(
+		            number_of_seconds[ value_index ],
+		            number_of_nano_seconds[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_merge_get_stream_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_merge_get_stream_index(
+     void )
+{
+	int64_t stream[ 4 ] = {
+		1,
+		3,
+		5,
+		5 };
+
+	size_t stream_index = 0;
+
+	stream_index = libfdatetime_internal_merge_get_stream_index(
+	                stream,
+	                4,
+	                5,
+	                0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_index",
+	 stream_index,
+	 (size_t) 2 );
+
+	stream_index = libfdatetime_internal_merge_get_stream_index(
+	                stream,
+	                4,
+	                5,
+	                1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_index",
+	 stream_index,
+	 (size_t) 4 );
+
+	stream_index = libfdatetime_internal_merge_get_stream_index(
+	                stream,
+	                4,
+	                0,
+	                1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_index",
+	 stream_index,
+	 (size_t) 0 );
+
+	stream_index = libfdatetime_internal_merge_get_stream_index(
+	                NULL,
+	                4,
+	                5,
+	                1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_index",
+	 stream_index,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_merge_get_split function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_merge_get_split(
+     void )
+{
+	int64_t stream1[ 4 ] = {
+		1,
+		3,
+		5,
+		5 };
+
+	int64_t stream2[ 3 ] = {
+		2,
+		5,
+		6 };
+
+	const int64_t *streams[ 2 ] = {
+		stream1,
+		stream2 };
+
+	size_t stream_sizes[ 2 ] = {
+		4,
+		3 };
+
+	size_t merged_indexes[ 5 ] = {
+		0,
+		4,
+		5,
+		6,
+		7 };
+
+	size_t expected_stream_indexes[ 5 ][ 2 ] = {
+		{ 0, 0 },
+		{ 3, 1 },
+		{ 4, 1 },
+		{ 4, 2 },
+		{ 4, 3 } };
+
+	size_t stream_indexes[ 2 ];
+
+	int split_index = 0;
+
+	for( split_index = 0;
+	     split_index < 5;
+	     split_index++ )
+	{
+		libfdatetime_internal_merge_get_split(
+		 streams,
+		 stream_sizes,
+		 2,
+		 merged_indexes[ split_index ],
+		 stream_indexes );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "stream_indexes[ 0 ]",
+		 stream_indexes[ 0 ],
+		 expected_stream_indexes[ split_index ][ 0 ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "stream_indexes[ 1 ]",
+		 stream_indexes[ 1 ],
+		 expected_stream_indexes[ split_index ][ 1 ] );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_compare_any function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_compare_any(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfdatetime_filetime_t *filetime         = NULL;
+	libfdatetime_floatingtime_t *floatingtime = NULL;
+	libfdatetime_hfs_time_t *hfs_time         = NULL;
+	libfdatetime_posix_time_t *posix_time     = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_from_64bit(
+	          filetime,
+	          0x019db1ded53e8000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_initialize(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "floatingtime",
+	 floatingtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_copy_from_64bit(
+	          floatingtime,
+	          0x40d8f84000000000UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_initialize(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "hfs_time",
+	 hfs_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_copy_from_32bit(
+	          hfs_time,
+	          0x7c25b080UL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_from_64bit(
+	          posix_time,
+	          0x0000000000000001UL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the FILETIME, floatingtime and HFS time represent January 1, 1970 00:00:00
+	 * the POSIX time represents January 1, 1970 00:00:01
+	 */
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	          (intptr_t *) floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	          (intptr_t *) hfs_time,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	          (intptr_t *) hfs_time,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          (intptr_t *) posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          (intptr_t *) posix_time,
+	          LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	          (intptr_t *) floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          NULL,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          (intptr_t *) posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_UNDEFINED,
+	          (intptr_t *) filetime,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          (intptr_t *) posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_compare_any(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          (intptr_t *) filetime,
+	          -1,
+	          (intptr_t *) posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_hfs_time_free(
+	          &hfs_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_floatingtime_free(
+	          &floatingtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( hfs_time != NULL )
+	{
+		libfdatetime_hfs_time_free(
+		 &hfs_time,
+		 NULL );
+	}
+	if( floatingtime != NULL )
+	{
+		libfdatetime_floatingtime_free(
+		 &floatingtime,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_sort_keys function with a specific number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_sort_keys_with_threads(
+     int number_of_threads )
+{
+	libcerror_error_t *error    = NULL;
+	int64_t *original_sort_keys = NULL;
+	int64_t *scratch_sort_keys  = NULL;
+	int64_t *sort_keys          = NULL;
+	size_t *permutation         = NULL;
+	size_t *scratch_permutation = NULL;
+	uint64_t random_state       = 0x5eed1234cafef00dULL;
+	size_t sort_key_index       = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	original_sort_keys = (int64_t *) malloc(
+	                                  sizeof( int64_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "original_sort_keys",
+	 original_sort_keys );
+
+	sort_keys = (int64_t *) malloc(
+	                         sizeof( int64_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "sort_keys",
+	 sort_keys );
+
+	scratch_sort_keys = (int64_t *) malloc(
+	                                 sizeof( int64_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "scratch_sort_keys",
+	 scratch_sort_keys );
+
+	permutation = (size_t *) malloc(
+	                          sizeof( size_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "permutation",
+	 permutation );
+
+	scratch_permutation = (size_t *) malloc(
+	                                  sizeof( size_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "scratch_permutation",
+	 scratch_permutation );
+
+	for( sort_key_index = 0;
+	     sort_key_index < FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS;
+	     sort_key_index++ )
+	{
+		original_sort_keys[ sort_key_index ] = fdatetime_test_sort_get_random_sort_key(
+		                                        &random_state );
+
+		sort_keys[ sort_key_index ] = original_sort_keys[ sort_key_index ];
+	}
+	original_sort_keys[ 0 ] = LIBFDATETIME_SORT_KEY_MAXIMUM;
+	original_sort_keys[ 1 ] = LIBFDATETIME_SORT_KEY_INVALID;
+	sort_keys[ 0 ]          = LIBFDATETIME_SORT_KEY_MAXIMUM;
+	sort_keys[ 1 ]          = LIBFDATETIME_SORT_KEY_INVALID;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "sort_keys[ 0 ]",
+	 sort_keys[ 0 ],
+	 LIBFDATETIME_SORT_KEY_INVALID );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "sort_keys[ FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS - 1 ]",
+	 sort_keys[ FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS - 1 ],
+	 LIBFDATETIME_SORT_KEY_MAXIMUM );
+
+	for( sort_key_index = 0;
+	     sort_key_index < FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS;
+	     sort_key_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ sort_key_index ]",
+		 sort_keys[ sort_key_index ],
+		 original_sort_keys[ permutation[ sort_key_index ] ] );
+
+		if( sort_key_index > 0 )
+		{
+			FDATETIME_TEST_ASSERT_LESS_THAN_INT(
+			 "sort_keys[ sort_key_index ] < sort_keys[ sort_key_index - 1 ]",
+			 (int) ( sort_keys[ sort_key_index ] < sort_keys[ sort_key_index - 1 ] ),
+			 1 );
+
+			/* Equal sort keys keep their original order
+			 */
+			if( sort_keys[ sort_key_index ] == sort_keys[ sort_key_index - 1 ] )
+			{
+				FDATETIME_TEST_ASSERT_EQUAL_INT(
+				 "permutation[ sort_key_index ] > permutation[ sort_key_index - 1 ]",
+				 (int) ( permutation[ sort_key_index ] > permutation[ sort_key_index - 1 ] ),
+				 1 );
+			}
+		}
+	}
+	/* Test sorting without a permutation, the sorted sort keys are kept
+	 * and the same pseudo random sort keys are generated again
+	 */
+	random_state = 0x5eed1234cafef00dULL;
+
+	for( sort_key_index = 0;
+	     sort_key_index < FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS;
+	     sort_key_index++ )
+	{
+		original_sort_keys[ sort_key_index ] = sort_keys[ sort_key_index ];
+
+		sort_keys[ sort_key_index ] = fdatetime_test_sort_get_random_sort_key(
+		                               &random_state );
+	}
+	sort_keys[ 0 ] = LIBFDATETIME_SORT_KEY_MAXIMUM;
+	sort_keys[ 1 ] = LIBFDATETIME_SORT_KEY_INVALID;
+
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          NULL,
+	          FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS,
+	          scratch_sort_keys,
+	          NULL,
+	          number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sort_key_index = 0;
+	     sort_key_index < FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS;
+	     sort_key_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ sort_key_index ]",
+		 sort_keys[ sort_key_index ],
+		 original_sort_keys[ sort_key_index ] );
+	}
+	/* Clean up
+	 */
+	free(
+	 scratch_permutation );
+
+	scratch_permutation = NULL;
+
+	free(
+	 permutation );
+
+	permutation = NULL;
+
+	free(
+	 scratch_sort_keys );
+
+	scratch_sort_keys = NULL;
+
+	free(
+	 sort_keys );
+
+	sort_keys = NULL;
+
+	free(
+	 original_sort_keys );
+
+	original_sort_keys = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scratch_permutation != NULL )
+	{
+		free(
+		 scratch_permutation );
+	}
+	if( permutation != NULL )
+	{
+		free(
+		 permutation );
+	}
+	if( scratch_sort_keys != NULL )
+	{
+		free(
+		 scratch_sort_keys );
+	}
+	if( sort_keys != NULL )
+	{
+		free(
+		 sort_keys );
+	}
+	if( original_sort_keys != NULL )
+	{
+		free(
+		 original_sort_keys );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_sort_keys(
+     void )
+{
+	int64_t sort_keys[ 5 ] = {
+		3,
+		-1,
+		LIBFDATETIME_SORT_KEY_INVALID,
+		3,
+		0 };
+
+	int64_t expected_sort_keys[ 5 ] = {
+		LIBFDATETIME_SORT_KEY_INVALID,
+		-1,
+		0,
+		3,
+		3 };
+
+	size_t expected_permutation[ 5 ] = {
+		2,
+		1,
+		4,
+		0,
+		3 };
+
+	int64_t scratch_sort_keys[ 5 ];
+	size_t permutation[ 5 ];
+	size_t scratch_permutation[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int sort_key_index       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          5,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sort_key_index = 0;
+	     sort_key_index < 5;
+	     sort_key_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ sort_key_index ]",
+		 sort_keys[ sort_key_index ],
+		 expected_sort_keys[ sort_key_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_SIZE(
+		 "permutation[ sort_key_index ]",
+		 permutation[ sort_key_index ],
+		 expected_permutation[ sort_key_index ] );
+	}
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          0,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_sort_keys(
+	          NULL,
+	          permutation,
+	          5,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          (size_t) SSIZE_MAX,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          5,
+	          NULL,
+	          scratch_permutation,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          5,
+	          scratch_sort_keys,
+	          NULL,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          5,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          permutation,
+	          5,
+	          scratch_sort_keys,
+	          scratch_permutation,
+	          LIBFDATETIME_SORT_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_merge_sorted_streams function with a specific number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_merge_sorted_streams_with_threads(
+     int number_of_threads )
+{
+	const int64_t *streams[ 3 ];
+	size_t scratch_buffer[ 3 * 3 * 4 ];
+	size_t stream_sizes[ 3 ];
+
+	libcerror_error_t *error   = NULL;
+	int64_t *merged_sort_keys  = NULL;
+	int64_t *scratch_sort_keys = NULL;
+	int64_t *sort_keys         = NULL;
+	int *merged_stream_indexes = NULL;
+	uint64_t random_state      = 0x0123456789abcdefULL;
+	size_t merged_index        = 0;
+	size_t sort_key_index      = 0;
+	int result                 = 0;
+	int stream_index           = 0;
+
+	/* Initialize test
+	 */
+	sort_keys = (int64_t *) malloc(
+	                         sizeof( int64_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "sort_keys",
+	 sort_keys );
+
+	scratch_sort_keys = (int64_t *) malloc(
+	                                 sizeof( int64_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "scratch_sort_keys",
+	 scratch_sort_keys );
+
+	merged_sort_keys = (int64_t *) malloc(
+	                                sizeof( int64_t ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "merged_sort_keys",
+	 merged_sort_keys );
+
+	merged_stream_indexes = (int *) malloc(
+	                                 sizeof( int ) * FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "merged_stream_indexes",
+	 merged_stream_indexes );
+
+	for( sort_key_index = 0;
+	     sort_key_index < FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS;
+	     sort_key_index++ )
+	{
+		sort_keys[ sort_key_index ] = fdatetime_test_sort_get_random_sort_key(
+		                               &random_state );
+	}
+	/* Split the sort keys into 3 streams of different sizes that are sorted individually
+	 */
+	stream_sizes[ 0 ] = FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS / 2;
+	stream_sizes[ 1 ] = FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS / 3;
+	stream_sizes[ 2 ] = FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS - stream_sizes[ 0 ] - stream_sizes[ 1 ];
+
+	sort_key_index = 0;
+
+	for( stream_index = 0;
+	     stream_index < 3;
+	     stream_index++ )
+	{
+		streams[ stream_index ] = &( sort_keys[ sort_key_index ] );
+
+		result = libfdatetime_sort_keys(
+		          &( sort_keys[ sort_key_index ] ),
+		          NULL,
+		          stream_sizes[ stream_index ],
+		          scratch_sort_keys,
+		          NULL,
+		          1,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		sort_key_index += stream_sizes[ stream_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          3,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS,
+	          scratch_buffer,
+	          3 * 3 * 4,
+	          number_of_threads,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The merged sort keys should be the sorted sort keys
+	 * and sort keys with the same value should be merged in stream order
+	 */
+	result = libfdatetime_sort_keys(
+	          sort_keys,
+	          NULL,
+	          FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS,
+	          scratch_sort_keys,
+	          NULL,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( merged_index = 0;
+	     merged_index < FDATETIME_TEST_SORT_NUMBER_OF_SORT_KEYS;
+	     merged_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "merged_sort_keys[ merged_index ]",
+		 merged_sort_keys[ merged_index ],
+		 sort_keys[ merged_index ] );
+
+		if( ( merged_index > 0 )
+		 && ( merged_sort_keys[ merged_index ] == merged_sort_keys[ merged_index - 1 ] ) )
+		{
+			FDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "merged_stream_indexes[ merged_index ] < merged_stream_indexes[ merged_index - 1 ]",
+			 (int) ( merged_stream_indexes[ merged_index ] < merged_stream_indexes[ merged_index - 1 ] ),
+			 0 );
+		}
+	}
+	/* Clean up
+	 */
+	free(
+	 merged_stream_indexes );
+
+	merged_stream_indexes = NULL;
+
+	free(
+	 merged_sort_keys );
+
+	merged_sort_keys = NULL;
+
+	free(
+	 scratch_sort_keys );
+
+	scratch_sort_keys = NULL;
+
+	free(
+	 sort_keys );
+
+	sort_keys = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merged_stream_indexes != NULL )
+	{
+		free(
+		 merged_stream_indexes );
+	}
+	if( merged_sort_keys != NULL )
+	{
+		free(
+		 merged_sort_keys );
+	}
+	if( scratch_sort_keys != NULL )
+	{
+		free(
+		 scratch_sort_keys );
+	}
+	if( sort_keys != NULL )
+	{
+		free(
+		 sort_keys );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_merge_sorted_streams function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_merge_sorted_streams(
+     void )
+{
+	int64_t stream1[ 4 ] = {
+		1,
+		3,
+		5,
+		5 };
+
+	int64_t stream3[ 3 ] = {
+		2,
+		5,
+		6 };
+
+	int64_t stream4[ 1 ] = {
+		-7 };
+
+	const int64_t *streams[ 4 ] = {
+		stream1,
+		NULL,
+		stream3,
+		stream4 };
+
+	size_t stream_sizes[ 4 ] = {
+		4,
+		0,
+		3,
+		1 };
+
+	int64_t expected_merged_sort_keys[ 8 ] = {
+		-7,
+		1,
+		2,
+		3,
+		5,
+		5,
+		5,
+		6 };
+
+	int expected_merged_stream_indexes[ 8 ] = {
+		3,
+		0,
+		2,
+		0,
+		0,
+		0,
+		2,
+		2 };
+
+	int64_t merged_sort_keys[ 8 ];
+	int merged_stream_indexes[ 8 ];
+	size_t scratch_buffer[ 3 * 4 ];
+
+	libcerror_error_t *error = NULL;
+	int merged_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( merged_index = 0;
+	     merged_index < 8;
+	     merged_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "merged_sort_keys[ merged_index ]",
+		 merged_sort_keys[ merged_index ],
+		 expected_merged_sort_keys[ merged_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "merged_stream_indexes[ merged_index ]",
+		 merged_stream_indexes[ merged_index ],
+		 expected_merged_stream_indexes[ merged_index ] );
+	}
+	/* Test a single stream without merged stream indexes
+	 */
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          1,
+	          merged_sort_keys,
+	          NULL,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( merged_index = 0;
+	     merged_index < 4;
+	     merged_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "merged_sort_keys[ merged_index ]",
+		 merged_sort_keys[ merged_index ],
+		 stream1[ merged_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_merge_sorted_streams(
+	          NULL,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          NULL,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          0,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          NULL,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          7,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          (size_t) SSIZE_MAX,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          NULL,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4 - 1,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          0,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a stream that is missing
+	 */
+	stream_sizes[ 1 ] = 1;
+
+	result = libfdatetime_merge_sorted_streams(
+	          streams,
+	          stream_sizes,
+	          4,
+	          merged_sort_keys,
+	          merged_stream_indexes,
+	          8,
+	          scratch_buffer,
+	          3 * 4,
+	          1,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_get_sort_key_from_number_of_seconds",
+	 fdatetime_test_get_sort_key_from_number_of_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_merge_get_stream_index",
+	 fdatetime_test_internal_merge_get_stream_index );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_merge_get_split",
+	 fdatetime_test_internal_merge_get_split );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_compare_any",
+	 fdatetime_test_compare_any );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_sort_keys",
+	 fdatetime_test_sort_keys );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_sort_keys",
+	 fdatetime_test_sort_keys_with_threads,
+	 1 );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_sort_keys",
+	 fdatetime_test_sort_keys_with_threads,
+	 4 );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_merge_sorted_streams",
+	 fdatetime_test_merge_sorted_streams );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_merge_sorted_streams",
+	 fdatetime_test_merge_sorted_streams_with_threads,
+	 1 );
+
+	FDATETIME_TEST_RUN_WITH_ARGS(
+	 "libfdatetime_merge_sorted_streams",
+	 fdatetime_test_merge_sorted_streams_with_threads,
+	 4 );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,544 @@
+/*
+ * Library statistics functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+/* Tests the libfdatetime_stats_get function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_stats_get(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          &value,
+	          &error );
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#else
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+#endif
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_stats_get(
+	          -1,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME + 1,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          -1,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN + 1,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_stats_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_stats_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	uint64_t value           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_stats_reset(
+	          &error );
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#else
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+
+/* Tests the counters updated by the conversion functions
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_stats_counters(
+     void )
+{
+	uint8_t byte_stream[ 8 ] = {
+		0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	size_t string_index               = 0;
+	uint64_t value                    = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_stats_reset(
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value that can be represented as a date and time string
+	 */
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	result = libfdatetime_filetime_copy_to_utf8_string_with_index(
+	          filetime,
+	          utf8_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value that is out of range and is formatted in hexadecimal
+	 */
+	result = libfdatetime_filetime_copy_from_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFDATETIME_ENDIAN_BIG,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	result = libfdatetime_filetime_copy_to_utf8_string_with_index(
+	          filetime,
+	          utf8_string,
+	          32,
+	          &string_index,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the counters
+	 */
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2 );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_TO_STRING_CALLS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2 );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_OUT_OF_RANGE,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1 );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_HEXADECIMAL_FALLBACKS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1 );
+
+	/* The date and time string is 32 bytes and the hexadecimal string 24 bytes
+	 * including the end of string character
+	 */
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_BYTES_WRITTEN,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 56 );
+
+	result = libfdatetime_stats_get(
+	          LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	          LIBFDATETIME_STATS_COUNTER_TYPE_COPY_FROM_CALLS,
+	          &value,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFDATETIME_STATS ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_stats_get",
+	 fdatetime_test_stats_get );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_stats_reset",
+	 fdatetime_test_stats_reset );
+
+#if defined( HAVE_LIBFDATETIME_STATS )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_stats_counters",
+	 fdatetime_test_stats_counters );
+
+#endif /* defined( HAVE_LIBFDATETIME_STATS ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -648,8 +649,1536 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfdatetime_internal_systemtime_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_systemtime_copy_from_date_time_values(
+     void )
+{
+	libfdatetime_date_time_values_t date_time_values;
+	libfdatetime_date_time_values_t round_trip_date_time_values;
+	libfdatetime_internal_systemtime_t internal_systemtime;
+
+	uint16_t years[ 4 ] = {
+		1601, 1970, 2010, 9999 };
+
+	uint8_t months[ 4 ] = {
+		1, 1, 9, 12 };
+
+	uint8_t days[ 4 ] = {
+		1, 1, 14, 31 };
+
+	uint16_t expected_days_of_week[ 4 ] = {
+		1, 4, 2, 5 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	date_time_values.hours         = 9;
+	date_time_values.minutes       = 54;
+	date_time_values.seconds       = 23;
+	date_time_values.milli_seconds = 123;
+	date_time_values.micro_seconds = 456;
+	date_time_values.nano_seconds  = 789;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		date_time_values.year  = years[ value_index ];
+		date_time_values.month = months[ value_index ];
+		date_time_values.day   = days[ value_index ];
+
+		result = libfdatetime_internal_systemtime_copy_from_date_time_values(
+		          &internal_systemtime,
+		          &date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+		 "internal_systemtime.day_of_week",
+		 internal_systemtime.day_of_week,
+		 expected_days_of_week[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT16(
+		 "internal_systemtime.milli_seconds",
+		 internal_systemtime.milli_seconds,
+		 123 );
+
+		result = libfdatetime_internal_systemtime_copy_to_date_time_values(
+		          &internal_systemtime,
+		          &round_trip_date_time_values,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.year",
+		 (int) round_trip_date_time_values.year,
+		 (int) years[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.day",
+		 (int) round_trip_date_time_values.day,
+		 (int) days[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "round_trip_date_time_values.seconds",
+		 (int) round_trip_date_time_values.seconds,
+		 23 );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_systemtime_copy_from_date_time_values(
+	          NULL,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_systemtime_copy_from_date_time_values(
+	          &internal_systemtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date_time_values.year = 1600;
+
+	result = libfdatetime_internal_systemtime_copy_from_date_time_values(
+	          &internal_systemtime,
+	          &date_time_values,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+/* Tests the libfdatetime_systemtime_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_copy_to_filetime(
+     void )
+{
+	uint8_t byte_stream[ 16 ] = {
+		0xcf, 0x07, 0x0c, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00 };
+
+	uint8_t invalid_byte_stream[ 16 ] = {
+		0xcf, 0x07, 0x0d, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_filetime_t *filetime     = NULL;
+	libfdatetime_systemtime_t *systemtime = NULL;
+	uint64_t value_64bit                  = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          systemtime,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_systemtime_copy_to_filetime(
+	          systemtime,
+	          filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_filetime_copy_to_64bit(
+	          filetime,
+	          &value_64bit,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 0x01bf53eb24d4a980UL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_copy_to_filetime(
+	          NULL,
+	          filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_copy_to_filetime(
+	          systemtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid month
+	 */
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          systemtime,
+	          invalid_byte_stream,
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_to_filetime(
+	          systemtime,
+	          filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_free(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	if( systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_systemtime_copy_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_copy_to_posix_time(
+     void )
+{
+	uint8_t byte_stream[ 16 ] = {
+		0xcf, 0x07, 0x0c, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00 };
+
+	uint8_t invalid_byte_stream[ 16 ] = {
+		0xcf, 0x07, 0x0d, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_posix_time_t *posix_time = NULL;
+	libfdatetime_systemtime_t *systemtime = NULL;
+	uint32_t value_32bit                  = 0;
+	uint8_t value_type                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_initialize(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          systemtime,
+	          byte_stream,
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_systemtime_copy_to_posix_time(
+	          systemtime,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_posix_time_copy_to_32bit(
+	          posix_time,
+	          &value_32bit,
+	          &value_type,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 0x386d437f );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_copy_to_posix_time(
+	          NULL,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_copy_to_posix_time(
+	          systemtime,
+	          NULL,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid month
+	 */
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          systemtime,
+	          invalid_byte_stream,
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_to_posix_time(
+	          systemtime,
+	          posix_time,
+	          LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_posix_time_free(
+	          &posix_time,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "posix_time",
+	 posix_time );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_free(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	if( systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_systemtime_copy_from_date_time_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_copy_from_date_time_values(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_systemtime_t *systemtime = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_systemtime_copy_from_date_time_values(
+	          systemtime,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_to_utf8_string(
+	          systemtime,
+	          utf8_string,
+	          32,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "2010-09-14T09:54:23",
+	          20 );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_copy_from_date_time_values(
+	          NULL,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_copy_from_date_time_values(
+	          systemtime,
+	          2010,
+	          13,
+	          14,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_copy_from_date_time_values(
+	          systemtime,
+	          2010,
+	          9,
+	          31,
+	          9,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_copy_from_date_time_values(
+	          systemtime,
+	          2010,
+	          9,
+	          14,
+	          24,
+	          54,
+	          23,
+	          123456789,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_copy_from_date_time_values(
+	          systemtime,
+	          2010,
+	          9,
+	          14,
+	          9,
+	          54,
+	          23,
+	          1000000000,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_systemtime_free(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_systemtime_get_sort_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_get_sort_key(
+     void )
+{
+	uint8_t byte_stream[ 32 ] = {
+		0xda, 0x07, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00,
+		0xda, 0x07, 0x0d, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00 };
+
+	int64_t expected_sort_keys[ 2 ] = {
+		129289340631230000,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_systemtime_t *systemtime = NULL;
+	int64_t sort_key                      = 0;
+	int result                            = 0;
+	int value_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		result = libfdatetime_systemtime_copy_from_byte_stream(
+		          systemtime,
+		          &( byte_stream[ value_index * 16 ] ),
+		          16,
+		          LIBFDATETIME_ENDIAN_LITTLE,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_systemtime_get_sort_key(
+		          systemtime,
+		          &sort_key,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_key",
+		 sort_key,
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_get_sort_key(
+	          NULL,
+	          &sort_key,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_get_sort_key(
+	          systemtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_systemtime_free(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_systemtime_has_valid_day_of_week function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_has_valid_day_of_week(
+     void )
+{
+	uint8_t byte_stream[ 48 ] = {
+		0xda, 0x07, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00,
+		0xda, 0x07, 0x09, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00,
+		0xda, 0x07, 0x0d, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00 };
+
+	int expected_results[ 3 ] = {
+		1, 0, 0 };
+
+	libcerror_error_t *error              = NULL;
+	libfdatetime_systemtime_t *systemtime = NULL;
+	int result                            = 0;
+	int value_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfdatetime_systemtime_copy_from_byte_stream(
+		          systemtime,
+		          &( byte_stream[ value_index * 16 ] ),
+		          16,
+		          LIBFDATETIME_ENDIAN_LITTLE,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfdatetime_systemtime_has_valid_day_of_week(
+		          systemtime,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ value_index ] );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_has_valid_day_of_week(
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_systemtime_free(
+	          &systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "systemtime",
+	 systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_systemtime_array_get_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_array_get_sort_keys(
+     void )
+{
+	uint8_t byte_stream[ 32 ] = {
+		0xda, 0x07, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00,
+		0xda, 0x07, 0x0d, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00 };
+
+	int64_t expected_sort_keys[ 2 ] = {
+		129289340631230000,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	int64_t sort_keys[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_systemtime_array_get_sort_keys(
+	          byte_stream,
+	          32,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          sort_keys,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "sort_keys[ value_index ]",
+		 sort_keys[ value_index ],
+		 expected_sort_keys[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_array_get_sort_keys(
+	          NULL,
+	          32,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          sort_keys,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_array_get_sort_keys(
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          sort_keys,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_array_get_sort_keys(
+	          byte_stream,
+	          32,
+	          -1,
+	          sort_keys,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_array_get_sort_keys(
+	          byte_stream,
+	          32,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          NULL,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_array_get_sort_keys(
+	          byte_stream,
+	          24,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          sort_keys,
+	          2,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_systemtime_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_systemtime_compare(
+     void )
+{
+	uint8_t byte_stream[ 32 ] = {
+		0xda, 0x07, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7b, 0x00,
+		0xda, 0x07, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x17, 0x00, 0x7c, 0x00 };
+
+	libcerror_error_t *error                     = NULL;
+	libfdatetime_systemtime_t *first_systemtime  = NULL;
+	libfdatetime_systemtime_t *second_systemtime = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_systemtime_initialize(
+	          &first_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_systemtime",
+	 first_systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_initialize(
+	          &second_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_systemtime",
+	 second_systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          first_systemtime,
+	          &( byte_stream[ 0 ] ),
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_copy_from_byte_stream(
+	          second_systemtime,
+	          &( byte_stream[ 16 ] ),
+	          16,
+	          LIBFDATETIME_ENDIAN_LITTLE,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_systemtime_compare(
+	          first_systemtime,
+	          second_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_LESS );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_compare(
+	          second_systemtime,
+	          first_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_GREATER );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_compare(
+	          first_systemtime,
+	          first_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATETIME_COMPARE_EQUAL );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_systemtime_compare(
+	          NULL,
+	          second_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_systemtime_compare(
+	          first_systemtime,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_systemtime_free(
+	          &first_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_systemtime",
+	 first_systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdatetime_systemtime_free(
+	          &second_systemtime,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_systemtime",
+	 second_systemtime );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &second_systemtime,
+		 NULL );
+	}
+	if( first_systemtime != NULL )
+	{
+		libfdatetime_systemtime_free(
+		 &first_systemtime,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfdatetime_systemtime_get_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -2568,8 +4097,40 @@ int main(
 	 "libfdatetime_internal_systemtime_copy_to_date_time_values",
 	 fdatetime_test_internal_systemtime_copy_to_date_time_values );
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_systemtime_copy_from_date_time_values",
+	 fdatetime_test_internal_systemtime_copy_from_date_time_values );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
 
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_copy_from_date_time_values",
+	 fdatetime_test_systemtime_copy_from_date_time_values );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_copy_to_filetime",
+	 fdatetime_test_systemtime_copy_to_filetime );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_copy_to_posix_time",
+	 fdatetime_test_systemtime_copy_to_posix_time );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_get_sort_key",
+	 fdatetime_test_systemtime_get_sort_key );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_has_valid_day_of_week",
+	 fdatetime_test_systemtime_has_valid_day_of_week );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_array_get_sort_keys",
+	 fdatetime_test_systemtime_array_get_sort_keys );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_systemtime_compare",
+	 fdatetime_test_systemtime_compare );
+
 	FDATETIME_TEST_RUN(
 	 "libfdatetime_systemtime_get_string_size",
 	 fdatetime_test_systemtime_get_string_size );
@@ -0,0 +1,1050 @@
+/*
+ * Library multi-threaded conversion testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+/* The number of values of each timestamp type
+ */
+#define FDATETIME_TEST_THREADS_NUMBER_OF_VALUES		256
+
+/* The number of threads that convert values concurrently
+ */
+#define FDATETIME_TEST_THREADS_NUMBER_OF_THREADS	8
+
+/* The number of times a thread converts all values
+ */
+#define FDATETIME_TEST_THREADS_NUMBER_OF_ITERATIONS	8
+
+/* The maximum size of a timestamp value in the byte stream
+ */
+#define FDATETIME_TEST_THREADS_MAXIMUM_VALUE_SIZE	16
+
+/* The size of the strings, which is large enough for the hexadecimal representation of a SYSTEMTIME
+ */
+#define FDATETIME_TEST_THREADS_STRING_SIZE		64
+
+typedef struct fdatetime_test_threads_worker fdatetime_test_threads_worker_t;
+
+struct fdatetime_test_threads_worker
+{
+	/* The timestamps shared by all threads
+	 */
+	intptr_t **shared_timestamps;
+
+	/* The checksum of the converted strings
+	 */
+	uint32_t checksum;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* The string format flags used by the test, these include combinations that
+ * use the specialized string functions and combinations that use the generic function
+ */
+uint32_t fdatetime_test_threads_string_format_flags[ 4 ] = {
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MICRO_SECONDS,
+	LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR };
+
+/* The timestamp types and the size of their values in the byte stream
+ */
+int fdatetime_test_threads_timestamp_types[ 7 ] = {
+	LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME,
+	LIBFDATETIME_TIMESTAMP_TYPE_FILETIME,
+	LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME,
+	LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME,
+	LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE,
+	LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME,
+	LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME };
+
+size_t fdatetime_test_threads_value_sizes[ 7 ] = {
+	4, 8, 8, 4, 8, 4, 16 };
+
+/* The input byte streams, one per timestamp type
+ */
+uint8_t fdatetime_test_threads_byte_streams[ 7 ][ FDATETIME_TEST_THREADS_NUMBER_OF_VALUES * FDATETIME_TEST_THREADS_MAXIMUM_VALUE_SIZE ];
+
+/* Retrieves a pseudo random value
+ * Returns the next pseudo random value
+ */
+uint32_t fdatetime_test_threads_get_random_value(
+          uint32_t *random_state )
+{
+	uint32_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Fills the input byte streams with deterministic values
+ */
+void fdatetime_test_threads_initialize_byte_streams(
+      void )
+{
+	double floatingtime_value = 0.0;
+	uint64_t value_64bit      = 0;
+	uint32_t random_state     = 0x1234abcdUL;
+	uint8_t *byte_stream      = NULL;
+	int value_index           = 0;
+
+	for( value_index = 0;
+	     value_index < FDATETIME_TEST_THREADS_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		/* FAT date and time, includes invalid values
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 0 ][ value_index * 4 ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 byte_stream,
+		 fdatetime_test_threads_get_random_value( &random_state ) );
+
+		/* FILETIME
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 1 ][ value_index * 8 ] );
+
+		value_64bit   = fdatetime_test_threads_get_random_value( &random_state ) & 0x01ffffffUL;
+		value_64bit <<= 32;
+		value_64bit  |= fdatetime_test_threads_get_random_value( &random_state );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 byte_stream,
+		 value_64bit );
+
+		/* Floatingtime, number of days since December 30, 1899
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 2 ][ value_index * 8 ] );
+
+		floatingtime_value = (double) ( fdatetime_test_threads_get_random_value( &random_state ) % 100000 )
+		                   + ( (double) ( fdatetime_test_threads_get_random_value( &random_state ) % 86400 ) / 86400.0 );
+
+		memory_copy(
+		 &value_64bit,
+		 &floatingtime_value,
+		 8 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 byte_stream,
+		 value_64bit );
+
+		/* HFS time
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 3 ][ value_index * 4 ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 byte_stream,
+		 fdatetime_test_threads_get_random_value( &random_state ) );
+
+		/* NSF timedate, Julian day in the upper 24-bits and 1/100 seconds in the lower 32-bits
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 4 ][ value_index * 8 ] );
+
+		value_64bit   = 2305814 + ( fdatetime_test_threads_get_random_value( &random_state ) % 3000000 );
+		value_64bit <<= 32;
+		value_64bit  |= fdatetime_test_threads_get_random_value( &random_state ) % 8640000;
+
+		byte_stream_copy_from_uint64_little_endian(
+		 byte_stream,
+		 value_64bit );
+
+		/* POSIX time, 32-bit unsigned number of seconds
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 5 ][ value_index * 4 ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 byte_stream,
+		 fdatetime_test_threads_get_random_value( &random_state ) );
+
+		/* Systemtime, every 16th value is invalid
+		 */
+		byte_stream = &( fdatetime_test_threads_byte_streams[ 6 ][ value_index * 16 ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 0 ] ),
+		 1601 + ( fdatetime_test_threads_get_random_value( &random_state ) % 8399 ) );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 2 ] ),
+		 1 + ( fdatetime_test_threads_get_random_value( &random_state ) % 12 ) );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 4 ] ),
+		 fdatetime_test_threads_get_random_value( &random_state ) % 7 );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 6 ] ),
+		 1 + ( fdatetime_test_threads_get_random_value( &random_state ) % 28 ) );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 8 ] ),
+		 fdatetime_test_threads_get_random_value( &random_state ) % 24 );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 10 ] ),
+		 fdatetime_test_threads_get_random_value( &random_state ) % 60 );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 12 ] ),
+		 fdatetime_test_threads_get_random_value( &random_state ) % 60 );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ 14 ] ),
+		 fdatetime_test_threads_get_random_value( &random_state ) % 1000 );
+
+		if( ( value_index % 16 ) == 15 )
+		{
+			byte_stream[ 2 ] = 13;
+		}
+	}
+}
+
+/* Updates a checksum with the contents of a buffer
+ * Returns the updated checksum
+ */
+uint32_t fdatetime_test_threads_update_checksum(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size )
+{
+	size_t buffer_index = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < size;
+	     buffer_index++ )
+	{
+		checksum ^= buffer[ buffer_index ];
+		checksum *= 0x01000193UL;
+	}
+	return( checksum );
+}
+
+/* Creates a timestamp of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_threads_timestamp_initialize(
+     int timestamp_type,
+     intptr_t **timestamp,
+     libcerror_error_t **error )
+{
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			return( libfdatetime_fat_date_time_initialize(
+			         (libfdatetime_fat_date_time_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			return( libfdatetime_filetime_initialize(
+			         (libfdatetime_filetime_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			return( libfdatetime_floatingtime_initialize(
+			         (libfdatetime_floatingtime_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			return( libfdatetime_hfs_time_initialize(
+			         (libfdatetime_hfs_time_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			return( libfdatetime_nsf_timedate_initialize(
+			         (libfdatetime_nsf_timedate_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			return( libfdatetime_posix_time_initialize(
+			         (libfdatetime_posix_time_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			return( libfdatetime_systemtime_initialize(
+			         (libfdatetime_systemtime_t **) timestamp,
+			         error ) );
+	}
+	return( -1 );
+}
+
+/* Frees a timestamp of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_threads_timestamp_free(
+     int timestamp_type,
+     intptr_t **timestamp,
+     libcerror_error_t **error )
+{
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			return( libfdatetime_fat_date_time_free(
+			         (libfdatetime_fat_date_time_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			return( libfdatetime_filetime_free(
+			         (libfdatetime_filetime_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			return( libfdatetime_floatingtime_free(
+			         (libfdatetime_floatingtime_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			return( libfdatetime_hfs_time_free(
+			         (libfdatetime_hfs_time_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			return( libfdatetime_nsf_timedate_free(
+			         (libfdatetime_nsf_timedate_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			return( libfdatetime_posix_time_free(
+			         (libfdatetime_posix_time_t **) timestamp,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			return( libfdatetime_systemtime_free(
+			         (libfdatetime_systemtime_t **) timestamp,
+			         error ) );
+	}
+	return( -1 );
+}
+
+/* Copies a timestamp of a specific type from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_threads_timestamp_copy_from_byte_stream(
+     int timestamp_type,
+     intptr_t *timestamp,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			return( libfdatetime_fat_date_time_copy_from_byte_stream(
+			         (libfdatetime_fat_date_time_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			return( libfdatetime_filetime_copy_from_byte_stream(
+			         (libfdatetime_filetime_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			return( libfdatetime_floatingtime_copy_from_byte_stream(
+			         (libfdatetime_floatingtime_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			return( libfdatetime_hfs_time_copy_from_byte_stream(
+			         (libfdatetime_hfs_time_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			return( libfdatetime_nsf_timedate_copy_from_byte_stream(
+			         (libfdatetime_nsf_timedate_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			return( libfdatetime_posix_time_copy_from_byte_stream(
+			         (libfdatetime_posix_time_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED,
+			         error ) );
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			return( libfdatetime_systemtime_copy_from_byte_stream(
+			         (libfdatetime_systemtime_t *) timestamp,
+			         byte_stream,
+			         byte_stream_size,
+			         LIBFDATETIME_ENDIAN_LITTLE,
+			         error ) );
+	}
+	return( -1 );
+}
+
+/* Copies a timestamp of a specific type to UTF-8, UTF-16 and UTF-32 strings
+ * and updates the checksum with the strings
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_threads_timestamp_copy_to_strings(
+     int timestamp_type,
+     intptr_t *timestamp,
+     uint32_t string_format_flags,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ FDATETIME_TEST_THREADS_STRING_SIZE ];
+	uint16_t utf16_string[ FDATETIME_TEST_THREADS_STRING_SIZE ];
+	uint32_t utf32_string[ FDATETIME_TEST_THREADS_STRING_SIZE ];
+
+	int result = -1;
+
+	/* Clear the strings so that the checksum does not depend on unused string data
+	 */
+	if( memory_set(
+	     utf8_string,
+	     0,
+	     sizeof( uint8_t ) * FDATETIME_TEST_THREADS_STRING_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     utf16_string,
+	     0,
+	     sizeof( uint16_t ) * FDATETIME_TEST_THREADS_STRING_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     utf32_string,
+	     0,
+	     sizeof( uint32_t ) * FDATETIME_TEST_THREADS_STRING_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	switch( timestamp_type )
+	{
+		case LIBFDATETIME_TIMESTAMP_TYPE_FAT_DATE_TIME:
+			result = libfdatetime_fat_date_time_copy_to_utf8_string(
+			          (libfdatetime_fat_date_time_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_fat_date_time_copy_to_utf16_string(
+				          (libfdatetime_fat_date_time_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_fat_date_time_copy_to_utf32_string(
+				          (libfdatetime_fat_date_time_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FILETIME:
+			result = libfdatetime_filetime_copy_to_utf8_string(
+			          (libfdatetime_filetime_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_filetime_copy_to_utf16_string(
+				          (libfdatetime_filetime_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_filetime_copy_to_utf32_string(
+				          (libfdatetime_filetime_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_FLOATINGTIME:
+			result = libfdatetime_floatingtime_copy_to_utf8_string(
+			          (libfdatetime_floatingtime_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_floatingtime_copy_to_utf16_string(
+				          (libfdatetime_floatingtime_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_floatingtime_copy_to_utf32_string(
+				          (libfdatetime_floatingtime_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_HFS_TIME:
+			result = libfdatetime_hfs_time_copy_to_utf8_string(
+			          (libfdatetime_hfs_time_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_hfs_time_copy_to_utf16_string(
+				          (libfdatetime_hfs_time_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_hfs_time_copy_to_utf32_string(
+				          (libfdatetime_hfs_time_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_NSF_TIMEDATE:
+			result = libfdatetime_nsf_timedate_copy_to_utf8_string(
+			          (libfdatetime_nsf_timedate_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_nsf_timedate_copy_to_utf16_string(
+				          (libfdatetime_nsf_timedate_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_nsf_timedate_copy_to_utf32_string(
+				          (libfdatetime_nsf_timedate_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_POSIX_TIME:
+			result = libfdatetime_posix_time_copy_to_utf8_string(
+			          (libfdatetime_posix_time_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_posix_time_copy_to_utf16_string(
+				          (libfdatetime_posix_time_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_posix_time_copy_to_utf32_string(
+				          (libfdatetime_posix_time_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+
+		case LIBFDATETIME_TIMESTAMP_TYPE_SYSTEMTIME:
+			result = libfdatetime_systemtime_copy_to_utf8_string(
+			          (libfdatetime_systemtime_t *) timestamp,
+			          utf8_string,
+			          FDATETIME_TEST_THREADS_STRING_SIZE,
+			          string_format_flags,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfdatetime_systemtime_copy_to_utf16_string(
+				          (libfdatetime_systemtime_t *) timestamp,
+				          utf16_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libfdatetime_systemtime_copy_to_utf32_string(
+				          (libfdatetime_systemtime_t *) timestamp,
+				          utf32_string,
+				          FDATETIME_TEST_THREADS_STRING_SIZE,
+				          string_format_flags,
+				          error );
+			}
+			break;
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	*checksum = fdatetime_test_threads_update_checksum(
+	             *checksum,
+	             utf8_string,
+	             FDATETIME_TEST_THREADS_STRING_SIZE );
+
+	*checksum = fdatetime_test_threads_update_checksum(
+	             *checksum,
+	             (uint8_t *) utf16_string,
+	             FDATETIME_TEST_THREADS_STRING_SIZE * sizeof( uint16_t ) );
+
+	*checksum = fdatetime_test_threads_update_checksum(
+	             *checksum,
+	             (uint8_t *) utf32_string,
+	             FDATETIME_TEST_THREADS_STRING_SIZE * sizeof( uint32_t ) );
+
+	return( 1 );
+}
+
+/* Converts all values of all timestamp types
+ * The timestamps of the worker are private, the shared timestamps are only read
+ * Returns 1 if successful or -1 on error
+ */
+int fdatetime_test_threads_worker_convert_values(
+     fdatetime_test_threads_worker_t *worker,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ FDATETIME_TEST_THREADS_STRING_SIZE ];
+
+	intptr_t *timestamp        = NULL;
+	const uint8_t *byte_stream = NULL;
+	size_t value_size          = 0;
+	int flags_index            = 0;
+	int type_index             = 0;
+	int value_index            = 0;
+
+	for( type_index = 0;
+	     type_index < 7;
+	     type_index++ )
+	{
+		value_size = fdatetime_test_threads_value_sizes[ type_index ];
+
+		if( fdatetime_test_threads_timestamp_initialize(
+		     fdatetime_test_threads_timestamp_types[ type_index ],
+		     &timestamp,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < FDATETIME_TEST_THREADS_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			byte_stream = &( fdatetime_test_threads_byte_streams[ type_index ][ value_index * value_size ] );
+
+			if( fdatetime_test_threads_timestamp_copy_from_byte_stream(
+			     fdatetime_test_threads_timestamp_types[ type_index ],
+			     timestamp,
+			     byte_stream,
+			     value_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			for( flags_index = 0;
+			     flags_index < 4;
+			     flags_index++ )
+			{
+				if( fdatetime_test_threads_timestamp_copy_to_strings(
+				     fdatetime_test_threads_timestamp_types[ type_index ],
+				     timestamp,
+				     fdatetime_test_threads_string_format_flags[ flags_index ],
+				     &( worker->checksum ),
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+		}
+		if( fdatetime_test_threads_timestamp_free(
+		     fdatetime_test_threads_timestamp_types[ type_index ],
+		     &timestamp,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		/* Read the timestamp that is shared with the other threads
+		 */
+		for( flags_index = 0;
+		     flags_index < 4;
+		     flags_index++ )
+		{
+			if( fdatetime_test_threads_timestamp_copy_to_strings(
+			     fdatetime_test_threads_timestamp_types[ type_index ],
+			     worker->shared_timestamps[ type_index ],
+			     fdatetime_test_threads_string_format_flags[ flags_index ],
+			     &( worker->checksum ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	/* The error functions must be usable concurrently as well
+	 */
+	if( libfdatetime_filetime_copy_to_utf8_string(
+	     NULL,
+	     utf8_string,
+	     FDATETIME_TEST_THREADS_STRING_SIZE,
+	     fdatetime_test_threads_string_format_flags[ 0 ],
+	     error ) != -1 )
+	{
+		goto on_error;
+	}
+	libcerror_error_free(
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( timestamp != NULL )
+	{
+		fdatetime_test_threads_timestamp_free(
+		 fdatetime_test_threads_timestamp_types[ type_index ],
+		 &timestamp,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The worker thread start function
+ * Returns NULL
+ */
+void *fdatetime_test_threads_worker_start_function(
+       void *arguments )
+{
+	libcerror_error_t *error                = NULL;
+	fdatetime_test_threads_worker_t *worker = NULL;
+	int iteration                           = 0;
+
+	worker = (fdatetime_test_threads_worker_t *) arguments;
+
+	worker->result = 1;
+
+	for( iteration = 0;
+	     iteration < FDATETIME_TEST_THREADS_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		worker->checksum = 0x811c9dc5UL;
+
+		if( fdatetime_test_threads_worker_convert_values(
+		     worker,
+		     &error ) != 1 )
+		{
+			worker->result = -1;
+
+			break;
+		}
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( NULL );
+}
+
+/* Tests converting values concurrently from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_threads_convert(
+     void )
+{
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	pthread_t threads[ FDATETIME_TEST_THREADS_NUMBER_OF_THREADS ];
+#endif
+
+	fdatetime_test_threads_worker_t workers[ FDATETIME_TEST_THREADS_NUMBER_OF_THREADS ];
+	intptr_t *shared_timestamps[ 7 ];
+
+	fdatetime_test_threads_worker_t reference_worker;
+
+	libcerror_error_t *error   = NULL;
+	int number_of_threads      = 0;
+	int result                 = 0;
+	int thread_index           = 0;
+	int type_index             = 0;
+
+	fdatetime_test_threads_initialize_byte_streams();
+
+	/* Initialize test
+	 */
+	for( type_index = 0;
+	     type_index < 7;
+	     type_index++ )
+	{
+		shared_timestamps[ type_index ] = NULL;
+	}
+	for( type_index = 0;
+	     type_index < 7;
+	     type_index++ )
+	{
+		result = fdatetime_test_threads_timestamp_initialize(
+		          fdatetime_test_threads_timestamp_types[ type_index ],
+		          &( shared_timestamps[ type_index ] ),
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fdatetime_test_threads_timestamp_copy_from_byte_stream(
+		          fdatetime_test_threads_timestamp_types[ type_index ],
+		          shared_timestamps[ type_index ],
+		          fdatetime_test_threads_byte_streams[ type_index ],
+		          fdatetime_test_threads_value_sizes[ type_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Determine the reference checksum in the calling thread
+	 */
+	reference_worker.shared_timestamps = shared_timestamps;
+	reference_worker.checksum          = 0x811c9dc5UL;
+
+	result = fdatetime_test_threads_worker_convert_values(
+	          &reference_worker,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < FDATETIME_TEST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		workers[ thread_index ].shared_timestamps = shared_timestamps;
+		workers[ thread_index ].checksum          = 0;
+		workers[ thread_index ].result            = 0;
+	}
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+	for( thread_index = 0;
+	     thread_index < FDATETIME_TEST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &fdatetime_test_threads_worker_start_function,
+		          (void *) &( workers[ thread_index ] ) );
+
+		if( result != 0 )
+		{
+			break;
+		}
+		number_of_threads++;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 FDATETIME_TEST_THREADS_NUMBER_OF_THREADS );
+#else
+	/* Without multi-threading support the workers run one after the other
+	 */
+	for( thread_index = 0;
+	     thread_index < FDATETIME_TEST_THREADS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		fdatetime_test_threads_worker_start_function(
+		 (void *) &( workers[ thread_index ] ) );
+
+		number_of_threads++;
+	}
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "workers[ thread_index ].result",
+		 workers[ thread_index ].result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "workers[ thread_index ].checksum",
+		 workers[ thread_index ].checksum,
+		 reference_worker.checksum );
+	}
+	/* Clean up
+	 */
+	for( type_index = 0;
+	     type_index < 7;
+	     type_index++ )
+	{
+		result = fdatetime_test_threads_timestamp_free(
+		          fdatetime_test_threads_timestamp_types[ type_index ],
+		          &( shared_timestamps[ type_index ] ),
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( type_index = 0;
+	     type_index < 7;
+	     type_index++ )
+	{
+		if( shared_timestamps[ type_index ] != NULL )
+		{
+			fdatetime_test_threads_timestamp_free(
+			 fdatetime_test_threads_timestamp_types[ type_index ],
+			 &( shared_timestamps[ type_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_threads_convert",
+	 fdatetime_test_threads_convert );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,585 @@
+/*
+ * Library truncate functions testing program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fdatetime_test_libcerror.h"
+#include "fdatetime_test_libfdatetime.h"
+#include "fdatetime_test_macros.h"
+#include "fdatetime_test_unused.h"
+
+#include "../libfdatetime/libfdatetime_truncate.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+/* Tests the libfdatetime_internal_truncate_get_unit_number_of_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_truncate_get_unit_number_of_seconds(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	int64_t unit_number_of_seconds = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+	          &unit_number_of_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "unit_number_of_seconds",
+	 unit_number_of_seconds,
+	 (int64_t) 3600 );
+
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+	          &unit_number_of_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_truncate_get_unit_number_of_seconds(
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          &unit_number_of_seconds,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_truncate_number_of_days function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_truncate_number_of_days(
+     void )
+{
+	/* January 1, 1970, February 29, 2024, December 31, 2024, March 1, 2000,
+	 * December 31, 1969, February 29, 1600 and January 1, 1601
+	 */
+	int64_t number_of_days[ 7 ] = {
+		0,
+		19782,
+		20088,
+		11017,
+		-1,
+		-135081,
+		-134774 };
+
+	int64_t expected_month_number_of_days[ 7 ] = {
+		0,
+		19754,
+		20058,
+		11017,
+		-31,
+		-135109,
+		-134774 };
+
+	int64_t expected_year_number_of_days[ 7 ] = {
+		0,
+		19723,
+		19723,
+		10957,
+		-365,
+		-135140,
+		-134774 };
+
+	int64_t truncated_number_of_days = 0;
+	int value_index                  = 0;
+
+	for( value_index = 0;
+	     value_index < 7;
+	     value_index++ )
+	{
+		truncated_number_of_days = libfdatetime_internal_truncate_number_of_days(
+		                            number_of_days[ value_index ],
+		                            LIBFDATETIME_TRUNCATE_UNIT_MONTH );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_number_of_days",
+		 truncated_number_of_days,
+		 expected_month_number_of_days[ value_index ] );
+
+		truncated_number_of_days = libfdatetime_internal_truncate_number_of_days(
+		                            number_of_days[ value_index ],
+		                            LIBFDATETIME_TRUNCATE_UNIT_YEAR );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_number_of_days",
+		 truncated_number_of_days,
+		 expected_year_number_of_days[ value_index ] );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfdatetime_internal_truncate_number_of_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_internal_truncate_number_of_seconds(
+     void )
+{
+	int units[ 6 ] = {
+		LIBFDATETIME_TRUNCATE_UNIT_SECOND,
+		LIBFDATETIME_TRUNCATE_UNIT_MINUTE,
+		LIBFDATETIME_TRUNCATE_UNIT_HOUR,
+		LIBFDATETIME_TRUNCATE_UNIT_DAY,
+		LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+		LIBFDATETIME_TRUNCATE_UNIT_YEAR };
+
+	/* December 31, 1969 23:59:59.5 truncated to every unit
+	 */
+	int64_t expected_number_of_seconds[ 6 ] = {
+		-1,
+		-60,
+		-3600,
+		-86400,
+		-2678400,
+		-31536000 };
+
+	libcerror_error_t *error        = NULL;
+	int64_t number_of_seconds       = 0;
+	uint32_t number_of_nano_seconds = 0;
+	int result                      = 0;
+	int unit_index                  = 0;
+
+	/* Test regular cases
+	 */
+	for( unit_index = 0;
+	     unit_index < 6;
+	     unit_index++ )
+	{
+		number_of_seconds      = -1;
+		number_of_nano_seconds = 500000000;
+
+		result = libfdatetime_internal_truncate_number_of_seconds(
+		          &number_of_seconds,
+		          &number_of_nano_seconds,
+		          units[ unit_index ],
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "number_of_seconds",
+		 number_of_seconds,
+		 expected_number_of_seconds[ unit_index ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "number_of_nano_seconds",
+		 number_of_nano_seconds,
+		 (uint32_t) 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfdatetime_internal_truncate_number_of_seconds(
+	          NULL,
+	          &number_of_nano_seconds,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_truncate_number_of_seconds(
+	          &number_of_seconds,
+	          NULL,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_internal_truncate_number_of_seconds(
+	          &number_of_seconds,
+	          &number_of_nano_seconds,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	number_of_seconds = -( (int64_t) 0x7fffffffffffffffULL );
+
+	result = libfdatetime_internal_truncate_number_of_seconds(
+	          &number_of_seconds,
+	          &number_of_nano_seconds,
+	          LIBFDATETIME_TRUNCATE_UNIT_YEAR,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+/* Tests the libfdatetime_sort_keys_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fdatetime_test_sort_keys_truncate(
+     void )
+{
+	int units[ 4 ] = {
+		LIBFDATETIME_TRUNCATE_UNIT_SECOND,
+		LIBFDATETIME_TRUNCATE_UNIT_DAY,
+		LIBFDATETIME_TRUNCATE_UNIT_MONTH,
+		LIBFDATETIME_TRUNCATE_UNIT_YEAR };
+
+	/* February 29, 2024 13:45:12.3456789, July 4, 1500 12:00:00.0000005
+	 * and the minimum, maximum and invalid sort keys
+	 */
+	int64_t sort_keys[ 5 ] = {
+		133536879123456789,
+		-31713551999999995,
+		LIBFDATETIME_SORT_KEY_MINIMUM,
+		LIBFDATETIME_SORT_KEY_MAXIMUM,
+		LIBFDATETIME_SORT_KEY_INVALID };
+
+	int64_t expected_sort_keys[ 4 ][ 2 ] = {
+		{ 133536879120000000, -31713552000000000 },
+		{ 133536384000000000, -31713984000000000 },
+		{ 133512192000000000, -31716576000000000 },
+		{ 133485408000000000, -31872960000000000 } };
+
+	int64_t truncated_sort_keys[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int unit_index           = 0;
+
+	/* Test regular cases
+	 */
+	for( unit_index = 0;
+	     unit_index < 4;
+	     unit_index++ )
+	{
+		result = libfdatetime_sort_keys_truncate(
+		          sort_keys,
+		          5,
+		          units[ unit_index ],
+		          truncated_sort_keys,
+		          &error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_sort_keys[ 0 ]",
+		 truncated_sort_keys[ 0 ],
+		 expected_sort_keys[ unit_index ][ 0 ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_sort_keys[ 1 ]",
+		 truncated_sort_keys[ 1 ],
+		 expected_sort_keys[ unit_index ][ 1 ] );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_sort_keys[ 2 ]",
+		 truncated_sort_keys[ 2 ],
+		 LIBFDATETIME_SORT_KEY_MINIMUM );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_sort_keys[ 3 ]",
+		 truncated_sort_keys[ 3 ],
+		 LIBFDATETIME_SORT_KEY_MAXIMUM );
+
+		FDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "truncated_sort_keys[ 4 ]",
+		 truncated_sort_keys[ 4 ],
+		 LIBFDATETIME_SORT_KEY_INVALID );
+	}
+	/* Test truncating in place
+	 */
+	result = libfdatetime_sort_keys_truncate(
+	          sort_keys,
+	          5,
+	          LIBFDATETIME_TRUNCATE_UNIT_YEAR,
+	          sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "sort_keys[ 0 ]",
+	 sort_keys[ 0 ],
+	 (int64_t) 133485408000000000 );
+
+	/* Test error cases
+	 */
+	result = libfdatetime_sort_keys_truncate(
+	          NULL,
+	          5,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys_truncate(
+	          sort_keys,
+	          (size_t) SSIZE_MAX,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          truncated_sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys_truncate(
+	          sort_keys,
+	          5,
+	          LIBFDATETIME_TRUNCATE_UNIT_DAY,
+	          NULL,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfdatetime_sort_keys_truncate(
+	          sort_keys,
+	          5,
+	          LIBFDATETIME_TRUNCATE_UNIT_UNDEFINED,
+	          truncated_sort_keys,
+	          &error );
+
+	FDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	FDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT )
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_truncate_get_unit_number_of_seconds",
+	 fdatetime_test_internal_truncate_get_unit_number_of_seconds );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_truncate_number_of_days",
+	 fdatetime_test_internal_truncate_number_of_days );
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_internal_truncate_number_of_seconds",
+	 fdatetime_test_internal_truncate_number_of_seconds );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFDATETIME_DLL_IMPORT ) */
+
+	FDATETIME_TEST_RUN(
+	 "libfdatetime_sort_keys_truncate",
+	 fdatetime_test_sort_keys_truncate );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "date_time_values error fat_date_time filetime floatingtime hfs_time nsf_timedate posix_time support systemtime"
+$LibraryTests = "allocations batch calendar corpus date_time_values differential duration error fat_date_time filetime floatingtime hfs_time histogram nsf_timedate parse posix_time scan sort stats support systemtime threads truncate"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 